@@ -23,6 +23,7 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include "include_graph.hpp"
 #include "include_inliner.hpp"
 #include "miopen/filesystem.hpp"
 #include <algorithm>
@@ -110,6 +111,9 @@ void PrintHelp()
     std::cout << "           -m[ark-includes] : mark variables that represent include files with "
                  "'_INCLUDE'. Default: off"
               << std::endl;
+    std::cout << "           -i[nclude-graph] : write the embedded headers each HIP source depends "
+                 "on instead of the sources. Default: off"
+              << std::endl;
 }
 
 [[noreturn]] void WrongUsage(std::string_view error)
@@ -224,6 +228,7 @@ int main(int argc, char* argv[])
     bool recurse       = true;
     bool as_extern     = false;
     bool mark_includes = false;
+    bool include_graph = false;
 
     // Parse command line options to establish configuration
 
@@ -270,6 +275,10 @@ int main(int argc, char* argv[])
         {
             as_extern = true;
         }
+        else if(arg == "-i" || arg == "-include-graph")
+        {
+            include_graph = true;
+        }
         else
         {
             UnknownArgument(arg);
@@ -287,15 +296,32 @@ int main(int argc, char* argv[])
         ss << "#ifndef " << guard << "\n#define " << guard << "\n";
     }
 
-    ss << "#ifndef MIOPEN_USE_CLANG_TIDY\n"
-          "#include <cstddef>\n";
-
-    for(const auto& file : sourceFiles)
+    if(include_graph)
     {
-        Process(file, ss, bufferSize, lineSize, recurse, as_extern, mark_includes);
+        IncludeGraph graph;
+        for(const auto& file : sourceFiles)
+        {
+            if(!fs::exists(file))
+            {
+                std::cerr << "File not found: " << file << std::endl;
+                return 1;
+            }
+            graph.Add(file);
+        }
+        graph.Write(ss);
     }
+    else
+    {
+        ss << "#ifndef MIOPEN_USE_CLANG_TIDY\n"
+              "#include <cstddef>\n";
 
-    ss << "#endif\n";
+        for(const auto& file : sourceFiles)
+        {
+            Process(file, ss, bufferSize, lineSize, recurse, as_extern, mark_includes);
+        }
+
+        ss << "#endif\n";
+    }
 
     if(guard.length() > 0)
     {
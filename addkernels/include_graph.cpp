@@ -0,0 +1,167 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include_graph.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <sstream>
+
+namespace {
+
+constexpr std::uint64_t fnv_offset_basis = 0xcbf29ce484222325ULL;
+constexpr std::uint64_t fnv_prime        = 0x100000001b3ULL;
+
+void HashCombine(std::uint64_t& hash, const std::string& data)
+{
+    for(const auto c : data)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= fnv_prime;
+    }
+    // Separates the concatenated strings.
+    hash ^= 0xff;
+    hash *= fnv_prime;
+}
+
+bool IsSpace(char c) { return c == ' ' || c == '\t'; }
+
+} // namespace
+
+void IncludeGraph::Add(const fs::path& path)
+{
+    std::ifstream file{path, std::ios::in | std::ios::binary};
+    if(!file.is_open())
+    {
+        std::cerr << "Error opening file: " << path << std::endl;
+        // NOLINTNEXTLINE (concurrency-mt-unsafe)
+        std::exit(1);
+    }
+
+    std::ostringstream ss;
+    ss << file.rdbuf();
+
+    auto& node    = nodes[path.filename().string()];
+    node.text     = ss.str();
+    node.includes = ParseIncludes(node.text);
+}
+
+std::vector<std::string> IncludeGraph::ParseIncludes(const std::string& text)
+{
+    std::vector<std::string> includes;
+    std::istringstream input{text};
+    std::string line;
+
+    while(std::getline(input, line))
+    {
+        auto pos               = std::size_t{0};
+        const auto skip_spaces = [&]() {
+            while(pos < line.size() && IsSpace(line[pos]))
+                ++pos;
+        };
+
+        skip_spaces();
+        if(pos == line.size() || line[pos] != '#')
+            continue;
+        ++pos;
+        skip_spaces();
+
+        const std::string directive = "include";
+        if(line.compare(pos, directive.size(), directive) != 0)
+            continue;
+        pos += directive.size();
+        skip_spaces();
+
+        if(pos == line.size() || (line[pos] != '"' && line[pos] != '<'))
+            continue;
+        const auto close = line.find(line[pos] == '"' ? '"' : '>', pos + 1);
+        if(close == std::string::npos)
+            continue;
+
+        // The embedded headers are flat, hiprtc finds them by the name as written.
+        includes.push_back(fs::path{line.substr(pos + 1, close - pos - 1)}.filename().string());
+    }
+
+    return includes;
+}
+
+std::vector<std::string> IncludeGraph::GetDependencies(const std::string& name) const
+{
+    std::set<std::string> visited;
+    std::vector<std::string> stack{name};
+
+    while(!stack.empty())
+    {
+        const auto current = stack.back();
+        stack.pop_back();
+
+        const auto node = nodes.find(current);
+        if(node == nodes.end())
+            continue;
+
+        for(const auto& include : node->second.includes)
+        {
+            if(include != name && nodes.count(include) != 0 && visited.insert(include).second)
+                stack.push_back(include);
+        }
+    }
+
+    return {visited.begin(), visited.end()};
+}
+
+std::uint64_t IncludeGraph::GetHash(const std::string& name) const
+{
+    auto hash = fnv_offset_basis;
+    HashCombine(hash, nodes.at(name).text);
+    for(const auto& dependency : GetDependencies(name))
+    {
+        HashCombine(hash, dependency);
+        HashCombine(hash, nodes.at(dependency).text);
+    }
+    return hash;
+}
+
+void IncludeGraph::Write(std::ostream& target) const
+{
+    for(const auto& node : nodes)
+    {
+        if(fs::path{node.first}.extension() != ".cpp")
+            continue;
+
+        target << "{\"" << node.first << "\", {0x" << std::hex << std::setw(16)
+               << std::setfill('0') << GetHash(node.first) << std::dec << "ULL, {";
+
+        auto first = true;
+        for(const auto& dependency : GetDependencies(node.first))
+        {
+            target << (first ? "" : ", ") << '"' << dependency << '"';
+            first = false;
+        }
+
+        target << "}}}," << std::endl;
+    }
+}
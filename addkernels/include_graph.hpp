@@ -0,0 +1,68 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_GRAPH_HPP
+#define INCLUDE_GRAPH_HPP
+
+#include <miopen/filesystem.hpp>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace fs = miopen::fs;
+
+/// Include dependencies between the embedded kernel sources and headers.
+///
+/// Includes are matched by the file name against the added files, all the other includes
+/// (e.g. HIP runtime headers) are ignored. Preprocessor conditions are not evaluated, so
+/// the dependencies are a superset of the headers the compiler actually opens.
+class IncludeGraph
+{
+public:
+    void Add(const fs::path& path);
+
+    /// Names of the files included by the file directly or transitively, sorted.
+    std::vector<std::string> GetDependencies(const std::string& name) const;
+    /// FNV-1a hash of the file text and the names and texts of its dependencies.
+    std::uint64_t GetHash(const std::string& name) const;
+
+    /// Writes the initializer list entries of the dependencies of the HIP sources.
+    void Write(std::ostream& target) const;
+
+    static std::vector<std::string> ParseIncludes(const std::string& text);
+
+private:
+    struct Node
+    {
+        std::string text;
+        std::vector<std::string> includes;
+    };
+
+    std::map<std::string, Node> nodes;
+};
+
+#endif // INCLUDE_GRAPH_HPP
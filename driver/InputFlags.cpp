@@ -200,6 +200,33 @@ void InputFlags::Parse(int argc, char* argv[])
     }
 }
 
+bool InputFlags::CanParse(int argc, char* argv[]) const
+{
+    for(int i = 2; i < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if(arg.size() < 2 || arg[0] != '-' || arg == "-?" || arg == "-h" || arg == "--help")
+            return false;
+        if(i + 1 >= argc)
+            return false;
+
+        if(arg[1] == '-')
+        {
+            const auto long_name = arg.substr(2);
+            const auto same_name = [&](const auto& input) {
+                return input.second.long_name == long_name;
+            };
+            if(std::none_of(MapInputs.begin(), MapInputs.end(), same_name))
+                return false;
+        }
+        else if(MapInputs.count(arg[1]) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 // This function updates the input flag parameters values.Depending on the flag setting,
 // input values are converted to uppercase & stored into map.This is used while
 // parsing the driver arguments.
@@ -101,6 +101,9 @@ public:
                        const std::string& default_desc = "");
 
     void Parse(int argc, char* argv[]);
+    /// Returns false if Parse() would exit on the arguments: unknown flags, flags without
+    /// values and help requests.
+    bool CanParse(int argc, char* argv[]) const;
     char FindShortName(const std::string& _long_name) const;
     [[noreturn]] void Print() const;
 
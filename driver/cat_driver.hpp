@@ -39,6 +39,7 @@
 #include <miopen/tensor.hpp>
 #include <numeric>
 #include <vector>
+#include <../test/cpu_cat.hpp>
 #include <../test/tensor_holder.hpp>
 #include <../test/verify.hpp>
 
@@ -52,40 +53,16 @@ int32_t mloCatForwardRunHost(std::vector<miopenTensorDescriptor_t> inputDescs,
                              Tcheck* outputhost,
                              uint32_t dim)
 {
-    auto shape             = miopen::deref(outputDesc).GetLengths();
-    size_t outer_size      = 1;
-    size_t inner_size      = 1;
-    size_t output_dim_size = shape[dim];
-    for(size_t i = 0; i < dim; i++)
-    {
-        outer_size *= shape[i];
-    }
-
-    for(size_t i = dim + 1; i < shape.size(); i++)
-    {
-        inner_size *= shape[i];
-    }
-
-    int32_t ret                = 0;
-    size_t output_start_offset = 0;
-
+    auto descs = std::vector<const miopen::TensorDescriptor*>{};
+    auto data  = std::vector<const Tgpu*>{};
     for(size_t i = 0; i < inputs.size(); i++)
     {
-        auto input       = inputs[i];
-        size_t dim_size  = miopen::deref(inputDescs[i]).GetLengths()[dim];
-        size_t copy_size = inner_size * dim_size;
-        for(size_t o = 0; o < outer_size; o++)
-        {
-            size_t output_offset = output_start_offset + (o * inner_size * output_dim_size);
-            for(size_t j = 0; j < copy_size; j++)
-            {
-                outputhost[output_offset + j] = input[copy_size * o + j];
-            }
-        }
-        output_start_offset += copy_size;
+        descs.push_back(&miopen::deref(inputDescs[i]));
+        data.push_back(inputs[i]);
     }
+    cpu_cat_forward(descs, data, miopen::deref(outputDesc), outputhost, dim);
 
-    return ret;
+    return 0;
 }
 
 #endif
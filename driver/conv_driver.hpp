@@ -324,6 +324,7 @@ public:
 
     int VerifyBackward() override;
     int VerifyForward() override;
+    std::vector<std::pair<std::string, miopenProblem_t>> MakeProblems() override;
     ~ConvDriver() override
     {
         miopenDestroyTensorDescriptor(biasTensor);
@@ -865,6 +866,28 @@ int ConvDriver<Tgpu, Tref>::GetandSetData()
     return (0);
 }
 
+template <typename Tgpu, typename Tref>
+std::vector<std::pair<std::string, miopenProblem_t>> ConvDriver<Tgpu, Tref>::MakeProblems()
+{
+    auto problems  = std::vector<std::pair<std::string, miopenProblem_t>>{};
+    const auto add = [&](const std::string& name, miopenProblemDirection_t direction) {
+        miopenProblem_t problem;
+        miopenCreateConvProblem(&problem, convDesc, direction);
+        miopenSetProblemTensorDescriptor(problem, miopenTensorConvolutionX, inputTensor);
+        miopenSetProblemTensorDescriptor(problem, miopenTensorConvolutionW, weightTensor);
+        miopenSetProblemTensorDescriptor(problem, miopenTensorConvolutionY, outputTensor);
+        problems.emplace_back(name, problem);
+    };
+
+    if(is_fwd)
+        add("fwd", miopenProblemDirectionForward);
+    if(is_bwd)
+        add("bwd", miopenProblemDirectionBackward);
+    if(is_wrw)
+        add("wrw", miopenProblemDirectionBackwardWeights);
+    return problems;
+}
+
 template <typename Tgpu, typename Tref>
 int ConvDriver<Tgpu, Tref>::AddCmdLineArgs()
 {
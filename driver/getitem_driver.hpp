@@ -40,6 +40,7 @@
 #include <miopen/tensor_view_utils.hpp>
 #include <numeric>
 #include <vector>
+#include <../test/cpu_getitem.hpp>
 #include <../test/tensor_holder.hpp>
 #include <../test/verify.hpp>
 
@@ -59,89 +60,23 @@ int32_t mloGetitemBackwardRunHost(miopenTensorDescriptor_t dyDesc,
                                   int32_t* slices,
                                   uint32_t offset)
 {
-    auto dy_dims  = miopen::deref(dyDesc).GetLengths();
-    auto dy_numel = std::accumulate(dy_dims.begin(), dy_dims.end(), 1L, std::multiplies<int64_t>());
-    auto dx_dims  = miopen::deref(dxDesc).GetLengths();
-    auto index_dims = miopen::deref(indexDescs[0]).GetLengths();
-    auto index_numel =
-        std::accumulate(index_dims.begin(), index_dims.end(), 1L, std::multiplies<int64_t>());
-    auto element_index = std::vector<int32_t>(indexCount * index_numel + indexCount);
-
-    std::vector<size_t> output_dims;
-    for(int32_t i = 0; i < dimCount; i++)
-    {
-        output_dims.push_back(dx_dims[dims[i]]);
-    }
-
-    auto dim_info_offset = indexCount > 0 ? indexCount * index_dims[0] : 0;
-    auto start_dim       = dims[0];
-
-    auto dy_tv     = miopen::get_inner_expanded_tv<5>(miopen::deref(dyDesc));
-    auto dxhost_tv = miopen::get_inner_expanded_tv<5>(miopen::deref(dxDesc));
-    miopen::slice_tv<5>(dxhost_tv, sliceCount, slices);
-
-    int32_t ret = 0;
+    std::ignore = errorDesc;
+    std::ignore = dimCount;
+    std::ignore = offset;
+
+    cpu_getitem_backward(dy,
+                         miopen::get_inner_expanded_tv<5>(miopen::deref(dyDesc)),
+                         indexCount,
+                         indexs,
+                         indexCount > 0 ? miopen::deref(indexDescs[0]).GetElementSize() : 0,
+                         dxhost,
+                         miopen::get_inner_expanded_tv<5>(miopen::deref(dxDesc)),
+                         errorhost,
+                         dims,
+                         sliceCount,
+                         slices);
 
-    // Get element index form indexs
-    for(size_t j = 0; j < indexCount; j++)
-    {
-        const auto& index_dim = dims[j];
-        const auto& dim_size  = output_dims[j];
-
-        for(size_t o = 0; o < index_numel; o++)
-        {
-            int32_t getitem_index = indexs[j][o];
-
-            if(getitem_index >= 0 && getitem_index < dim_size)
-            {
-                element_index[(o * indexCount) + j] = getitem_index;
-            }
-            else if(getitem_index >= -dim_size && getitem_index < 0)
-            {
-                element_index[(o * indexCount) + j] = getitem_index + dim_size;
-            }
-            else
-            {
-                errorhost[j] = -1;
-            }
-
-            if(o == 0)
-            {
-                element_index[dim_info_offset + j] = index_dim;
-            }
-        }
-    }
-
-    // GetItem
-    for(size_t o = 0; o < dy_numel; o++)
-    {
-        tensor_layout_t<5> ncdhw(dy_tv, o);
-        tensor_layout_t<5> idx(ncdhw);
-
-        if(indexCount > 0)
-        {
-            size_t dim_cursor = ncdhw.layout[start_dim];
-            size_t i          = start_dim;
-            size_t j          = 0;
-
-            for(; i < start_dim + indexCount; ++i, ++j)
-            {
-                size_t dim_idx      = element_index[dim_info_offset + j];
-                idx.layout[dim_idx] = element_index[(dim_cursor * indexCount) + j];
-            }
-
-            i          = element_index[dim_info_offset + indexCount - 1] + 1;
-            dim_cursor = start_dim + 1;
-            for(; i < 5; ++i, ++dim_cursor)
-            {
-                idx.layout[i] = ncdhw.layout[dim_cursor];
-            }
-        }
-
-        dxhost[dxhost_tv.get_tensor_view_idx(idx)] += dy[dy_tv.get_tensor_view_idx(ncdhw)];
-    }
-
-    return ret;
+    return 0;
 }
 
 template <typename Tgpu, typename Tref>
@@ -30,6 +30,7 @@
 #include "timer.hpp"
 #include "random.hpp"
 
+#include <../test/cpu_kthvalue.hpp>
 #include <../test/tensor_holder.hpp>
 #include <../test/verify.hpp>
 
@@ -49,44 +50,14 @@ void mloKthvalueFwdRunHost(TIO* input,
                            size_t k,
                            int dim)
 {
-    auto inputDesc         = miopen::deref(pInputDesc);
-    size_t inputSize       = inputDesc.GetElementSize();
-    size_t dimSize         = inputDesc.GetLengths()[dim];
-    size_t dimStride       = inputDesc.GetStrides()[dim];
-    auto inputTv           = miopen::get_inner_expanded_tv<5>(miopen::deref(pInputDesc));
-    auto inputTvWithoutDim = miopen::get_tv_without_dim<5>(inputTv, dim);
-    auto outputTv          = miopen::get_inner_expanded_tv<5>(miopen::deref(outputDesc));
-    auto indicesTv         = miopen::get_inner_expanded_tv<5>(miopen::deref(indicesDesc));
-
-    size_t numSlice = inputSize / dimSize;
-
-    std::vector<float> elements;
-    std::vector<size_t> ids(dimSize);
-    for(int i = 0; i < dimSize; ++i)
-    {
-        ids[i] = i;
-    }
-
-    for(int slideID = 0; slideID < numSlice; ++slideID)
-    {
-        elements.clear();
-        tensor_layout_t<4> layout(inputTvWithoutDim, slideID);
-        auto idx = inputTvWithoutDim.get_tensor_view_idx(layout);
-
-        for(int j = 0; j < dimSize; ++j)
-        {
-            elements.push_back(static_cast<float>(input[idx + j * dimStride]));
-        }
-
-        std::sort(ids.begin(), ids.end(), [=](size_t x, size_t y) -> bool {
-            return elements[x] < elements[y];
-        });
-        auto output_layout  = tensor_layout_t<5>(outputTv, slideID);
-        auto indices_layout = tensor_layout_t<5>(indicesTv, slideID);
-        outputHost[outputTv.get_tensor_view_idx(output_layout)] =
-            static_cast<TIO>(elements[ids[k - 1]]);
-        indices[indicesTv.get_tensor_view_idx(indices_layout)] = ids[k - 1];
-    }
+    cpu_kthvalue(input,
+                 miopen::deref(pInputDesc),
+                 outputHost,
+                 miopen::deref(outputDesc),
+                 indices,
+                 miopen::deref(indicesDesc),
+                 k,
+                 dim);
 }
 
 template <typename TIO>
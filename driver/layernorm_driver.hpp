@@ -26,6 +26,7 @@
 #ifndef GUARD_MIOPEN_LAYERNORM_DRIVER_HPP
 #define GUARD_MIOPEN_LAYERNORM_DRIVER_HPP
 
+#include <../test/cpu_norm.hpp>
 #include <../test/tensor_holder.hpp>
 #include <../test/verify.hpp>
 #include "InputFlags.hpp"
@@ -53,49 +54,19 @@ int32_t mloLayerNormForwardRunHost(miopenTensorDescriptor_t inputDesc,
                                    int32_t normalized_dim,
                                    miopenNormMode_t mode)
 {
-    auto dims         = miopen::deref(inputDesc).GetLengths();
-    size_t outer_size = 1;
-    size_t inner_size = 1;
-    size_t norm_dim   = static_cast<size_t>(normalized_dim);
-
-    for(size_t i = 0ULL; i < dims.size(); ++i)
-    {
-        if(i < norm_dim)
-            outer_size *= dims[i];
-        else
-            inner_size *= dims[i];
-    }
-
-    int32_t ret = 0;
-
-    for(int32_t o = 0; o < outer_size; o++)
-    {
-        Tcheck pmean = 0.0f;
-        Tcheck pvar  = 0.0f;
-        for(int32_t i = 0; i < inner_size; i++)
-        {
-            Tcheck tmp = static_cast<Tcheck>(input[o * inner_size + i]);
-            pmean += tmp;
-            pvar += tmp * tmp;
-        }
-
-        pmean        = pmean / inner_size;
-        pvar         = pvar / inner_size - pmean * pmean;
-        Tcheck prstd = 1.0f / sqrt(pvar + eps);
-
-        meanhost[o] = pmean;
-        rstdhost[o] = prstd;
-
-        for(int32_t i = 0; i < inner_size; i++)
-        {
-            Tcheck pweight =
-                (mode == MIOPEN_ELEMENTWISE_AFFINE) ? 1 : static_cast<Tcheck>(weight[i]);
-            Tcheck pbias = (mode == MIOPEN_ELEMENTWISE_AFFINE) ? 0 : static_cast<Tcheck>(bias[i]);
-            outputhost[o * inner_size + i] =
-                (static_cast<Tcheck>(input[o * inner_size + i]) - pmean) * prstd * pweight + pbias;
-        }
-    }
-    return ret;
+    const auto affine = mode != MIOPEN_ELEMENTWISE_AFFINE;
+    cpu_norm_forward(cpu_norm_layout::layer(miopen::deref(inputDesc).GetLengths(),
+                                            static_cast<size_t>(normalized_dim)),
+                     cpu_norm_kind::standard,
+                     input,
+                     static_cast<const Tgpu*>(nullptr),
+                     affine ? weight : nullptr,
+                     affine ? bias : nullptr,
+                     eps,
+                     outputhost,
+                     meanhost,
+                     rstdhost);
+    return 0;
 }
 
 template <typename Tgpu, typename Tref>
@@ -26,6 +26,7 @@
 #ifndef MLO_GROUPNORMHOST_H_
 #define MLO_GROUPNORMHOST_H_
 
+#include <../test/cpu_norm.hpp>
 #include <miopen/tensor.hpp>
 
 ////////////////////////////////////////////////////////////
@@ -44,44 +45,16 @@ int32_t mloGroupNormForwardRunHost(miopenTensorDescriptor_t inputDesc,
                                    float eps,
                                    miopenNormMode_t mode)
 {
-    auto dims = miopen::deref(inputDesc).GetLengths();
-
-    size_t numel             = miopen::deref(inputDesc).GetElementSize();
-    size_t numel_per_channel = numel / dims[0] / dims[1];
-    size_t num_channels      = dims[1];
-
-    size_t outer_size = dims[0] * num_groups;
-    size_t inner_size = numel / outer_size;
-
-    for(size_t o = 0; o < outer_size; o++)
-    {
-        Tcheck pmean = 0.0f;
-        Tcheck pvar  = 0.0f;
-        for(size_t i = 0; i < inner_size; i++)
-        {
-            Tcheck tmp = static_cast<Tcheck>(input[o * inner_size + i]);
-            pmean += tmp;
-            pvar += tmp * tmp;
-        }
-
-        pmean        = pmean / inner_size;
-        pvar         = pvar / inner_size - pmean * pmean;
-        Tcheck prstd = 1.0f / sqrt(pvar + eps);
-
-        meanhost[o] = pmean;
-        rstdhost[o] = prstd;
-
-        for(size_t i = 0; i < inner_size; i++)
-        {
-            size_t idx     = o * inner_size + i;
-            size_t c       = (idx / numel_per_channel) % num_channels;
-            Tcheck pweight = mode ? static_cast<Tcheck>(weight[c]) : 1;
-            Tcheck pbias   = mode ? static_cast<Tcheck>(bias[c]) : 0;
-
-            outputhost[idx] = (static_cast<Tcheck>(input[idx]) - pmean) * prstd * pweight + pbias;
-        }
-    }
-
+    cpu_norm_forward(cpu_norm_layout::group(miopen::deref(inputDesc).GetLengths(), num_groups),
+                     cpu_norm_kind::standard,
+                     input,
+                     static_cast<const Tgpu*>(nullptr),
+                     mode ? weight : nullptr,
+                     mode ? bias : nullptr,
+                     eps,
+                     outputhost,
+                     meanhost,
+                     rstdhost);
     return 0;
 }
 #endif
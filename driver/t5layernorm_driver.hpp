@@ -26,6 +26,7 @@
 #ifndef GUARD_MIOPEN_T5LAYERNORM_DRIVER_HPP
 #define GUARD_MIOPEN_T5LAYERNORM_DRIVER_HPP
 
+#include <../test/cpu_norm.hpp>
 #include <../test/tensor_holder.hpp>
 #include <../test/verify.hpp>
 #include "InputFlags.hpp"
@@ -50,41 +51,18 @@ int32_t mloT5LayerNormForwardRunHost(miopenTensorDescriptor_t xDesc,
                                      float eps,
                                      miopenNormMode_t mode)
 {
-    auto dims         = miopen::deref(xDesc).GetLengths();
-    size_t outer_size = 1;
-    size_t inner_size = dims[dims.size() - 1];
-
-    for(size_t i = 0ULL; i < dims.size() - 1; ++i)
-    {
-        outer_size *= dims[i];
-    }
-
-    int32_t ret = 0;
-
-    for(int32_t o = 0; o < outer_size; o++)
-    {
-        Tcheck pvar = static_cast<Tcheck>(0);
-        for(int32_t i = 0; i < inner_size; i++)
-        {
-            Tcheck tmp = static_cast<Tcheck>(x[o * inner_size + i]);
-            pvar += tmp * tmp;
-        }
-
-        pvar         = pvar / inner_size;
-        Tcheck prstd = static_cast<Tcheck>(1.0) / sqrt(pvar + eps);
-
-        rstdhost[o] = prstd;
-
-        for(int32_t i = 0; i < inner_size; i++)
-        {
-            Tcheck pweight = (mode == MIOPEN_ELEMENTWISE_AFFINE_T5)
-                                 ? static_cast<Tcheck>(1)
-                                 : static_cast<Tcheck>(weight[i]);
-            yhost[o * inner_size + i] =
-                (static_cast<Tcheck>(x[o * inner_size + i])) * prstd * pweight;
-        }
-    }
-    return ret;
+    const auto& dims = miopen::deref(xDesc).GetLengths();
+    cpu_norm_forward(cpu_norm_layout::layer(dims, dims.size() - 1),
+                     cpu_norm_kind::rms,
+                     x,
+                     static_cast<const Tgpu*>(nullptr),
+                     mode == MIOPEN_ELEMENTWISE_AFFINE_T5 ? nullptr : weight,
+                     static_cast<const Tgpu*>(nullptr),
+                     eps,
+                     yhost,
+                     static_cast<Tcheck*>(nullptr),
+                     rstdhost);
+    return 0;
 }
 
 template <typename Tgpu, typename Tcheck>
@@ -96,79 +74,44 @@ int32_t mloT5LayerNormBackwardRunHost(miopenTensorDescriptor_t dyDesc,
                                       Tcheck* dxhost,
                                       miopenNormMode_t mode)
 {
-    auto dims         = miopen::deref(dyDesc).GetLengths();
-    size_t outer_size = 1;
-    size_t inner_size = dims[dims.size() - 1];
-
-    for(size_t i = 0ULL; i < dims.size() - 1; ++i)
+    const auto& dims = miopen::deref(dyDesc).GetLengths();
+    if(dy == nullptr)
     {
-        outer_size *= dims[i];
+        std::fill_n(dxhost, miopen::deref(dyDesc).GetElementSize(), static_cast<Tcheck>(0));
+        return 0;
     }
 
-    int32_t ret = 0;
-
-    for(int32_t o = 0; o < outer_size; o++)
-    {
-        Tcheck sum = static_cast<Tcheck>(0);
-        for(int32_t i = 0; i < inner_size; i++)
-        {
-            Tcheck pweight = (mode == MIOPEN_ELEMENTWISE_AFFINE_T5)
-                                 ? static_cast<Tcheck>(1)
-                                 : static_cast<Tcheck>(weight[i]);
-            Tcheck pdy = dy ? static_cast<Tcheck>(dy[o * inner_size + i]) : static_cast<Tcheck>(0);
-            Tcheck px  = static_cast<Tcheck>(x[o * inner_size + i]);
-            sum += pdy * px * pweight;
-        }
-
-        Tcheck ds    = sum;
-        Tcheck s     = static_cast<Tcheck>(1) / inner_size;
-        Tcheck prstd = rstdhost[o];
-        Tcheck a     = ds * prstd * prstd * prstd * s;
-
-        for(int32_t i = 0; i < inner_size; i++)
-        {
-            Tcheck pweight = (mode == MIOPEN_ELEMENTWISE_AFFINE_T5)
-                                 ? static_cast<Tcheck>(1)
-                                 : static_cast<Tcheck>(weight[i]);
-            Tcheck pdy = dy ? static_cast<Tcheck>(dy[o * inner_size + i]) : static_cast<Tcheck>(0);
-
-            Tcheck val = prstd * pdy * pweight - a * static_cast<Tcheck>(x[o * inner_size + i]);
-            dxhost[o * inner_size + i] = static_cast<Tcheck>(val);
-        }
-    }
-    return ret;
+    cpu_norm_backward(cpu_norm_layout::layer(dims, dims.size() - 1),
+                      cpu_norm_kind::rms,
+                      dy,
+                      x,
+                      mode == MIOPEN_ELEMENTWISE_AFFINE_T5 ? nullptr : weight,
+                      static_cast<const Tcheck*>(nullptr),
+                      rstdhost,
+                      dxhost);
+    return 0;
 }
 
 template <typename Tgpu, typename Tcheck>
 int32_t mloT5LayerNormBackckwardweightRunHost(
     miopenTensorDescriptor_t dyDesc, Tgpu* dy, Tgpu* x, Tcheck* rstdhost, Tcheck* dwhost)
 {
-    auto dims         = miopen::deref(dyDesc).GetLengths();
-    size_t outer_size = 1;
-    size_t inner_size = dims[dims.size() - 1];
-
-    for(size_t i = 0ULL; i < dims.size() - 1; ++i)
+    const auto& dims = miopen::deref(dyDesc).GetLengths();
+    if(dy == nullptr)
     {
-        outer_size *= dims[i];
+        std::fill_n(dwhost, dims.back(), static_cast<Tcheck>(0));
+        return 0;
     }
 
-    int32_t ret = 0;
-
-    for(int32_t o = 0; o < inner_size; o++)
-    {
-        Tcheck sum = static_cast<Tcheck>(0);
-        for(uint64_t i = 0; i < outer_size; ++i)
-        {
-            Tcheck prstd = static_cast<Tcheck>(rstdhost[i]);
-            Tcheck pdy   = dy ? static_cast<Tcheck>(dy[i * inner_size + o]) : 0;
-            Tcheck px    = static_cast<Tcheck>(x[i * inner_size + o]);
-
-            sum += pdy * px * prstd;
-        }
-
-        dwhost[o] = sum;
-    }
-    return ret;
+    cpu_norm_backward_weight_bias(cpu_norm_layout::layer(dims, dims.size() - 1),
+                                  cpu_norm_kind::rms,
+                                  dy,
+                                  x,
+                                  static_cast<const Tcheck*>(nullptr),
+                                  rstdhost,
+                                  dwhost,
+                                  static_cast<Tcheck*>(nullptr));
+    return 0;
 }
 
 template <typename Tgpu, typename Tref>
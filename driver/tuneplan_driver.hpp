@@ -0,0 +1,305 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_TUNEPLAN_DRIVER_HPP
+#define GUARD_MIOPEN_TUNEPLAN_DRIVER_HPP
+
+#include "InputFlags.hpp"
+#include "driver.hpp"
+#include "registry_driver_maker.hpp"
+
+#include <miopen/miopen.h>
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// Tunes the problems of a network within the total time budget. The problems are read from
+/// a file with MIOpenDriver command lines (e.g. test/perf_models/* or the commands logged with
+/// MIOPEN_ENABLE_LOGGING_CMD), repeated lines count as multiple occurrences of the problem.
+/// The budget is distributed among the problems by miopenTuningPlanner.
+class TunePlanDriver : public Driver
+{
+public:
+    ~TunePlanDriver() override
+    {
+        for(auto& problem : problems)
+            miopenDestroyProblem(problem);
+        if(planner != nullptr)
+            miopenDestroyTuningPlanner(planner);
+    }
+
+    int AddCmdLineArgs() override
+    {
+        inflags.AddInputFlag("forw", 'F', "1", "Unused, tuning covers the commands as is", "int");
+        inflags.AddInputFlag(
+            "input", 'i', "", "File with MIOpenDriver command lines (Default='')", "string");
+        inflags.AddInputFlag(
+            "budget", 'b', "7200", "Total tuning time budget in seconds (Default=7200)", "int");
+        inflags.AddInputFlag(
+            "tune", 't', "1", "Tune (1) or only print the initial plan (0) (Default=1)", "int");
+        inflags.AddInputFlag("verify", 'V', "0", "Unused", "int");
+        return 0;
+    }
+
+    int ParseCmdLineArgs(int argc, char* argv[]) override
+    {
+        inflags.Parse(argc, argv);
+        if(inflags.GetValueStr("input").empty())
+        {
+            std::cout << "Input file is not specified" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    InputFlags& GetInputFlags() override { return inflags; }
+
+    int GetandSetData() override
+    {
+        const auto budget_ms = static_cast<size_t>(inflags.GetValueInt("budget")) * 1000;
+        if(miopenCreateTuningPlanner(&planner, budget_ms) != miopenStatusSuccess)
+            return 1;
+
+        std::ifstream file{inflags.GetValueStr("input")};
+        if(!file)
+        {
+            std::cout << "Unable to open " << inflags.GetValueStr("input") << std::endl;
+            return 1;
+        }
+
+        std::string line;
+        auto skipped = 0;
+        while(std::getline(file, line))
+        {
+            if(!AddCommand(line))
+                ++skipped;
+        }
+        if(skipped > 0)
+            std::cout << "Skipped " << skipped << " command(s)" << std::endl;
+        if(problems.empty())
+        {
+            std::cout << "No problems to tune" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    int AllocateBuffersAndCopy() override { return 0; }
+
+    int RunForwardGPU() override
+    {
+        if(inflags.GetValueInt("tune") == 0)
+        {
+            PrintPlan();
+            return 0;
+        }
+
+        miopenFindOptions_t options;
+        miopenCreateFindOptions(&options);
+        miopenSetFindOptionTuning(options, 1);
+
+        auto rc          = 0;
+        auto total_spent = std::chrono::milliseconds{0};
+        for(;;)
+        {
+            size_t index  = 0;
+            size_t budget = 0;
+            miopenTuningPlannerGetNext(planner, &index, &budget);
+            if(index == std::numeric_limits<size_t>::max())
+                break;
+
+            std::cout << "Tuning " << descriptions[index] << " for up to " << budget << " ms"
+                      << std::endl;
+            miopenSetFindOptionTuningTimeLimit(options, budget);
+
+            const auto start = std::chrono::steady_clock::now();
+            miopenSolution_t solution;
+            size_t found = 0;
+            const auto status =
+                miopenFindSolutions(GetHandle(), problems[index], options, &solution, &found, 1);
+            const auto spent = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start);
+            total_spent += spent;
+
+            auto time = -1.0f;
+            if(status == miopenStatusSuccess && found > 0)
+            {
+                miopenGetSolutionTime(solution, &time);
+                miopenDestroySolution(solution);
+            }
+            else
+            {
+                rc = 1;
+            }
+
+            std::cout << "Spent " << spent.count() << " ms, best time: " << time << " ms"
+                      << std::endl;
+            miopenTuningPlannerReport(planner, index, spent.count(), time);
+        }
+
+        miopenDestroyFindOptions(options);
+        std::cout << "Total tuning time: " << total_spent.count() << " ms" << std::endl;
+        return rc;
+    }
+
+    int VerifyForward() override { return 0; }
+    int RunBackwardGPU() override { return 0; }
+    int VerifyBackward() override { return 0; }
+
+private:
+    /// A driver parses all the commands of its kind, so that a handle is not created for each
+    /// command. The flags are reset to the defaults before each command.
+    struct CommandParser
+    {
+        std::unique_ptr<Driver> driver;
+        InputFlags defaults;
+    };
+
+    CommandParser* GetParser(const std::string& name)
+    {
+        const auto found = parsers.find(name);
+        if(found != parsers.end())
+            return &found->second;
+
+        std::unique_ptr<Driver> drv;
+        for(auto f : rdm::GetRegistry())
+        {
+            drv.reset(f(name));
+            if(drv != nullptr)
+                break;
+        }
+        if(drv == nullptr)
+            return nullptr;
+
+        drv->AddCmdLineArgs();
+        auto& parser    = parsers[name];
+        parser.defaults = drv->GetInputFlags();
+        parser.driver   = std::move(drv);
+        return &parser;
+    }
+
+    /// Adds the problems of the command. Returns false if the command is skipped.
+    bool AddCommand(const std::string& line)
+    {
+        std::istringstream ss{line};
+        auto args = std::vector<std::string>{std::istream_iterator<std::string>{ss},
+                                             std::istream_iterator<std::string>{}};
+
+        // Skips the executable name and the logging prefixes.
+        auto base = args.begin();
+        while(base != args.end() && base->rfind("conv", 0) != 0)
+            ++base;
+        if(base == args.end())
+            return true;
+        args.erase(args.begin(), base);
+        args.insert(args.begin(), "MIOpenDriver");
+
+        auto* const parser = GetParser(args[1]);
+        if(parser == nullptr)
+        {
+            std::cout << "Unsupported command: " << line << std::endl;
+            return false;
+        }
+
+        auto argv = std::vector<char*>{};
+        for(auto& arg : args)
+            argv.push_back(arg.data());
+        const auto argc = static_cast<int>(argv.size());
+
+        // Parsing exits the process on unknown flags.
+        if(!parser->defaults.CanParse(argc, argv.data()))
+        {
+            std::cout << "Unable to parse: " << line << std::endl;
+            return false;
+        }
+
+        auto& drv           = *parser->driver;
+        drv.GetInputFlags() = parser->defaults;
+        auto rc             = drv.ParseCmdLineArgs(argc, argv.data());
+        if(rc == 0)
+            rc = drv.GetandSetData();
+        if(rc != 0)
+        {
+            std::cout << "Unable to parse: " << line << std::endl;
+            return false;
+        }
+
+        auto command = std::string{};
+        for(auto i = std::size_t{1}; i < args.size(); ++i)
+            command += (i > 1 ? " " : "") + args[i];
+
+        auto added = true;
+        for(const auto& named : drv.MakeProblems())
+        {
+            size_t index = 0;
+            const auto status =
+                miopenTuningPlannerAddProblem(planner, GetHandle(), named.second, 1, &index);
+            if(status != miopenStatusSuccess || index < problems.size())
+                miopenDestroyProblem(named.second);
+            if(status != miopenStatusSuccess)
+            {
+                std::cout << "Unable to add the " << named.first << " problem of: " << line
+                          << std::endl;
+                added = false;
+                continue;
+            }
+
+            if(index == problems.size())
+            {
+                problems.push_back(named.second);
+                descriptions.push_back(command + " (" + named.first + ")");
+            }
+        }
+        return added;
+    }
+
+    void PrintPlan() const
+    {
+        for(auto i = std::size_t{0}; i < problems.size(); ++i)
+        {
+            size_t budget = 0;
+            miopenTuningPlannerGetBudget(planner, i, &budget);
+            std::cout << std::setw(10) << budget << " ms: " << descriptions[i] << std::endl;
+        }
+    }
+
+    InputFlags inflags;
+    miopenTuningPlanner_t planner = nullptr;
+    std::vector<miopenProblem_t> problems;
+    std::vector<std::string> descriptions;
+    std::map<std::string, CommandParser> parsers;
+};
+
+#endif // GUARD_MIOPEN_TUNEPLAN_DRIVER_HPP
@@ -266,6 +266,36 @@ MIOPEN_EXPORT miopenStatus_t miopenGetKernelTime(miopenHandle_t handle, float* t
  * @return           miopenStatus_t
  */
 MIOPEN_EXPORT miopenStatus_t miopenEnableProfiling(miopenHandle_t handle, bool enable);
+
+#ifdef MIOPEN_BETA_API
+/*! @brief Initializes the handle state which is otherwise created on first use
+ *
+ * Device properties, rocBLAS and hipBLASLt handles, system databases and the kernel cache
+ * are created when an operation needs them. Latency-sensitive applications may call this
+ * function after creating the handle to keep the cost out of their first operation.
+ * @param handle     MIOpen handle (input)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenWarmUpHandle(miopenHandle_t handle);
+
+/*! @brief Returns the tensor statistics collected with MIOPEN_CHECK_NUMERICS=0x20
+ *
+ * The report has a line per checked tensor: counts of the values, NaNs, infinities and zeros,
+ * min, max, mean, mean of magnitudes, the largest magnitude and the histogram of log2 of
+ * magnitudes, accumulated over the sampled checks since the start or the last reset.
+ * @param report     Buffer for the null-terminated report, or nullptr to query the size (output)
+ * @param size       Size of the buffer, set to the size of the report including the
+ *                   terminator (input/output)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetNumericsStatsReport(char* report, size_t* size);
+
+/*! @brief Discards the tensor statistics collected with MIOPEN_CHECK_NUMERICS=0x20
+ *
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenResetNumericsStats();
+#endif
 /** @} */
 // CLOSEOUT HANDLE DOXYGEN GROUP
 
@@ -6076,6 +6106,104 @@ MIOPEN_EXPORT miopenStatus_t miopenCreateSoftmaxProblem(miopenProblem_t* problem
                                                         miopenSoftmaxDescriptor_t operatorDesc,
                                                         miopenProblemDirection_t direction);
 
+/*! @brief Limits the total time of the tuning searches run by the find call. Applies only
+ * when tuning is enabled by miopenSetFindOptionTuning. MIOPEN_TUNING_TIME_MS_MAX still limits
+ * each of the searches. Not limited by default.
+ *
+ * @param options      Options object to update
+ * @param milliseconds Time limit in milliseconds
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenSetFindOptionTuningTimeLimit(miopenFindOptions_t options,
+                                                                size_t milliseconds);
+
+/*! @brief The miopenTuningPlanner distributes a total tuning time budget among the problems of a
+ * network. The problems are weighted by the expected gain of tuning: the number of occurrences
+ * times the time of a single call times the expected relative improvement. The time is taken
+ * from the find-db when available, otherwise it is estimated from the amount of work of the
+ * problem. The budget is redistributed each time a problem is reported as tuned.
+ * @example
+ * miopenTuningPlannerAddProblem(planner, handle, problem, count, &index); // For each problem
+ * miopenTuningPlannerGetNext(planner, &index, &budget);
+ * while(index != SIZE_MAX)
+ * {
+ *     miopenSetFindOptionTuningTimeLimit(options, budget);
+ *     // Run miopenFindSolutions for the problem with tuning enabled
+ *     miopenTuningPlannerReport(planner, index, spent, time);
+ *     miopenTuningPlannerGetNext(planner, &index, &budget);
+ * }
+ */
+MIOPEN_DECLARE_OBJECT(miopenTuningPlanner);
+
+/*! @brief Initializes miopenTuningPlanner object.
+ *
+ * @param planner  Pointer to the planner object to initialize
+ * @param budgetMs Total tuning time budget in milliseconds
+ * @return         miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenCreateTuningPlanner(miopenTuningPlanner_t* planner,
+                                                       size_t budgetMs);
+
+/*! @brief Destroys miopenTuningPlanner object.
+ *
+ * @param planner Planner object to destroy
+ * @return        miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenDestroyTuningPlanner(miopenTuningPlanner_t planner);
+
+/*! @brief Adds a problem to the planner. Adding the same problem again increases its occurrence
+ * count. Only convolution problems are supported.
+ *
+ * @param planner Planner object to update
+ * @param handle  Handle of the device the problem is to be tuned on
+ * @param problem Problem to add
+ * @param count   Number of the problem occurrences in the network
+ * @param index   Pointer to a location where to write the index of the problem
+ * @return        miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenTuningPlannerAddProblem(miopenTuningPlanner_t planner,
+                                                           miopenHandle_t handle,
+                                                           miopenProblem_t problem,
+                                                           size_t count,
+                                                           size_t* index);
+
+/*! @brief Gets the problem to tune next along with its time budget.
+ *
+ * @param planner  Planner object
+ * @param index    Pointer to a location where to write the index of the problem. SIZE_MAX is
+ * written when no problem is worth tuning within the remaining budget
+ * @param budgetMs Pointer to a location where to write the budget in milliseconds
+ * @return         miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenTuningPlannerGetNext(miopenTuningPlanner_t planner,
+                                                        size_t* index,
+                                                        size_t* budgetMs);
+
+/*! @brief Gets the current budget of a problem. The budget is zero for the problems that are
+ * already tuned or not worth tuning within the remaining budget.
+ *
+ * @param planner  Planner object
+ * @param index    Index of the problem
+ * @param budgetMs Pointer to a location where to write the budget in milliseconds
+ * @return         miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenTuningPlannerGetBudget(miopenTuningPlanner_t planner,
+                                                          size_t index,
+                                                          size_t* budgetMs);
+
+/*! @brief Reports a problem as tuned and replans the remaining budget.
+ *
+ * @param planner Planner object to update
+ * @param index   Index of the problem
+ * @param spentMs Time spent on tuning in milliseconds
+ * @param timeMs  Time of the best solution found in milliseconds, negative if unknown
+ * @return        miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenTuningPlannerReport(miopenTuningPlanner_t planner,
+                                                       size_t index,
+                                                       size_t spentMs,
+                                                       float timeMs);
+
 #endif
 
 /** @} */
@@ -7505,6 +7633,113 @@ miopenFusedAdamWithOutput(miopenHandle_t handle,
                           const miopenTensorDescriptor_t foundInfDesc,
                           const void* foundInf);
 
+/*! @brief Perform Fused Adam optimization for a list of tensors in place.
+ *
+ * This function is equivalent to calling miopenFusedAdam for every tensor of the list with the
+ * same hyperparameters, but the tensors are split into fixed size chunks and packed into a small
+ * number of kernel launches, so the host overhead does not grow with the number of tensors.
+ * All the tensors must be contiguous and share the parameter and the gradient data types. The step
+ * is passed by value; state step tensors are not supported, the caller increments the step.
+ *
+ * @see miopenFusedAdam
+ *
+ * @code
+ * // Execute Adam for all the parameters of a model
+ * miopenFusedAdamMultiTensor(handle,
+ *                            tensorCount,
+ *                            paramDescs,
+ *                            params,
+ *                            gradDescs,
+ *                            grads,
+ *                            expAvgDescs,
+ *                            expAvgs,
+ *                            expAvgSqDescs,
+ *                            expAvgSqs,
+ *                            NULL,     // Unused maxExpAvgSq Tensors because amsgrad is false
+ *                            NULL,
+ *                            NULL,     // Unused paramFloat16 Tensors because not amp
+ *                            NULL,
+ *                            step,
+ *                            lr,
+ *                            beta1,
+ *                            beta2,
+ *                            weight_decay,
+ *                            eps,
+ *                            false,    // amsgrad
+ *                            false,    // maximize
+ *                            false,    // adamw
+ *                            NULL,     // Unused gradScale Tensor because not amp
+ *                            NULL,
+ *                            NULL,     // Unused foundInf Tensor because not amp
+ *                            NULL);
+ * @endcode
+ *
+ * @param handle              MIOpen handle (input)
+ * @param tensorCount         Number of tensors in every array (input)
+ * @param paramDescs          Tensor descriptors of the parameter tensors (input)
+ * @param params              Parameter tensors (input/output)
+ * @param gradDescs           Tensor descriptors of the gradient tensors (input)
+ * @param grads               Gradient tensors (input)
+ * @param expAvgDescs         Tensor descriptors of the exponential moving average tensors (input)
+ * @param expAvgs             Exponential moving average tensors (input/output)
+ * @param expAvgSqDescs       Tensor descriptors of the exponential moving average squared tensors
+ *                            (input)
+ * @param expAvgSqs           Exponential moving average squared tensors (input/output)
+ * @param maxExpAvgSqDescs    Tensor descriptors of the maximum exponential moving average squared
+ *                            tensors. Used when amsgrad is true (input, optional)
+ * @param maxExpAvgSqs        Maximum exponential moving average squared tensors. Used when
+ *                            amsgrad is true (input/output, optional)
+ * @param paramFloat16Descs   Tensor descriptors of the float16 copies of the parameters (input,
+ *                            optional)
+ * @param paramsFloat16       Float16 copies of the updated parameters (output, optional)
+ * @param state_step          Step of the optimizer, starting from 1 (input)
+ * @param lr                  Learning rate (input)
+ * @param beta1               Coefficient used for computing the first moment running average of
+ *                            gradient (input)
+ * @param beta2               Coefficient used for computing the second moment running average of
+ *                            gradient (input)
+ * @param weight_decay        Weight decay (input)
+ * @param eps                 Term added to the denominator to improve numerical stability (input)
+ * @param amsgrad             Flag indicating whether to use the AMSGrad variant of Adam (input)
+ * @param maximize            Flag indicating whether to maximize the objective with respect to the
+ *                            parameters (input)
+ * @param adamw               If it is true, the operation becomes AdamW (input)
+ * @param gradScaleDesc       Tensor descriptor for the input grad scale tensor (input, optional)
+ * @param gradScale           Input grad scale tensor (input, optional)
+ * @param foundInfDesc        Tensor descriptor for the input found inf tensor (input, optional)
+ * @param foundInf            Tensor indicating presence of inf or nan in gradients. If true, skips
+ *                            operation. (input, optional)
+ * @return                    miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenFusedAdamMultiTensor(miopenHandle_t handle,
+                           const int32_t tensorCount,
+                           const miopenTensorDescriptor_t* paramDescs,
+                           void* const* params,
+                           const miopenTensorDescriptor_t* gradDescs,
+                           const void* const* grads,
+                           const miopenTensorDescriptor_t* expAvgDescs,
+                           void* const* expAvgs,
+                           const miopenTensorDescriptor_t* expAvgSqDescs,
+                           void* const* expAvgSqs,
+                           const miopenTensorDescriptor_t* maxExpAvgSqDescs,
+                           void* const* maxExpAvgSqs,
+                           const miopenTensorDescriptor_t* paramFloat16Descs,
+                           void* const* paramsFloat16,
+                           const unsigned int state_step,
+                           const float lr,
+                           const float beta1,
+                           const float beta2,
+                           const float weight_decay,
+                           const float eps,
+                           const bool amsgrad,
+                           const bool maximize,
+                           const bool adamw,
+                           const miopenTensorDescriptor_t gradScaleDesc,
+                           const void* gradScale,
+                           const miopenTensorDescriptor_t foundInfDesc,
+                           const void* foundInf);
+
 /** @} */
 // CLOSEOUT SGD DOXYGEN GROUP
 #endif // MIOPEN_BETA_API
@@ -7785,6 +8020,73 @@ miopenTransformersAdamWWithOutput(miopenHandle_t handle,
                                   const miopenTensorDescriptor_t foundInfDesc,
                                   const void* foundInf);
 
+/*! @brief Implements TransformersAdamW for a list of tensors in place.
+ *
+ * This function is equivalent to calling miopenTransformersAdamW for every tensor of the list
+ * with the same hyperparameters, but the tensors are packed into a small number of kernel
+ * launches. All the tensors must be contiguous and share the parameter and the gradient data
+ * types. State step tensors are not supported, the caller increments the step.
+ *
+ * @see miopenTransformersAdamW
+ * @see miopenFusedAdamMultiTensor
+ *
+ * @param handle              MIOpen handle (input)
+ * @param tensorCount         Number of tensors in every array (input)
+ * @param paramDescs          Tensor descriptors of the parameter tensors (input)
+ * @param params              Parameter tensors (input/output)
+ * @param gradDescs           Tensor descriptors of the gradient tensors (input)
+ * @param grads               Gradient tensors (input)
+ * @param expAvgDescs         Tensor descriptors of the exponential moving average tensors (input)
+ * @param expAvgs             Exponential moving average tensors (input/output)
+ * @param expAvgSqDescs       Tensor descriptors of the exponential moving average squared tensors
+ *                            (input)
+ * @param expAvgSqs           Exponential moving average squared tensors (input/output)
+ * @param paramFloat16Descs   Tensor descriptors of the float16 copies of the parameters (input,
+ *                            optional)
+ * @param paramsFloat16       Float16 copies of the updated parameters (output, optional)
+ * @param state_step          Step of the optimizer, starting from 1 (input)
+ * @param lr                  Learning rate (input)
+ * @param beta1               Coefficient used for computing the first moment running average of
+ *                            gradient (input)
+ * @param beta2               Coefficient used for computing the second moment running average of
+ *                            gradient (input)
+ * @param weight_decay        Weight decay (input)
+ * @param eps                 Term added to the denominator to improve numerical stability (input)
+ * @param step_size           Pre-calculated step_size, negative to compute it from lr (input)
+ * @param correct_bias        Whether or not to correct bias in Adam (input)
+ * @param gradScaleDesc       Tensor descriptor for the input grad scale tensor (input, optional)
+ * @param gradScale           Input grad scale tensor (input, optional)
+ * @param foundInfDesc        Tensor descriptor for the input found inf tensor (input, optional)
+ * @param foundInf            Tensor indicating presence of inf or nan in gradients. If true, skips
+ *                            operation. (input, optional)
+ * @return                    miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenTransformersAdamWMultiTensor(miopenHandle_t handle,
+                                   const int32_t tensorCount,
+                                   const miopenTensorDescriptor_t* paramDescs,
+                                   void* const* params,
+                                   const miopenTensorDescriptor_t* gradDescs,
+                                   const void* const* grads,
+                                   const miopenTensorDescriptor_t* expAvgDescs,
+                                   void* const* expAvgs,
+                                   const miopenTensorDescriptor_t* expAvgSqDescs,
+                                   void* const* expAvgSqs,
+                                   const miopenTensorDescriptor_t* paramFloat16Descs,
+                                   void* const* paramsFloat16,
+                                   const unsigned int state_step,
+                                   const float lr,
+                                   const float beta1,
+                                   const float beta2,
+                                   const float weight_decay,
+                                   const float eps,
+                                   const float step_size,
+                                   const bool correct_bias,
+                                   const miopenTensorDescriptor_t gradScaleDesc,
+                                   const void* gradScale,
+                                   const miopenTensorDescriptor_t foundInfDesc,
+                                   const void* foundInf);
+
 /** @} */
 // CLOSEOUT SGD DOXYGEN GROUP
 #endif // MIOPEN_BETA_API
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/adam/multi_tensor.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+/// Measures the host side cost of a multi-tensor optimizer step: planning of the work lists
+/// and packing of the kernel arguments. Does not require a GPU.
+///
+/// Usage: speedtest_adam_multi_tensor [tensor_count] [iterations]
+int main(int argc, char* argv[])
+{
+    const auto tensor_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096ULL;
+    const auto iterations   = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000ULL;
+
+    // Typical transformer layout: many small bias/norm tensors mixed with large weights.
+    auto numels = std::vector<std::size_t>(tensor_count);
+    for(std::size_t i = 0; i < numels.size(); ++i)
+        numels[i] = i % 4 == 0 ? 1024 * 1024 : 1024;
+
+    auto storage = std::vector<char>(1);
+    auto params  = std::vector<Data_t>(tensor_count, storage.data());
+    auto grads   = std::vector<ConstData_t>(tensor_count, storage.data());
+    auto avgs    = std::vector<Data_t>(tensor_count, storage.data());
+    auto avg_sqs = std::vector<Data_t>(tensor_count, storage.data());
+
+    auto buffers      = miopen::adam::MultiTensorBuffers{};
+    buffers.params    = params.data();
+    buffers.grads     = grads.data();
+    buffers.expAvgs   = avgs.data();
+    buffers.expAvgSqs = avg_sqs.data();
+
+    auto launch_count = std::size_t{0};
+    auto checksum     = std::size_t{0};
+
+    const auto start = Clock::now();
+    for(auto i = 0ULL; i < iterations; ++i)
+    {
+        const auto launches = miopen::adam::MakeMultiTensorLaunches(numels);
+        for(const auto& launch : launches)
+            checksum += miopen::adam::MakeMultiTensorList(launch, numels, buffers).numel[0];
+        launch_count = launches.size();
+    }
+    const auto time = Seconds(start);
+
+    std::cout << "Tensors: " << tensor_count << std::endl;
+    std::cout << "Kernel launches: " << tensor_count << " per tensor, " << launch_count
+              << " multi-tensor" << std::endl;
+    std::cout << "Host time per step: " << time * 1e6 / iterations << " us" << std::endl;
+
+    // Keep the results alive in release builds.
+    return checksum == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
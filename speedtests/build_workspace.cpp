@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/build_workspace.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/write_file.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Mimics the file operations done around the offline compiler for a single kernel.
+// The compiler itself is not run.
+void Build(const miopen::fs::path& dir, const std::string& src, bool write_includes)
+{
+    miopen::fs::create_directories(dir);
+    if(write_includes)
+        miopen::WriteKernelIncludes(dir);
+    miopen::WriteFile(src, dir / "kernel.cpp");
+    miopen::WriteFile(src, dir / "kernel.cpp.o");
+    miopen::fs::remove_all(dir);
+}
+
+} // namespace
+
+/// Measures the per-kernel file system overhead of an offline build excluding the compiler:
+/// the previous layout (headers written next to every source in the system temporary
+/// directory) against the build workspace (shared headers, tmpfs where available).
+///
+/// Usage: speedtest_build_workspace [iterations]
+int main(int argc, char* argv[])
+{
+    const auto iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100ULL;
+    const auto src        = std::string(64 * 1024, 'x');
+
+    std::cout << "Workspace: " << miopen::GetBuildWorkspace() << std::endl;
+
+    auto start = Clock::now();
+    miopen::GetKernelIncludeDir();
+    std::cout << "Shared headers: " << Seconds(start) * 1e3 << " ms once per process"
+              << std::endl;
+
+    const auto tmp = miopen::fs::temp_directory_path();
+    start          = Clock::now();
+    for(auto i = 0ULL; i < iterations; ++i)
+        Build(tmp / ("miopen-speedtest-" + std::to_string(i)), src, true);
+    const auto per_build_headers = Seconds(start);
+
+    start = Clock::now();
+    for(auto i = 0ULL; i < iterations; ++i)
+    {
+        const miopen::TmpDir dir{"speedtest"};
+        Build(dir.path, src, false);
+    }
+    const auto workspace = Seconds(start);
+
+    std::cout << "Headers per build in " << tmp << ": " << per_build_headers * 1e3 / iterations
+              << " ms" << std::endl;
+    std::cout << "Build workspace: " << workspace * 1e3 / iterations << " ms" << std::endl;
+
+    return EXIT_SUCCESS;
+}
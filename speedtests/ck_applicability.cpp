@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/miopen.h>
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+#define CHECK(expr)                                                        \
+    do                                                                     \
+    {                                                                      \
+        if((expr) != miopenStatusSuccess)                                  \
+        {                                                                  \
+            std::cerr << "Failed: " #expr << std::endl;                    \
+            std::exit(EXIT_FAILURE); /* NOLINT (concurrency-mt-unsafe) */ \
+        }                                                                  \
+    } while(false)
+
+struct GroupConvProblem
+{
+    int n, c, h, w, k, y, x, groups;
+};
+
+// Grouped NHWC convolutions served by the composable_kernel solvers.
+const auto problems = std::vector<GroupConvProblem>{
+    {16, 256, 56, 56, 256, 3, 3, 32},
+    {16, 512, 28, 28, 512, 3, 3, 32},
+    {16, 1024, 14, 14, 1024, 3, 3, 32},
+    {32, 128, 56, 56, 128, 3, 3, 8},
+    {32, 64, 112, 112, 64, 3, 3, 64},
+    {8, 960, 7, 7, 960, 5, 5, 960},
+};
+
+/// Runs immediate mode Find (no benchmarking) for all the problems, which evaluates
+/// applicability of every solver, and returns the number of solutions found.
+std::size_t Query(miopenHandle_t handle,
+                  miopenTensorDescriptor_t x_desc,
+                  miopenTensorDescriptor_t w_desc,
+                  miopenTensorDescriptor_t y_desc,
+                  miopenConvolutionDescriptor_t conv_desc)
+{
+    auto total = std::size_t{0};
+    for(const auto& p : problems)
+    {
+        const auto x_lens = std::array<int, 4>{p.n, p.c, p.h, p.w};
+        const auto w_lens = std::array<int, 4>{p.k, p.c / p.groups, p.y, p.x};
+        const auto y_lens = std::array<int, 4>{p.n, p.k, p.h, p.w};
+        CHECK(miopenSetNdTensorDescriptorWithLayout(
+            x_desc, miopenHalf, miopenTensorNHWC, x_lens.data(), 4));
+        CHECK(miopenSetNdTensorDescriptorWithLayout(
+            w_desc, miopenHalf, miopenTensorNHWC, w_lens.data(), 4));
+        CHECK(miopenSetNdTensorDescriptorWithLayout(
+            y_desc, miopenHalf, miopenTensorNHWC, y_lens.data(), 4));
+        CHECK(miopenInitConvolutionDescriptor(
+            conv_desc, miopenConvolution, p.y / 2, p.x / 2, 1, 1, 1, 1));
+        CHECK(miopenSetConvolutionGroupCount(conv_desc, p.groups));
+
+        auto count = std::size_t{0};
+        CHECK(miopenConvolutionForwardGetSolutionCount(
+            handle, w_desc, x_desc, conv_desc, y_desc, &count));
+        auto solutions = std::vector<miopenConvSolution_t>(count);
+        CHECK(miopenConvolutionForwardGetSolution(
+            handle, w_desc, x_desc, conv_desc, y_desc, count, &count, solutions.data()));
+        total += count;
+    }
+    return total;
+}
+
+} // namespace
+
+/// Measures the time of immediate mode Find for grouped convolutions. The first pass
+/// includes construction of the composable_kernel instance registries.
+///
+/// Usage: speedtest_ck_applicability [iterations]
+int main(int argc, char* argv[])
+{
+    const auto iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10ULL;
+
+    miopenHandle_t handle;
+    miopenTensorDescriptor_t x_desc, w_desc, y_desc;
+    miopenConvolutionDescriptor_t conv_desc;
+    CHECK(miopenCreate(&handle));
+    CHECK(miopenCreateTensorDescriptor(&x_desc));
+    CHECK(miopenCreateTensorDescriptor(&w_desc));
+    CHECK(miopenCreateTensorDescriptor(&y_desc));
+    CHECK(miopenCreateConvolutionDescriptor(&conv_desc));
+
+    auto start       = Clock::now();
+    const auto found = Query(handle, x_desc, w_desc, y_desc, conv_desc);
+    const auto cold  = Seconds(start);
+
+    start = Clock::now();
+    for(auto i = 0ULL; i < iterations; ++i)
+        Query(handle, x_desc, w_desc, y_desc, conv_desc);
+    const auto warm = Seconds(start);
+
+    std::cout << "Problems: " << problems.size() << ", solutions: " << found << std::endl;
+    std::cout << "First pass: " << cold * 1e3 / problems.size() << " ms per problem"
+              << std::endl;
+    std::cout << "Next passes: " << warm * 1e3 / (iterations * problems.size())
+              << " ms per problem" << std::endl;
+
+    miopenDestroyConvolutionDescriptor(conv_desc);
+    miopenDestroyTensorDescriptor(y_desc);
+    miopenDestroyTensorDescriptor(w_desc);
+    miopenDestroyTensorDescriptor(x_desc);
+    miopenDestroy(handle);
+    return EXIT_SUCCESS;
+}
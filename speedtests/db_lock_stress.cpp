@@ -0,0 +1,182 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Stress test for the db lock: N processes read and update one user find-db.
+// Usage: speedtest_db_lock_stress [processes] [seconds] [write percent] [readers|writers]
+// Without the last argument both lock preferences are measured.
+// Reports throughput and latency percentiles of reads and writes.
+
+#include <miopen/db.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/perf_field.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int record_count = 256;
+
+std::string Key(int i)
+{
+    return "1-28-28-3x3-64-28-28-" + std::to_string(i) + "-1x1-1x1-1x1-0-NCHW-FP32-F";
+}
+
+miopen::DbRecord MakeRecord(int i, int version)
+{
+    auto record     = miopen::DbRecord{miopen::DbKinds::FindDb, Key(i)};
+    const auto time = static_cast<float>(version % 100 + 1);
+    record.SetValues("ConvOclDirectFwd",
+                     miopen::FindDbData{time, 0, "miopenConvolutionFwdAlgoDirect"});
+    return record;
+}
+
+struct Sample
+{
+    bool write;
+    float us;
+};
+
+void RunClient(const miopen::fs::path& db_path,
+               const miopen::fs::path& out_path,
+               int client,
+               double seconds,
+               int write_percent,
+               miopen::LockFile::Preference preference)
+{
+    miopen::LockFile::Get(miopen::LockFilePath(db_path)).SetPreference(preference);
+    auto db      = miopen::PlainTextDb{miopen::DbKinds::FindDb, db_path};
+    auto rng     = std::mt19937{static_cast<unsigned>(client)};
+    auto percent = std::uniform_int_distribution<int>{0, 99};
+    auto record  = std::uniform_int_distribution<int>{0, record_count - 1};
+
+    auto samples   = std::vector<Sample>{};
+    const auto end = Clock::now() + std::chrono::duration<double>(seconds);
+    for(auto version = 0; Clock::now() < end; ++version)
+    {
+        const auto write = percent(rng) < write_percent;
+        const auto start = Clock::now();
+        if(write)
+            db.StoreRecord(MakeRecord(record(rng), version));
+        else
+            db.FindRecord(Key(record(rng)));
+        samples.push_back(
+            {write, std::chrono::duration<float, std::micro>(Clock::now() - start).count()});
+    }
+
+    auto out = std::ofstream{out_path, std::ios::binary};
+    out.write(reinterpret_cast<const char*>(samples.data()),
+              static_cast<std::streamsize>(samples.size() * sizeof(Sample)));
+}
+
+void Report(const char* name, std::vector<float>& us, double seconds)
+{
+    if(us.empty())
+        return;
+    std::sort(us.begin(), us.end());
+    const auto at = [&](double q) {
+        return us[std::min(us.size() - 1, static_cast<std::size_t>(q * us.size()))];
+    };
+    std::cout << std::setw(8) << name << std::fixed << std::setprecision(0) << std::setw(10)
+              << us.size() / seconds << " op/s" << std::setprecision(1) << "  p50 " << at(0.5)
+              << " us  p99 " << at(0.99) << " us  p99.9 " << at(0.999) << " us  max "
+              << us.back() << " us" << std::endl;
+}
+
+void Measure(int processes,
+             double seconds,
+             int write_percent,
+             miopen::LockFile::Preference preference)
+{
+    const miopen::TmpDir dir{"db-lock-stress"};
+    const auto db_path = dir.path / "gfx90a_104.ufdb.txt";
+    {
+        auto db = miopen::PlainTextDb{miopen::DbKinds::FindDb, db_path};
+        for(auto i = 0; i < record_count; ++i)
+            db.StoreRecord(MakeRecord(i, 0));
+    }
+
+    std::cout << std::flush;
+    auto pids = std::vector<pid_t>{};
+    for(auto i = 0; i < processes; ++i)
+    {
+        const auto pid = fork();
+        if(pid == 0)
+        {
+            RunClient(db_path, dir.path / std::to_string(i), i, seconds, write_percent, preference);
+            std::_Exit(0);
+        }
+        pids.push_back(pid);
+    }
+    for(auto pid : pids)
+        waitpid(pid, nullptr, 0);
+
+    auto reads  = std::vector<float>{};
+    auto writes = std::vector<float>{};
+    for(auto i = 0; i < processes; ++i)
+    {
+        auto in     = std::ifstream{dir.path / std::to_string(i), std::ios::binary};
+        auto sample = Sample{};
+        while(in.read(reinterpret_cast<char*>(&sample), sizeof(sample)))
+            (sample.write ? writes : reads).push_back(sample.us);
+    }
+
+    std::cout << (preference == miopen::LockFile::Preference::Readers ? "Readers" : "Writers")
+              << " preferred, " << processes << " processes, " << write_percent << "% writes"
+              << std::endl;
+    Report("Reads", reads, seconds);
+    Report("Writes", writes, seconds);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const auto processes     = argc > 1 ? std::atoi(argv[1]) : 8;
+    const auto seconds       = argc > 2 ? std::atof(argv[2]) : 5.0;
+    const auto write_percent = argc > 3 ? std::atoi(argv[3]) : 5;
+    const auto which         = std::string{argc > 4 ? argv[4] : ""};
+
+    if(which != "writers")
+        Measure(processes, seconds, write_percent, miopen::LockFile::Preference::Readers);
+    if(which != "readers")
+        Measure(processes, seconds, write_percent, miopen::LockFile::Preference::Writers);
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/handle.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Microseconds(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+} // namespace
+
+/// Measures the cost of creating a handle, the first use of the lazily initialized
+/// target properties and an explicit warm-up. Meant to be run with the nogpu backend,
+/// where only the host side of the handle is measured.
+///
+/// Usage: speedtest_handle_creation [iterations]
+int main(int argc, char* argv[])
+{
+    const auto iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000ULL;
+
+    auto construction = 0.;
+    auto first_use    = 0.;
+    auto warm_up      = 0.;
+    auto name         = std::string{};
+
+    for(auto i = 0ULL; i < iterations; ++i)
+    {
+        auto start  = Clock::now();
+        auto handle = miopen::Handle{};
+        construction += Microseconds(start);
+
+        start = Clock::now();
+        name  = handle.GetDeviceName();
+        first_use += Microseconds(start);
+
+        start = Clock::now();
+        handle.WarmUp();
+        warm_up += Microseconds(start);
+    }
+
+    const auto n = static_cast<double>(iterations);
+    std::cout << "Device: " << name << std::endl;
+    std::cout << "Handle construction: " << construction / n << " us" << std::endl;
+    std::cout << "First use of target properties: " << first_use / n << " us" << std::endl;
+    std::cout << "Explicit warm-up: " << warm_up / n << " us" << std::endl;
+    return 0;
+}
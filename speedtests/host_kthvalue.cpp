@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cpu_kthvalue.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// The loop the references used before: copy every slice and sort the positions.
+void LegacyKthvalue(const std::vector<float>& x,
+                    std::vector<float>& y,
+                    std::vector<size_t>& indices,
+                    size_t slices,
+                    size_t n,
+                    size_t k)
+{
+    auto elements = std::vector<float>(n);
+    auto ids      = std::vector<size_t>(n);
+    for(size_t s = 0; s < slices; ++s)
+    {
+        std::copy_n(x.begin() + s * n, n, elements.begin());
+        std::iota(ids.begin(), ids.end(), 0);
+        std::sort(ids.begin(), ids.end(), [&](size_t a, size_t b) {
+            return elements[a] < elements[b];
+        });
+        y[s]       = elements[ids[k - 1]];
+        indices[s] = ids[k - 1];
+    }
+}
+
+template <class F>
+double MeasureMs(size_t iterations, F&& f)
+{
+    const auto start = Clock::now();
+    for(size_t i = 0; i < iterations; ++i)
+        f();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() /
+           static_cast<double>(iterations);
+}
+
+} // namespace
+
+/// Usage: speedtest_host_kthvalue [slices] [slice length] [k] [iterations]
+int main(int argc, char* argv[])
+{
+    const auto slices     = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024ULL;
+    const auto n          = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 8192ULL;
+    const auto k          = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : n / 2;
+    const auto iterations = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 3ULL;
+
+    auto gen  = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<float>{-10.f, 10.f};
+    auto x    = std::vector<float>(slices * n);
+    std::generate(x.begin(), x.end(), [&]() { return dist(gen); });
+
+    // Slices are the rows of a {slices, n} matrix, selecting along the last dim.
+    const auto xTv  = tensor_view_t<5>{{0, 0, 0, n, 1}, {1, 1, 1, slices, n}};
+    const auto yTv  = tensor_view_t<5>{{0, 0, 0, 1, 1}, {1, 1, 1, slices, 1}};
+    auto legacy     = std::vector<float>(slices);
+    auto legacy_ids = std::vector<size_t>(slices);
+    auto engine     = std::vector<float>(slices);
+    auto engine_ids = std::vector<size_t>(slices);
+
+    const auto legacy_ms = MeasureMs(
+        iterations, [&]() { LegacyKthvalue(x, legacy, legacy_ids, slices, n, k); });
+    const auto engine_ms = MeasureMs(iterations, [&]() {
+        cpu_kthvalue(x.data(), xTv, engine.data(), yTv, engine_ids.data(), yTv, k, 4);
+    });
+
+    std::cout << "Kthvalue " << slices << "x" << n << " k " << k << std::endl;
+    std::cout << "Legacy:  " << legacy_ms << " ms" << std::endl;
+    std::cout << "Engine:  " << engine_ms << " ms" << std::endl;
+    std::cout << "Speedup: " << legacy_ms / engine_ms << "x" << std::endl;
+    std::cout << "Matches: " << (legacy == engine ? "yes" : "no") << std::endl;
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cpu_norm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// The scalar two-pass loop the references used before, sum and sum of squares in float.
+void LegacyLayerNorm(const std::vector<float>& x,
+                     const std::vector<float>& weight,
+                     const std::vector<float>& bias,
+                     std::vector<float>& y,
+                     std::size_t outer,
+                     std::size_t inner,
+                     float eps)
+{
+    for(std::size_t o = 0; o < outer; ++o)
+    {
+        float mean = 0;
+        float var  = 0;
+        for(std::size_t i = 0; i < inner; ++i)
+        {
+            const auto v = x[o * inner + i];
+            mean += v;
+            var += v * v;
+        }
+        mean            = mean / inner;
+        var             = var / inner - mean * mean;
+        const auto rstd = 1 / std::sqrt(var + eps);
+        for(std::size_t i = 0; i < inner; ++i)
+            y[o * inner + i] = (x[o * inner + i] - mean) * rstd * weight[i] + bias[i];
+    }
+}
+
+template <class F>
+double MeasureMs(std::size_t iterations, F&& f)
+{
+    const auto start = Clock::now();
+    for(std::size_t i = 0; i < iterations; ++i)
+        f();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() /
+           static_cast<double>(iterations);
+}
+
+} // namespace
+
+/// Usage: speedtest_host_norm [outer] [inner] [iterations]
+int main(int argc, char* argv[])
+{
+    const auto outer      = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096ULL;
+    const auto inner      = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4096ULL;
+    const auto iterations = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 5ULL;
+    const auto eps        = 1e-5f;
+
+    auto gen    = std::mt19937{42};
+    auto dist   = std::uniform_real_distribution<float>{-1.f, 1.f};
+    auto x      = std::vector<float>(outer * inner);
+    auto weight = std::vector<float>(inner);
+    auto bias   = std::vector<float>(inner);
+    std::generate(x.begin(), x.end(), [&]() { return dist(gen) + 10.f; });
+    std::generate(weight.begin(), weight.end(), [&]() { return dist(gen); });
+    std::generate(bias.begin(), bias.end(), [&]() { return dist(gen); });
+
+    auto legacy = std::vector<float>(x.size());
+    auto engine = std::vector<float>(x.size());
+    auto mean   = std::vector<float>(outer);
+    auto rstd   = std::vector<float>(outer);
+
+    const auto legacy_ms = MeasureMs(
+        iterations, [&]() { LegacyLayerNorm(x, weight, bias, legacy, outer, inner, eps); });
+    const auto engine_ms = MeasureMs(iterations, [&]() {
+        cpu_norm_forward(cpu_norm_layout::layer({outer, inner}, 1),
+                         cpu_norm_kind::standard,
+                         x.data(),
+                         static_cast<const float*>(nullptr),
+                         weight.data(),
+                         bias.data(),
+                         eps,
+                         engine.data(),
+                         mean.data(),
+                         rstd.data());
+    });
+
+    auto max_diff = 0.f;
+    for(std::size_t i = 0; i < x.size(); ++i)
+        max_diff = std::max(max_diff, std::abs(legacy[i] - engine[i]));
+
+    const auto gb = 2.0 * x.size() * sizeof(float) / 1e6;
+    std::cout << "LayerNorm forward " << outer << "x" << inner << std::endl;
+    std::cout << "Legacy:  " << legacy_ms << " ms, " << gb / legacy_ms << " GB/s" << std::endl;
+    std::cout << "Engine:  " << engine_ms << " ms, " << gb / engine_ms << " GB/s" << std::endl;
+    std::cout << "Speedup: " << legacy_ms / engine_ms << "x" << std::endl;
+    std::cout << "Max abs difference: " << max_diff << std::endl;
+    return 0;
+}
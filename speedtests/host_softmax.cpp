@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cpu_softmax.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// The scalar loops the references used before: max, sum of std::exp and the output in
+/// separate passes.
+void LegacySoftmax(const std::vector<float>& x,
+                   std::vector<float>& y,
+                   std::size_t rows,
+                   std::size_t row_len)
+{
+    for(std::size_t r = 0; r < rows; ++r)
+    {
+        const auto* row = x.data() + r * row_len;
+        auto max        = std::numeric_limits<float>::lowest();
+        for(std::size_t i = 0; i < row_len; ++i)
+            max = std::max(max, row[i]);
+        double sum = 0;
+        for(std::size_t i = 0; i < row_len; ++i)
+            sum += std::exp(row[i] - max);
+        for(std::size_t i = 0; i < row_len; ++i)
+            y[r * row_len + i] = std::exp(row[i] - max) / sum;
+    }
+}
+
+template <class F>
+double MeasureMs(std::size_t iterations, F&& f)
+{
+    const auto start = Clock::now();
+    for(std::size_t i = 0; i < iterations; ++i)
+        f();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() /
+           static_cast<double>(iterations);
+}
+
+} // namespace
+
+/// Usage: speedtest_host_softmax [rows] [row length] [iterations]
+int main(int argc, char* argv[])
+{
+    const auto rows       = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2048ULL;
+    const auto row_len    = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4096ULL;
+    const auto iterations = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 5ULL;
+
+    auto gen  = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<float>{-10.f, 10.f};
+    auto x    = std::vector<float>(rows * row_len);
+    std::generate(x.begin(), x.end(), [&]() { return dist(gen); });
+
+    auto legacy            = std::vector<float>(x.size());
+    auto engine            = std::vector<float>(x.size());
+    const auto rows_layout = cpu_softmax_layout::packed(rows, row_len);
+
+    const auto legacy_ms =
+        MeasureMs(iterations, [&]() { LegacySoftmax(x, legacy, rows, row_len); });
+    const auto engine_ms = MeasureMs(iterations, [&]() {
+        cpu_softmax_forward(
+            rows_layout, rows_layout, MIOPEN_SOFTMAX_ACCURATE, x.data(), engine.data());
+    });
+
+    auto max_rel = 0.0;
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        if(legacy[i] > 0)
+            max_rel = std::max(max_rel, std::abs(1.0 * engine[i] / legacy[i] - 1));
+    }
+
+    std::cout << "Softmax forward " << rows << "x" << row_len << std::endl;
+    std::cout << "Legacy:  " << legacy_ms << " ms" << std::endl;
+    std::cout << "Engine:  " << engine_ms << " ms" << std::endl;
+    std::cout << "Speedup: " << legacy_ms / engine_ms << "x" << std::endl;
+    std::cout << "Max relative difference: " << max_rel << std::endl;
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cpu_getitem.hpp>
+#include <cpu_strided_copy.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <class F>
+double MeasureMs(size_t iterations, F&& f)
+{
+    const auto start = Clock::now();
+    for(size_t i = 0; i < iterations; ++i)
+        f();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() /
+           static_cast<double>(iterations);
+}
+
+void Report(const char* name, double legacy_ms, double engine_ms, size_t bytes)
+{
+    std::cout << name << std::endl;
+    std::cout << "Legacy:  " << legacy_ms << " ms, " << bytes / legacy_ms / 1e6 << " GB/s"
+              << std::endl;
+    std::cout << "Engine:  " << engine_ms << " ms, " << bytes / engine_ms / 1e6 << " GB/s"
+              << std::endl;
+    std::cout << "Speedup: " << legacy_ms / engine_ms << "x" << std::endl;
+}
+
+/// Concatenation of two {outer, inner} matrices along dim 1, with the index arithmetic of the
+/// old Cat reference.
+void BenchCat(size_t outer, size_t inner, size_t iterations)
+{
+    const auto a   = std::vector<float>(outer * inner, 1.f);
+    const auto b   = std::vector<float>(outer * inner, 2.f);
+    auto legacy    = std::vector<float>(outer * inner * 2);
+    auto engine    = legacy;
+    const auto row = inner * 2;
+
+    const auto legacy_ms = MeasureMs(iterations, [&]() {
+        size_t start = 0;
+        for(const auto* input : {&a, &b})
+        {
+            for(size_t o = 0; o < input->size(); ++o)
+                legacy[start + o / inner * row + o % inner] = (*input)[o];
+            start += inner;
+        }
+    });
+    const auto engine_ms = MeasureMs(iterations, [&]() {
+        size_t start = 0;
+        for(const auto* input : {&a, &b})
+        {
+            auto plan = cpu_copy_plan{};
+            plan.add(outer, inner, row).add(inner, 1, 1);
+            plan.run(input->data(), engine.data() + start);
+            start += inner;
+        }
+    });
+
+    Report("Cat", legacy_ms, engine_ms, 2 * engine.size() * sizeof(float));
+    std::cout << "Matches: " << (legacy == engine ? "yes" : "no") << std::endl;
+}
+
+/// GetItem backward of dx[index] += dy over the rows of {rows, inner}, with the element by
+/// element tensor view arithmetic of the old reference.
+void BenchGetitem(size_t rows, size_t inner, size_t iterations)
+{
+    const auto dy = std::vector<float>(rows * inner, 1.f);
+    auto index    = std::vector<int32_t>(rows);
+    for(size_t i = 0; i < rows; ++i)
+        index[i] = static_cast<int32_t>(i * 7 % rows);
+    auto legacy = std::vector<float>(rows * inner);
+    auto engine = legacy;
+    auto tv     = tensor_view_t<5>{{inner, 1, 1, 1, 1}, {rows, inner, 1, 1, 1}};
+
+    const auto legacy_ms = MeasureMs(iterations, [&]() {
+        for(size_t o = 0; o < dy.size(); ++o)
+        {
+            tensor_layout_t<5> ncdhw(tv, o);
+            tensor_layout_t<5> idx(ncdhw);
+            idx.layout[0] = index[ncdhw.layout[0]];
+            legacy[tv.get_tensor_view_idx(idx)] += dy[tv.get_tensor_view_idx(ncdhw)];
+        }
+    });
+    const int32_t dims[]    = {0};
+    const int32_t* indexs[] = {index.data()};
+    int32_t error           = 0;
+    const auto engine_ms    = MeasureMs(iterations, [&]() {
+        cpu_getitem_backward(
+            dy.data(), tv, 1, indexs, rows, engine.data(), tv, &error, dims, 0, nullptr);
+    });
+
+    Report("GetItem backward", legacy_ms, engine_ms, 3 * dy.size() * sizeof(float));
+    std::cout << "Matches: " << (legacy == engine ? "yes" : "no") << std::endl;
+}
+
+} // namespace
+
+/// Usage: speedtest_host_strided_copy [rows] [row length] [iterations]
+int main(int argc, char* argv[])
+{
+    const auto rows       = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096ULL;
+    const auto inner      = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1024ULL;
+    const auto iterations = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 5ULL;
+
+    BenchCat(rows, inner, iterations);
+    BenchGetitem(rows, inner, iterations);
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/process.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+#ifndef _WIN32
+/// A launch through fork(), as popen() does in older C libraries.
+int ForkLaunch(const char* cmd)
+{
+    const auto pid = fork();
+    if(pid == 0)
+    {
+        execl("/bin/sh", "sh", "-c", cmd, static_cast<char*>(nullptr));
+        _exit(127);
+    }
+    auto status = 0;
+    waitpid(pid, &status, 0);
+    return status;
+}
+
+/// The launch the library used before: a shell started by popen() and reading its output.
+int LegacyLaunch(const char* cmd)
+{
+    auto* pipe = popen(cmd, "r");
+    if(pipe == nullptr)
+        return -1;
+    char buffer[256];
+    while(std::fgets(buffer, sizeof(buffer), pipe) != nullptr) {}
+    return pclose(pipe);
+}
+#endif
+
+template <class F>
+double MeasureMs(size_t iterations, F&& f)
+{
+    const auto start = Clock::now();
+    for(size_t i = 0; i < iterations; ++i)
+        f();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() /
+           static_cast<double>(iterations);
+}
+
+} // namespace
+
+/// Usage: speedtest_process_spawn [parent RSS in MiB] [launches]
+int main(int argc, char* argv[])
+{
+#ifdef _WIN32
+    std::ignore = argc;
+    std::ignore = argv;
+    std::cout << "Not supported on Windows" << std::endl;
+#else
+    const auto rss_mib    = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024ULL;
+    const auto iterations = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200ULL;
+
+    // Touch every page, so fork() has to copy the page tables of a resident buffer.
+    auto ballast = std::vector<char>(rss_mib << 20);
+    std::memset(ballast.data(), 1, ballast.size());
+
+    const auto fork_ms   = MeasureMs(iterations, []() { ForkLaunch("echo 1 >/dev/null"); });
+    const auto legacy_ms = MeasureMs(iterations, []() { LegacyLaunch("echo 1"); });
+    const auto spawn_ms  = MeasureMs(iterations, []() {
+        auto out = std::ostringstream{};
+        miopen::Process{"echo"}("1", "", &out);
+    });
+
+    auto worker          = miopen::ProcessWorker{"/bin/sh"};
+    const auto worker_ms = MeasureMs(iterations, [&]() { worker.Call("echo 1; echo .\n", "."); });
+    worker.Close();
+
+    std::cout << "Parent RSS:  " << rss_mib << " MiB" << std::endl;
+    std::cout << "fork:        " << fork_ms << " ms per launch" << std::endl;
+    std::cout << "popen:       " << legacy_ms << " ms per launch" << std::endl;
+    std::cout << "posix_spawn: " << spawn_ms << " ms per launch" << std::endl;
+    std::cout << "Worker:      " << worker_ms << " ms per request" << std::endl;
+    std::cout << "Speedup over fork:  " << fork_ms / spawn_ms << "x" << std::endl;
+    std::cout << "Speedup over popen: " << legacy_ms / spawn_ms << "x" << std::endl;
+#endif
+    return 0;
+}
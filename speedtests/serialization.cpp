@@ -0,0 +1,170 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/serializable.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Has the same shape as typical implicit GEMM performance configs.
+struct PerfConfigLike : miopen::solver::Serializable<PerfConfigLike>
+{
+    int block_size   = 256;
+    int gemm_m       = 128;
+    int gemm_n       = 128;
+    int gemm_k       = 16;
+    int wave_m       = 32;
+    int wave_n       = 32;
+    int k_per_thread = 4;
+    int m_per_thread = 4;
+    int n_per_thread = 4;
+    bool use_spare   = false;
+    int vector_size  = 8;
+    int split_k      = 1;
+
+    template <class Self, class F>
+    static void Visit(Self&& self, F f)
+    {
+        f(self.block_size, "block_size");
+        f(self.gemm_m, "gemm_m");
+        f(self.gemm_n, "gemm_n");
+        f(self.gemm_k, "gemm_k");
+        f(self.wave_m, "wave_m");
+        f(self.wave_n, "wave_n");
+        f(self.k_per_thread, "k_per_thread");
+        f(self.m_per_thread, "m_per_thread");
+        f(self.n_per_thread, "n_per_thread");
+        f(self.use_spare, "use_spare");
+        f(self.vector_size, "vector_size");
+        f(self.split_k, "split_k");
+    }
+};
+
+/// The implementation used before std::to_chars/std::from_chars.
+struct LegacySerDes
+{
+    template <class Self>
+    static void Serialize(const Self& self, std::ostream& stream)
+    {
+        char sep = 0;
+        Self::Visit(self, [&](const auto& x, const char*) {
+            if(sep != 0)
+                stream << sep;
+            stream << x;
+            sep = ',';
+        });
+    }
+
+    template <class Self>
+    static bool Deserialize(Self& self, const std::string& s)
+    {
+        auto out = self;
+        bool ok  = true;
+        std::istringstream ss(s);
+        Self::Visit(out, [&](auto& x, const char*) {
+            if(!ok)
+                return;
+            std::string part;
+            if(!std::getline(ss, part, ','))
+            {
+                ok = false;
+                return;
+            }
+            std::stringstream ps;
+            ps.str(part);
+            ps >> x;
+        });
+        if(ok)
+            self = out;
+        return ok;
+    }
+};
+
+template <class F>
+double MeasureNs(std::size_t iterations, F&& f)
+{
+    const auto start = Clock::now();
+    for(std::size_t i = 0; i < iterations; ++i)
+        f(i);
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+           static_cast<double>(iterations);
+}
+
+} // namespace
+
+/// Usage: speedtest_serialization [iterations]
+int main(int argc, char* argv[])
+{
+    const auto iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000ULL;
+
+    auto config  = PerfConfigLike{};
+    auto records = std::vector<std::string>{};
+    for(auto i = 0; i < 64; ++i)
+    {
+        config.gemm_k  = 4 << (i % 4);
+        config.split_k = i;
+        std::ostringstream ss;
+        config.Serialize(ss);
+        records.push_back(ss.str());
+    }
+
+    auto checksum = std::size_t{0};
+
+    const auto legacy_format = MeasureNs(iterations, [&](auto i) {
+        config.split_k = static_cast<int>(i);
+        std::ostringstream ss;
+        LegacySerDes::Serialize(config, ss);
+        checksum += ss.str().size();
+    });
+    const auto fast_format = MeasureNs(iterations, [&](auto i) {
+        config.split_k = static_cast<int>(i);
+        std::ostringstream ss;
+        config.Serialize(ss);
+        checksum += ss.str().size();
+    });
+    const auto legacy_parse = MeasureNs(iterations, [&](auto i) {
+        checksum += LegacySerDes::Deserialize(config, records[i % records.size()]) ? 1 : 0;
+    });
+    const auto fast_parse = MeasureNs(iterations, [&](auto i) {
+        checksum += config.Deserialize(records[i % records.size()]) ? 1 : 0;
+    });
+
+    std::cout << "Format, iostream: " << legacy_format << " ns/record" << std::endl;
+    std::cout << "Format, to_chars: " << fast_format << " ns/record" << std::endl;
+    std::cout << "Parse, iostream: " << legacy_parse << " ns/record" << std::endl;
+    std::cout << "Parse, from_chars: " << fast_parse << " ns/record" << std::endl;
+
+    // Keep the results alive in release builds.
+    return checksum == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Compares the first lookup in a system find-db loaded in full with a sharded one.
+// Usage: speedtest_sharded_find_db <path to an unsharded .fdb.txt> [problem family]
+// The family is the shard name, e.g. NHWC-FP16-F. Each case runs in its own process,
+// so the resident set size is not affected by the other one.
+
+#include <miopen/db_shard.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Milliseconds(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+double ResidentMiB()
+{
+    auto statm    = std::ifstream{"/proc/self/statm"};
+    auto size     = 0LL;
+    auto resident = 0LL;
+    statm >> size >> resident;
+    return static_cast<double>(resident) * static_cast<double>(sysconf(_SC_PAGESIZE)) /
+           (1024. * 1024.);
+}
+
+/// Keeps the heap of this process small, so the children start from the same state.
+template <class F>
+bool RunInChild(F&& f)
+{
+    std::cout << std::flush;
+    const auto pid = fork();
+    if(pid == 0)
+    {
+        const auto ok = f();
+        std::cout << std::flush;
+        std::_Exit(ok ? 0 : 1);
+    }
+
+    auto status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+void Measure(const std::string& name, const miopen::fs::path& file, const std::string& key)
+{
+    RunInChild([&]() {
+        const auto rss_before = ResidentMiB();
+        const auto start      = Clock::now();
+        const auto& db = miopen::ReadonlyRamDb::GetCached(miopen::DbKinds::FindDb, file, true);
+        const auto found      = db.FindRecord(key).has_value();
+        const auto first_call = Milliseconds(start);
+
+        std::cout << name << ": first lookup " << first_call << " ms, RSS +"
+                  << ResidentMiB() - rss_before << " MiB, " << db.GetLoadedShardCount()
+                  << " shard(s) loaded, key " << (found ? "found" : "not found") << std::endl;
+        return found;
+    });
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if(argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <fdb.txt> [problem family]" << std::endl;
+        return 1;
+    }
+
+    const auto source = miopen::fs::path{argv[1]};
+    const auto family = std::string{argc > 2 ? argv[2] : "NHWC-FP16-F"};
+
+    // Any key of the family will do.
+    auto key = std::string{};
+    {
+        auto input = std::ifstream{source};
+        for(auto line = std::string{}; key.empty() && std::getline(input, line);)
+        {
+            const auto candidate = line.substr(0, line.find('='));
+            if(miopen::GetDbShardName(candidate) == family)
+                key = candidate;
+        }
+    }
+
+    if(key.empty())
+    {
+        std::cerr << "No records of " << family << " in " << source << std::endl;
+        return 1;
+    }
+
+    const miopen::TmpDir dir{"sharded-find-db-speedtest"};
+    const auto sharded = dir.path / source.filename();
+    const auto shard = [&]() {
+        auto input    = std::ifstream{source, std::ios::binary};
+        auto output   = std::ofstream{sharded, std::ios::binary};
+        auto manifest = std::ofstream{miopen::GetDbShardManifestPath(sharded.string())};
+        return miopen::WriteShardedDb(input, output, manifest);
+    };
+    if(!RunInChild(shard))
+    {
+        std::cerr << "Unable to shard " << source << std::endl;
+        return 1;
+    }
+
+    std::cout << "Looking up " << key << std::endl;
+    Measure("Full load", source, key);
+    Measure("Sharded", sharded, key);
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/solver_id.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+/// Measures construction of the solver id registry and the cost of the lookups
+/// used while decoding db records.
+///
+/// Usage: speedtest_solver_registry [iterations]
+int main(int argc, char* argv[])
+{
+    const auto iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000ULL;
+
+    auto start = Clock::now();
+    const auto& first =
+        miopen::solver::GetSolversByPrimitive(miopen::solver::Primitive::Convolution);
+    std::cout << "Registry construction: " << Seconds(start) * 1e3 << " ms" << std::endl;
+
+    auto names  = std::vector<std::string>{};
+    auto values = std::vector<uint64_t>{};
+    for(auto p = static_cast<int>(miopen::solver::Primitive::Convolution);
+        p <= static_cast<int>(miopen::solver::Primitive::MultiMarginLoss);
+        ++p)
+    {
+        for(const auto& id :
+            miopen::solver::GetSolversByPrimitive(static_cast<miopen::solver::Primitive>(p)))
+        {
+            names.push_back(id.ToString());
+            values.push_back(id.Value());
+        }
+    }
+    std::cout << "Registered solvers: " << names.size() << " (" << first.size()
+              << " convolutions)" << std::endl;
+
+    auto valid = std::size_t{0};
+
+    start = Clock::now();
+    for(auto i = 0ULL; i < iterations; ++i)
+        valid += miopen::solver::Id{names[i % names.size()].c_str()}.IsValid() ? 1 : 0;
+    const auto by_name = Seconds(start);
+
+    start = Clock::now();
+    for(auto i = 0ULL; i < iterations; ++i)
+        valid += miopen::solver::Id{values[i % values.size()]}.IsValid() ? 1 : 0;
+    const auto by_value = Seconds(start);
+
+    start = Clock::now();
+    for(auto i = 0ULL; i < iterations; ++i)
+        valid += miopen::solver::Id{values[i % values.size()]}.ToString().size();
+    const auto to_string = Seconds(start);
+
+    std::cout << "Id(const char*): " << by_name * 1e9 / iterations << " ns" << std::endl;
+    std::cout << "Id(uint64_t): " << by_value * 1e9 / iterations << " ns" << std::endl;
+    std::cout << "Id::ToString(): " << to_string * 1e9 / iterations << " ns" << std::endl;
+
+    // Keep the results alive in release builds.
+    return valid == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
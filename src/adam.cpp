@@ -25,6 +25,7 @@
  *******************************************************************************/
 #include <miopen/adam.hpp>
 #include <miopen/adam/invoke_params.hpp>
+#include <miopen/adam/multi_tensor.hpp>
 #include <miopen/adam/solvers.hpp>
 #include <miopen/check_numerics.hpp>
 #include <miopen/datatype.hpp>
@@ -135,4 +136,81 @@ miopenStatus_t Adam(Handle& handle,
     return miopenStatusSuccess;
 }
 
+miopenStatus_t AdamMultiTensor(Handle& handle,
+                               const int32_t tensorCount,
+                               const TensorDescriptor* const* paramDescs,
+                               Data_t const* params,
+                               const TensorDescriptor* const* gradDescs,
+                               ConstData_t const* grads,
+                               const TensorDescriptor* const* expAvgDescs,
+                               Data_t const* expAvgs,
+                               const TensorDescriptor* const* expAvgSqDescs,
+                               Data_t const* expAvgSqs,
+                               const TensorDescriptor* const* maxExpAvgSqDescs,
+                               Data_t const* maxExpAvgSqs,
+                               const TensorDescriptor* const* paramFloat16Descs,
+                               Data_t const* paramsFloat16,
+                               ConstData_t gradScale,
+                               ConstData_t foundInf,
+                               const uint32_t step,
+                               const float lr,
+                               const float beta1,
+                               const float beta2,
+                               const float weight_decay,
+                               const float eps,
+                               const bool amsgrad,
+                               const bool maximize,
+                               const bool adamw,
+                               const bool is_amp)
+{
+    const auto problem = adam::MultiTensorProblemDescription{tensorCount,
+                                                             paramDescs,
+                                                             gradDescs,
+                                                             expAvgDescs,
+                                                             expAvgSqDescs,
+                                                             maxExpAvgSqDescs,
+                                                             paramFloat16Descs,
+                                                             amsgrad,
+                                                             adamw,
+                                                             is_amp,
+                                                             false};
+
+    const auto numels   = problem.GetNumels();
+    const auto launches = adam::MakeMultiTensorLaunches(numels);
+
+    const auto invoke_params = [&]() {
+        auto tmp     = adam::AdamMultiTensorInvokeParams{};
+        tmp.type     = InvokeType::Run;
+        tmp.launches = &launches;
+        tmp.numels   = &numels;
+
+        tmp.buffers.params        = params;
+        tmp.buffers.grads         = grads;
+        tmp.buffers.expAvgs       = expAvgs;
+        tmp.buffers.expAvgSqs     = expAvgSqs;
+        tmp.buffers.maxExpAvgSqs  = amsgrad ? maxExpAvgSqs : nullptr;
+        tmp.buffers.paramsFloat16 = paramsFloat16;
+        tmp.gradScale             = gradScale;
+        tmp.foundInf              = foundInf;
+
+        tmp.step         = step;
+        tmp.lr           = lr;
+        tmp.beta1        = beta1;
+        tmp.beta2        = beta2;
+        tmp.weight_decay = weight_decay;
+        tmp.eps          = eps;
+        tmp.amsgrad      = amsgrad;
+        tmp.maximize     = maximize;
+        tmp.adamw        = adamw;
+
+        return tmp;
+    }();
+
+    const auto algo    = AlgorithmName{"AdamMultiTensor"};
+    const auto solvers = solver::SolverContainer<solver::adam::AdamMultiTensor>{};
+    solvers.ExecutePrimitive(handle, problem, algo, invoke_params);
+
+    return miopenStatusSuccess;
+}
+
 } // namespace miopen
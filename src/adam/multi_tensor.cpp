@@ -0,0 +1,122 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/adam/multi_tensor.hpp>
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+
+namespace miopen {
+
+namespace adam {
+
+std::vector<MultiTensorLaunch> MakeMultiTensorLaunches(const std::vector<std::size_t>& numels,
+                                                       std::size_t chunk_size,
+                                                       std::size_t max_tensors,
+                                                       std::size_t max_blocks)
+{
+    if(chunk_size == 0 || max_tensors == 0 || max_blocks == 0 ||
+       max_tensors > ADAM_MULTI_TENSOR_MAX_TENSORS || max_blocks > ADAM_MULTI_TENSOR_MAX_BLOCKS)
+    {
+        MIOPEN_THROW(miopenStatusBadParm, "Adam: Invalid multi-tensor launch limits.");
+    }
+
+    auto launches = std::vector<MultiTensorLaunch>{};
+    auto current  = MultiTensorLaunch{};
+
+    const auto flush = [&]() {
+        launches.push_back(std::move(current));
+        current = MultiTensorLaunch{};
+    };
+
+    for(std::size_t i = 0; i < numels.size(); ++i)
+    {
+        const auto chunks = (numels[i] + chunk_size - 1) / chunk_size;
+
+        for(std::size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            if(current.tensors.empty() || current.tensors.back() != i)
+            {
+                if(current.tensors.size() == max_tensors)
+                    flush();
+                current.tensors.push_back(i);
+            }
+
+            current.block_to_tensor.push_back(static_cast<uint8_t>(current.tensors.size() - 1));
+            current.block_to_chunk.push_back(static_cast<uint32_t>(chunk));
+
+            if(current.block_to_tensor.size() == max_blocks)
+                flush();
+        }
+    }
+
+    if(!current.block_to_tensor.empty())
+        flush();
+
+    return launches;
+}
+
+adam_multi_tensor_list_t MakeMultiTensorList(const MultiTensorLaunch& launch,
+                                             const std::vector<std::size_t>& numels,
+                                             const MultiTensorBuffers& buffers,
+                                             bool amsgrad)
+{
+    if(amsgrad && buffers.maxExpAvgSqs == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Adam: In the amsgrad, the max_exp_avg_sq tensors are required.");
+
+    auto list = adam_multi_tensor_list_t{};
+
+    for(std::size_t slot = 0; slot < launch.tensors.size(); ++slot)
+    {
+        const auto i = launch.tensors[slot];
+
+        list.param[slot]      = buffers.params[i];
+        list.grad[slot]       = const_cast<Data_t>(buffers.grads[i]); // NOLINT
+        list.exp_avg[slot]    = buffers.expAvgs[i];
+        list.exp_avg_sq[slot] = buffers.expAvgSqs[i];
+        list.numel[slot]      = numels[i];
+
+        if(amsgrad)
+        {
+            if(buffers.maxExpAvgSqs[i] == nullptr)
+                MIOPEN_THROW(miopenStatusBadParm,
+                             "Adam: In the amsgrad, the max_exp_avg_sq tensors are required.");
+            list.max_exp_avg_sq[slot] = buffers.maxExpAvgSqs[i];
+        }
+        if(buffers.paramsFloat16 != nullptr)
+            list.param_fp16[slot] = buffers.paramsFloat16[i];
+    }
+
+    std::copy(launch.block_to_tensor.begin(), launch.block_to_tensor.end(), list.block_to_tensor);
+    std::copy(launch.block_to_chunk.begin(), launch.block_to_chunk.end(), list.block_to_chunk);
+
+    return list;
+}
+
+} // namespace adam
+
+} // namespace miopen
@@ -58,6 +58,21 @@ NetworkConfig ProblemDescription::MakeNetworkConfig() const
     return NetworkConfig{ss.str()};
 }
 
+NetworkConfig MultiTensorProblemDescription::MakeNetworkConfig() const
+{
+    // Tensor count and sizes are runtime kernel arguments and are not part of the config.
+    std::ostringstream ss;
+
+    ss << (IsTransformers() ? "transformers" : "") << (IsAmp() ? "ampadam" : "adam");
+    if(IsAdamW())
+        ss << "w";
+    ss << "multitensor";
+    ss << "dtype" << paramDescs[0]->GetType();
+    ss << "grad_dtype" << gradDescs[0]->GetType();
+
+    return NetworkConfig{ss.str()};
+}
+
 } // namespace adam
 
 } // namespace miopen
@@ -29,6 +29,11 @@
 #include <miopen/logger.hpp>
 #include <miopen/tensor_ops.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
 static void LogCmdAdam(const miopenTensorDescriptor_t paramDesc,
                        const float lr,
                        const float beta1,
@@ -78,6 +83,48 @@ static void LogCmdAdam(const miopenTensorDescriptor_t paramDesc,
 
 #define CHECK_DESC_EXIST(desc) (((desc) != nullptr) ? miopen::deref(desc) : dummyDesc)
 
+// Converts the per-tensor arrays of the multi-tensor API. Optional arrays may be null,
+// in which case the result is empty.
+static std::vector<const miopen::TensorDescriptor*>
+DerefDescs(int32_t count, const miopenTensorDescriptor_t* descs, bool optional = false)
+{
+    auto result = std::vector<const miopen::TensorDescriptor*>{};
+    if(descs == nullptr)
+    {
+        if(!optional)
+            MIOPEN_THROW(miopenStatusBadParm, "Adam: Tensor descriptor array is null.");
+        return result;
+    }
+    result.reserve(count);
+    std::transform(descs, descs + count, std::back_inserter(result), [](const auto& desc) {
+        return &miopen::deref(desc);
+    });
+    return result;
+}
+
+template <class T>
+static auto CastBuffers(int32_t count, T* const* buffers, bool optional = false)
+{
+    auto result = std::vector<decltype(DataCast(std::declval<T*>()))>{};
+    if(buffers == nullptr)
+    {
+        if(!optional)
+            MIOPEN_THROW(miopenStatusBadParm, "Adam: Tensor array is null.");
+        return result;
+    }
+    result.reserve(count);
+    std::transform(buffers, buffers + count, std::back_inserter(result), [](T* x) {
+        return DataCast(x);
+    });
+    return result;
+}
+
+template <class T>
+static auto DataOrNull(const std::vector<T>& v)
+{
+    return v.empty() ? nullptr : v.data();
+}
+
 extern "C" miopenStatus_t miopenFusedAdam(miopenHandle_t handle,
                                           const miopenTensorDescriptor_t paramDesc,
                                           void* param,
@@ -304,3 +351,114 @@ miopenFusedAdamWithOutput(miopenHandle_t handle,
                      is_amp);
     });
 }
+
+extern "C" miopenStatus_t
+miopenFusedAdamMultiTensor(miopenHandle_t handle,
+                           const int32_t tensorCount,
+                           const miopenTensorDescriptor_t* paramDescs,
+                           void* const* params,
+                           const miopenTensorDescriptor_t* gradDescs,
+                           const void* const* grads,
+                           const miopenTensorDescriptor_t* expAvgDescs,
+                           void* const* expAvgs,
+                           const miopenTensorDescriptor_t* expAvgSqDescs,
+                           void* const* expAvgSqs,
+                           const miopenTensorDescriptor_t* maxExpAvgSqDescs,
+                           void* const* maxExpAvgSqs,
+                           const miopenTensorDescriptor_t* paramFloat16Descs,
+                           void* const* paramsFloat16,
+                           const unsigned int state_step,
+                           const float lr,
+                           const float beta1,
+                           const float beta2,
+                           const float weight_decay,
+                           const float eps,
+                           const bool amsgrad,
+                           const bool maximize,
+                           const bool adamw,
+                           const miopenTensorDescriptor_t gradScaleDesc,
+                           const void* gradScale,
+                           const miopenTensorDescriptor_t foundInfDesc,
+                           const void* foundInf)
+{
+    MIOPEN_LOG_FUNCTION(handle,
+                        tensorCount,
+                        paramDescs,
+                        params,
+                        gradDescs,
+                        grads,
+                        expAvgDescs,
+                        expAvgs,
+                        expAvgSqDescs,
+                        expAvgSqs,
+                        maxExpAvgSqDescs,
+                        maxExpAvgSqs,
+                        paramFloat16Descs,
+                        paramsFloat16,
+                        state_step,
+                        lr,
+                        beta1,
+                        beta2,
+                        weight_decay,
+                        eps,
+                        amsgrad,
+                        maximize,
+                        adamw,
+                        gradScaleDesc,
+                        gradScale,
+                        foundInfDesc,
+                        foundInf);
+
+    bool is_amp = (foundInfDesc != nullptr || gradScaleDesc != nullptr);
+
+    return miopen::try_([&] {
+        if(tensorCount <= 0)
+            MIOPEN_THROW(miopenStatusBadParm, "Adam: At least one tensor is required.");
+
+        const auto paramDescsCast        = DerefDescs(tensorCount, paramDescs);
+        const auto gradDescsCast         = DerefDescs(tensorCount, gradDescs);
+        const auto expAvgDescsCast       = DerefDescs(tensorCount, expAvgDescs);
+        const auto expAvgSqDescsCast     = DerefDescs(tensorCount, expAvgSqDescs);
+        const auto maxExpAvgSqDescsCast  = DerefDescs(tensorCount, maxExpAvgSqDescs, true);
+        const auto paramFloat16DescsCast = DerefDescs(tensorCount, paramFloat16Descs, true);
+
+        const auto paramsCast        = CastBuffers(tensorCount, params);
+        const auto gradsCast         = CastBuffers(tensorCount, grads);
+        const auto expAvgsCast       = CastBuffers(tensorCount, expAvgs);
+        const auto expAvgSqsCast     = CastBuffers(tensorCount, expAvgSqs);
+        const auto maxExpAvgSqsCast  = CastBuffers(tensorCount, maxExpAvgSqs, true);
+        const auto paramsFloat16Cast = CastBuffers(tensorCount, paramsFloat16, true);
+
+        if(amsgrad && (maxExpAvgSqs == nullptr ||
+                       std::count(maxExpAvgSqs, maxExpAvgSqs + tensorCount, nullptr) != 0))
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "Adam: In the amsgrad, the max_exp_avg_sq tensors are required.");
+
+        miopen::AdamMultiTensor(miopen::deref(handle),
+                                tensorCount,
+                                paramDescsCast.data(),
+                                paramsCast.data(),
+                                gradDescsCast.data(),
+                                gradsCast.data(),
+                                expAvgDescsCast.data(),
+                                expAvgsCast.data(),
+                                expAvgSqDescsCast.data(),
+                                expAvgSqsCast.data(),
+                                DataOrNull(maxExpAvgSqDescsCast),
+                                DataOrNull(maxExpAvgSqsCast),
+                                DataOrNull(paramFloat16DescsCast),
+                                DataOrNull(paramsFloat16Cast),
+                                DataCast(gradScale),
+                                DataCast(foundInf),
+                                state_step,
+                                lr,
+                                beta1,
+                                beta2,
+                                weight_decay,
+                                eps,
+                                amsgrad,
+                                maximize,
+                                adamw,
+                                is_amp);
+    });
+}
@@ -269,6 +269,16 @@ miopenStatus_t miopenSetFindOptionAttachBinaries(miopenFindOptions_t options, un
     });
 }
 
+miopenStatus_t miopenSetFindOptionTuningTimeLimit(miopenFindOptions_t options, size_t milliseconds)
+{
+    MIOPEN_LOG_FUNCTION(options, milliseconds);
+
+    return miopen::try_([&] {
+        auto& options_deref             = miopen::deref(options);
+        options_deref.tuning_time_limit = std::chrono::milliseconds{milliseconds};
+    });
+}
+
 miopenStatus_t miopenFindSolutions(miopenHandle_t handle,
                                    miopenProblem_t problem,
                                    miopenFindOptions_t options,
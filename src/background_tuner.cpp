@@ -0,0 +1,276 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/background_tuner.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_ENABLE_BACKGROUND_TUNING)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_BACKGROUND_TUNING_QUEUE_MAX, 64)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_BACKGROUND_TUNING_WAIT_MS_MAX, 600000)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_BACKGROUND_TUNING_DUTY_PERCENT, 50)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_BACKGROUND_TUNING_FINISHED_MAX, 1024)
+
+namespace miopen {
+
+BackgroundTuner::BackgroundTuner(Options options_, Clock clock_)
+    : options(options_), clock(std::move(clock_))
+{
+    if(!(options.duty_cycle > 0.0 && options.duty_cycle <= 1.0))
+        MIOPEN_THROW(miopenStatusBadParm, "Duty cycle must be in (0, 1]");
+}
+
+BackgroundTuner::~BackgroundTuner() { Stop(); }
+
+bool BackgroundTuner::Enqueue(const std::string& key, Job job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = entries.find(key);
+        if(it != entries.end())
+        {
+            switch(it->second.state)
+            {
+            case State::Queued: ++it->second.requests; return false;
+            case State::Running:
+            case State::Done:
+            case State::Failed: return false;
+            case State::Unknown:
+            case State::Dropped: break;
+            }
+        }
+
+        if(queue.size() >= options.max_queued)
+        {
+            MIOPEN_LOG_I2("Queue is full, ignoring " << key);
+            return false;
+        }
+
+        auto& entry     = entries[key];
+        entry.state     = State::Queued;
+        entry.job       = std::move(job);
+        entry.queued_at = clock();
+        entry.requests  = 1;
+        queue.push_back(key);
+        MIOPEN_LOG_I2("Queued " << key);
+    }
+    wake_up.notify_one();
+    return true;
+}
+
+BackgroundTuner::State BackgroundTuner::GetState(const std::string& key) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = entries.find(key);
+    return it == entries.end() ? State::Unknown : it->second.state;
+}
+
+std::size_t BackgroundTuner::GetQueueSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.size();
+}
+
+std::size_t BackgroundTuner::GetGeneration() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return generation;
+}
+
+std::optional<BackgroundTuner::Duration> BackgroundTuner::RunNext()
+{
+    std::string key;
+    Job job;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto now = clock();
+
+        queue.erase(std::remove_if(queue.begin(),
+                                   queue.end(),
+                                   [&](const auto& queued) {
+                                       auto& entry = entries[queued];
+                                       if(now - entry.queued_at <= options.max_wait)
+                                           return false;
+                                       MIOPEN_LOG_I2("Dropped " << queued);
+                                       entry.job = nullptr;
+                                       Finish(queued, State::Dropped);
+                                       return true;
+                                   }),
+                    queue.end());
+
+        if(queue.empty())
+            return std::nullopt;
+        if(now < next_run)
+            return next_run - now;
+
+        // The most requested job first, the oldest one among equals.
+        const auto it = std::max_element(queue.begin(), queue.end(), [&](auto& l, auto& r) {
+            return entries[l].requests < entries[r].requests;
+        });
+        key = *it;
+        queue.erase(it);
+
+        auto& entry = entries[key];
+        entry.state = State::Running;
+        job         = std::move(entry.job);
+        entry.job   = nullptr;
+    }
+
+    MIOPEN_LOG_I2("Running " << key);
+    const auto start = clock();
+    auto state       = State::Done;
+    try
+    {
+        job();
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_W("Background tuning of " << key << " failed: " << ex.what());
+        state = State::Failed;
+    }
+    catch(...)
+    {
+        MIOPEN_LOG_W("Background tuning of " << key << " failed");
+        state = State::Failed;
+    }
+    const auto end = clock();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    Finish(key, state);
+    if(state == State::Done)
+        ++generation;
+
+    // Keep the share of the time spent in the jobs within the duty cycle.
+    const auto busy = std::chrono::duration<double, std::milli>(end - start);
+    next_run = end + std::chrono::duration_cast<Duration>(busy * (1.0 - options.duty_cycle) /
+                                                          options.duty_cycle);
+    if(queue.empty())
+        return std::nullopt;
+    return std::max(Duration{0}, next_run - end);
+}
+
+void BackgroundTuner::Finish(const std::string& key, State state)
+{
+    entries[key].state = state;
+    finished.push_back(key);
+
+    while(finished.size() > options.max_finished)
+    {
+        // The key may have been queued again after being dropped, or listed twice.
+        const auto it = entries.find(finished.front());
+        if(it != entries.end() && it->second.state != State::Queued &&
+           it->second.state != State::Running)
+            entries.erase(it);
+        finished.pop_front();
+    }
+}
+
+void BackgroundTuner::Start()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(worker.joinable())
+        return;
+    stop   = false;
+    cancel = false;
+    worker = std::thread{[this]() { WorkerLoop(); }};
+}
+
+void BackgroundTuner::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    wake_up.notify_all();
+    if(worker.joinable())
+        worker.join();
+}
+
+void BackgroundTuner::Shutdown()
+{
+    cancel = true;
+    Stop();
+}
+
+void BackgroundTuner::WorkerLoop()
+{
+    for(;;)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(stop)
+                return;
+        }
+        const auto delay = RunNext();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if(stop)
+            return;
+        if(!delay)
+            wake_up.wait(lock, [&]() { return stop || !queue.empty(); });
+        else if(delay->count() > 0)
+            wake_up.wait_for(lock, *delay, [&]() { return stop; });
+        if(stop)
+            return;
+    }
+}
+
+BackgroundTuner* BackgroundTuner::GetInstance()
+{
+    // Shut down by the exit handler rather than the static destructor, so the job in flight is
+    // cancelled and the worker is joined before the destruction of the objects it uses.
+    static auto* const instance = []() -> BackgroundTuner* {
+        if(!env::enabled(MIOPEN_ENABLE_BACKGROUND_TUNING))
+            return nullptr;
+
+        auto options         = Options{};
+        options.max_queued   = env::value(MIOPEN_BACKGROUND_TUNING_QUEUE_MAX);
+        options.max_wait     = Duration{env::value(MIOPEN_BACKGROUND_TUNING_WAIT_MS_MAX)};
+        options.duty_cycle   =
+            std::clamp<uint64_t>(env::value(MIOPEN_BACKGROUND_TUNING_DUTY_PERCENT), 1, 100) / 100.0;
+        options.max_finished = env::value(MIOPEN_BACKGROUND_TUNING_FINISHED_MAX);
+
+        auto tuner = std::make_unique<BackgroundTuner>(options);
+        tuner->Start();
+        std::atexit([]() { GetInstance()->Shutdown(); });
+        return tuner.release();
+    }();
+    return instance;
+}
+
+BackgroundTuner::Duration BackgroundTuner::SteadyClock()
+{
+    return std::chrono::duration_cast<Duration>(
+        std::chrono::steady_clock::now().time_since_epoch());
+}
+
+} // namespace miopen
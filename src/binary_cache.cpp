@@ -26,6 +26,7 @@
 
 #include <miopen/binary_cache.hpp>
 #include <miopen/handle.hpp>
+#include <miopen/kernel.hpp>
 #include <miopen/md5.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/env.hpp>
@@ -43,6 +44,8 @@
 #include <miopen/filesystem.hpp>
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <tuple>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DISABLE_CACHE)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_CUSTOM_CACHE_DIR)
@@ -143,6 +146,33 @@ KDb GetDb(const TargetProperties& target, size_t num_cu)
 }
 #endif
 
+void WarmUpBinaryCache(const TargetProperties& target, std::size_t num_cu)
+{
+    if(miopen::IsCacheDisabled())
+        return;
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    std::ignore = GetDb(target, num_cu);
+#else
+    std::ignore = target;
+    std::ignore = num_cu;
+    std::ignore = GetCachePath(false);
+#endif
+}
+
+/// In the user cache, the embedded HIP kernels are also keyed by the hash of their text and
+/// the headers they include, so the binaries built from other versions of the sources are
+/// never loaded. The installed kernel databases are built together with the library and keep
+/// the plain keys.
+static std::string GetUserCacheArgs(const fs::path& name, const std::string& args)
+{
+    const auto deps = GetKernelIncDeps(name);
+    if(deps == nullptr)
+        return args;
+    std::ostringstream ss;
+    ss << args << " #src:" << std::hex << deps->hash;
+    return ss.str();
+}
+
 fs::path GetCacheFile(const std::string& device, const fs::path& name, const std::string& args)
 {
     const auto filename = make_object_file_name(name);
@@ -161,10 +191,11 @@ std::vector<char> LoadBinary(const TargetProperties& target,
     auto db = GetDb(target, num_cu);
 
     const auto filename = make_object_file_name(name);
+    const KernelConfig user_cfg{filename, GetUserCacheArgs(name, args), {}};
     const KernelConfig cfg{filename, args, {}};
 
     MIOPEN_LOG_I2("Loading binary for: " << filename << "; args: " << args);
-    auto record = db.FindRecord(cfg);
+    auto record = db.FindRecordSplit(user_cfg, cfg);
     if(record)
     {
         MIOPEN_LOG_I2("Successfully loaded binary for: " << filename << "; args: " << args);
@@ -189,7 +220,7 @@ void SaveBinary(const std::vector<char>& hsaco,
     auto db = GetDb(target, num_cu);
 
     const auto filename = make_object_file_name(name);
-    KernelConfig cfg{filename, args, hsaco};
+    KernelConfig cfg{filename, GetUserCacheArgs(name, args), hsaco};
 
     MIOPEN_LOG_I2("Saving binary for: " << filename << "; args: " << args);
     db.StoreRecord(cfg);
@@ -204,7 +235,7 @@ fs::path LoadBinary(const TargetProperties& target,
         return {};
 
     (void)num_cu;
-    auto f = GetCacheFile(target.DbId(), name, args);
+    auto f = GetCacheFile(target.DbId(), name, GetUserCacheArgs(name, args));
     if(fs::exists(f))
     {
         return f;
@@ -227,7 +258,7 @@ fs::path SaveBinary(const fs::path& binary_path,
     }
     else
     {
-        auto p = GetCacheFile(target.DbId(), name, args);
+        auto p = GetCacheFile(target.DbId(), name, GetUserCacheArgs(name, args));
         fs::create_directories(p.parent_path());
         fs::rename(binary_path, p);
         return p;
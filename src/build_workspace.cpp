@@ -0,0 +1,214 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/build_workspace.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/kernel.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/process.hpp>
+#include <miopen/write_file.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_BUILD_WORKSPACE_DIR)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_TMPFS_BUILD_WORKSPACE)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_BUILD_WORKSPACE_TMPFS_MIN_MB, 512)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_SAVE_TEMP_DIR)
+
+namespace miopen {
+
+namespace {
+
+constexpr std::string_view workspace_prefix = "miopen-build-";
+constexpr std::string_view workspace_suffix = "-%%%%-%%%%-%%%%-%%%%";
+
+long GetPid()
+{
+#ifndef _WIN32
+    return static_cast<long>(getpid());
+#else
+    return 0;
+#endif
+}
+
+fs::path MakeUniqueDir(const fs::path& base)
+{
+    RemoveAbandonedBuildWorkspaces(base);
+    // The owner is a part of the name, so the workspace can be removed by the others once the
+    // owner is killed.
+    const auto name = std::string{workspace_prefix} + std::to_string(GetPid()) +
+                      std::string{workspace_suffix};
+    auto path = base / boost::filesystem::unique_path(name).string();
+    fs::create_directories(path);
+    return path;
+}
+
+struct Workspace
+{
+    fs::path path;
+#ifndef _WIN32
+    pid_t owner = getpid();
+#endif
+
+    explicit Workspace(const fs::path& base)
+    {
+        try
+        {
+            path = MakeUniqueDir(base);
+        }
+        catch(const fs::filesystem_error& ex)
+        {
+            // tmpfs may be full or not writable, fall back to the regular temporary directory.
+            if(base == fs::temp_directory_path())
+                throw;
+            MIOPEN_LOG_W("Unable to use " << base << " for builds: " << ex.what());
+            path = MakeUniqueDir(fs::temp_directory_path());
+        }
+        MIOPEN_LOG_I2(path);
+    }
+
+    Workspace(const Workspace&) = delete;
+    Workspace& operator=(const Workspace&) = delete;
+
+    ~Workspace()
+    {
+        if(env::enabled(MIOPEN_DEBUG_SAVE_TEMP_DIR))
+            return;
+#ifndef _WIN32
+        // Forked children share the object but must not remove the parent's files.
+        if(owner != getpid())
+            return;
+#endif
+        auto ec = std::error_code{};
+        fs::remove_all(path, ec);
+    }
+};
+
+} // namespace
+
+std::size_t RemoveAbandonedBuildWorkspaces(const fs::path& base)
+{
+    auto removed = std::size_t{0};
+    auto ec      = std::error_code{};
+    for(auto it = fs::directory_iterator{base, ec}; !ec && it != fs::directory_iterator{};
+        it.increment(ec))
+    {
+        const auto name = it->path().filename().string();
+        if(name.compare(0, workspace_prefix.size(), workspace_prefix) != 0)
+            continue;
+
+        // The owner of the workspaces named without the pid is unknown, these are kept.
+        const auto* const pid_begin = name.c_str() + workspace_prefix.size();
+        char* pid_end               = nullptr;
+        const auto pid              = std::strtol(pid_begin, &pid_end, 10);
+        if(pid <= 0 || pid_end == pid_begin ||
+           std::string_view{pid_end}.size() != workspace_suffix.size() || *pid_end != '-' ||
+           pid == GetPid() || IsProcessAlive(pid))
+            continue;
+
+        auto remove_ec = std::error_code{};
+        fs::remove_all(it->path(), remove_ec);
+        if(remove_ec)
+            continue;
+        MIOPEN_LOG_I2("Removed " << it->path() << " of process " << pid);
+        ++removed;
+    }
+    return removed;
+}
+
+fs::path GetBuildWorkspaceBase()
+{
+    const auto& custom = env::value(MIOPEN_BUILD_WORKSPACE_DIR);
+    if(!custom.empty())
+        return custom;
+
+#ifndef _WIN32
+    if(!env::enabled(MIOPEN_DEBUG_DISABLE_TMPFS_BUILD_WORKSPACE))
+    {
+        const auto shm = fs::path{"/dev/shm"};
+        auto ec        = std::error_code{};
+        if(fs::is_directory(shm, ec) && access(shm.c_str(), W_OK | X_OK) == 0)
+        {
+            // tmpfs is shared with other processes and is often small, the builds would fail
+            // with ENOSPC when it is nearly full.
+            const auto space    = fs::space(shm, ec);
+            const auto required = env::value(MIOPEN_BUILD_WORKSPACE_TMPFS_MIN_MB) * 1024 * 1024;
+            if(!ec && space.available >= required)
+                return shm;
+            MIOPEN_LOG_I2("Not enough space in " << shm << " for builds");
+        }
+    }
+#endif
+
+    return fs::temp_directory_path();
+}
+
+const fs::path& GetBuildWorkspace()
+{
+    static const Workspace workspace{GetBuildWorkspaceBase()};
+    return workspace.path;
+}
+
+void WriteKernelIncludes(const fs::path& dir)
+{
+    fs::create_directories(dir);
+    for(const auto& inc_file : GetKernelIncList())
+        WriteFile(GetKernelInc(inc_file), dir / inc_file.get());
+}
+
+const fs::path& GetKernelIncludeDir()
+{
+    static const auto dir = []() -> fs::path {
+        const auto path = GetBuildWorkspace() / "include";
+        try
+        {
+            WriteKernelIncludes(path);
+            return path;
+        }
+        catch(const std::exception& ex)
+        {
+            // tmpfs may still run out of space, fall back to the regular temporary directory.
+            if(GetBuildWorkspace().parent_path() == fs::temp_directory_path())
+                throw;
+            MIOPEN_LOG_W("Unable to write the kernel includes to " << path << ": " << ex.what());
+        }
+        static const Workspace fallback{fs::temp_directory_path()};
+        WriteKernelIncludes(fallback.path / "include");
+        return fallback.path / "include";
+    }();
+    return dir;
+}
+
+} // namespace miopen
@@ -28,9 +28,12 @@
 #include <miopen/env.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/numerics_stats.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/datatype.hpp>
 
+#include <sstream>
+
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_CHECK_NUMERICS)
 
 namespace miopen {
@@ -70,9 +73,47 @@ std::string GetKernelName(miopenDataType_t data_type)
     }
 }
 
+namespace {
+
+// Copies the tensor to the host on the sampled checks and accumulates its statistics.
+// Returns true if an abnormal value is found.
+bool CollectNumericsStats(const Handle& handle,
+                          const TensorDescriptor& dDesc,
+                          ConstData_t data,
+                          bool isInput)
+{
+    std::ostringstream key;
+    key << (isInput ? "INPUT " : "OUTPUT ") << dDesc;
+
+    auto& monitor = NumericsMonitor::GetInstance();
+    if(!monitor.Sample(key.str()))
+        return false;
+
+    std::vector<char> host(dDesc.GetNumBytes());
+    handle.ReadTo(host.data(), data, host.size());
+    const auto stats =
+        ComputeNumericsStats(dDesc.GetType(), dDesc.GetLengths(), dDesc.GetStrides(), host.data());
+    monitor.Record(key.str(), stats);
+
+    if(stats.HasAbnormal())
+        MIOPEN_LOG_W(key.str() << " ptr=" << data << " " << stats);
+    return stats.HasAbnormal();
+}
+
+} // namespace
+
 bool checkNumericsImpl(
     const Handle& handle, int mode, const TensorDescriptor& dDesc, ConstData_t data, bool isInput)
 {
+    bool isAbnormalOnHost = false;
+    if((mode & CheckNumerics::Histograms) != 0)
+    {
+        isAbnormalOnHost = CollectNumericsStats(handle, dDesc, data, isInput);
+        // Only the sampled host statistics are requested, skip the kernel.
+        if((mode & ~CheckNumerics::Histograms) == 0)
+            return isAbnormalOnHost;
+    }
+
     int numElements = dDesc.GetElementSize();
     CheckNumericsResult abnormal_h;
     auto abnormal_d =
@@ -92,7 +133,7 @@ bool checkNumericsImpl(
 
     handle.ReadTo(&abnormal_h, abnormal_d, sizeof(CheckNumericsResult));
 
-    bool isAbnormal = (abnormal_h.hasNan != 0) || (abnormal_h.hasInf != 0);
+    bool isAbnormal = (abnormal_h.hasNan != 0) || (abnormal_h.hasInf != 0) || isAbnormalOnHost;
 
     if(((mode & CheckNumerics::Info) != 0) || (((mode & CheckNumerics::Warn) != 0) && isAbnormal))
     {
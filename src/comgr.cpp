@@ -36,6 +36,7 @@
 #include <miopen/logger.hpp>
 #include <miopen/solver/implicitgemm_util.hpp>
 #include <miopen/stringutils.hpp>
+#include <miopen/timer.hpp>
 
 #include <amd_comgr/amd_comgr.h>
 #include <hip/hip_runtime_api.h>
@@ -70,6 +71,9 @@ MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_COMGR_LOG_OPTIONS)
 /// you would like to log onto console.
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_COMGR_LOG_SOURCE_TEXT)
 
+/// Passes all the embedded headers to hiprtc instead of the ones the kernel depends on.
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_COMGR_HIP_ALL_INCLUDES)
+
 /// \todo see issue #1222, PR #1316
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_SRAM_EDC_DISABLED)
 
@@ -859,17 +863,33 @@ public:
         // of the addkernels tool. We don't do that for HIP sources, and, therefore
         // have to export include files prior compilation.
         // Note that we do not need any "subdirs" in the include "pathnames" so far.
-        const auto inc_names = miopen::GetKernelIncList();
-        include_names.reserve(inc_names.size());
-        for(const auto& inc_name : inc_names)
-        {
+        CompileTimer ct;
+        const auto add_include = [&](const fs::path& inc_name) {
             const auto inc_text = GetKernelInc(inc_name);
             LogInputFile(inc_name, inc_text);
-            include_names.push_back(inc_name.get().string());
+            include_names.push_back(inc_name.string());
             include_texts.push_back(inc_text);
+        };
+        // The embedded kernels get only the headers they depend on. Registering all the headers
+        // makes hiprtc process the whole include set for every kernel.
+        const auto deps = GetEmbeddedKernelIncDeps();
+        if(deps != nullptr)
+        {
+            include_names.reserve(deps->includes.size());
+            for(const auto& inc_name : deps->includes)
+                add_include(inc_name);
+        }
+        else
+        {
+            const auto inc_names = miopen::GetKernelIncList();
+            include_names.reserve(inc_names.size());
+            for(const auto& inc_name : inc_names)
+                add_include(inc_name);
         }
         prog = CreateProgram(
             src_text, src_name, include_texts.size(), include_texts.data(), include_names.data());
+        ct.Log("HIPRTC setup",
+               std::string{src_name} + ", " + std::to_string(include_names.size()) + " headers");
     }
 
     void Compile(const std::vector<std::string>& options)
@@ -881,10 +901,12 @@ public:
                        [](const std::string& s) { return s.c_str(); });
         comgr::LogOptions(c_options.data(), c_options.size());
 
+        CompileTimer ct;
         HIPRTC_CALL_INFO_THROW_MSG(
             hiprtcCompileProgram(prog.get(), c_options.size(), c_options.data()),
             src_name,
             GetLog(true));
+        ct.Log("HIPRTC", std::string{src_name});
         const auto log = GetLog(false);
         if(!log.empty())
             MIOPEN_LOG_I(log);
@@ -899,6 +921,17 @@ public:
     }
 
 private:
+    const KernelIncDeps* GetEmbeddedKernelIncDeps() const
+    {
+        if(env::enabled(MIOPEN_DEBUG_COMGR_HIP_ALL_INCLUDES))
+            return nullptr;
+        const auto deps = GetKernelIncDeps(src_name);
+        // Sources provided by the solvers may reuse the names of the embedded kernels.
+        if(deps == nullptr || src_text != GetKernelSrc(src_name))
+            return nullptr;
+        return deps;
+    }
+
     void LogInputFile(const fs::path& name, std::string_view content)
     {
         if(env::enabled(MIOPEN_DEBUG_COMGR_LOG_SOURCE_NAMES))
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/background_tuning.hpp>
+
+#include <miopen/background_tuner.hpp>
+#include <miopen/conv/data_invoke_params.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/solver_finders.hpp>
+#include <miopen/conv/tensors.hpp>
+#include <miopen/conv/wrw_invoke_params.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tuning_cancel.hpp>
+
+#include <memory>
+#include <sstream>
+#include <type_traits>
+
+namespace miopen {
+namespace conv {
+
+namespace {
+
+#if MIOPEN_BACKEND_HIP
+using StreamPtr = std::unique_ptr<std::remove_pointer_t<hipStream_t>, decltype(&hipStreamDestroy)>;
+
+/// The tuning must not delay the work submitted by the application.
+StreamPtr CreateLowPriorityStream(int device)
+{
+    if(hipSetDevice(device) != hipSuccess)
+        MIOPEN_THROW("Unable to set device " + std::to_string(device));
+
+    int least_priority    = 0;
+    int greatest_priority = 0;
+    if(hipDeviceGetStreamPriorityRange(&least_priority, &greatest_priority) != hipSuccess)
+        MIOPEN_THROW("Unable to get stream priority range");
+
+    hipStream_t stream = nullptr;
+    if(hipStreamCreateWithPriority(&stream, hipStreamNonBlocking, least_priority) != hipSuccess)
+        MIOPEN_THROW("Unable to create stream");
+    return {stream, &hipStreamDestroy};
+}
+
+void Tune(int device, const ProblemDescription& problem)
+{
+    const auto stream = CreateLowPriorityStream(device);
+    auto handle       = Handle{stream.get()};
+
+    auto ctx = ExecutionContext{&handle};
+    problem.SetupFloats(ctx);
+    ctx.do_search = true;
+
+    const auto& conv          = problem.GetConv();
+    const auto workspace_size = conv.GetWorkSpaceSize(ctx, problem);
+
+    // Contents of the buffers do not matter for benchmarking.
+    const auto in        = handle.Create(problem.GetIn().GetNumBytes());
+    const auto w         = handle.Create(problem.GetWeights().GetNumBytes());
+    const auto out       = handle.Create(problem.GetOut().GetNumBytes());
+    const auto workspace = handle.Create(workspace_size);
+
+    const auto& in_desc  = problem.GetIn();
+    const auto& w_desc   = problem.GetWeights();
+    const auto& out_desc = problem.GetOut();
+
+    const auto data = ConvDataTensors{in_desc, in.get(), w_desc, w.get(), out_desc, out.get()};
+    const auto wrw  = ConvWrwTensors{in_desc, in.get(), out_desc, out.get(), w_desc, w.get()};
+
+    const auto& fp16alt = conv.attribute.gfx90aFp16alt;
+
+    const auto invoke_ctx = [&]() -> AnyInvokeParams {
+        switch(problem.GetDirection())
+        {
+        case Direction::Forward:
+            return DataInvokeParams{data, workspace.get(), workspace_size, fp16alt.GetFwd()};
+        case Direction::BackwardData:
+            return DataInvokeParams{data, workspace.get(), workspace_size, fp16alt.GetBwd()};
+        case Direction::BackwardWeights:
+            return WrWInvokeParams{wrw, workspace.get(), workspace_size, fp16alt.GetWrW()};
+        }
+        MIOPEN_THROW(miopenStatusInternalError);
+    }();
+
+    UserFindDbRecord::TryLoad(handle, problem, [&]() {
+        const auto params = ConvFindParameters{conv.IsWinograd3x3SupportedAndFast(ctx, problem)};
+        return FindCore(invoke_ctx, ctx, problem, params, GetConvSolverFinders());
+    });
+}
+#endif
+
+} // namespace
+
+std::string MakeBackgroundTuningKey(const ExecutionContext& ctx, const ProblemDescription& problem)
+{
+    std::ostringstream ss;
+    ss << ctx.GetStream().GetDbBasename() << ':' << problem;
+    return ss.str();
+}
+
+void RequestBackgroundTuning(const ExecutionContext& ctx, const ProblemDescription& problem)
+{
+#if MIOPEN_BACKEND_HIP
+    auto* const tuner = BackgroundTuner::GetInstance();
+    if(tuner == nullptr)
+        return;
+
+    int device = 0;
+    if(hipGetDevice(&device) != hipSuccess)
+        return;
+
+    tuner->Enqueue(MakeBackgroundTuningKey(ctx, problem), [tuner, device, problem]() {
+        const solver::TuningCancelScope cancel{tuner->GetCancelFlag()};
+        Tune(device, problem);
+    });
+#else
+    std::ignore = ctx;
+    std::ignore = problem;
+#endif
+}
+
+} // namespace conv
+} // namespace miopen
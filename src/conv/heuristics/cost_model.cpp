@@ -0,0 +1,635 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/heuristics/cost_model.hpp>
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/transform_plan.hpp>
+#include <miopen/datatype.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DEBUG_CONV_COST_MODEL_COEFFS_PATH)
+
+namespace miopen {
+namespace conv {
+namespace cost_model {
+
+namespace {
+
+constexpr std::array<const char*, SolverFamilyCount> family_names = {
+    "Direct", "Asm1x1", "Asm3x3", "Winograd", "ImplicitGemm", "Gemm", "Fft", "Unknown"};
+
+/// Defaults are rough averages over find-db records of gfx90a and gfx942.
+/// Use Calibrate() to obtain coefficients for a particular system.
+constexpr std::array<FamilyCoefficients, SolverFamilyCount> default_coefficients = {{
+    {0.12, 0.40, 0.010}, // Direct
+    {0.45, 0.70, 0.008}, // Asm1x1
+    {0.40, 0.60, 0.008}, // Asm3x3
+    {0.40, 0.60, 0.010}, // Winograd
+    {0.45, 0.65, 0.010}, // ImplicitGemm
+    {0.50, 0.70, 0.015}, // Gemm
+    {0.30, 0.60, 0.050}, // Fft
+    {0.10, 0.30, 0.010}, // Unknown
+}};
+
+struct ArchInfo
+{
+    const char* prefix;
+    std::size_t ref_cu;
+    double clock_ghz;
+    double fp32_flops_per_cu_clk;
+    double matrix_fp16_multiplier;
+    double bandwidth_gbps;
+};
+
+// clang-format off
+/// Reference products are used to get clocks and bandwidth. Bandwidth is scaled
+/// by the ratio of actual and reference CU counts to handle partitioned devices.
+constexpr std::array<ArchInfo, 8> arch_table = {{
+    {"gfx900",  64, 1.50, 128, 2, 484},  // MI25
+    {"gfx906",  60, 1.75, 128, 2, 1024}, // MI50
+    {"gfx908", 120, 1.50, 128, 8, 1228}, // MI100
+    {"gfx90a", 110, 1.70, 256, 8, 1638}, // MI250 (single GCD)
+    {"gfx94",  304, 2.10, 256, 8, 5300}, // MI300X
+    {"gfx103",  80, 2.25, 128, 2, 512},  // RX 6900 XT
+    {"gfx110",  96, 2.50, 256, 2, 960},  // RX 7900 XTX
+    {"gfx115",  16, 2.90, 256, 2, 120},  // APU
+}};
+// clang-format on
+
+std::size_t Product(const std::array<std::size_t, 3>& v) { return v[0] * v[1] * v[2]; }
+
+bool IsMatrixCoreSolverName(const std::string& name)
+{
+    return name.find("Xdlops") != std::string::npos || name.find("xdlops") != std::string::npos ||
+           name.find("Wmma") != std::string::npos || name.find("WMMA") != std::string::npos;
+}
+
+} // namespace
+
+const char* ToString(SolverFamily family)
+{
+    return family_names[static_cast<std::size_t>(family)];
+}
+
+SolverFamily SolverFamilyFromString(const std::string& str)
+{
+    for(std::size_t i = 0; i < family_names.size(); ++i)
+    {
+        if(str == family_names[i])
+            return static_cast<SolverFamily>(i);
+    }
+    return SolverFamily::Unknown;
+}
+
+SolverFamily GetSolverFamily(const std::string& solver_name, miopenConvAlgorithm_t algo)
+{
+    switch(algo)
+    {
+    case miopenConvolutionAlgoGEMM: return SolverFamily::Gemm;
+    case miopenConvolutionAlgoFFT: return SolverFamily::Fft;
+    case miopenConvolutionAlgoWinograd: return SolverFamily::Winograd;
+    case miopenConvolutionAlgoImplicitGEMM: return SolverFamily::ImplicitGemm;
+    case miopenConvolutionAlgoDirect:
+        if(StartsWith(solver_name, "ConvAsm1x1U") || solver_name == "ConvAsmBwdWrW1x1")
+            return SolverFamily::Asm1x1;
+        if(solver_name == "ConvAsm3x3U" || solver_name == "ConvAsmBwdWrW3x3")
+            return SolverFamily::Asm3x3;
+        return SolverFamily::Direct;
+    }
+    return SolverFamily::Unknown;
+}
+
+SolverFamily GetSolverFamily(const solver::Id& id)
+{
+    if(!id.IsValid() || id.GetPrimitive() != solver::Primitive::Convolution)
+        return SolverFamily::Unknown;
+    return GetSolverFamily(id.ToString(), id.GetAlgo());
+}
+
+double DeviceCaps::PeakGflops(miopenDataType_t type, bool matrix_cores) const
+{
+    const auto fp32 = static_cast<double>(num_cu) * clock_ghz * fp32_flops_per_cu_clk;
+    switch(type)
+    {
+    case miopenHalf:
+    case miopenBFloat16: return matrix_cores ? fp32 * matrix_fp16_multiplier : fp32 * 2;
+    case miopenFloat8:
+    case miopenBFloat8:
+    case miopenInt8: return matrix_cores ? fp32 * matrix_fp16_multiplier * 2 : fp32 * 2;
+    case miopenDouble: return fp32 / 2;
+    case miopenFloat:
+    case miopenInt32:
+    case miopenInt64: break;
+    }
+    // Matrix cores do not help fp32 much on the supported devices except for the
+    // reduced amount of register traffic.
+    return fp32;
+}
+
+DeviceCaps DeviceCaps::FromName(const std::string& name, std::size_t num_cu)
+{
+    auto caps = DeviceCaps{};
+    if(num_cu == 0)
+        num_cu = caps.num_cu;
+
+    const auto arch = std::find_if(arch_table.begin(), arch_table.end(), [&](const auto& info) {
+        return StartsWith(name, info.prefix);
+    });
+
+    if(arch == arch_table.end())
+    {
+        caps.bandwidth_gbps *= static_cast<double>(num_cu) / static_cast<double>(caps.num_cu);
+        caps.num_cu = num_cu;
+        return caps;
+    }
+
+    caps.num_cu                 = num_cu;
+    caps.clock_ghz              = arch->clock_ghz;
+    caps.fp32_flops_per_cu_clk  = arch->fp32_flops_per_cu_clk;
+    caps.matrix_fp16_multiplier = arch->matrix_fp16_multiplier;
+    caps.bandwidth_gbps =
+        arch->bandwidth_gbps * static_cast<double>(num_cu) / static_cast<double>(arch->ref_cu);
+    return caps;
+}
+
+DeviceCaps DeviceCaps::FromContext(const ExecutionContext& ctx)
+{
+    return FromName(ctx.GetStream().GetDeviceName(), ctx.GetStream().GetMaxComputeUnits());
+}
+
+ConvShape ConvShape::From(const ProblemDescription& problem)
+{
+    // In the problem description, "in" and "out" are swapped for the backward
+    // directions. The model always works with the forward convolution.
+    const auto fwd = problem.IsDirectionForward();
+
+    auto shape  = ConvShape{};
+    shape.n     = problem.GetBatchSize();
+    shape.c     = fwd ? problem.GetInChannels() : problem.GetOutChannels();
+    shape.k     = fwd ? problem.GetOutChannels() : problem.GetInChannels();
+    shape.group = std::max(problem.GetGroupCount(), 1);
+    shape.type  = problem.GetInDataType();
+
+    shape.in_spatial = fwd ? std::array<std::size_t, 3>{problem.GetInDepth(),
+                                                        problem.GetInHeight(),
+                                                        problem.GetInWidth()}
+                           : std::array<std::size_t, 3>{problem.GetOutDepth(),
+                                                        problem.GetOutHeight(),
+                                                        problem.GetOutWidth()};
+    shape.out_spatial = fwd ? std::array<std::size_t, 3>{problem.GetOutDepth(),
+                                                         problem.GetOutHeight(),
+                                                         problem.GetOutWidth()}
+                            : std::array<std::size_t, 3>{problem.GetInDepth(),
+                                                         problem.GetInHeight(),
+                                                         problem.GetInWidth()};
+    shape.filter = {problem.GetWeightsDepth(),
+                    problem.GetWeightsHeight(),
+                    problem.GetWeightsWidth()};
+    shape.stride = {static_cast<std::size_t>(std::max(problem.GetKernelStrideD(), 1)),
+                    static_cast<std::size_t>(std::max(problem.GetKernelStrideH(), 1)),
+                    static_cast<std::size_t>(std::max(problem.GetKernelStrideW(), 1))};
+    return shape;
+}
+
+bool ConvShape::FromDbKey(const std::string& key, ConvShape& shape)
+{
+    auto problem_part = key;
+    auto group        = std::size_t{1};
+
+    const auto options = SplitDelim(key, '_');
+    if(options.empty())
+        return false;
+    problem_part = options[0];
+    for(std::size_t i = 1; i < options.size(); ++i)
+    {
+        if(StartsWith(options[i], "g"))
+            group = std::strtoull(options[i].c_str() + 1, nullptr, 10);
+    }
+
+    const auto attrs = SplitDelim(problem_part, '-');
+    // 2D keys have 15 (17 with per-tensor layouts) fields, 3D keys have 17 (19).
+    const auto is_3d = attrs.size() > 4 && SplitDelim(attrs[4], 'x').size() == 3;
+    const auto dims  = is_3d ? 3 : 2;
+
+    if(!(attrs.size() == 15 || attrs.size() == 17 || (is_3d && attrs.size() == 19)))
+        return false;
+
+    const auto to_size = [](const std::string& s, std::size_t& v) {
+        char* end = nullptr;
+        v         = std::strtoull(s.c_str(), &end, 10);
+        return end != s.c_str() && *end == '\0';
+    };
+
+    const auto to_vec = [&](const std::string& s, std::array<std::size_t, 3>& v) {
+        const auto parts = SplitDelim(s, 'x');
+        if(parts.size() != static_cast<std::size_t>(dims))
+            return false;
+        v = {1, 1, 1};
+        for(std::size_t i = 0; i < parts.size(); ++i)
+        {
+            if(!to_size(parts[i], v[3 - parts.size() + i]))
+                return false;
+        }
+        return true;
+    };
+
+    auto result = ConvShape{};
+    auto ok     = true;
+    auto idx    = std::size_t{0};
+
+    ok = ok && to_size(attrs[idx++], result.c);
+    for(auto d = 3 - dims; d < 3; ++d)
+        ok = ok && to_size(attrs[idx++], result.in_spatial[d]);
+    ok = ok && to_vec(attrs[idx++], result.filter);
+    ok = ok && to_size(attrs[idx++], result.k);
+    for(auto d = 3 - dims; d < 3; ++d)
+        ok = ok && to_size(attrs[idx++], result.out_spatial[d]);
+    ok = ok && to_size(attrs[idx++], result.n);
+    auto pads = std::array<std::size_t, 3>{};
+    ok        = ok && to_vec(attrs[idx++], pads);
+    ok        = ok && to_vec(attrs[idx++], result.stride);
+    if(!ok)
+        return false;
+
+    const auto& precision = attrs[attrs.size() - 2];
+    const auto& direction = attrs[attrs.size() - 1];
+
+    if(precision == "FP32")
+        result.type = miopenFloat;
+    else if(precision == "FP16")
+        result.type = miopenHalf;
+    else if(precision == "BF16")
+        result.type = miopenBFloat16;
+    else if(precision == "INT8")
+        result.type = miopenInt8;
+    else if(precision == "FP64")
+        result.type = miopenDouble;
+    else if(StartsWith(precision, "FP8") || StartsWith(precision, "BF8"))
+        result.type = miopenFloat8;
+    else
+        return false;
+
+    // Keys store "in" and "out" of the problem description, which are swapped for the
+    // backward directions.
+    if(direction == "B" || direction == "W")
+    {
+        std::swap(result.c, result.k);
+        std::swap(result.in_spatial, result.out_spatial);
+    }
+    else if(direction != "F")
+        return false;
+
+    result.group = std::max<std::size_t>(group, 1);
+    shape        = result;
+    return true;
+}
+
+std::size_t ConvShape::FilterSize() const { return Product(filter); }
+std::size_t ConvShape::InSpatialSize() const { return Product(in_spatial); }
+std::size_t ConvShape::OutSpatialSize() const { return Product(out_spatial); }
+
+double ConvShape::DirectFlops() const
+{
+    return 2.0 * static_cast<double>(n) * static_cast<double>(k) *
+           static_cast<double>(c / std::max<std::size_t>(group, 1)) *
+           static_cast<double>(OutSpatialSize()) * static_cast<double>(FilterSize());
+}
+
+double ConvShape::MinBytes() const
+{
+    const auto elem = static_cast<double>(GetTypeSize(type));
+    const auto in   = static_cast<double>(n * c * InSpatialSize());
+    const auto wei  = static_cast<double>(k * (c / std::max<std::size_t>(group, 1)) * FilterSize());
+    const auto out  = static_cast<double>(n * k * OutSpatialSize());
+    return elem * (in + wei + out);
+}
+
+FamilyWork GetFamilyWork(SolverFamily family, const ConvShape& shape)
+{
+    auto work  = FamilyWork{};
+    work.flops = shape.DirectFlops();
+    work.bytes = shape.MinBytes();
+
+    const auto elem         = static_cast<double>(GetTypeSize(shape.type));
+    const auto unit_strides = shape.stride[0] == 1 && shape.stride[1] == 1 && shape.stride[2] == 1;
+    const auto valid_groups =
+        shape.group > 0 && shape.c % shape.group == 0 && shape.k % shape.group == 0;
+    const auto is_2d = shape.in_spatial[0] == 1 && shape.filter[0] == 1 && valid_groups;
+    // The shape has no padding, assume the one keeping the spatial size.
+    const auto same_pad_h = static_cast<int>(shape.filter[1] - 1) / 2;
+    const auto same_pad_w = static_cast<int>(shape.filter[2] - 1) / 2;
+
+    switch(family)
+    {
+    case SolverFamily::Winograd: {
+        // F(m, r) computes an m x m output tile with (m + r - 1)^2 multiplications
+        // instead of (m * r)^2. The solvers use m = 2..6; F(2,3) is the common case.
+        // Non-3x3 filters are split into 3x3 blocks, strided filters are decomposed.
+        if(is_2d)
+        {
+            const auto plan = WinogradPlan::Make(
+                WinogradScheme::Fused, shape, 2, 3, 2, 3, same_pad_h, same_pad_w);
+            work.flops = plan.GetFlops();
+        }
+        else
+        {
+            const auto m            = 2.0;
+            const auto r            = 3.0;
+            const auto tile_gain    = (m * r) * (m * r) / ((m + r - 1) * (m + r - 1));
+            const auto filter_2d    = static_cast<double>(shape.filter[1] * shape.filter[2]);
+            const auto blocks       = std::ceil(static_cast<double>(shape.filter[1]) / r) *
+                                std::ceil(static_cast<double>(shape.filter[2]) / r);
+            const auto padding_loss = filter_2d / (blocks * r * r);
+            const auto stride_loss  = unit_strides ? 1.0 : 0.5;
+            work.flops /= std::max(1.0, tile_gain * padding_loss * stride_loss);
+        }
+        // Transformed data usually goes through L2, count one additional pass over
+        // input and output.
+        work.bytes += elem * static_cast<double>(shape.n) *
+                      static_cast<double>(shape.c * shape.InSpatialSize() +
+                                          shape.k * shape.OutSpatialSize());
+        break;
+    }
+    case SolverFamily::Fft: {
+        // Forward FFT of input and filters, pointwise complex products, inverse FFT
+        // of the output. When the tiles of the solver fit, the plan gives exact counts.
+        if(is_2d && shape.group == 1 && unit_strides)
+        {
+            const auto plan = FftPlan::Make(shape, same_pad_h, same_pad_w);
+            if(plan.IsSupported())
+            {
+                work.flops = plan.GetFlops();
+                // The workspace is written and read back.
+                work.bytes += 2.0 * static_cast<double>(plan.GetWorkspaceSize());
+                break;
+            }
+        }
+        // Otherwise transforms are padded to the input size.
+        const auto p       = static_cast<double>(shape.InSpatialSize());
+        const auto log_p   = std::log2(std::max(p, 2.0));
+        const auto ngroups = static_cast<double>(std::max<std::size_t>(shape.group, 1));
+        const auto n       = static_cast<double>(shape.n);
+        const auto c       = static_cast<double>(shape.c);
+        const auto k       = static_cast<double>(shape.k);
+        const auto fft     = 5.0 * p * log_p;
+
+        work.flops = fft * (n * c + c * k / ngroups + n * k) + 8.0 * n * c * k * p / ngroups;
+        // Complex workspace for all three tensors is written and read back.
+        work.bytes += 2.0 * 2.0 * 4.0 * p * (n * c + c * k / ngroups + n * k);
+        break;
+    }
+    case SolverFamily::Gemm:
+        work.matrix_cores = true;
+        // Im2Col (or Col2Im) buffer is written and read unless the filter is 1x1
+        // with unit strides.
+        if(!(shape.FilterSize() == 1 && unit_strides))
+        {
+            work.bytes += 2.0 * elem * static_cast<double>(shape.n) *
+                          static_cast<double>(shape.c * shape.FilterSize()) *
+                          static_cast<double>(shape.OutSpatialSize());
+        }
+        break;
+    case SolverFamily::ImplicitGemm: work.matrix_cores = true; break;
+    case SolverFamily::Direct:
+    case SolverFamily::Asm1x1:
+    case SolverFamily::Asm3x3:
+    case SolverFamily::Unknown: break;
+    }
+    return work;
+}
+
+CostModel::CostModel()
+{
+    std::copy(default_coefficients.begin(), default_coefficients.end(), coefficients.begin());
+}
+
+const FamilyCoefficients& CostModel::Get(SolverFamily family) const
+{
+    return coefficients[static_cast<std::size_t>(family)];
+}
+
+void CostModel::Set(SolverFamily family, const FamilyCoefficients& coeffs)
+{
+    coefficients[static_cast<std::size_t>(family)] = coeffs;
+}
+
+float CostModel::Estimate(const DeviceCaps& device,
+                          const ConvShape& shape,
+                          SolverFamily family,
+                          float wti) const
+{
+    const auto& coeffs = Get(family);
+    const auto work    = GetFamilyWork(family, shape);
+
+    double compute_ms = 0.0;
+    if(wti > 0.0f)
+    {
+        // WTI is relative to the Direct algorithm running at peak vector throughput.
+        compute_ms = shape.DirectFlops() / (device.PeakGflops(shape.type, false) * 1e6) /
+                     static_cast<double>(wti);
+    }
+    else
+    {
+        const auto peak = device.PeakGflops(shape.type, work.matrix_cores);
+        compute_ms      = work.flops / (peak * 1e6 * coeffs.compute_efficiency);
+    }
+
+    const auto memory_ms = work.bytes / (device.bandwidth_gbps * 1e6 * coeffs.memory_efficiency);
+
+    return static_cast<float>(coeffs.launch_overhead_ms + std::max(compute_ms, memory_ms));
+}
+
+float CostModel::EstimateFallback(const DeviceCaps& device,
+                                  const ConvShape& shape,
+                                  SolverFamily family,
+                                  float wti) const
+{
+    if(wti < 0.0f && !calibrated)
+        return -1.0f;
+    return Estimate(device, shape, family, wti);
+}
+
+bool CostModel::Load(std::istream& stream)
+{
+    auto line = std::string{};
+    while(std::getline(stream, line))
+    {
+        if(line.empty() || line[0] == '#')
+            continue;
+
+        const auto eq = line.find('=');
+        if(eq == std::string::npos)
+            return false;
+
+        const auto family = SolverFamilyFromString(line.substr(0, eq));
+        auto values       = std::istringstream{line.substr(eq + 1)};
+        auto coeffs       = FamilyCoefficients{};
+        char sep1 = 0, sep2 = 0;
+        values >> coeffs.compute_efficiency >> sep1 >> coeffs.memory_efficiency >> sep2 >>
+            coeffs.launch_overhead_ms;
+        if(values.fail() || sep1 != ',' || sep2 != ',')
+            return false;
+        if(!(coeffs.compute_efficiency > 0.0) || !(coeffs.memory_efficiency > 0.0) ||
+           coeffs.launch_overhead_ms < 0.0)
+            return false;
+        Set(family, coeffs);
+    }
+    calibrated = true;
+    return true;
+}
+
+void CostModel::Save(std::ostream& stream) const
+{
+    stream << "# family=compute_efficiency,memory_efficiency,launch_overhead_ms" << std::endl;
+    for(std::size_t i = 0; i < SolverFamilyCount; ++i)
+    {
+        const auto& c = coefficients[i];
+        stream << family_names[i] << '=' << c.compute_efficiency << ',' << c.memory_efficiency
+               << ',' << c.launch_overhead_ms << std::endl;
+    }
+}
+
+const CostModel& CostModel::GetDefault()
+{
+    static const CostModel instance = [] {
+        auto model      = CostModel{};
+        const auto path = env::value(MIOPEN_DEBUG_CONV_COST_MODEL_COEFFS_PATH);
+        if(path.empty())
+            return model;
+        auto file = std::ifstream{path};
+        if(!file)
+        {
+            MIOPEN_LOG_W("Unable to open cost model coefficients file: " << path);
+            return model;
+        }
+        auto loaded = model;
+        if(!loaded.Load(file))
+        {
+            MIOPEN_LOG_W("Ill-formed cost model coefficients file: " << path);
+            return model;
+        }
+        MIOPEN_LOG_I("Cost model coefficients loaded from " << path);
+        return loaded;
+    }();
+    return instance;
+}
+
+CostModel Calibrate(const DeviceCaps& device,
+                    const std::vector<CalibrationSample>& samples,
+                    const CostModel& initial)
+{
+    auto model = initial;
+
+    for(std::size_t f = 0; f < SolverFamilyCount; ++f)
+    {
+        const auto family = static_cast<SolverFamily>(f);
+        auto coeffs       = initial.Get(family);
+
+        auto launch      = std::numeric_limits<double>::max();
+        auto has_samples = false;
+        for(const auto& s : samples)
+        {
+            if(s.family != family || !(s.measured_ms > 0.0f))
+                continue;
+            has_samples = true;
+            launch      = std::min(launch, static_cast<double>(s.measured_ms));
+        }
+        if(!has_samples)
+            continue;
+
+        // The fastest problem is mostly launch overhead but not entirely, so take
+        // only a half of it.
+        coeffs.launch_overhead_ms = launch / 2;
+
+        auto log_compute = 0.0;
+        auto log_memory  = 0.0;
+        auto n_compute   = 0;
+        auto n_memory    = 0;
+
+        for(const auto& s : samples)
+        {
+            if(s.family != family || !(s.measured_ms > 0.0f))
+                continue;
+            const auto busy_ms = static_cast<double>(s.measured_ms) - coeffs.launch_overhead_ms;
+            if(busy_ms <= 0.0)
+                continue;
+
+            const auto work       = GetFamilyWork(family, s.shape);
+            const auto peak       = device.PeakGflops(s.shape.type, work.matrix_cores);
+            const auto compute_ms = work.flops / (peak * 1e6);
+            const auto memory_ms  = work.bytes / (device.bandwidth_gbps * 1e6);
+
+            // Efficiency can't exceed 1 by definition. Larger values mean the model
+            // underestimates the work, clamp them to avoid optimistic predictions.
+            if(compute_ms >= memory_ms)
+            {
+                log_compute += std::log(std::min(compute_ms / busy_ms, 1.0));
+                ++n_compute;
+            }
+            else
+            {
+                log_memory += std::log(std::min(memory_ms / busy_ms, 1.0));
+                ++n_memory;
+            }
+        }
+
+        if(n_compute > 0)
+            coeffs.compute_efficiency = std::exp(log_compute / n_compute);
+        if(n_memory > 0)
+            coeffs.memory_efficiency = std::exp(log_memory / n_memory);
+
+        model.Set(family, coeffs);
+    }
+
+    return model;
+}
+
+float EstimateTime(const ExecutionContext& ctx,
+                   const ProblemDescription& problem,
+                   const solver::Id& id,
+                   float wti)
+{
+    return CostModel::GetDefault().EstimateFallback(
+        DeviceCaps::FromContext(ctx), ConvShape::From(problem), GetSolverFamily(id), wti);
+}
+
+} // namespace cost_model
+} // namespace conv
+} // namespace miopen
@@ -32,6 +32,7 @@
 #include <miopen/perf_field.hpp>
 #include <miopen/conv/problem_description.hpp>
 #include <miopen/solution.hpp>
+#include <miopen/tuning_cancel.hpp>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_GEMM)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_DIRECT)
@@ -337,6 +338,10 @@ FindCoreResult FindCore(const AnyInvokeParams& invoke_ctx,
                                   f->Find(ctx, problem, invoke_ctx, parameters, options));
         });
 
+    // Partial results must not be stored to the find-db.
+    if(solver::IsTuningCancelled())
+        MIOPEN_THROW("Find cancelled");
+
     std::size_t total = 0;
 
     for(auto it = solutions.begin(); it != solutions.end();)
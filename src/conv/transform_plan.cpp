@@ -0,0 +1,319 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/transform_plan.hpp>
+
+#include <miopen/conv/heuristics/cost_model.hpp>
+#include <miopen/convolution_fft.hpp>
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace miopen {
+namespace conv {
+
+namespace {
+
+std::size_t CeilDiv(std::size_t x, std::size_t y) { return (x + y - 1) / y; }
+
+int ToInt(std::size_t x) { return static_cast<int>(x); }
+
+/// Filter size of a phase of the stride decomposition.
+std::size_t PhaseFilter(std::size_t filter, std::size_t stride, std::size_t phase)
+{
+    return filter > phase ? CeilDiv(filter - phase, stride) : 0;
+}
+
+} // namespace
+
+double WinogradPlan::GetInputTransformFlops() const
+{
+    const auto ah = static_cast<double>(xform_h);
+    const auto aw = static_cast<double>(xform_w);
+    return static_cast<double>(input_transforms) * 2.0 * ah * aw * (ah + aw);
+}
+
+double WinogradPlan::GetFilterTransformFlops() const
+{
+    const auto ah = static_cast<double>(xform_h);
+    const auto aw = static_cast<double>(xform_w);
+    const auto rh = static_cast<double>(filter_h);
+    const auto rw = static_cast<double>(filter_w);
+    return static_cast<double>(filter_transforms) * 2.0 * (ah * rh * rw + ah * rw * aw);
+}
+
+double WinogradPlan::GetOutputTransformFlops() const
+{
+    const auto ah = static_cast<double>(xform_h);
+    const auto aw = static_cast<double>(xform_w);
+    const auto mh = static_cast<double>(tile_h);
+    const auto mw = static_cast<double>(tile_w);
+    return static_cast<double>(output_transforms) * 2.0 * (mh * ah * aw + mh * aw * mw);
+}
+
+double WinogradPlan::GetGemmFlops() const
+{
+    return 2.0 * static_cast<double>(gemm_batch) * static_cast<double>(gemm_m) *
+           static_cast<double>(gemm_n) * static_cast<double>(gemm_k);
+}
+
+double WinogradPlan::GetFlops() const
+{
+    return GetInputTransformFlops() + GetFilterTransformFlops() + GetOutputTransformFlops() +
+           GetGemmFlops();
+}
+
+WinogradPlan WinogradPlan::Make(WinogradScheme scheme,
+                                const cost_model::ConvShape& shape,
+                                int tile_h,
+                                int filter_h,
+                                int tile_w,
+                                int filter_w,
+                                int pad_h,
+                                int pad_w,
+                                bool backward_data,
+                                std::size_t element_size)
+{
+    if(tile_h < 1 || tile_w < 1 || filter_h < 1 || filter_w < 1)
+        MIOPEN_THROW(miopenStatusBadParm, "Invalid Winograd tile");
+    if(shape.group < 1 || shape.c % shape.group != 0 || shape.k % shape.group != 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Invalid group count");
+
+    auto plan          = WinogradPlan{};
+    plan.scheme        = scheme;
+    plan.tile_h        = tile_h;
+    plan.tile_w        = tile_w;
+    plan.filter_h      = filter_h;
+    plan.filter_w      = filter_w;
+    plan.xform_h       = tile_h + filter_h - 1;
+    plan.xform_w       = tile_w + filter_w - 1;
+    plan.group         = shape.group;
+    plan.n             = shape.n;
+    plan.c             = shape.c / shape.group;
+    plan.k             = shape.k / shape.group;
+    plan.in_h          = shape.in_spatial[1];
+    plan.in_w          = shape.in_spatial[2];
+    plan.out_h         = shape.out_spatial[1];
+    plan.out_w         = shape.out_spatial[2];
+    plan.pad_h         = pad_h;
+    plan.pad_w         = pad_w;
+    plan.backward_data = backward_data && scheme != WinogradScheme::MultipassWrW;
+
+    const auto wei_h      = shape.filter[1];
+    const auto wei_w      = shape.filter[2];
+    const auto elem       = ToInt(element_size);
+    const auto xform_size = static_cast<std::size_t>(plan.xform_h * plan.xform_w);
+
+    if(plan.backward_data)
+    {
+        // The solvers compute dx as a convolution of dy with the mirrored filter.
+        std::swap(plan.c, plan.k);
+        std::swap(plan.in_h, plan.out_h);
+        std::swap(plan.in_w, plan.out_w);
+        plan.pad_h = ToInt(wei_h) - 1 - pad_h;
+        plan.pad_w = ToInt(wei_w) - 1 - pad_w;
+    }
+
+    switch(scheme)
+    {
+    case WinogradScheme::Fused: {
+        plan.data_tiles_h = CeilDiv(plan.out_h, tile_h);
+        plan.data_tiles_w = CeilDiv(plan.out_w, tile_w);
+
+        // Every phase of the stride decomposition is split into r x r filter blocks.
+        auto blocks_h = std::size_t{0};
+        auto blocks_w = std::size_t{0};
+        for(std::size_t phase = 0; phase < shape.stride[1]; ++phase)
+            blocks_h += CeilDiv(PhaseFilter(wei_h, shape.stride[1], phase), filter_h);
+        for(std::size_t phase = 0; phase < shape.stride[2]; ++phase)
+            blocks_w += CeilDiv(PhaseFilter(wei_w, shape.stride[2], phase), filter_w);
+        plan.filter_tiles_h = blocks_h;
+        plan.filter_tiles_w = blocks_w;
+
+        const auto tiles       = plan.data_tiles_h * plan.data_tiles_w;
+        const auto blocks      = blocks_h * blocks_w;
+        plan.gemm_batch        = plan.group * xform_size;
+        plan.gemm_m            = plan.k;
+        plan.gemm_n            = plan.n * tiles;
+        plan.gemm_k            = plan.c * blocks;
+        plan.input_transforms  = plan.group * plan.n * plan.c * tiles * blocks;
+        plan.filter_transforms = plan.group * plan.k * plan.c * blocks;
+        plan.output_transforms = plan.group * plan.n * plan.k * tiles;
+        break;
+    }
+    case WinogradScheme::Bidirectional: {
+        if(ToInt(wei_h) != filter_h || ToInt(wei_w) != filter_w || shape.stride[1] != 1 ||
+           shape.stride[2] != 1)
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "The bidirectional Winograd needs a filter of r x r and stride 1");
+
+        // Same as WinogradBufferInfo with ConvWinoXformType::N_GXhXw_C_Th_Tw.
+        plan.data_tiles_h = CeilDiv(plan.out_h, tile_h);
+        plan.data_tiles_w = CeilDiv(plan.out_w, tile_w);
+        const auto th     = ToInt(plan.data_tiles_h);
+        const auto tw     = ToInt(plan.data_tiles_w);
+        const auto wino_g = ToInt(plan.group * xform_size);
+        const auto n      = ToInt(plan.n);
+        const auto c      = ToInt(plan.c);
+        const auto k      = ToInt(plan.k);
+        plan.in           = BuffInfo(MemLayout_t::GCNHW, n, c, th, tw, wino_g, elem);
+        plan.out          = BuffInfo(MemLayout_t::GCNHW, n, k, th, tw, wino_g, elem);
+        plan.wei          = BuffInfo(MemLayout_t::GCNHW, k, c, 1, 1, wino_g, elem);
+
+        const auto tiles       = plan.data_tiles_h * plan.data_tiles_w;
+        plan.gemm_batch        = plan.group * xform_size;
+        plan.gemm_m            = plan.k;
+        plan.gemm_n            = plan.n * tiles;
+        plan.gemm_k            = plan.c;
+        plan.input_transforms  = plan.group * plan.n * plan.c * tiles;
+        plan.filter_transforms = plan.group * plan.k * plan.c;
+        plan.output_transforms = plan.group * plan.n * plan.k * tiles;
+        break;
+    }
+    case WinogradScheme::MultipassWrW: {
+        if(plan.group != 1)
+            MIOPEN_THROW(miopenStatusBadParm, "The multi-pass Winograd does not support groups");
+
+        // The output is the filter gradient, dy is split into filter blocks and the input
+        // tiles are strided: see ConvWinograd3x3MultipassWrW::GetSolverWinoXformHWSize().
+        plan.xform_h = tile_h + (filter_h - 1) * (tile_h == 7 ? 2 : ToInt(shape.stride[1]));
+        plan.xform_w = tile_w + (filter_w - 1) * (tile_w == 7 ? 2 : ToInt(shape.stride[2]));
+
+        // Same as WinogradBufferInfo with ConvWinoXformType::N_1_CThTw_Xh_Xw.
+        plan.data_tiles_h   = CeilDiv(wei_h, tile_h);
+        plan.data_tiles_w   = CeilDiv(wei_w, tile_w);
+        plan.filter_tiles_h = CeilDiv(plan.out_h, filter_h);
+        plan.filter_tiles_w = CeilDiv(plan.out_w, filter_w);
+
+        const auto wino_c = plan.n * plan.filter_tiles_h * plan.filter_tiles_w;
+        const auto wc     = ToInt(wino_c);
+        const auto xh     = plan.xform_h;
+        const auto xw     = plan.xform_w;
+        const auto dh     = ToInt(xh * plan.data_tiles_h);
+        const auto dw     = ToInt(xw * plan.data_tiles_w);
+        const auto c      = ToInt(plan.c);
+        const auto k      = ToInt(plan.k);
+        plan.in           = BuffInfo(MemLayout_t::HWNC, c, wc, dh, dw, elem);
+        plan.out          = BuffInfo(MemLayout_t::HWCN, c, k, dh, dw, elem);
+        plan.wei          = BuffInfo(MemLayout_t::HWNC, k, wc, xh, xw, elem);
+
+        const auto tiles       = plan.data_tiles_h * plan.data_tiles_w;
+        plan.gemm_batch        = static_cast<std::size_t>(plan.xform_h * plan.xform_w);
+        plan.gemm_m            = plan.k;
+        plan.gemm_n            = plan.c * tiles;
+        plan.gemm_k            = wino_c;
+        plan.input_transforms  = plan.c * wino_c * tiles;
+        plan.filter_transforms = plan.k * wino_c;
+        plan.output_transforms = plan.c * plan.k * tiles;
+        break;
+    }
+    }
+
+    return plan;
+}
+
+std::size_t FftPlan::GetSourceStride() const
+{
+    return n * GetSourceChannels() + FFTConvParams::TransposePadding;
+}
+
+std::size_t FftPlan::GetFilterStride() const
+{
+    return k * c + FFTConvParams::TransposePadding;
+}
+
+std::size_t FftPlan::GetResultStride() const
+{
+    return n * GetResultChannels() + FFTConvParams::TransposePadding;
+}
+
+std::size_t FftPlan::GetHalfSize() const
+{
+    // See fft::GetWorkspaceSize(): the products may overwrite the transformed data.
+    return frequencies * std::max(GetSourceStride() + GetFilterStride(), GetResultStride());
+}
+
+std::size_t FftPlan::GetWorkspaceSize() const { return sizeof(float) * 2 * 2 * GetHalfSize(); }
+
+bool FftPlan::IsSupported() const
+{
+    const auto th = static_cast<std::size_t>(tile_h);
+    const auto tw = static_cast<std::size_t>(tile_w);
+    return pad_h >= 0 && pad_w >= 0 && static_cast<std::size_t>(pad_h) < wei_h &&
+           static_cast<std::size_t>(pad_w) < wei_w && in_h + 2 * pad_h <= th &&
+           in_w + 2 * pad_w <= tw && out_h + wei_h == in_h + 2 * pad_h + 1 &&
+           out_w + wei_w == in_w + 2 * pad_w + 1;
+}
+
+double FftPlan::GetTransformFlops() const
+{
+    // A real to complex transform costs half of the complex one, 5 N log2(N).
+    const auto size    = static_cast<double>(tile_h) * static_cast<double>(tile_w);
+    const auto fft     = 2.5 * size * std::log2(size);
+    const auto forward = static_cast<double>(n * GetSourceChannels() + k * c);
+    const auto inverse = static_cast<double>(n * GetResultChannels());
+    return fft * (forward + inverse);
+}
+
+double FftPlan::GetGemmFlops() const
+{
+    // A complex multiply-add is 8 real flops.
+    return 8.0 * static_cast<double>(frequencies) * static_cast<double>(n) *
+           static_cast<double>(c) * static_cast<double>(k);
+}
+
+double FftPlan::GetFlops() const { return GetTransformFlops() + GetGemmFlops(); }
+
+FftPlan FftPlan::Make(const cost_model::ConvShape& shape, int pad_h, int pad_w, bool backward_data)
+{
+    if(shape.group != 1 || shape.stride[1] != 1 || shape.stride[2] != 1)
+        MIOPEN_THROW(miopenStatusBadParm, "The FFT convolution needs stride 1 and no groups");
+
+    auto plan          = FftPlan{};
+    plan.n             = shape.n;
+    plan.c             = shape.c;
+    plan.k             = shape.k;
+    plan.in_h          = shape.in_spatial[1];
+    plan.in_w          = shape.in_spatial[2];
+    plan.out_h         = shape.out_spatial[1];
+    plan.out_w         = shape.out_spatial[2];
+    plan.wei_h         = shape.filter[1];
+    plan.wei_w         = shape.filter[2];
+    plan.pad_h         = pad_h;
+    plan.pad_w         = pad_w;
+    plan.backward_data = backward_data;
+
+    const auto h     = ToInt(plan.in_h);
+    const auto w     = ToInt(plan.in_w);
+    plan.tile_h      = FFTConvParams::TileDim(h, w);
+    plan.tile_w      = plan.tile_h;
+    plan.frequencies = FFTConvParams::TileSize(h, w);
+    return plan;
+}
+
+} // namespace conv
+} // namespace miopen
@@ -0,0 +1,454 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_maintenance.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/perf_field.hpp>
+
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/kern_db.hpp>
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+namespace miopen {
+
+namespace {
+
+// Smaller files are not worth spawning threads.
+constexpr std::size_t min_chunk_size = std::size_t{1} << 20;
+
+std::size_t GetThreadCount(std::size_t requested, std::size_t work, std::size_t min_work)
+{
+    if(requested == 0)
+        requested = std::max(1u, std::thread::hardware_concurrency());
+    return std::clamp<std::size_t>(work / std::max<std::size_t>(min_work, 1), 1, requested);
+}
+
+std::string_view PopToken(std::string_view& text, char separator)
+{
+    const auto pos   = text.find(separator);
+    const auto token = text.substr(0, pos);
+    text             = pos == std::string_view::npos ? std::string_view{} : text.substr(pos + 1);
+    return token;
+}
+
+struct Chunk
+{
+    TextDbRecords records;
+    TextDbReadStats stats;
+};
+
+void ParseChunk(std::string_view text, Chunk& chunk)
+{
+    while(!text.empty())
+    {
+        auto line = PopToken(text, '\n');
+        ++chunk.stats.lines;
+        if(!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        if(line.empty())
+            continue;
+
+        const auto eq = line.find('=');
+        if(eq == std::string_view::npos)
+        {
+            ++chunk.stats.ill_formed;
+            continue;
+        }
+
+        const auto [record, inserted] = chunk.records.try_emplace(std::string{line.substr(0, eq)});
+        if(!inserted)
+            ++chunk.stats.duplicate_keys;
+
+        auto items = line.substr(eq + 1);
+        while(!items.empty())
+        {
+            const auto item = PopToken(items, ';');
+            if(item.empty())
+                continue;
+            const auto colon = item.find(':');
+            if(colon == std::string_view::npos)
+            {
+                ++chunk.stats.ill_formed;
+                continue;
+            }
+            // The library reads the first occurrence, later ones are never returned.
+            record->second.try_emplace(std::string{item.substr(0, colon)}, item.substr(colon + 1));
+        }
+    }
+}
+
+} // namespace
+
+TextDbRecords ReadTextDb(const fs::path& file, std::size_t n_threads, TextDbReadStats* stats)
+{
+    auto contents = std::string{};
+    {
+        auto stream = std::ifstream{file, std::ios::binary | std::ios::ate};
+        if(!stream)
+            return {};
+        contents.resize(static_cast<std::size_t>(stream.tellg()));
+        stream.seekg(0);
+        stream.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    // Chunks start right after a line break.
+    const auto n_chunks = GetThreadCount(n_threads, contents.size(), min_chunk_size);
+    auto bounds         = std::vector<std::size_t>{0};
+    for(auto i = std::size_t{1}; i < n_chunks; ++i)
+    {
+        const auto start = std::max(bounds.back(), i * contents.size() / n_chunks);
+        const auto eol   = contents.find('\n', start);
+        if(eol == std::string::npos)
+            break;
+        bounds.push_back(eol + 1);
+    }
+    bounds.push_back(contents.size());
+
+    auto chunks     = std::vector<Chunk>(bounds.size() - 1);
+    auto threads    = std::vector<std::thread>{};
+    const auto view = std::string_view{contents};
+    for(auto i = std::size_t{1}; i < chunks.size(); ++i)
+        threads.emplace_back(
+            [&, i]() { ParseChunk(view.substr(bounds[i], bounds[i + 1] - bounds[i]), chunks[i]); });
+    ParseChunk(view.substr(0, bounds[1]), chunks[0]);
+    for(auto& thread : threads)
+        thread.join();
+
+    auto records = std::move(chunks[0].records);
+    auto total   = chunks[0].stats;
+    for(auto i = std::size_t{1}; i < chunks.size(); ++i)
+    {
+        total.lines += chunks[i].stats.lines;
+        total.ill_formed += chunks[i].stats.ill_formed;
+        total.duplicate_keys += chunks[i].stats.duplicate_keys;
+
+        for(auto& [key, values] : chunks[i].records)
+        {
+            const auto [record, inserted] = records.try_emplace(key, std::move(values));
+            if(inserted)
+                continue;
+            ++total.duplicate_keys;
+            // Chunks are in file order, the earlier ones win.
+            for(auto& [id, value] : values)
+                record->second.try_emplace(id, std::move(value));
+        }
+    }
+
+    if(total.ill_formed > 0)
+        MIOPEN_LOG_W(file << ": " << total.ill_formed << " ill-formed records or items skipped");
+    if(stats != nullptr)
+        *stats = total;
+    return records;
+}
+
+void WriteTextDb(const fs::path& file, const TextDbRecords& records)
+{
+    const auto temp = fs::path{file.string() + ".tmp"};
+    {
+        auto stream = std::ofstream{temp, std::ios::binary};
+        for(const auto& [key, record] : records)
+        {
+            if(record.empty())
+                continue;
+            stream << key << '=';
+            auto first = true;
+            for(const auto& [id, values] : record)
+            {
+                if(!first)
+                    stream << ';';
+                stream << id << ':' << values;
+                first = false;
+            }
+            stream << '\n';
+        }
+        if(!stream)
+            MIOPEN_THROW("Unable to write " + temp.string());
+    }
+    fs::rename(temp, file);
+}
+
+void UpdateTextDb(const fs::path& file,
+                  const std::function<void(TextDbRecords&)>& update,
+                  std::size_t n_threads)
+{
+    auto lock = std::unique_lock<LockFile>(LockFile::Get(LockFilePath(file)),
+                                           std::chrono::seconds{60});
+    if(!lock)
+        MIOPEN_THROW("Db lock has failed to lock: " + file.string());
+
+    auto records = ReadTextDb(file, n_threads);
+    update(records);
+    if(file.has_parent_path())
+        fs::create_directories(file.parent_path());
+    WriteTextDb(file, records);
+}
+
+float GetFindDbTime(const std::string& values)
+{
+    auto data = FindDbData{};
+    if(!data.Deserialize(values) || data.time < 0)
+        return std::numeric_limits<float>::infinity();
+    return data.time;
+}
+
+TextDbDiff DiffTextDbs(const TextDbRecords& from, const TextDbRecords& to)
+{
+    auto diff = TextDbDiff{};
+
+    const auto list_all = [](const auto& record, std::vector<std::string>& out) {
+        for(const auto& id : record.second)
+            out.push_back(record.first + ':' + id.first);
+    };
+
+    auto it_from = from.begin();
+    auto it_to   = to.begin();
+    while(it_from != from.end() || it_to != to.end())
+    {
+        if(it_to == to.end() || (it_from != from.end() && it_from->first < it_to->first))
+        {
+            list_all(*it_from++, diff.removed);
+            continue;
+        }
+        if(it_from == from.end() || it_to->first < it_from->first)
+        {
+            list_all(*it_to++, diff.added);
+            continue;
+        }
+
+        const auto& key = it_from->first;
+        for(const auto& [id, values] : it_from->second)
+        {
+            const auto other = it_to->second.find(id);
+            if(other == it_to->second.end())
+                diff.removed.push_back(key + ':' + id);
+            else if(other->second != values)
+                diff.changed.push_back(key + ':' + id);
+        }
+        for(const auto& [id, values] : it_to->second)
+        {
+            if(it_from->second.count(id) == 0)
+                diff.added.push_back(key + ':' + id);
+        }
+        ++it_from;
+        ++it_to;
+    }
+
+    return diff;
+}
+
+std::size_t PruneTextDb(TextDbRecords& records,
+                        const std::function<bool(const std::string& id)>& keep)
+{
+    auto removed = std::size_t{0};
+    for(auto record = records.begin(); record != records.end();)
+    {
+        auto& values = record->second;
+        for(auto it = values.begin(); it != values.end();)
+        {
+            if(keep(it->first))
+            {
+                ++it;
+                continue;
+            }
+            it = values.erase(it);
+            ++removed;
+        }
+        record = values.empty() ? records.erase(record) : std::next(record);
+    }
+    return removed;
+}
+
+DbStats GetTextDbStats(DbKinds db_kind, const TextDbRecords& records)
+{
+    auto stats = DbStats{};
+    for(const auto& [key, values] : records)
+    {
+        ++stats.records;
+        stats.values += values.size();
+
+        auto best    = std::numeric_limits<float>::infinity();
+        auto best_id = static_cast<const std::string*>(nullptr);
+        for(const auto& [id, value] : values)
+        {
+            ++stats.per_solver[id].values;
+            if(db_kind != DbKinds::FindDb)
+                continue;
+            const auto time = GetFindDbTime(value);
+            if(time < best)
+            {
+                best    = time;
+                best_id = &id;
+            }
+        }
+        if(best_id != nullptr)
+            ++stats.per_solver[*best_id].best;
+    }
+    return stats;
+}
+
+#if MIOPEN_ENABLE_SQLITE
+DbStats GetPerfDbStats(SQLitePerfDb& db)
+{
+    auto stats = DbStats{};
+    for(auto& row : db.sql.Exec("SELECT solver, COUNT(*) AS count FROM perf_db GROUP BY solver;"))
+    {
+        auto& solver  = stats.per_solver[row["solver"]];
+        solver.values = std::stoull(row["count"]);
+        stats.values += solver.values;
+    }
+    for(auto& row : db.sql.Exec("SELECT COUNT(DISTINCT config) AS count FROM perf_db;"))
+        stats.records = std::stoull(row["count"]);
+    return stats;
+}
+
+std::size_t PrunePerfDb(SQLitePerfDb& db, const std::function<bool(const std::string& id)>& keep)
+{
+    auto removed = std::size_t{0};
+    for(auto& row : db.sql.Exec("SELECT DISTINCT solver FROM perf_db;"))
+    {
+        const auto& solver = row["solver"];
+        if(keep(solver))
+            continue;
+
+        auto stmt = SQLite::Statement{db.sql, "DELETE FROM perf_db WHERE solver = ?;", {solver}};
+        if(stmt.Step(db.sql) != SQLITE_DONE)
+            MIOPEN_THROW(miopenStatusInternalError, db.sql.ErrorMessage());
+        removed += db.sql.Changes();
+    }
+    return removed;
+}
+
+void VacuumPerfDb(SQLitePerfDb& db)
+{
+    db.sql.Exec("DELETE FROM config WHERE id NOT IN (SELECT config FROM perf_db);");
+    db.sql.Exec("VACUUM;");
+}
+
+std::size_t MergeKernDbs(KernDb& target, KernDb& source)
+{
+    auto added = std::size_t{0};
+    for(auto& row :
+        source.sql.Exec("SELECT kernel_name, kernel_args FROM " + KernelConfig::table_name() + ";"))
+    {
+        auto config = KernelConfig{row["kernel_name"], row["kernel_args"], {}};
+        if(target.FindRecord(config))
+            continue;
+
+        try
+        {
+            auto blob = source.FindRecord(config);
+            if(!blob)
+                continue;
+            config.kernel_blob = std::move(*blob);
+        }
+        catch(const Exception&)
+        {
+            MIOPEN_LOG_W("Skipping broken " << config.kernel_name << " " << config.kernel_args);
+            continue;
+        }
+
+        target.StoreRecord(config);
+        ++added;
+    }
+    return added;
+}
+
+DbStats GetKernDbStats(KernDb& db)
+{
+    auto stats = DbStats{};
+    for(auto& row : db.sql.Exec("SELECT kernel_name, COUNT(*) AS count FROM " +
+                                KernelConfig::table_name() + " GROUP BY kernel_name;"))
+    {
+        auto& kernel  = stats.per_solver[row["kernel_name"]];
+        kernel.values = std::stoull(row["count"]);
+        stats.values += kernel.values;
+    }
+    stats.records = stats.values;
+    return stats;
+}
+
+std::size_t PruneKernDb(KernDb& db, std::size_t n_threads)
+{
+    const auto rows =
+        db.sql.Exec("SELECT kernel_name, kernel_args FROM " + KernelConfig::table_name() + ";");
+
+    const auto get_config = [&](std::size_t i) {
+        return KernelConfig{rows[i].at("kernel_name"), rows[i].at("kernel_args"), {}};
+    };
+
+    // Each thread verifies the blobs through its own connection.
+    const auto n_verifiers = GetThreadCount(n_threads, rows.size(), 1);
+    auto broken            = std::vector<char>(rows.size(), 0);
+    auto threads           = std::vector<std::thread>{};
+    for(auto t = std::size_t{0}; t < n_verifiers; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            auto reader = KernDb{DbKinds::KernelDb, db.filename, db.is_system};
+            for(auto i = t; i < rows.size(); i += n_verifiers)
+            {
+                auto config = get_config(i);
+                try
+                {
+                    std::ignore = reader.FindRecord(config);
+                }
+                catch(const Exception&)
+                {
+                    broken[i] = 1;
+                }
+            }
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+
+    auto removed = std::size_t{0};
+    for(auto i = std::size_t{0}; i < rows.size(); ++i)
+    {
+        if(broken[i] == 0)
+            continue;
+        auto config = get_config(i);
+        MIOPEN_LOG_I("Removing " << config.kernel_name << " " << config.kernel_args);
+        db.RemoveRecord(config);
+        ++removed;
+    }
+    return removed;
+}
+
+void VacuumKernDb(KernDb& db) { db.sql.Exec("VACUUM;"); }
+#endif
+
+} // namespace miopen
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_merge.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <limits>
+#include <map>
+#include <set>
+#include <string>
+#include <system_error>
+
+namespace miopen {
+
+namespace {
+
+constexpr float unknown_time = std::numeric_limits<float>::infinity();
+
+struct Candidate
+{
+    std::string value;
+    float time;
+    std::size_t shard;
+};
+
+using Candidates = std::map<std::string, std::map<std::string, Candidate>>;
+
+struct SolverTime
+{
+    float time        = unknown_time;
+    bool beats_target = true;
+};
+
+// device -> solver -> time, collected per shard from its find-db files.
+using ShardTimes = std::map<std::string, std::map<std::string, SolverTime>>;
+
+bool IsFindDbFile(const std::string& name) { return EndsWith(name, ".ufdb.txt"); }
+bool IsPerfDbFile(const std::string& name)
+{
+    return !IsFindDbFile(name) && EndsWith(name, ".udb.txt");
+}
+
+std::string GetDevice(const std::string& name) { return name.substr(0, name.find('.')); }
+
+void AddCandidate(Candidates& candidates,
+                  const std::string& key,
+                  const std::string& id,
+                  Candidate candidate,
+                  DbMergeStats& stats)
+{
+    auto& slot    = candidates[key];
+    const auto it = slot.find(id);
+    if(it == slot.end())
+    {
+        slot.emplace(id, std::move(candidate));
+        return;
+    }
+
+    // Equal times keep the candidate from the earlier shard.
+    if(candidate.time < it->second.time)
+        it->second = std::move(candidate);
+    ++stats.kept;
+}
+
+template <class Replaces>
+void ApplyCandidates(TextDbRecords& target,
+                     const Candidates& candidates,
+                     const Replaces& replaces,
+                     DbMergeStats& stats)
+{
+    for(const auto& [key, slot] : candidates)
+    {
+        auto& record = target[key];
+        for(const auto& [id, candidate] : slot)
+        {
+            const auto it = record.find(id);
+            if(it == record.end())
+            {
+                record.emplace(id, candidate.value);
+                ++stats.added;
+            }
+            else if(replaces(it->second, id, candidate))
+            {
+                it->second = candidate.value;
+                ++stats.replaced;
+            }
+            else
+            {
+                ++stats.kept;
+            }
+        }
+    }
+}
+
+} // namespace
+
+DbMergeStats MergeUserDbShards(const std::vector<fs::path>& shards, const fs::path& target)
+{
+    auto find_dbs = std::set<std::string>{};
+    auto perf_dbs = std::set<std::string>{};
+
+    for(const auto& shard : shards)
+    {
+        auto ec = std::error_code{};
+        for(auto it = fs::directory_iterator{shard, ec}; !ec && it != fs::directory_iterator{};
+            it.increment(ec))
+        {
+            const auto name = it->path().filename().string();
+            if(IsFindDbFile(name))
+                find_dbs.insert(name);
+            else if(IsPerfDbFile(name))
+                perf_dbs.insert(name);
+        }
+    }
+
+    fs::create_directories(target);
+
+    auto stats = DbMergeStats{};
+    auto times = std::vector<ShardTimes>(shards.size());
+
+    // Find-db goes first: it provides the times to resolve the perf-db conflicts.
+    for(const auto& name : find_dbs)
+    {
+        const auto device = GetDevice(name);
+
+        UpdateTextDb(target / name, [&](TextDbRecords& records) {
+            auto candidates = Candidates{};
+
+            for(auto i = std::size_t{0}; i < shards.size(); ++i)
+            {
+                for(const auto& [key, record] : ReadTextDb(shards[i] / name))
+                {
+                    const auto target_record = records.find(key);
+                    for(const auto& [id, values] : record)
+                    {
+                        const auto time = GetFindDbTime(values);
+                        auto& solver    = times[i][device][id];
+                        solver.time     = std::min(solver.time, time);
+
+                        if(target_record != records.end())
+                        {
+                            const auto old = target_record->second.find(id);
+                            if(old != target_record->second.end() &&
+                               !(time < GetFindDbTime(old->second)))
+                                solver.beats_target = false;
+                        }
+
+                        AddCandidate(candidates, key, id, {values, time, i}, stats);
+                    }
+                }
+            }
+
+            ApplyCandidates(
+                records,
+                candidates,
+                [](const std::string& old, const std::string&, const Candidate& candidate) {
+                    return candidate.time < GetFindDbTime(old);
+                },
+                stats);
+        });
+    }
+
+    for(const auto& name : perf_dbs)
+    {
+        const auto device = GetDevice(name);
+
+        const auto get_time = [&](std::size_t shard, const std::string& id) {
+            const auto& solvers = times[shard][device];
+            const auto solver   = solvers.find(id);
+            return solver == solvers.end() ? SolverTime{unknown_time, false} : solver->second;
+        };
+
+        UpdateTextDb(target / name, [&](TextDbRecords& records) {
+            auto candidates = Candidates{};
+
+            for(auto i = std::size_t{0}; i < shards.size(); ++i)
+            {
+                for(const auto& [key, record] : ReadTextDb(shards[i] / name))
+                {
+                    for(const auto& [id, values] : record)
+                        AddCandidate(candidates, key, id, {values, get_time(i, id).time, i}, stats);
+                }
+            }
+
+            ApplyCandidates(
+                records,
+                candidates,
+                [&](const std::string&, const std::string& id, const Candidate& candidate) {
+                    const auto solver = get_time(candidate.shard, id);
+                    return solver.time != unknown_time && solver.beats_target;
+                },
+                stats);
+        });
+    }
+
+    MIOPEN_LOG_I("Merged " << shards.size() << " shards into " << target << ": " << stats.added
+                           << " added, " << stats.replaced << " replaced, " << stats.kept
+                           << " kept");
+    return stats;
+}
+
+DbMergeStats MergeTextDbs(DbKinds db_kind,
+                          TextDbRecords& target,
+                          const std::vector<TextDbRecords>& sources)
+{
+    auto stats      = DbMergeStats{};
+    auto candidates = Candidates{};
+    const auto find = db_kind == DbKinds::FindDb;
+
+    for(auto i = std::size_t{0}; i < sources.size(); ++i)
+    {
+        for(const auto& [key, record] : sources[i])
+        {
+            for(const auto& [id, values] : record)
+            {
+                const auto time = find ? GetFindDbTime(values) : unknown_time;
+                AddCandidate(candidates, key, id, {values, time, i}, stats);
+            }
+        }
+    }
+
+    ApplyCandidates(
+        target,
+        candidates,
+        [&](const std::string& old, const std::string&, const Candidate& candidate) {
+            return find && candidate.time < GetFindDbTime(old);
+        },
+        stats);
+
+    return stats;
+}
+
+} // namespace miopen
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/device_capabilities.hpp>
+
+#include <miopen/binary_cache.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <system_error>
+#include <utility>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEVICE_INFO_CACHE)
+
+namespace miopen {
+
+namespace {
+
+// Bump when the format of the persisted record changes.
+constexpr std::string_view device_info_format = "MIOpen device info 1";
+
+fs::path GetDeviceInfoCachePath(const std::string& key)
+{
+    if(!env::enabled(MIOPEN_DEVICE_INFO_CACHE) || IsCacheDisabled())
+        return {};
+    const auto directory = GetCachePath(false);
+    if(directory.empty())
+        return {};
+    return directory / ("device_" + md5(key) + ".txt");
+}
+
+bool ParseSize(std::string_view s, std::size_t& value)
+{
+    const auto end    = s.data() + s.size();
+    const auto result = std::from_chars(s.data(), end, value);
+    return !s.empty() && result.ec == std::errc{} && result.ptr == end;
+}
+
+bool ParseHexDigit(char c, unsigned& value)
+{
+    if(std::isdigit(static_cast<unsigned char>(c)) != 0)
+        value = c - '0';
+    else if(c >= 'a' && c <= 'f')
+        value = c - 'a' + 10;
+    else
+        return false;
+    return true;
+}
+
+} // namespace
+
+std::string DeviceInfo::GetSettingsKey()
+{
+    auto key = std::string{};
+    for(const auto name : {"ROC_GLOBAL_CU_MASK", "HSA_CU_MASK", "HSA_XNACK"})
+    {
+        if(const auto value = env::getEnvironmentVariable(name))
+            key += std::string{", "} + name + "=" + *value;
+    }
+    // The key is a single line of the persisted record.
+    std::replace(key.begin(), key.end(), '\n', ' ');
+    return key;
+}
+
+bool DeviceInfo::Load(const fs::path& file, const std::string& key)
+{
+    auto in   = std::ifstream{file};
+    auto line = std::string{};
+    if(!std::getline(in, line) || line != device_info_format)
+        return false;
+    if(!std::getline(in, line) || line != key)
+        return false;
+
+    auto loaded = DeviceInfo{};
+    auto fields = 0;
+    while(std::getline(in, line))
+    {
+        const auto separator = line.find('=');
+        if(separator == std::string::npos)
+            return false;
+        const auto name  = std::string_view{line}.substr(0, separator);
+        const auto value = std::string_view{line}.substr(separator + 1);
+
+        auto ok = true;
+        if(name == "raw_name")
+            loaded.raw_name = value;
+        else if(name == "compute_units")
+            ok = ParseSize(value, loaded.compute_units);
+        else if(name == "wavefront_width")
+            ok = ParseSize(value, loaded.wavefront_width);
+        else if(name == "local_memory_size")
+            ok = ParseSize(value, loaded.local_memory_size);
+        else if(name == "global_memory_size")
+            ok = ParseSize(value, loaded.global_memory_size);
+        else if(name == "image3d_max_width")
+            ok = ParseSize(value, loaded.image3d_max_width);
+        else if(name == "cooperative_launch")
+            loaded.cooperative_launch = value == "1";
+        else
+            ok = false;
+        if(!ok)
+            return false;
+        ++fields;
+    }
+    if(fields != 7 || loaded.raw_name.empty())
+        return false;
+
+    loaded.target.Init(loaded.raw_name);
+    *this = std::move(loaded);
+    return true;
+}
+
+void DeviceInfo::Save(const fs::path& file, const std::string& key) const
+{
+    // Written to a unique temporary file and renamed, so concurrent processes never read
+    // a partial record.
+    auto temp = file;
+    temp += "." + std::to_string(std::random_device{}()) + ".tmp";
+    try
+    {
+        fs::create_directories(file.parent_path());
+        {
+            auto out = std::ofstream{temp};
+            out << device_info_format << '\n'
+                << key << '\n'
+                << "raw_name=" << raw_name << '\n'
+                << "compute_units=" << compute_units << '\n'
+                << "wavefront_width=" << wavefront_width << '\n'
+                << "local_memory_size=" << local_memory_size << '\n'
+                << "global_memory_size=" << global_memory_size << '\n'
+                << "image3d_max_width=" << image3d_max_width << '\n'
+                << "cooperative_launch=" << (cooperative_launch ? 1 : 0) << '\n';
+            if(!out.flush())
+            {
+                MIOPEN_LOG_W("Unable to write the device info to " << temp);
+                out.close();
+                fs::remove(temp);
+                return;
+            }
+        }
+        fs::rename(temp, file);
+    }
+    catch(const fs::filesystem_error& ex)
+    {
+        MIOPEN_LOG_W("Unable to save the device info to " << file << ": " << ex.what());
+        std::error_code ignored;
+        fs::remove(temp, ignored);
+    }
+}
+
+const DeviceInfo& DeviceInfo::Get(const std::string& device_key,
+                                  const std::function<DeviceInfo()>& query)
+{
+    const auto key = device_key + GetSettingsKey();
+
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::map<std::string, DeviceInfo> records;
+
+    const std::lock_guard<std::mutex> lock(mutex);
+    const auto found = records.find(key);
+    if(found != records.end())
+        return found->second;
+
+    auto info       = DeviceInfo{};
+    const auto file = GetDeviceInfoCachePath(key);
+    if(!file.empty() && info.Load(file, key))
+    {
+        MIOPEN_LOG_I2("Device info of " << key << " loaded from " << file);
+    }
+    else
+    {
+        info = query();
+        info.target.Init(info.raw_name);
+        if(!file.empty())
+            info.Save(file, key);
+    }
+    return records.emplace(key, std::move(info)).first->second;
+}
+
+DeviceCapabilities DeviceCapabilities::FromName(const std::string& name, std::size_t compute_units)
+{
+    auto caps          = DeviceCapabilities{};
+    caps.compute_units = compute_units;
+
+    // gfx<major><minor><stepping>, the last two are single hex digits.
+    const auto id = std::string_view{name}.substr(0, name.find(':'));
+    if(!StartsWith(name, "gfx") || id.size() < 6)
+        return caps;
+    const auto major = id.substr(3, id.size() - 5);
+    if(!std::all_of(major.begin(), major.end(), [](char c) {
+           return std::isdigit(static_cast<unsigned char>(c)) != 0;
+       }))
+        return caps;
+    auto minor    = 0U;
+    auto stepping = 0U;
+    if(!ParseHexDigit(id[id.size() - 2], minor) || !ParseHexDigit(id.back(), stepping))
+        return caps;
+
+    caps.gfx_major    = std::stoul(std::string{major});
+    caps.gfx_minor    = minor;
+    caps.gfx_stepping = stepping;
+    caps.xdlops       = caps.IsGfx(9, 0, 8) || caps.IsGfx(9, 0, 0xa) || caps.IsGfx(9, 4);
+    caps.wmma         = caps.gfx_major == 11 || caps.gfx_major == 12;
+    return caps;
+}
+
+const DeviceCapabilities& DeviceCapabilities::Get(const std::string& name,
+                                                  std::size_t compute_units)
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::map<std::pair<std::string, std::size_t>, DeviceCapabilities> records;
+
+    const std::lock_guard<std::mutex> lock(mutex);
+    auto key   = std::make_pair(name, compute_units);
+    auto found = records.find(key);
+    if(found == records.end())
+        found = records.emplace(key, FromName(name, compute_units)).first;
+    return found->second;
+}
+
+} // namespace miopen
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/driver_cmd_log.hpp>
+
+#include <algorithm>
+#include <istream>
+
+namespace miopen {
+
+namespace {
+
+// Written by MIOPEN_LOG_DRIVER_COMMAND after the logging prefix.
+constexpr std::string_view command_marker = ": Command [";
+
+std::vector<std::string_view> SplitArgs(std::string_view text)
+{
+    constexpr std::string_view spaces = " \t\r\n";
+    auto tokens                       = std::vector<std::string_view>{};
+    for(auto begin = text.find_first_not_of(spaces); begin != std::string_view::npos;)
+    {
+        const auto end = std::min(text.find_first_of(spaces, begin), text.size());
+        tokens.push_back(text.substr(begin, end - begin));
+        begin = text.find_first_not_of(spaces, end);
+    }
+    return tokens;
+}
+
+} // namespace
+
+std::optional<DriverCommand> ParseDriverCommand(std::string_view line)
+{
+    const auto marker = line.find(command_marker);
+    if(marker == std::string_view::npos)
+        return std::nullopt;
+
+    auto rest          = line.substr(marker + command_marker.size());
+    const auto api_end = rest.find(']');
+    if(api_end == std::string_view::npos)
+        return std::nullopt;
+
+    auto command = DriverCommand{std::string{rest.substr(0, api_end)}, {}};
+
+    // The first token is the driver path, it differs between platforms.
+    const auto tokens = SplitArgs(rest.substr(api_end + 1));
+    if(tokens.size() < 2)
+        return std::nullopt;
+    for(auto token = tokens.begin() + 1; token != tokens.end(); ++token)
+    {
+        if(!command.args.empty())
+            command.args += ' ';
+        command.args += *token;
+    }
+    return command;
+}
+
+std::string_view GetDriverOperation(std::string_view args)
+{
+    const auto tokens = SplitArgs(args);
+    return tokens.empty() ? std::string_view{} : tokens.front();
+}
+
+std::optional<std::string_view> GetDriverFlag(std::string_view args, std::string_view flag)
+{
+    const auto tokens = SplitArgs(args);
+    const auto found  = std::find(tokens.begin(), tokens.end(), flag);
+    if(found == tokens.end() || found + 1 == tokens.end())
+        return std::nullopt;
+    return *(found + 1);
+}
+
+void DriverCommandLog::Add(const DriverCommand& command)
+{
+    auto& problem = problems[command.args];
+    if(problem.count == 0)
+        problem.args = command.args;
+    ++problem.count;
+    ++problem.apis[command.api];
+    ++total;
+}
+
+std::size_t DriverCommandLog::Read(std::istream& stream)
+{
+    auto found = std::size_t{0};
+    auto line  = std::string{};
+    while(std::getline(stream, line))
+    {
+        if(const auto command = ParseDriverCommand(line))
+        {
+            Add(*command);
+            ++found;
+        }
+    }
+    return found;
+}
+
+std::vector<DriverProblem> DriverCommandLog::GetProblems() const
+{
+    auto result = std::vector<DriverProblem>{};
+    result.reserve(problems.size());
+    for(const auto& problem : problems)
+        result.push_back(problem.second);
+    std::sort(result.begin(), result.end(), [](const auto& l, const auto& r) {
+        return l.count != r.count ? l.count > r.count : l.args < r.args;
+    });
+    return result;
+}
+
+} // namespace miopen
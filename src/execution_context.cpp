@@ -214,13 +214,25 @@ bool IsHipKernelsEnabled()
 
 void ExecutionContext::DetectRocm()
 {
+    // Every context runs this, so the environment is read and the assembler is validated
+    // only once in the process.
+    struct Flags
+    {
+        bool hip_kernels;
+        bool opencl_convolutions;
+        bool asm_kernels;
+    };
+    static const auto flags = Flags{IsHipKernelsEnabled(),
+                                    !env::disabled(MIOPEN_DEBUG_OPENCL_CONVOLUTIONS),
+                                    !env::disabled(MIOPEN_DEBUG_GCN_ASM_KERNELS)};
+
     use_asm_kernels         = false;
-    use_hip_kernels         = IsHipKernelsEnabled();
-    use_opencl_convolutions = !env::disabled(MIOPEN_DEBUG_OPENCL_CONVOLUTIONS);
+    use_hip_kernels         = flags.hip_kernels;
+    use_opencl_convolutions = flags.opencl_convolutions;
     rmv                     = rocm_meta_version::Default;
     if(IsAmdRocmOpencl(*this))
     {
-        use_asm_kernels = !env::disabled(MIOPEN_DEBUG_GCN_ASM_KERNELS) && ValidateGcnAssembler();
+        use_asm_kernels = flags.asm_kernels && ValidateGcnAssembler();
     }
 }
 
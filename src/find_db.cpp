@@ -34,6 +34,8 @@
 #endif
 #include <miopen/filesystem.hpp>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace miopen {
@@ -271,6 +273,32 @@ void FindDbRecord_t<TDb>::LogFindDbItem(const std::pair<std::string, FindDbData>
         MIOPEN_LOG_I2("Find-db record content: " << pair2.first << ':' << pair2.second);
 }
 
+template <class TDb>
+void FindDbRecord_t<TDb>::WarmUp(Handle& handle, const std::string& path_suffix)
+{
+    if(!debug::testing_find_db_enabled || env::enabled(MIOPEN_DEBUG_DISABLE_FIND_DB))
+        return;
+
+    const auto user_path = debug::testing_find_db_path_override()
+                               ? *debug::testing_find_db_path_override()
+                               : GetUserPath(handle, path_suffix);
+
+    // Constructing the db loads the cached instances.
+    if constexpr(std::is_same_v<TDb, FindDb>)
+    {
+        const auto installed_path = debug::testing_find_db_path_override()
+                                        ? *debug::testing_find_db_path_override()
+                                        : GetInstalledPath(handle, path_suffix);
+        std::ignore = DbTimer<TDb>{DbKinds::FindDb, installed_path, user_path};
+    }
+    else
+    {
+#if !MIOPEN_DISABLE_USERDB
+        std::ignore = DbTimer<TDb>{DbKinds::FindDb, user_path, false};
+#endif
+    }
+}
+
 template class FindDbRecord_t<FindDb>;
 template class FindDbRecord_t<UserFindDb>;
 
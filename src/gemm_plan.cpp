@@ -0,0 +1,265 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/gemm_plan.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <boost/container_hash/hash.hpp>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_GEMM_PLAN_CACHE_SIZE, 256)
+
+namespace miopen {
+
+namespace {
+
+/// Element strides of op(A), op(B) and C, resolved once per plan.
+struct HostGemmPlan : GemmPlan
+{
+    std::size_t a_row, a_col;
+    std::size_t b_row, b_col;
+    std::size_t c_col;
+    std::size_t batch_count;
+    std::size_t a_batch, b_batch, c_batch;
+};
+
+template <class T>
+void HostGemm(const HostGemmPlan& plan, const GemmDescriptor& desc, const T* a, const T* b, T* c)
+{
+    const auto alpha = static_cast<T>(desc.alpha);
+    const auto beta  = static_cast<T>(desc.beta);
+
+    for(auto batch = std::size_t{0}; batch < plan.batch_count; ++batch)
+    {
+        const auto* a_batch = a + batch * plan.a_batch;
+        const auto* b_batch = b + batch * plan.b_batch;
+        auto* c_batch       = c + batch * plan.c_batch;
+
+        for(auto j = 0; j < desc.n; ++j)
+        {
+            for(auto i = 0; i < desc.m; ++i)
+            {
+                auto sum = T{0};
+                for(auto p = 0; p < desc.k; ++p)
+                    sum += a_batch[i * plan.a_row + p * plan.a_col] *
+                           b_batch[p * plan.b_row + j * plan.b_col];
+
+                auto& out = c_batch[i + j * plan.c_col];
+                // Like BLAS, C is not read when beta is zero.
+                out = beta == T{0} ? alpha * sum : alpha * sum + beta * out;
+            }
+        }
+    }
+}
+
+} // namespace
+
+GemmPlanKey GemmPlanKey::Make(std::string scope, const GemmDescriptor& desc, bool batched)
+{
+    if(!desc.isColMajor)
+        MIOPEN_THROW(miopenStatusInternalError, "GEMM plans expect column-major descriptors");
+
+    return {std::move(scope),
+            desc.transA,
+            desc.transB,
+            desc.m,
+            desc.n,
+            desc.k,
+            desc.lda,
+            desc.ldb,
+            desc.ldc,
+            batched ? desc.batch_count : 1,
+            batched ? desc.strideA : 0,
+            batched ? desc.strideB : 0,
+            batched ? desc.strideC : 0,
+            desc.dataType,
+            desc.a_cast_type,
+            desc.b_cast_type,
+            desc.alpha == 1.0f,
+            desc.beta == 0.0f,
+            desc.deterministic,
+            desc.gfx90a_alt_impl};
+}
+
+std::size_t GemmPlanKey::Hash::operator()(const GemmPlanKey& key) const
+{
+    auto seed = std::size_t{0};
+    std::apply([&](const auto&... fields) { (boost::hash_combine(seed, fields), ...); },
+               key.Tie());
+    return seed;
+}
+
+GemmPlanCache::GemmPlanCache(std::size_t capacity_) : capacity(capacity_) {}
+
+GemmPlanCache::PlanPtr
+GemmPlanCache::GetOrCreate(const GemmPlanKey& key,
+                           const std::function<std::unique_ptr<GemmPlan>()>& create)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = entries.find(key);
+        if(it != entries.end())
+        {
+            ++hits;
+            lru.splice(lru.begin(), lru, it->second.lru);
+            return it->second.plan;
+        }
+        ++misses;
+    }
+
+    auto plan = PlanPtr{create()};
+    if(capacity == 0)
+        return plan;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = entries.find(key);
+    if(it != entries.end())
+        return it->second.plan;
+
+    if(entries.size() >= capacity)
+    {
+        entries.erase(lru.back());
+        lru.pop_back();
+    }
+    lru.push_front(key);
+    entries.emplace(key, Entry{plan, lru.begin()});
+    return plan;
+}
+
+std::size_t GemmPlanCache::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+std::size_t GemmPlanCache::GetHits() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+std::size_t GemmPlanCache::GetMisses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+void GemmPlanCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    lru.clear();
+    hits   = 0;
+    misses = 0;
+}
+
+GemmPlanCache& GemmPlanCache::GetInstance()
+{
+    static auto instance = GemmPlanCache{env::value(MIOPEN_GEMM_PLAN_CACHE_SIZE)};
+    return instance;
+}
+
+void RunGemmPlan(const GemmBlasBackend& backend,
+                 GemmPlanCache& cache,
+                 const GemmDescriptor& desc,
+                 bool batched,
+                 ConstData_t A,
+                 std::size_t a_offset,
+                 ConstData_t B,
+                 std::size_t b_offset,
+                 Data_t C,
+                 std::size_t c_offset)
+{
+    const auto key  = GemmPlanKey::Make(backend.GetPlanScope(), desc, batched);
+    const auto plan = cache.GetOrCreate(key, [&]() {
+        MIOPEN_LOG_I2("Creating GEMM plan, " << key.scope << ", transA " << desc.transA
+                                              << ", transB " << desc.transB << ", m " << desc.m
+                                              << ", n " << desc.n << ", k " << desc.k
+                                              << ", batch_count " << key.batch_count);
+        return backend.CreatePlan(desc, batched);
+    });
+    backend.Run(*plan, desc, batched, A, a_offset, B, b_offset, C, c_offset);
+}
+
+std::unique_ptr<GemmPlan> HostGemmBackend::CreatePlan(const GemmDescriptor& desc,
+                                                      bool batched) const
+{
+    if(desc.dataType != miopenFloat && desc.dataType != miopenDouble)
+        MIOPEN_THROW(miopenStatusNotImplemented, "Host GEMM supports fp32 and fp64 only");
+    if(desc.m < 0 || desc.n < 0 || desc.k < 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Negative GEMM dimensions");
+
+    ++plans_created;
+
+    auto plan         = std::make_unique<HostGemmPlan>();
+    const auto lda    = static_cast<std::size_t>(desc.lda);
+    const auto ldb    = static_cast<std::size_t>(desc.ldb);
+    plan->a_row       = desc.transA ? lda : 1;
+    plan->a_col       = desc.transA ? 1 : lda;
+    plan->b_row       = desc.transB ? ldb : 1;
+    plan->b_col       = desc.transB ? 1 : ldb;
+    plan->c_col       = static_cast<std::size_t>(desc.ldc);
+    plan->batch_count = batched ? static_cast<std::size_t>(desc.batch_count) : 1;
+    plan->a_batch     = batched ? static_cast<std::size_t>(desc.strideA) : 0;
+    plan->b_batch     = batched ? static_cast<std::size_t>(desc.strideB) : 0;
+    plan->c_batch     = batched ? static_cast<std::size_t>(desc.strideC) : 0;
+    return plan;
+}
+
+void HostGemmBackend::Run(const GemmPlan& plan,
+                          const GemmDescriptor& desc,
+                          bool,
+                          ConstData_t A,
+                          std::size_t a_offset,
+                          ConstData_t B,
+                          std::size_t b_offset,
+                          Data_t C,
+                          std::size_t c_offset) const
+{
+    ++calls;
+    const auto& host_plan = dynamic_cast<const HostGemmPlan&>(plan);
+
+    if(desc.dataType == miopenFloat)
+    {
+        HostGemm(host_plan,
+                 desc,
+                 static_cast<const float*>(A) + a_offset,
+                 static_cast<const float*>(B) + b_offset,
+                 static_cast<float*>(C) + c_offset);
+    }
+    else
+    {
+        HostGemm(host_plan,
+                 desc,
+                 static_cast<const double*>(A) + a_offset,
+                 static_cast<const double*>(B) + b_offset,
+                 static_cast<double*>(C) + c_offset);
+    }
+}
+
+} // namespace miopen
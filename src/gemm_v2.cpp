@@ -25,6 +25,7 @@
  *******************************************************************************/
 #include <miopen/config.h>
 #include <miopen/gemm_v2.hpp>
+#include <miopen/gemm_plan.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/env.hpp>
 #include <miopen/tensor.hpp>
@@ -363,141 +364,199 @@ static inline void check_hipblas_status(hipblasStatus_t status)
     }
 }
 
-template <typename DataTypeAB, typename DataTypeC>
-static void miopen_hipblasLt_gemm(const miopen::Handle& handle,
-                                  const miopen::GemmDescriptor& gemm_desc,
-                                  ConstData_t A,
-                                  std::size_t a_offset,
-                                  ConstData_t B,
-                                  std::size_t b_offset,
-                                  hipDataType hip_type_AB,
-                                  Data_t C,
-                                  std::size_t c_offset,
-                                  hipDataType hip_type_C,
-                                  bool skip_batches)
+struct HipblasLtType
 {
-    HipBLASLtMemoryHandles hipBLASLtHandles;
+    hipDataType type;
+    std::size_t size;
+};
 
-    if(gemm_desc.transA)
+static HipblasLtType GetHipblasLtType(const miopen::Handle& handle, miopenDataType_t data_type)
+{
+    switch(data_type)
     {
-        check_hipblas_status(hipblasLtMatrixLayoutCreate(
-            &hipBLASLtHandles.matA, hip_type_AB, gemm_desc.k, gemm_desc.m, gemm_desc.lda));
+    case miopenInt8:
+        MIOPEN_THROW(miopenStatusInternalError, "miopenInt8 is not supported for hipBLASLt");
+    case miopenInt32:
+        MIOPEN_THROW(miopenStatusInternalError, "miopenInt32 is not supported for hipBLASLt");
+    case miopenHalf: return {HIP_R_16F, sizeof(hipblasLtHalf)};
+    case miopenBFloat16: return {HIP_R_16BF, sizeof(hipblasLtBfloat16)};
+    case miopenFloat: return {HIP_R_32F, sizeof(hipblasLtFloat)};
+    case miopenFloat8: {
+        const auto is_gfx94x = miopen::StartsWith(handle.GetDeviceName(), "gfx94");
+        if(!is_gfx94x)
+        {
+            MIOPEN_THROW(miopenStatusInternalError,
+                         "miopenFloat8 is only supported for hipBlasLt on gfx94x");
+        }
+        return {HIP_R_8F_E4M3_FNUZ, sizeof(hipblaslt_f8_fnuz)};
     }
-    else
-    {
-        check_hipblas_status(hipblasLtMatrixLayoutCreate(
-            &hipBLASLtHandles.matA, hip_type_AB, gemm_desc.m, gemm_desc.k, gemm_desc.lda));
+    case miopenBFloat8: {
+        const auto is_gfx94x = miopen::StartsWith(handle.GetDeviceName(), "gfx94");
+        if(!is_gfx94x)
+        {
+            MIOPEN_THROW(miopenStatusInternalError,
+                         "miopenBFloat8 is only supported for hipBlasLt on gfx94x");
+        }
+#ifdef ENABLE_HIPBLASLT_BF8
+        return {HIP_R_8F_E5M2_FNUZ, sizeof(hipblaslt_bf8_fnuz)};
+#else
+        MIOPEN_THROW(miopenStatusInternalError,
+                     "miopenBFloat8 is not supported for this version of hipBlasLt on gfx94x");
+#endif
     }
+    case miopenDouble:
+        MIOPEN_THROW(miopenStatusInternalError, "miopenDouble is not supported for hipBlasLt");
+    case miopenInt64:
+        MIOPEN_THROW(miopenStatusInternalError, "miopenInt64 is not supported for hipBlasLt");
+    }
+    MIOPEN_THROW(miopenStatusInternalError, "Unknown data type");
+}
 
-    if(gemm_desc.transB)
+/// Matrix layouts, matmul descriptor and the algorithm chosen by the heuristic,
+/// which are otherwise recreated on every call.
+struct HipblasLtGemmPlan : GemmPlan
+{
+    HipBLASLtMemoryHandles handles;
+    hipblasLtMatmulAlgo_t algo;
+    std::size_t ab_size = 0;
+    std::size_t c_size  = 0;
+};
+
+class HipblasLtGemmBackend : public GemmBlasBackend
+{
+public:
+    explicit HipblasLtGemmBackend(const miopen::Handle& handle_) : handle(handle_) {}
+
+    std::string GetPlanScope() const override { return "hipblaslt:" + handle.GetDeviceName(); }
+
+    std::unique_ptr<GemmPlan> CreatePlan(const GemmDescriptor& gemm_desc,
+                                         bool batched) const override
     {
+        const auto type_AB = GetHipblasLtType(handle, gemm_desc.dataType);
+        const auto type_C  = type_AB;
+
+        auto plan              = std::make_unique<HipblasLtGemmPlan>();
+        plan->ab_size          = type_AB.size;
+        plan->c_size           = type_C.size;
+        auto& hipBLASLtHandles = plan->handles;
+
+        if(gemm_desc.transA)
+        {
+            check_hipblas_status(hipblasLtMatrixLayoutCreate(
+                &hipBLASLtHandles.matA, type_AB.type, gemm_desc.k, gemm_desc.m, gemm_desc.lda));
+        }
+        else
+        {
+            check_hipblas_status(hipblasLtMatrixLayoutCreate(
+                &hipBLASLtHandles.matA, type_AB.type, gemm_desc.m, gemm_desc.k, gemm_desc.lda));
+        }
+
+        if(gemm_desc.transB)
+        {
+            check_hipblas_status(hipblasLtMatrixLayoutCreate(
+                &hipBLASLtHandles.matB, type_AB.type, gemm_desc.n, gemm_desc.k, gemm_desc.ldb));
+        }
+        else
+        {
+            check_hipblas_status(hipblasLtMatrixLayoutCreate(
+                &hipBLASLtHandles.matB, type_AB.type, gemm_desc.k, gemm_desc.n, gemm_desc.ldb));
+        }
+
         check_hipblas_status(hipblasLtMatrixLayoutCreate(
-            &hipBLASLtHandles.matB, hip_type_AB, gemm_desc.n, gemm_desc.k, gemm_desc.ldb));
-    }
-    else
-    {
+            &hipBLASLtHandles.matC, type_C.type, gemm_desc.m, gemm_desc.n, gemm_desc.ldc));
         check_hipblas_status(hipblasLtMatrixLayoutCreate(
-            &hipBLASLtHandles.matB, hip_type_AB, gemm_desc.k, gemm_desc.n, gemm_desc.ldb));
-    }
+            &hipBLASLtHandles.matD, type_C.type, gemm_desc.m, gemm_desc.n, gemm_desc.ldc));
 
-    check_hipblas_status(hipblasLtMatrixLayoutCreate(
-        &hipBLASLtHandles.matC, hip_type_C, gemm_desc.m, gemm_desc.n, gemm_desc.ldc));
-    check_hipblas_status(hipblasLtMatrixLayoutCreate(
-        &hipBLASLtHandles.matD, hip_type_C, gemm_desc.m, gemm_desc.n, gemm_desc.ldc));
+        if(gemm_desc.batch_count > 1 && batched)
+        {
+            const auto set_batch = [&](hipblasLtMatrixLayout_t layout,
+                                       const long long int& stride) {
+                check_hipblas_status(
+                    hipblasLtMatrixLayoutSetAttribute(layout,
+                                                      HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
+                                                      &gemm_desc.batch_count,
+                                                      sizeof(gemm_desc.batch_count)));
+                check_hipblas_status(
+                    hipblasLtMatrixLayoutSetAttribute(layout,
+                                                      HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
+                                                      &stride,
+                                                      sizeof(stride)));
+            };
+            set_batch(hipBLASLtHandles.matA, gemm_desc.strideA);
+            set_batch(hipBLASLtHandles.matB, gemm_desc.strideB);
+            set_batch(hipBLASLtHandles.matC, gemm_desc.strideC);
+            set_batch(hipBLASLtHandles.matD, gemm_desc.strideC);
+        }
 
-    if(gemm_desc.batch_count > 1 && !skip_batches)
-    {
-        check_hipblas_status(hipblasLtMatrixLayoutSetAttribute(hipBLASLtHandles.matA,
-                                                               HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
-                                                               &gemm_desc.batch_count,
-                                                               sizeof(gemm_desc.batch_count)));
         check_hipblas_status(
-            hipblasLtMatrixLayoutSetAttribute(hipBLASLtHandles.matA,
-                                              HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
-                                              &gemm_desc.strideA,
-                                              sizeof(gemm_desc.strideA)));
-        check_hipblas_status(hipblasLtMatrixLayoutSetAttribute(hipBLASLtHandles.matB,
-                                                               HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
-                                                               &gemm_desc.batch_count,
-                                                               sizeof(gemm_desc.batch_count)));
-        check_hipblas_status(
-            hipblasLtMatrixLayoutSetAttribute(hipBLASLtHandles.matB,
-                                              HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
-                                              &gemm_desc.strideB,
-                                              sizeof(gemm_desc.strideB)));
-        check_hipblas_status(hipblasLtMatrixLayoutSetAttribute(hipBLASLtHandles.matC,
-                                                               HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
-                                                               &gemm_desc.batch_count,
-                                                               sizeof(gemm_desc.batch_count)));
-        check_hipblas_status(
-            hipblasLtMatrixLayoutSetAttribute(hipBLASLtHandles.matC,
-                                              HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
-                                              &gemm_desc.strideC,
-                                              sizeof(gemm_desc.strideC)));
-        check_hipblas_status(hipblasLtMatrixLayoutSetAttribute(hipBLASLtHandles.matD,
-                                                               HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
-                                                               &gemm_desc.batch_count,
-                                                               sizeof(gemm_desc.batch_count)));
+            hipblasLtMatmulDescCreate(&hipBLASLtHandles.matmul, HIPBLAS_COMPUTE_32F, HIP_R_32F));
+
+        hipblasOperation_t opTypeA = gemm_desc.transA ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+        hipblasOperation_t opTypeB = gemm_desc.transB ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+        check_hipblas_status(hipblasLtMatmulDescSetAttribute(
+            hipBLASLtHandles.matmul, HIPBLASLT_MATMUL_DESC_TRANSA, &opTypeA, sizeof(opTypeA)));
+        check_hipblas_status(hipblasLtMatmulDescSetAttribute(
+            hipBLASLtHandles.matmul, HIPBLASLT_MATMUL_DESC_TRANSB, &opTypeB, sizeof(opTypeB)));
+
+        hipblasLtEpilogue_t epilogue = HIPBLASLT_EPILOGUE_DEFAULT;
+        check_hipblas_status(hipblasLtMatmulDescSetAttribute(
+            hipBLASLtHandles.matmul, HIPBLASLT_MATMUL_DESC_EPILOGUE, &epilogue, sizeof(epilogue)));
+
+        check_hipblas_status(hipblasLtMatmulPreferenceCreate(&hipBLASLtHandles.pref));
         check_hipblas_status(
-            hipblasLtMatrixLayoutSetAttribute(hipBLASLtHandles.matD,
-                                              HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
-                                              &gemm_desc.strideC,
-                                              sizeof(gemm_desc.strideC)));
+            hipblasLtMatmulPreferenceSetAttribute(hipBLASLtHandles.pref,
+                                                  HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                                                  &max_workspace_size,
+                                                  sizeof(max_workspace_size)));
+
+        const int requestSolutions = 1;
+        hipblasLtMatmulHeuristicResult_t heuristicResult[requestSolutions];
+        int returnedAlgoCount = 0;
+        check_hipblas_status(hipblasLtMatmulAlgoGetHeuristic(handle.HipblasLtHandle().get(),
+                                                             hipBLASLtHandles.matmul,
+                                                             hipBLASLtHandles.matA,
+                                                             hipBLASLtHandles.matB,
+                                                             hipBLASLtHandles.matC,
+                                                             hipBLASLtHandles.matD,
+                                                             hipBLASLtHandles.pref,
+                                                             requestSolutions,
+                                                             heuristicResult,
+                                                             &returnedAlgoCount));
+
+        if(returnedAlgoCount == 0)
+        {
+            MIOPEN_THROW(miopenStatusInternalError,
+                         "no solution found for hipBLASLt hipBLASLtHandles.matmul");
+        }
+
+        plan->algo = heuristicResult[0].algo;
+        return plan;
     }
 
-    check_hipblas_status(
-        hipblasLtMatmulDescCreate(&hipBLASLtHandles.matmul, HIPBLAS_COMPUTE_32F, HIP_R_32F));
-
-    hipblasOperation_t opTypeA = gemm_desc.transA ? HIPBLAS_OP_T : HIPBLAS_OP_N;
-    hipblasOperation_t opTypeB = gemm_desc.transB ? HIPBLAS_OP_T : HIPBLAS_OP_N;
-    check_hipblas_status(hipblasLtMatmulDescSetAttribute(
-        hipBLASLtHandles.matmul, HIPBLASLT_MATMUL_DESC_TRANSA, &opTypeA, sizeof(opTypeA)));
-    check_hipblas_status(hipblasLtMatmulDescSetAttribute(
-        hipBLASLtHandles.matmul, HIPBLASLT_MATMUL_DESC_TRANSB, &opTypeB, sizeof(opTypeB)));
-
-    hipblasLtEpilogue_t epilogue = HIPBLASLT_EPILOGUE_DEFAULT;
-    check_hipblas_status(hipblasLtMatmulDescSetAttribute(
-        hipBLASLtHandles.matmul, HIPBLASLT_MATMUL_DESC_EPILOGUE, &epilogue, sizeof(epilogue)));
-
-    /// \todo Need to request additional workspace for optimal gemm performance, and pass down
-    /// workspace size & pointer. --BrianHarrisonAMD June 2024
-    size_t max_workspace_size = 0;
-    void* workspace           = nullptr;
-    check_hipblas_status(hipblasLtMatmulPreferenceCreate(&hipBLASLtHandles.pref));
-    check_hipblas_status(
-        hipblasLtMatmulPreferenceSetAttribute(hipBLASLtHandles.pref,
-                                              HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
-                                              &max_workspace_size,
-                                              sizeof(max_workspace_size)));
-
-    const int requestSolutions = 1;
-    hipblasLtMatmulHeuristicResult_t heuristicResult[requestSolutions];
-    int returnedAlgoCount = 0;
-    check_hipblas_status(hipblasLtMatmulAlgoGetHeuristic(handle.HipblasLtHandle().get(),
-                                                         hipBLASLtHandles.matmul,
-                                                         hipBLASLtHandles.matA,
-                                                         hipBLASLtHandles.matB,
-                                                         hipBLASLtHandles.matC,
-                                                         hipBLASLtHandles.matD,
-                                                         hipBLASLtHandles.pref,
-                                                         requestSolutions,
-                                                         heuristicResult,
-                                                         &returnedAlgoCount));
-
-    if(returnedAlgoCount == 0)
+    void Run(const GemmPlan& plan,
+             const GemmDescriptor& gemm_desc,
+             bool,
+             ConstData_t A,
+             std::size_t a_offset,
+             ConstData_t B,
+             std::size_t b_offset,
+             Data_t C,
+             std::size_t c_offset) const override
     {
-        MIOPEN_THROW(miopenStatusInternalError,
-                     "no solution found for hipBLASLt hipBLASLtHandles.matmul");
-    }
+        const auto& hipblaslt_plan   = static_cast<const HipblasLtGemmPlan&>(plan);
+        const auto& hipBLASLtHandles = hipblaslt_plan.handles;
 
-    float alpha       = gemm_desc.alpha;
-    float beta        = gemm_desc.beta;
-    const void* aData = static_cast<const DataTypeAB*>(A) + a_offset;
-    const void* bData = static_cast<const DataTypeAB*>(B) + b_offset;
-    const void* cData = static_cast<const DataTypeC*>(C) + c_offset;
-    void* dData       = static_cast<DataTypeC*>(C) + c_offset;
+        /// \todo Need to request additional workspace for optimal gemm performance, and pass down
+        /// workspace size & pointer. --BrianHarrisonAMD June 2024
+        void* workspace = nullptr;
+
+        float alpha       = gemm_desc.alpha;
+        float beta        = gemm_desc.beta;
+        const void* aData = static_cast<const char*>(A) + a_offset * hipblaslt_plan.ab_size;
+        const void* bData = static_cast<const char*>(B) + b_offset * hipblaslt_plan.ab_size;
+        const void* cData = static_cast<const char*>(C) + c_offset * hipblaslt_plan.c_size;
+        void* dData       = static_cast<char*>(C) + c_offset * hipblaslt_plan.c_size;
 
-    {
         HipEventProfiler profiler(handle);
         check_hipblas_status(hipblasLtMatmul(handle.HipblasLtHandle().get(),
                                              hipBLASLtHandles.matmul,
@@ -511,13 +570,20 @@ static void miopen_hipblasLt_gemm(const miopen::Handle& handle,
                                              hipBLASLtHandles.matC,
                                              dData,
                                              hipBLASLtHandles.matD,
-                                             &heuristicResult[0].algo,
+                                             &hipblaslt_plan.algo,
                                              workspace,
                                              max_workspace_size,
                                              handle.GetStream()));
     }
-}
 
+private:
+    static constexpr std::size_t max_workspace_size = 0;
+
+    const miopen::Handle& handle;
+};
+
+// Descriptors and heuristic results are reused across the calls with the same problem,
+// which matters for the callers running many small GEMMs, e.g. RNN time steps.
 static void call_miopen_hipblasLt_gemm(const miopen::Handle& handle,
                                        const miopen::GemmDescriptor& gemm_desc,
                                        ConstData_t A,
@@ -528,118 +594,16 @@ static void call_miopen_hipblasLt_gemm(const miopen::Handle& handle,
                                        std::size_t c_offset,
                                        bool skip_batches)
 {
-    switch(gemm_desc.dataType)
-    {
-    case miopenInt8: {
-        MIOPEN_THROW(miopenStatusInternalError, "miopenInt8 is not supported for hipBLASLt");
-    }
-    break;
-    case miopenInt32: {
-        MIOPEN_THROW(miopenStatusInternalError, "miopenInt32 is not supported for hipBLASLt");
-    }
-    break;
-    case miopenHalf: {
-        miopen_hipblasLt_gemm<hipblasLtHalf, hipblasLtHalf>(handle,
-                                                            gemm_desc,
-                                                            A,
-                                                            a_offset,
-                                                            B,
-                                                            b_offset,
-                                                            HIP_R_16F,
-                                                            C,
-                                                            c_offset,
-                                                            HIP_R_16F,
-                                                            skip_batches);
-    }
-    break;
-    case miopenBFloat16: {
-        miopen_hipblasLt_gemm<hipblasLtBfloat16, hipblasLtBfloat16>(handle,
-                                                                    gemm_desc,
-                                                                    A,
-                                                                    a_offset,
-                                                                    B,
-                                                                    b_offset,
-                                                                    HIP_R_16BF,
-                                                                    C,
-                                                                    c_offset,
-                                                                    HIP_R_16BF,
-                                                                    skip_batches);
-    }
-    break;
-    case miopenFloat: {
-        miopen_hipblasLt_gemm<hipblasLtFloat, hipblasLtFloat>(handle,
-                                                              gemm_desc,
-                                                              A,
-                                                              a_offset,
-                                                              B,
-                                                              b_offset,
-                                                              HIP_R_32F,
-                                                              C,
-                                                              c_offset,
-                                                              HIP_R_32F,
-                                                              skip_batches);
-    }
-    break;
-    case miopenFloat8: {
-        const auto is_gfx94x = miopen::StartsWith(handle.GetDeviceName(), "gfx94");
-        if(is_gfx94x)
-        {
-            miopen_hipblasLt_gemm<hipblaslt_f8_fnuz, hipblaslt_f8_fnuz>(handle,
-                                                                        gemm_desc,
-                                                                        A,
-                                                                        a_offset,
-                                                                        B,
-                                                                        b_offset,
-                                                                        HIP_R_8F_E4M3_FNUZ,
-                                                                        C,
-                                                                        c_offset,
-                                                                        HIP_R_8F_E4M3_FNUZ,
-                                                                        skip_batches);
-        }
-        else
-        {
-            MIOPEN_THROW(miopenStatusInternalError,
-                         "miopenFloat8 is only supported for hipBlasLt on gfx94x");
-        }
-    }
-    break;
-    case miopenBFloat8: {
-        const auto is_gfx94x = miopen::StartsWith(handle.GetDeviceName(), "gfx94");
-        if(is_gfx94x)
-        {
-#ifdef ENABLE_HIPBLASLT_BF8
-            miopen_hipblasLt_gemm<hipblaslt_bf8_fnuz, hipblaslt_bf8_fnuz>(handle,
-                                                                          gemm_desc,
-                                                                          A,
-                                                                          a_offset,
-                                                                          B,
-                                                                          b_offset,
-                                                                          HIP_R_8F_E5M2_FNUZ,
-                                                                          C,
-                                                                          c_offset,
-                                                                          HIP_R_8F_E5M2_FNUZ,
-                                                                          skip_batches);
-#else
-            MIOPEN_THROW(miopenStatusInternalError,
-                         "miopenBFloat8 is not supported for this version of hipBlasLt on gfx94x");
-#endif
-        }
-        else
-        {
-            MIOPEN_THROW(miopenStatusInternalError,
-                         "miopenBFloat8 is only supported for hipBlasLt on gfx94x");
-        }
-    }
-    break;
-    case miopenDouble: {
-        MIOPEN_THROW(miopenStatusInternalError, "miopenDouble is not supported for hipBlasLt");
-    }
-    break;
-    case miopenInt64: {
-        MIOPEN_THROW(miopenStatusInternalError, "miopenInt64 is not supported for hipBlasLt");
-    }
-    break;
-    }
+    RunGemmPlan(HipblasLtGemmBackend{handle},
+                GemmPlanCache::GetInstance(),
+                gemm_desc,
+                !skip_batches,
+                A,
+                a_offset,
+                B,
+                b_offset,
+                C,
+                c_offset);
 }
 #endif
 
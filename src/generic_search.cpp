@@ -26,9 +26,12 @@
 
 #include <miopen/generic_search.hpp>
 #include <miopen/generic_search_controls.hpp>
+#include <miopen/tuning_cancel.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <chrono>
+#include <optional>
 
 namespace miopen {
 namespace solver {
@@ -49,6 +52,36 @@ TuningIterationScopedLimiter::~TuningIterationScopedLimiter()
 }
 } // namespace debug
 
+namespace {
+
+// Per thread, so concurrent finds and the background tuning do not share the limits.
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::optional<std::chrono::steady_clock::time_point> tuning_deadline;
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+thread_local const std::atomic<bool>* tuning_cancel = nullptr;
+
+} // namespace
+
+TuningTimeScopedLimiter::TuningTimeScopedLimiter(std::chrono::milliseconds budget)
+    : old_deadline(tuning_deadline)
+{
+    const auto deadline = std::chrono::steady_clock::now() + budget;
+    tuning_deadline     = old_deadline ? std::min(*old_deadline, deadline) : deadline;
+}
+
+TuningTimeScopedLimiter::~TuningTimeScopedLimiter() { tuning_deadline = old_deadline; }
+
+TuningCancelScope::TuningCancelScope(const std::atomic<bool>& flag) : old_flag(tuning_cancel)
+{
+    tuning_cancel = &flag;
+}
+
+TuningCancelScope::~TuningCancelScope() { tuning_cancel = old_flag; }
+
+const std::atomic<bool>* GetTuningCancelFlag() { return tuning_cancel; }
+
+bool IsTuningCancelled() { return tuning_cancel != nullptr && tuning_cancel->load(); }
+
 std::size_t GetTuningIterationsMax()
 {
     if(debug::tuning_iterations_limit)
@@ -58,7 +91,13 @@ std::size_t GetTuningIterationsMax()
 
 std::chrono::milliseconds GetTuningTimeMax()
 {
-    return std::chrono::milliseconds{env::value(MIOPEN_TUNING_TIME_MS_MAX)};
+    const auto limit = std::chrono::milliseconds{env::value(MIOPEN_TUNING_TIME_MS_MAX)};
+
+    if(!tuning_deadline)
+        return limit;
+    const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+        *tuning_deadline - std::chrono::steady_clock::now());
+    return std::clamp(left, std::chrono::milliseconds{0}, limit);
 }
 
 std::size_t GetTuningThreadsMax() { return env::value(MIOPEN_COMPILE_PARALLEL_LEVEL); }
@@ -120,3 +120,8 @@ extern "C" miopenStatus_t miopenEnableProfiling(miopenHandle_t handle, bool enab
 {
     return miopen::try_([&] { miopen::deref(handle).EnableProfiling(enable); });
 }
+
+extern "C" miopenStatus_t miopenWarmUpHandle(miopenHandle_t handle)
+{
+    return miopen::try_([&] { miopen::deref(handle).WarmUp(); });
+}
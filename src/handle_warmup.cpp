@@ -0,0 +1,62 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/handle.hpp>
+
+#include <miopen/binary_cache.hpp>
+#include <miopen/device_capabilities.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/mlo_internal.hpp>
+
+#include <chrono>
+#include <tuple>
+
+namespace miopen {
+
+void Handle::WarmUp()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    const auto& target = GetTargetProperties();
+    std::ignore        = GetCapabilities();
+#if MIOPEN_USE_ROCBLAS
+    std::ignore = rhandle();
+#endif
+#if MIOPEN_USE_HIPBLASLT
+    std::ignore = HipblasLtHandle();
+#endif
+    WarmUpBinaryCache(target, GetMaxComputeUnits());
+    FindDbRecord::WarmUp(*this);
+    std::ignore = GetDb(ExecutionContext{this});
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    MIOPEN_LOG_I("Handle warm-up time: "
+                 << std::chrono::duration<float, std::milli>(elapsed).count() << " ms");
+}
+
+} // namespace miopen
@@ -28,6 +28,7 @@
 #include <miopen/handle.hpp>
 
 #include <miopen/binary_cache.hpp>
+#include <miopen/device_capabilities.hpp>
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
@@ -51,6 +52,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <thread>
@@ -218,16 +220,62 @@ struct HandleImpl
 
     void set_ctx() const { miopen::set_device(this->device); }
 
-    std::string get_device_name() const
+    /// Identifies the physical device together with the driver and runtime versions.
+    std::string get_device_info_key() const
+    {
+        char bus_id[64] = {};
+        auto key        = std::string{};
+        if(hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) == hipSuccess)
+            key = bus_id;
+        else
+            key = "device " + std::to_string(device);
+
+        int driver_version  = 0;
+        int runtime_version = 0;
+        if(hipDriverGetVersion(&driver_version) != hipSuccess ||
+           hipRuntimeGetVersion(&runtime_version) != hipSuccess)
+            MIOPEN_THROW("Failed to query HIP driver and runtime versions");
+        return key + ", driver " + std::to_string(driver_version) + ", runtime " +
+               std::to_string(runtime_version);
+    }
+
+    /// All device properties the handle reports, with a single runtime query.
+    DeviceInfo query_device_info() const
     {
         hipDeviceProp_t props{};
-        hipGetDeviceProperties(&props, device);
-        const std::string name(props.gcnArchName);
-        MIOPEN_LOG_NQI("Raw device name: " << name);
-        return name; // NOLINT (performance-no-automatic-move)
+        const auto status = hipGetDeviceProperties(&props, device);
+        if(status != hipSuccess)
+            MIOPEN_THROW_HIP_STATUS(status, "Failed to query device properties");
+
+        auto info               = DeviceInfo{};
+        info.raw_name           = props.gcnArchName;
+        info.compute_units      = props.multiProcessorCount;
+        info.wavefront_width    = props.warpSize;
+        info.local_memory_size  = props.sharedMemPerBlock;
+        info.global_memory_size = props.totalGlobalMem;
+        info.image3d_max_width  = props.maxGridSize[0];
+        info.cooperative_launch = props.cooperativeLaunch != 0;
+        MIOPEN_LOG_NQI("Raw device name: " << info.raw_name);
+        return info;
+    }
+
+    const DeviceInfo& get_device_info()
+    {
+        if(const auto* info = device_info.load())
+            return *info;
+        const std::lock_guard<std::mutex> lock(lazy_init_mutex);
+        if(device_info == nullptr)
+            device_info =
+                &DeviceInfo::Get(get_device_info_key(), [&]() { return query_device_info(); });
+        return *device_info;
     }
 
     std::shared_timed_mutex stream_pool_mutex;
+    // Guards the members below which are created on first use, see Handle::WarmUp().
+    std::mutex lazy_init_mutex;
+    // Shared by the handles of the device, see DeviceInfo::Get().
+    std::atomic<const DeviceInfo*> device_info{nullptr};
+    std::atomic<const DeviceCapabilities*> capabilities{nullptr};
     // the main stream and main rocblas_handle rhandle_
 
 #if MIOPEN_USE_ROCBLAS
@@ -287,7 +335,6 @@ struct HandleImpl
     int device             = -1;
     Allocator allocator{};
     KernelCache cache;
-    TargetProperties target_properties;
 };
 
 Handle::Handle(miopenAcceleratorQueue_t stream) : impl(std::make_unique<HandleImpl>())
@@ -305,14 +352,7 @@ Handle::Handle(miopenAcceleratorQueue_t stream) : impl(std::make_unique<HandleIm
     this->impl->ms_resourse_ptr = &(this->impl->extra_stream_map.begin()->second);
 
     this->SetAllocator(nullptr, nullptr, nullptr);
-
-#if MIOPEN_USE_ROCBLAS
-    this->impl->rhandle_ = CreateRocblasHandle(stream);
-#endif
-#if MIOPEN_USE_HIPBLASLT
-    this->impl->hip_blasLt_handle = CreateHipblasLtHandle();
-#endif
-    this->impl->target_properties.Init(this);
+    // BLAS handles and target properties are created on first use.
     MIOPEN_LOG_NQI(*this);
 }
 
@@ -332,14 +372,7 @@ Handle::Handle() : impl(std::make_unique<HandleImpl>())
     this->impl->ms_resourse_ptr = &(this->impl->extra_stream_map.begin()->second);
 
     this->SetAllocator(nullptr, nullptr, nullptr);
-
-#if MIOPEN_USE_ROCBLAS
-    this->impl->rhandle_ = CreateRocblasHandle(root_stream);
-#endif
-#if MIOPEN_USE_HIPBLASLT
-    this->impl->hip_blasLt_handle = CreateHipblasLtHandle();
-#endif
-    this->impl->target_properties.Init(this);
+    // BLAS handles and target properties are created on first use.
     MIOPEN_LOG_NQI(*this);
 }
 
@@ -357,9 +390,13 @@ void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
     this->impl->ms_resourse_ptr = &(this->impl->extra_stream_map[streamID]);
 
 #if MIOPEN_USE_ROCBLAS
-    rocblas_set_stream(this->rhandle().get(), this->GetStream());
+    {
+        // A handle created later picks up the new stream by itself.
+        const std::lock_guard<std::mutex> lock(this->impl->lazy_init_mutex);
+        if(this->impl->rhandle_)
+            rocblas_set_stream(this->impl->rhandle_.get(), this->GetStream());
+    }
 #endif
-    this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
 }
 
@@ -700,24 +737,12 @@ void Handle::AccumKernelTime(float curr_time) const { this->impl->profiling_resu
 
 std::size_t Handle::GetLocalMemorySize() const
 {
-    int result;
-    auto status = hipDeviceGetAttribute(
-        &result, hipDeviceAttributeMaxSharedMemoryPerBlock, this->impl->device);
-    if(status != hipSuccess)
-        MIOPEN_THROW_HIP_STATUS(status);
-
-    return result;
+    return this->impl->get_device_info().local_memory_size;
 }
 
 std::size_t Handle::GetGlobalMemorySize() const
 {
-    size_t result;
-    auto status = hipDeviceTotalMem(&result, this->impl->device);
-
-    if(status != hipSuccess)
-        MIOPEN_THROW_HIP_STATUS(status);
-
-    return result;
+    return this->impl->get_device_info().global_memory_size;
 }
 
 std::size_t Handle::GetMaxComputeUnits() const
@@ -726,31 +751,17 @@ std::size_t Handle::GetMaxComputeUnits() const
     if(num_cu > 0)
         return num_cu;
 
-    int result;
-    auto status =
-        hipDeviceGetAttribute(&result, hipDeviceAttributeMultiprocessorCount, this->impl->device);
-    if(status != hipSuccess)
-        MIOPEN_THROW_HIP_STATUS(status);
-
-    return result;
+    return this->impl->get_device_info().compute_units;
 }
 
 std::size_t Handle::GetImage3dMaxWidth() const
 {
-    int result;
-    auto status = hipDeviceGetAttribute(&result, hipDeviceAttributeMaxGridDimX, this->impl->device);
-    if(status != hipSuccess)
-        MIOPEN_THROW_HIP_STATUS(status);
-
-    return result;
+    return this->impl->get_device_info().image3d_max_width;
 }
 
 std::size_t Handle::GetWavefrontWidth() const
 {
-    hipDeviceProp_t props{};
-    hipGetDeviceProperties(&props, this->impl->device);
-    auto result = static_cast<size_t>(props.warpSize);
-    return result;
+    return this->impl->get_device_info().wavefront_width;
 }
 
 // No HIP API that could return maximum memory allocation size
@@ -771,22 +782,26 @@ std::size_t Handle::GetMaxMemoryAllocSize()
 
 bool Handle::CooperativeLaunchSupported() const
 {
-    int result;
-    auto status =
-        hipDeviceGetAttribute(&result, hipDeviceAttributeCooperativeLaunch, this->impl->device);
-    if(status != hipSuccess)
-        MIOPEN_THROW_HIP_STATUS(status);
-
-    return result == 1;
+    return this->impl->get_device_info().cooperative_launch;
 }
 
-std::string Handle::GetDeviceNameImpl() const { return this->impl->get_device_name(); }
+std::string Handle::GetDeviceNameImpl() const { return this->impl->get_device_info().raw_name; }
 
-std::string Handle::GetDeviceName() const { return this->impl->target_properties.Name(); }
+std::string Handle::GetDeviceName() const { return this->GetTargetProperties().Name(); }
 
 const TargetProperties& Handle::GetTargetProperties() const
 {
-    return this->impl->target_properties;
+    return this->impl->get_device_info().target;
+}
+
+const DeviceCapabilities& Handle::GetCapabilities() const
+{
+    if(const auto* caps = this->impl->capabilities.load())
+        return *caps;
+    // Records are interned, concurrent callers store the same pointer.
+    const auto& caps         = DeviceCapabilities::Get(GetDeviceName(), GetMaxComputeUnits());
+    this->impl->capabilities = &caps;
+    return caps;
 }
 
 std::ostream& Handle::Print(std::ostream& os) const
@@ -812,7 +827,12 @@ shared<ConstData_t> Handle::CreateSubBuffer(ConstData_t data, std::size_t offset
 const rocblas_handle_ptr& Handle::rhandle() const
 {
     if(meopenHandle_current_stream_id == 0)
+    {
+        const std::lock_guard<std::mutex> lock(this->impl->lazy_init_mutex);
+        if(!this->impl->rhandle_)
+            this->impl->rhandle_ = CreateRocblasHandle(this->impl->root_stream.get());
         return this->impl->rhandle_;
+    }
     // locking only if handle in multistream mode
     std::shared_lock<std::shared_timed_mutex> lock(this->impl->stream_pool_mutex);
     return this->impl->ms_resourse_ptr->rhandle_pool.at(meopenHandle_current_stream_id - 1);
@@ -832,7 +852,12 @@ rocblas_handle_ptr Handle::CreateRocblasHandle(miopenAcceleratorQueue_t stream)
 const hipblasLt_handle_ptr& Handle::HipblasLtHandle() const
 {
     if(meopenHandle_current_stream_id == 0)
+    {
+        const std::lock_guard<std::mutex> lock(this->impl->lazy_init_mutex);
+        if(!this->impl->hip_blasLt_handle)
+            this->impl->hip_blasLt_handle = CreateHipblasLtHandle();
         return this->impl->hip_blasLt_handle;
+    }
     // locking only if handle in multistream mode
     std::shared_lock<std::shared_timed_mutex> lock(this->impl->stream_pool_mutex);
     return this->impl->ms_resourse_ptr->hhandle_pool.at(meopenHandle_current_stream_id - 1);
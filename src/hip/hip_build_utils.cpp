@@ -26,6 +26,7 @@
 
 #include <miopen/config.h>
 #include <miopen/hip_build_utils.hpp>
+#include <miopen/build_workspace.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/exec_utils.hpp>
 #include <miopen/logger.hpp>
@@ -114,19 +115,6 @@ static fs::path HipBuildImpl(const TmpDir& tmp_dir,
                              const TargetProperties& target,
                              const bool testing_mode)
 {
-    // Write out the include files
-    // Let's assume includes are overkill for feature tests & optimize'em out.
-    if(!testing_mode)
-    {
-        auto inc_list = GetKernelIncList();
-        fs::create_directories(tmp_dir);
-        for(const auto& inc_file : inc_list)
-        {
-            auto inc_src = GetKernelInc(inc_file);
-            WriteFile(inc_src, tmp_dir / inc_file);
-        }
-    }
-
     src += "\nint main() {}\n";
     WriteFile(src, tmp_dir / filename);
 
@@ -154,6 +142,10 @@ static fs::path HipBuildImpl(const TmpDir& tmp_dir,
     params += " -c";
     params += " -O3 ";
     params += " -Wno-unused-command-line-argument -I. ";
+    // The include files are shared by all the builds of the process.
+    // Let's assume includes are overkill for feature tests & optimize'em out.
+    if(!testing_mode)
+        params += "-I" + GetKernelIncludeDir().string() + " ";
     params += MIOPEN_STRINGIZE(HIP_COMPILER_FLAGS);
 
 #if MIOPEN_BUILD_DEV
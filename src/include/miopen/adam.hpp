@@ -108,5 +108,58 @@ TransformersAdamW(Handle& handle,
                   float step_size,
                   bool correct_bias,
                   bool is_amp);
+
+MIOPEN_INTERNALS_EXPORT miopenStatus_t
+AdamMultiTensor(Handle& handle,
+                int32_t tensorCount,
+                const TensorDescriptor* const* paramDescs,
+                Data_t const* params,
+                const TensorDescriptor* const* gradDescs,
+                ConstData_t const* grads,
+                const TensorDescriptor* const* expAvgDescs,
+                Data_t const* expAvgs,
+                const TensorDescriptor* const* expAvgSqDescs,
+                Data_t const* expAvgSqs,
+                const TensorDescriptor* const* maxExpAvgSqDescs,
+                Data_t const* maxExpAvgSqs,
+                const TensorDescriptor* const* paramFloat16Descs,
+                Data_t const* paramsFloat16,
+                ConstData_t gradScale,
+                ConstData_t foundInf,
+                uint32_t step,
+                float lr,
+                float beta1,
+                float beta2,
+                float weight_decay,
+                float eps,
+                bool amsgrad,
+                bool maximize,
+                bool adamw,
+                bool is_amp);
+
+MIOPEN_INTERNALS_EXPORT miopenStatus_t
+TransformersAdamWMultiTensor(Handle& handle,
+                             int32_t tensorCount,
+                             const TensorDescriptor* const* paramDescs,
+                             Data_t const* params,
+                             const TensorDescriptor* const* gradDescs,
+                             ConstData_t const* grads,
+                             const TensorDescriptor* const* expAvgDescs,
+                             Data_t const* expAvgs,
+                             const TensorDescriptor* const* expAvgSqDescs,
+                             Data_t const* expAvgSqs,
+                             const TensorDescriptor* const* paramFloat16Descs,
+                             Data_t const* paramsFloat16,
+                             ConstData_t gradScale,
+                             ConstData_t foundInf,
+                             uint32_t step,
+                             float lr,
+                             float beta1,
+                             float beta2,
+                             float eps,
+                             float weight_decay,
+                             float step_size,
+                             bool correct_bias,
+                             bool is_amp);
 } // namespace miopen
 #endif // _MIOPEN_ADAM_HPP_
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <miopen/adam/multi_tensor.hpp>
 #include <miopen/invoke_params.hpp>
 #include <miopen/tensor.hpp>
 
@@ -101,5 +102,56 @@ struct TransformersAdamWInvokeParams : public miopen::InvokeParams
     Data_t GetWorkspace() const { return nullptr; }
 };
 
+struct AdamMultiTensorInvokeParams : public miopen::InvokeParams
+{
+    AdamMultiTensorInvokeParams() = default;
+
+    const std::vector<MultiTensorLaunch>* launches = nullptr;
+    const std::vector<std::size_t>* numels         = nullptr;
+    std::size_t chunkSize                          = multi_tensor_chunk_size;
+
+    MultiTensorBuffers buffers;
+    ConstData_t gradScale = nullptr;
+    ConstData_t foundInf  = nullptr;
+
+    uint32_t step      = 0;
+    float lr           = 0.0;
+    float beta1        = 0.0;
+    float beta2        = 0.0;
+    float weight_decay = 0.0;
+    float eps          = 0.0;
+    bool amsgrad       = false;
+    bool maximize      = false;
+    bool adamw         = false;
+
+    std::size_t GetWorkspaceSize() const { return 0; }
+    Data_t GetWorkspace() const { return nullptr; }
+};
+
+struct TransformersAdamWMultiTensorInvokeParams : public miopen::InvokeParams
+{
+    TransformersAdamWMultiTensorInvokeParams() = default;
+
+    const std::vector<MultiTensorLaunch>* launches = nullptr;
+    const std::vector<std::size_t>* numels         = nullptr;
+    std::size_t chunkSize                          = multi_tensor_chunk_size;
+
+    MultiTensorBuffers buffers;
+    ConstData_t gradScale = nullptr;
+    ConstData_t foundInf  = nullptr;
+
+    uint32_t step      = 0;
+    float lr           = 0.0;
+    float beta1        = 0.0;
+    float beta2        = 0.0;
+    float eps          = 0.0;
+    float weight_decay = 0.0;
+    float step_size    = 0.0;
+    bool correct_bias  = true;
+
+    std::size_t GetWorkspaceSize() const { return 0; }
+    Data_t GetWorkspace() const { return nullptr; }
+};
+
 } // namespace adam
 } // namespace miopen
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/common.hpp>
+#include <miopen/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../../../kernels/adam_multi_tensor.hpp"
+
+namespace miopen {
+
+namespace adam {
+
+/// Number of elements updated by one workgroup of the multi-tensor kernels.
+constexpr std::size_t multi_tensor_chunk_size = 65536;
+
+/// One kernel launch of a multi-tensor optimizer step.
+struct MultiTensorLaunch
+{
+    /// Indices of the tensors bound to the kernel argument slots, in slot order.
+    std::vector<std::size_t> tensors;
+    /// Slot and chunk index processed by every workgroup.
+    std::vector<uint8_t> block_to_tensor;
+    std::vector<uint32_t> block_to_chunk;
+};
+
+/// Splits the tensors into chunks and packs them into as few launches as the kernel
+/// argument limits allow. Tensors are kept in order, a tensor may span several launches,
+/// and empty tensors are skipped.
+MIOPEN_INTERNALS_EXPORT std::vector<MultiTensorLaunch>
+MakeMultiTensorLaunches(const std::vector<std::size_t>& numels,
+                        std::size_t chunk_size  = multi_tensor_chunk_size,
+                        std::size_t max_tensors = ADAM_MULTI_TENSOR_MAX_TENSORS,
+                        std::size_t max_blocks  = ADAM_MULTI_TENSOR_MAX_BLOCKS);
+
+/// Device buffers of all the tensors of a multi-tensor step, indexed by tensor.
+/// maxExpAvgSqs and paramsFloat16 are optional and may be null.
+struct MultiTensorBuffers
+{
+    Data_t const* params        = nullptr;
+    ConstData_t const* grads    = nullptr;
+    Data_t const* expAvgs       = nullptr;
+    Data_t const* expAvgSqs     = nullptr;
+    Data_t const* maxExpAvgSqs  = nullptr;
+    Data_t const* paramsFloat16 = nullptr;
+};
+
+/// Builds the kernel argument of a single launch. The max_exp_avg_sq buffers are passed only
+/// with amsgrad, which requires all of them.
+MIOPEN_INTERNALS_EXPORT adam_multi_tensor_list_t
+MakeMultiTensorList(const MultiTensorLaunch& launch,
+                    const std::vector<std::size_t>& numels,
+                    const MultiTensorBuffers& buffers,
+                    bool amsgrad = false);
+
+} // namespace adam
+
+} // namespace miopen
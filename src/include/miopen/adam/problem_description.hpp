@@ -30,6 +30,7 @@
 #include <miopen/tensor.hpp>
 
 #include <string>
+#include <vector>
 
 namespace miopen {
 
@@ -161,6 +162,122 @@ private:
     NetworkConfig MakeForwardNetworkConfig() const;
 };
 
+/// Problem of updating many independent tensors in place with a single optimizer step.
+/// Optional per-tensor descriptor arrays (maxExpAvgSqDescs, paramFloat16Descs) may be null.
+struct MIOPEN_INTERNALS_EXPORT MultiTensorProblemDescription : ProblemDescriptionBase
+{
+    MultiTensorProblemDescription(int32_t tensorCount_,
+                                  const TensorDescriptor* const* paramDescs_,
+                                  const TensorDescriptor* const* gradDescs_,
+                                  const TensorDescriptor* const* expAvgDescs_,
+                                  const TensorDescriptor* const* expAvgSqDescs_,
+                                  const TensorDescriptor* const* maxExpAvgSqDescs_,
+                                  const TensorDescriptor* const* paramFloat16Descs_,
+                                  bool amsgrad_,
+                                  bool adamw_,
+                                  bool is_amp_,
+                                  bool transformers_)
+        : paramDescs(paramDescs_),
+          gradDescs(gradDescs_),
+          expAvgDescs(expAvgDescs_),
+          expAvgSqDescs(expAvgSqDescs_),
+          maxExpAvgSqDescs(maxExpAvgSqDescs_),
+          paramFloat16Descs(paramFloat16Descs_),
+          tensorCount(tensorCount_),
+          amsgrad(amsgrad_),
+          adamw(adamw_),
+          is_amp(is_amp_),
+          transformers(transformers_)
+    {
+        if(tensorCount <= 0)
+            MIOPEN_THROW(miopenStatusBadParm, "Adam: At least one tensor is required.");
+
+        if(amsgrad && maxExpAvgSqDescs == nullptr)
+        {
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "Adam: In the amsgrad, the max_exp_avg_sq tensor is required.");
+        }
+
+        const auto dtype      = paramDescs[0]->GetType();
+        const auto grad_dtype = gradDescs[0]->GetType();
+
+        if((dtype == miopenBFloat16) || (grad_dtype == miopenBFloat16))
+            MIOPEN_THROW(miopenStatusBadParm, "Adam: bfloat16 type is not supported.");
+
+        if(!is_amp && grad_dtype != dtype)
+            MIOPEN_THROW(miopenStatusBadParm, "Adam: Tensor types do not match.");
+
+        for(int32_t i = 0; i < tensorCount; ++i)
+        {
+            const auto numel = paramDescs[i]->GetElementSize();
+
+            if((paramDescs[i]->GetType() != dtype) || (gradDescs[i]->GetType() != grad_dtype) ||
+               (expAvgDescs[i]->GetType() != dtype) || (expAvgSqDescs[i]->GetType() != dtype) ||
+               (amsgrad && maxExpAvgSqDescs[i]->GetType() != dtype))
+            {
+                MIOPEN_THROW(miopenStatusBadParm, "Adam: Tensor types do not match.");
+            }
+
+            if(paramFloat16Descs != nullptr && paramFloat16Descs[i]->GetType() != miopenHalf)
+                MIOPEN_THROW(miopenStatusBadParm, "Adam: Invalid type of param_out_float16.");
+
+            if((gradDescs[i]->GetElementSize() != numel) ||
+               (expAvgDescs[i]->GetElementSize() != numel) ||
+               (expAvgSqDescs[i]->GetElementSize() != numel) ||
+               (amsgrad && maxExpAvgSqDescs[i]->GetElementSize() != numel) ||
+               (paramFloat16Descs != nullptr && paramFloat16Descs[i]->GetElementSize() != numel))
+            {
+                MIOPEN_THROW(miopenStatusBadParm, "Adam: Tensor dimension lengths do not match.");
+            }
+        }
+    }
+
+    int32_t GetTensorCount() const { return tensorCount; }
+    const TensorDescriptor& GetParamDesc(int32_t i) const { return *paramDescs[i]; }
+    const TensorDescriptor& GetGradDesc(int32_t i) const { return *gradDescs[i]; }
+    bool IsAmp() const { return is_amp; }
+    bool IsAdamW() const { return adamw; }
+    bool IsAmsgrad() const { return amsgrad; }
+    bool IsTransformers() const { return transformers; }
+    bool IsAllContiguous() const
+    {
+        for(int32_t i = 0; i < tensorCount; ++i)
+        {
+            if(!(paramDescs[i]->IsContiguous() && gradDescs[i]->IsContiguous() &&
+                 expAvgDescs[i]->IsContiguous() && expAvgSqDescs[i]->IsContiguous() &&
+                 (!amsgrad || maxExpAvgSqDescs[i]->IsContiguous()) &&
+                 (paramFloat16Descs == nullptr || paramFloat16Descs[i]->IsContiguous())))
+                return false;
+        }
+        return true;
+    }
+
+    /// Element counts of all the tensors, in order.
+    std::vector<std::size_t> GetNumels() const
+    {
+        auto numels = std::vector<std::size_t>(tensorCount);
+        for(int32_t i = 0; i < tensorCount; ++i)
+            numels[i] = paramDescs[i]->GetElementSize();
+        return numels;
+    }
+
+    NetworkConfig MakeNetworkConfig() const override;
+
+private:
+    const TensorDescriptor* const* paramDescs        = nullptr;
+    const TensorDescriptor* const* gradDescs         = nullptr;
+    const TensorDescriptor* const* expAvgDescs       = nullptr;
+    const TensorDescriptor* const* expAvgSqDescs     = nullptr;
+    const TensorDescriptor* const* maxExpAvgSqDescs  = nullptr;
+    const TensorDescriptor* const* paramFloat16Descs = nullptr;
+
+    int32_t tensorCount = 0;
+    bool amsgrad        = false;
+    bool adamw          = false;
+    bool is_amp         = false;
+    bool transformers   = false;
+};
+
 } // namespace adam
 
 } // namespace miopen
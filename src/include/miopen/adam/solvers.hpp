@@ -73,6 +73,48 @@ struct TransformersAdamW final : AdamSolver
     bool MayNeedWorkspace() const override { return false; }
 };
 
+using AdamMultiTensorSolver =
+    NonTunableSolverBase<ExecutionContext, miopen::adam::MultiTensorProblemDescription>;
+
+struct AdamMultiTensor final : AdamMultiTensorSolver
+{
+    const std::string& SolverDbId() const override { return GetSolverDbId<AdamMultiTensor>(); }
+
+    bool IsApplicable(const ExecutionContext& context,
+                      const miopen::adam::MultiTensorProblemDescription& problem) const override;
+    ConvSolution
+    GetSolution(const ExecutionContext& context,
+                const miopen::adam::MultiTensorProblemDescription& problem) const override;
+    std::size_t GetWorkspaceSize(
+        [[maybe_unused]] const ExecutionContext& context,
+        [[maybe_unused]] const miopen::adam::MultiTensorProblemDescription& problem) const override
+    {
+        return 0;
+    }
+    bool MayNeedWorkspace() const override { return false; }
+};
+
+struct TransformersAdamWMultiTensor final : AdamMultiTensorSolver
+{
+    const std::string& SolverDbId() const override
+    {
+        return GetSolverDbId<TransformersAdamWMultiTensor>();
+    }
+
+    bool IsApplicable(const ExecutionContext& context,
+                      const miopen::adam::MultiTensorProblemDescription& problem) const override;
+    ConvSolution
+    GetSolution(const ExecutionContext& context,
+                const miopen::adam::MultiTensorProblemDescription& problem) const override;
+    std::size_t GetWorkspaceSize(
+        [[maybe_unused]] const ExecutionContext& context,
+        [[maybe_unused]] const miopen::adam::MultiTensorProblemDescription& problem) const override
+    {
+        return 0;
+    }
+    bool MayNeedWorkspace() const override { return false; }
+};
+
 } // namespace adam
 
 } // namespace solver
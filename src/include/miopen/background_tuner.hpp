@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_BACKGROUND_TUNER_HPP_
+#define GUARD_MIOPEN_BACKGROUND_TUNER_HPP_
+
+#include <miopen/config.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+/// Runs tuning jobs (e.g. Find for problems that missed the find-db in immediate mode)
+/// on a low-priority worker thread, so that the request path only pays for queueing.
+/// The results are expected to be stored to the user databases by the jobs, and picked up
+/// by the subsequent calls.
+///
+/// The scheduling is separated from the worker thread: RunNext() can be driven
+/// manually with a simulated clock.
+class MIOPEN_INTERNALS_EXPORT BackgroundTuner
+{
+public:
+    using Duration = std::chrono::milliseconds;
+    /// Returns the current time. Must be monotonic.
+    using Clock = std::function<Duration()>;
+    using Job   = std::function<void()>;
+
+    enum class State
+    {
+        Unknown,
+        Queued,
+        Running,
+        Done,
+        Failed,
+        Dropped,
+    };
+
+    struct Options
+    {
+        /// Requests beyond this number of queued jobs are ignored.
+        std::size_t max_queued = 64;
+        /// Jobs not started within this time are dropped and may be requested again.
+        Duration max_wait = std::chrono::minutes{10};
+        /// Fraction of the time the worker is allowed to spend running jobs, (0, 1].
+        double duty_cycle = 0.5;
+        /// The oldest finished jobs beyond this number are forgotten and may be requested again.
+        std::size_t max_finished = 1024;
+    };
+
+    explicit BackgroundTuner(Options options_, Clock clock_ = SteadyClock);
+    ~BackgroundTuner();
+
+    BackgroundTuner(const BackgroundTuner&) = delete;
+    BackgroundTuner& operator=(const BackgroundTuner&) = delete;
+
+    /// Queues the job unless a job with the same key is queued, running or finished.
+    /// A repeated request raises the priority of the queued job.
+    /// Returns true if the job has been queued.
+    bool Enqueue(const std::string& key, Job job);
+
+    State GetState(const std::string& key) const;
+    std::size_t GetQueueSize() const;
+    /// Number of successfully finished jobs, changes every time new results become available.
+    std::size_t GetGeneration() const;
+
+    /// Runs the most requested job if the duty cycle allows. Exceptions from the job mark it
+    /// as failed. Returns the delay until the next job may run or nullopt if nothing is queued.
+    std::optional<Duration> RunNext();
+
+    /// Starts the worker thread which calls RunNext() with the real time.
+    void Start();
+    /// Stops the worker thread after the current job. Queued jobs are kept.
+    void Stop();
+    /// Stops the worker thread and waits for it, setting the cancellation flag for the job in
+    /// flight. The wait is as long as it takes the job to notice the flag.
+    void Shutdown();
+
+    /// Set by Shutdown(). Long jobs are expected to check it, e.g. with TuningCancelScope.
+    const std::atomic<bool>& GetCancelFlag() const { return cancel; }
+
+    /// Process-wide instance configured from the environment.
+    /// Returns nullptr if background tuning is disabled. The instance is shut down at exit,
+    /// cancelling the job in flight.
+    static BackgroundTuner* GetInstance();
+
+    static Duration SteadyClock();
+
+private:
+    struct Entry
+    {
+        State state = State::Unknown;
+        Job job;
+        Duration queued_at{};
+        std::size_t requests = 0;
+    };
+
+    void WorkerLoop();
+    void Finish(const std::string& key, State state);
+
+    const Options options;
+    const Clock clock;
+
+    mutable std::mutex mutex;
+    std::condition_variable wake_up;
+    std::unordered_map<std::string, Entry> entries;
+    std::vector<std::string> queue;
+    /// Keys of the finished jobs in the order of completion, the oldest ones are evicted first.
+    std::deque<std::string> finished;
+    std::size_t generation = 0;
+    Duration next_run{};
+
+    std::thread worker;
+    bool stop = false;
+    std::atomic<bool> cancel{false};
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_BACKGROUND_TUNER_HPP_
@@ -41,6 +41,9 @@ GetCacheFile(const std::string& device, const fs::path& name, const std::string&
 
 MIOPEN_INTERNALS_EXPORT fs::path GetCachePath(bool is_system);
 
+/// Opens the kernel cache of the target ahead of the first kernel build.
+void WarmUpBinaryCache(const TargetProperties& target, std::size_t num_cu);
+
 #if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
 fs::path LoadBinary(const TargetProperties& target,
                     std::size_t num_cu,
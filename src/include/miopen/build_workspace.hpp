@@ -0,0 +1,64 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_BUILD_WORKSPACE_HPP
+#define GUARD_MIOPEN_BUILD_WORKSPACE_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+
+namespace miopen {
+
+/// Returns the directory where the build workspace of the process is placed.
+/// Prefers tmpfs (/dev/shm) over the system temporary directory, so the sources and
+/// objects passed to the offline compilers do not touch the disk. tmpfs is skipped when it
+/// has less than MIOPEN_BUILD_WORKSPACE_TMPFS_MIN_MB available.
+/// MIOPEN_BUILD_WORKSPACE_DIR overrides the choice.
+MIOPEN_INTERNALS_EXPORT fs::path GetBuildWorkspaceBase();
+
+/// Per-process directory holding all temporary build directories (see TmpDir).
+/// Created on first use and removed as a whole at process exit. The name holds the pid of
+/// the process, and the workspaces left by killed processes are removed when a new one is
+/// created in the same place.
+MIOPEN_INTERNALS_EXPORT const fs::path& GetBuildWorkspace();
+
+/// Directory with the inlined kernel headers. The headers are written once per process
+/// and shared by all the builds. Placed in the system temporary directory if writing them
+/// to the workspace fails.
+MIOPEN_INTERNALS_EXPORT const fs::path& GetKernelIncludeDir();
+
+/// Removes the workspaces in \p base whose owner processes no longer exist.
+/// Returns the number of removed workspaces.
+MIOPEN_INTERNALS_EXPORT std::size_t RemoveAbandonedBuildWorkspaces(const fs::path& base);
+
+/// Writes all the inlined kernel headers into the directory.
+MIOPEN_INTERNALS_EXPORT void WriteKernelIncludes(const fs::path& dir);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_BUILD_WORKSPACE_HPP
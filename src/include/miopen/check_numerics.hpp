@@ -15,6 +15,7 @@ struct CheckNumerics
     static const int Throw        = 0x04; // MIOPEN_THROW on abnormal result
     static const int Abort        = 0x08; // abort on abnormal result (to drop into debugger)
     static const int ComputeStats = 0x10; // Print mean/absmean/min/max (slow)
+    static const int Histograms   = 0x20; // Accumulate per-tensor stats on host, NumericsMonitor
 };
 
 MIOPEN_INTERNALS_EXPORT bool CheckNumericsEnabled(int bitMask = -1);
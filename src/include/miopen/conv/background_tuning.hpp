@@ -0,0 +1,48 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/execution_context.hpp>
+
+#include <string>
+
+namespace miopen {
+namespace conv {
+
+struct ProblemDescription;
+
+/// Key of the background tuning job for the problem on the device of the context.
+std::string MakeBackgroundTuningKey(const ExecutionContext& ctx, const ProblemDescription& problem);
+
+/// Queues Find for the problem to the background tuner, if it is enabled
+/// (MIOPEN_ENABLE_BACKGROUND_TUNING). Intended for find-db misses in immediate mode:
+/// the results are stored to the user find-db and perf-db, so the next GetSolutions()
+/// call returns the tuned solution instead of the heuristic one.
+void RequestBackgroundTuning(const ExecutionContext& ctx, const ProblemDescription& problem);
+
+} // namespace conv
+} // namespace miopen
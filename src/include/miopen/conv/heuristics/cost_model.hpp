@@ -0,0 +1,220 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_CONV_HEURISTICS_COST_MODEL_HPP_
+#define GUARD_MIOPEN_CONV_HEURISTICS_COST_MODEL_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/miopen.h>
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct ExecutionContext;
+
+namespace solver {
+struct Id;
+} // namespace solver
+
+namespace conv {
+
+struct ProblemDescription;
+
+/// Analytic (roofline-style) execution time model for convolution solvers.
+///
+/// The model is used on the immediate mode fallback path when neither find-db nor
+/// AI heuristics can rank the applicable solvers. It works entirely on the host and
+/// does not require the device; everything it needs is taken from the problem
+/// description and a handful of device characteristics.
+namespace cost_model {
+
+enum class SolverFamily
+{
+    Direct,       // OpenCL/HIP direct and naive kernels
+    Asm1x1,       // ConvAsm1x1U*, ConvAsmBwdWrW1x1
+    Asm3x3,       // ConvAsm3x3U, ConvAsmBwdWrW3x3
+    Winograd,     // Binary, multi-pass and Fury Winograd
+    ImplicitGemm, // HIP/ASM/CK/MLIR implicit GEMM
+    Gemm,         // rocBLAS/hipBLASLt based (im2col + GEMM)
+    Fft,          // FFT-based convolution
+    Unknown,
+};
+
+constexpr std::size_t SolverFamilyCount = static_cast<std::size_t>(SolverFamily::Unknown) + 1;
+
+MIOPEN_INTERNALS_EXPORT const char* ToString(SolverFamily family);
+MIOPEN_INTERNALS_EXPORT SolverFamily SolverFamilyFromString(const std::string& str);
+
+/// Classifies solver by its algorithm and name.
+MIOPEN_INTERNALS_EXPORT SolverFamily GetSolverFamily(const std::string& solver_name,
+                                                     miopenConvAlgorithm_t algo);
+MIOPEN_INTERNALS_EXPORT SolverFamily GetSolverFamily(const solver::Id& id);
+
+/// Device characteristics the model relies on.
+struct DeviceCaps
+{
+    std::size_t num_cu            = 64;
+    double clock_ghz              = 1.5;
+    double fp32_flops_per_cu_clk  = 128; // Vector ALU, FMA counted as 2 flops.
+    double matrix_fp16_multiplier = 2;   // Peak of fp16/bf16 matrix (or packed) math vs fp32.
+    double bandwidth_gbps         = 512; // Global memory bandwidth of the whole device.
+
+    /// Returns peak GFLOPS for the given data type. \p matrix_cores tells if the solver
+    /// is able to use matrix instructions (xdlops/wmma).
+    MIOPEN_INTERNALS_EXPORT double PeakGflops(miopenDataType_t type, bool matrix_cores) const;
+
+    /// Builds capabilities from the device name (like "gfx90a") and CU count.
+    /// Unknown devices get conservative defaults scaled by the number of CUs.
+    MIOPEN_INTERNALS_EXPORT static DeviceCaps FromName(const std::string& name,
+                                                       std::size_t num_cu);
+    MIOPEN_INTERNALS_EXPORT static DeviceCaps FromContext(const ExecutionContext& ctx);
+};
+
+/// Geometry of a convolution in the form suitable for the model. For backward
+/// directions the fields still describe the forward convolution.
+struct ConvShape
+{
+    std::size_t n     = 1;
+    std::size_t c     = 1; // input channels of the forward convolution
+    std::size_t k     = 1; // output channels of the forward convolution
+    std::size_t group = 1;
+    std::array<std::size_t, 3> in_spatial{1, 1, 1};  // D, H, W
+    std::array<std::size_t, 3> out_spatial{1, 1, 1}; // D, H, W
+    std::array<std::size_t, 3> filter{1, 1, 1};      // D, H, W
+    std::array<std::size_t, 3> stride{1, 1, 1};      // D, H, W
+    miopenDataType_t type = miopenFloat;
+
+    MIOPEN_INTERNALS_EXPORT static ConvShape From(const ProblemDescription& problem);
+
+    /// Parses find-db/perf-db problem key, for example
+    /// "64-56-56-3x3-64-56-56-16-1x1-1x1-1x1-0-NCHW-FP32-F".
+    /// Returns false when the key is ill-formed.
+    MIOPEN_INTERNALS_EXPORT static bool FromDbKey(const std::string& key, ConvShape& shape);
+
+    MIOPEN_INTERNALS_EXPORT std::size_t FilterSize() const;
+    MIOPEN_INTERNALS_EXPORT std::size_t InSpatialSize() const;
+    MIOPEN_INTERNALS_EXPORT std::size_t OutSpatialSize() const;
+    /// Arithmetic operations of the Direct algorithm.
+    MIOPEN_INTERNALS_EXPORT double DirectFlops() const;
+    /// Minimal amount of memory traffic: each tensor is read or written once.
+    MIOPEN_INTERNALS_EXPORT double MinBytes() const;
+};
+
+/// Per-family efficiency coefficients. Efficiencies are fractions of the peak
+/// compute throughput and memory bandwidth which the family typically reaches.
+struct FamilyCoefficients
+{
+    double compute_efficiency = 0.3;
+    double memory_efficiency  = 0.5;
+    double launch_overhead_ms = 0.01;
+};
+
+/// Work of the solver family relative to the Direct algorithm in flops and bytes.
+struct FamilyWork
+{
+    double flops      = 0.0;
+    double bytes      = 0.0;
+    bool matrix_cores = false;
+};
+
+MIOPEN_INTERNALS_EXPORT FamilyWork GetFamilyWork(SolverFamily family, const ConvShape& shape);
+
+class MIOPEN_INTERNALS_EXPORT CostModel
+{
+public:
+    CostModel();
+
+    const FamilyCoefficients& Get(SolverFamily family) const;
+    void Set(SolverFamily family, const FamilyCoefficients& coeffs);
+
+    /// Estimated execution time in milliseconds.
+    /// When \p wti is positive, it is used instead of the family compute efficiency:
+    /// WTI is the fraction of the peak the solver reaches relative to the Direct algorithm
+    /// (see SolverInterface::GetWti).
+    float Estimate(const DeviceCaps& device,
+                   const ConvShape& shape,
+                   SolverFamily family,
+                   float wti = -1.0f) const;
+
+    /// Estimate() for the immediate mode fallback. The built-in coefficients are not fitted to
+    /// any system, so solvers with unknown (negative) \p wti are estimated only by a calibrated
+    /// model. Otherwise returns a negative value, and such solvers are not ranked.
+    float EstimateFallback(const DeviceCaps& device,
+                           const ConvShape& shape,
+                           SolverFamily family,
+                           float wti) const;
+
+    /// Tells if the coefficients were loaded, e.g. the ones written by the calibration tool.
+    bool IsCalibrated() const { return calibrated; }
+
+    /// Reads coefficients in the form written by Save(). Families missing in the
+    /// stream keep their current values. Returns false on parsing errors.
+    bool Load(std::istream& stream);
+    void Save(std::ostream& stream) const;
+
+    /// Coefficients used by the library. These are built-in defaults optionally
+    /// overridden by the file set via MIOPEN_DEBUG_CONV_COST_MODEL_COEFFS_PATH.
+    static const CostModel& GetDefault();
+
+private:
+    std::array<FamilyCoefficients, SolverFamilyCount> coefficients;
+    bool calibrated = false;
+};
+
+/// A measured point used for calibration.
+struct CalibrationSample
+{
+    SolverFamily family;
+    ConvShape shape;
+    float measured_ms;
+};
+
+/// Fits family coefficients to the measured timings (e.g. taken from find-db).
+/// Launch overhead is the lower bound of timings of the smallest problems,
+/// and efficiencies are geometric means of the ratios ideal/measured for
+/// compute-bound and memory-bound samples respectively. Families without samples
+/// keep the coefficients of \p initial.
+MIOPEN_INTERNALS_EXPORT CostModel Calibrate(const DeviceCaps& device,
+                                            const std::vector<CalibrationSample>& samples,
+                                            const CostModel& initial = CostModel{});
+
+/// Convenience wrapper used on the immediate mode fallback path, see
+/// CostModel::EstimateFallback().
+MIOPEN_INTERNALS_EXPORT float EstimateTime(const ExecutionContext& ctx,
+                                           const ProblemDescription& problem,
+                                           const solver::Id& id,
+                                           float wti);
+
+} // namespace cost_model
+} // namespace conv
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_CONV_HEURISTICS_COST_MODEL_HPP_
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_CONV_TRANSFORM_PLAN_HPP_
+#define GUARD_MIOPEN_CONV_TRANSFORM_PLAN_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/buffer_info.hpp>
+
+#include <cstddef>
+
+namespace miopen {
+namespace conv {
+
+namespace cost_model {
+struct ConvShape;
+} // namespace cost_model
+
+/// Workspace layout and arithmetic of the transform based convolution solvers, computed on the
+/// host without the device. The plans describe the same buffers the solvers allocate, so they
+/// can be used to size workspaces, to estimate costs, and by the host references in the tests
+/// (test/cpu_winograd.hpp and test/cpu_fft.hpp).
+///
+/// Flop counts assume dense transform matrices applied separably (rows, then columns) and
+/// count a multiply-add as 2 flops.
+
+enum class WinogradScheme
+{
+    /// ConvBinWinoRxS, ConvWinoFuryRxS: the transforms are fused into a single kernel and need
+    /// no workspace. Larger filters are split into r x r blocks, stride 2 into 4 phases.
+    Fused,
+    /// ConvMPBidirectWinograd: input, filter and output transform kernels around a GEMM batched
+    /// over the transformed tile points. Forward and backward data, filter of r x r, stride 1.
+    Bidirectional,
+    /// ConvWinograd3x3MultipassWrW: the same structure for the backward weights direction, the
+    /// filter gradient being the m x m output and dy being split into r x r filter blocks.
+    MultipassWrW,
+};
+
+struct MIOPEN_INTERNALS_EXPORT WinogradPlan
+{
+    WinogradScheme scheme = WinogradScheme::Bidirectional;
+
+    /// F(m x m, r x r): output tile, filter tile and transformed tile sizes.
+    int tile_h   = 2;
+    int tile_w   = 2;
+    int filter_h = 3;
+    int filter_w = 3;
+    int xform_h  = 4;
+    int xform_w  = 4;
+
+    /// Geometry of the computed convolution. For the backward data direction, c and k are
+    /// swapped and the input is dy: the plan describes the convolution the solver runs.
+    std::size_t group  = 1;
+    std::size_t n      = 1;
+    std::size_t c      = 1; // per group
+    std::size_t k      = 1; // per group
+    std::size_t in_h   = 1;
+    std::size_t in_w   = 1;
+    std::size_t out_h  = 1;
+    std::size_t out_w  = 1;
+    int pad_h          = 0;
+    int pad_w          = 0;
+    bool backward_data = false;
+
+    std::size_t data_tiles_h   = 1;
+    std::size_t data_tiles_w   = 1;
+    std::size_t filter_tiles_h = 1;
+    std::size_t filter_tiles_w = 1;
+
+    /// Number of 2D tile transforms of each kind.
+    std::size_t input_transforms  = 0;
+    std::size_t filter_transforms = 0;
+    std::size_t output_transforms = 0;
+
+    /// The elementwise stage as a batched GEMM: gemm_batch products of m x k by k x n.
+    std::size_t gemm_batch = 0;
+    std::size_t gemm_m     = 0;
+    std::size_t gemm_n     = 0;
+    std::size_t gemm_k     = 0;
+
+    /// Transformed buffers in the layouts of the solvers, empty for the fused scheme.
+    BuffInfo in;
+    BuffInfo out;
+    BuffInfo wei;
+
+    /// Buffers follow each other in the workspace: in, out, wei.
+    std::size_t GetInOffset() const { return 0; }
+    std::size_t GetOutOffset() const { return in.total_byte_size; }
+    std::size_t GetWeiOffset() const { return in.total_byte_size + out.total_byte_size; }
+    std::size_t GetWorkspaceSize() const
+    {
+        return in.total_byte_size + out.total_byte_size + wei.total_byte_size;
+    }
+
+    double GetInputTransformFlops() const;
+    double GetFilterTransformFlops() const;
+    double GetOutputTransformFlops() const;
+    double GetGemmFlops() const;
+    double GetFlops() const;
+
+    /// Plans F(tile x tile, filter x filter) for the forward shape. Pads are these of the forward
+    /// convolution. Element size is the one of the transformed data, fp32 by default.
+    static WinogradPlan Make(WinogradScheme scheme,
+                             const cost_model::ConvShape& shape,
+                             int tile_h,
+                             int filter_h,
+                             int tile_w,
+                             int filter_w,
+                             int pad_h,
+                             int pad_w,
+                             bool backward_data       = false,
+                             std::size_t element_size = 4);
+};
+
+/// The pipeline of the fft solver: real to complex 2D FFTs of the padded images and filters,
+/// complex GEMMs batched over the frequencies, inverse FFT of the result. The workspace holds
+/// complex floats in two halves: the second one receives the transformed source images
+/// followed by the transformed filters, the first one the products. Each is stored frequency
+/// major, with a stride padded by FFTConvParams::TransposePadding.
+struct MIOPEN_INTERNALS_EXPORT FftPlan
+{
+    int tile_h = 32;
+    int tile_w = 32;
+    /// Complex values kept per transformed tile: tile_h * (tile_w / 2 + 1).
+    std::size_t frequencies = 0;
+
+    /// Geometry of the forward convolution.
+    std::size_t n     = 1;
+    std::size_t c     = 1;
+    std::size_t k     = 1;
+    std::size_t in_h  = 1;
+    std::size_t in_w  = 1;
+    std::size_t out_h = 1;
+    std::size_t out_w = 1;
+    std::size_t wei_h = 1;
+    std::size_t wei_w = 1;
+    int pad_h         = 0;
+    int pad_w         = 0;
+    /// dy is transformed instead of x, the result is dx.
+    bool backward_data = false;
+
+    /// Channels of the transformed source and of the result.
+    std::size_t GetSourceChannels() const { return backward_data ? k : c; }
+    std::size_t GetResultChannels() const { return backward_data ? c : k; }
+
+    /// Strides between frequencies, in complex values.
+    std::size_t GetSourceStride() const;
+    std::size_t GetFilterStride() const;
+    std::size_t GetResultStride() const;
+
+    /// Offsets in complex values.
+    std::size_t GetSourceOffset() const { return GetHalfSize(); }
+    std::size_t GetFilterOffset() const { return GetHalfSize() + frequencies * GetSourceStride(); }
+    std::size_t GetResultOffset() const { return 0; }
+
+    /// Size of a workspace half in complex values.
+    std::size_t GetHalfSize() const;
+    std::size_t GetWorkspaceSize() const;
+
+    /// Tiles are large enough for the padded images without wrapping around.
+    bool IsSupported() const;
+
+    double GetTransformFlops() const;
+    double GetGemmFlops() const;
+    double GetFlops() const;
+
+    /// Plans the tile chosen by the solver for the input size (FFTConvParams). Only stride 1,
+    /// groups of 1 and no dilation are possible.
+    static FftPlan Make(const cost_model::ConvShape& shape,
+                        int pad_h,
+                        int pad_w,
+                        bool backward_data = false);
+};
+
+} // namespace conv
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_CONV_TRANSFORM_PLAN_HPP_
@@ -30,25 +30,21 @@ namespace miopen {
 
 struct FFTConvParams
 {
-    static int TileSize(int in_h, int in_w)
+    /// FFT tile height and width, the tiles are square.
+    static int TileDim(int in_h, int in_w)
     {
-        int NX, NY; // fft tile width, height
-
         if((in_h == 7) && (in_w == 7))
-        {
-            NY = 12;
-            NX = 12;
-        }
-        else if((in_h == 14) && (in_w == 14))
-        {
-            NY = 18;
-            NX = 18;
-        }
-        else
-        {
-            NY = 32;
-            NX = 32;
-        }
+            return 12;
+        if((in_h == 14) && (in_w == 14))
+            return 18;
+        return 32;
+    }
+
+    /// Complex values of the real to complex transform of a tile.
+    static int TileSize(int in_h, int in_w)
+    {
+        const int NY = TileDim(in_h, in_w); // fft tile height
+        const int NX = NY;                  // fft tile width
 
         return NY * (1 + NX / 2);
     }
@@ -221,6 +221,15 @@ public:
         return users ? users : _installed.FindRecord(args...);
     }
 
+    /// Like FindRecord(), but the user db is searched by its own key, for records that are
+    /// keyed by more in the user db than in the installed one.
+    template <typename TUserKey, typename TInstalledKey>
+    auto FindRecordSplit(const TUserKey& user_key, const TInstalledKey& installed_key)
+    {
+        auto users = _user.FindRecord(user_key);
+        return users ? users : _installed.FindRecord(installed_key);
+    }
+
     template <typename... U>
     auto StoreRecord(const U&... args)
     {
@@ -301,6 +310,12 @@ public:
         return Measure("FindRecord", [&]() { return inner.FindRecord(args...); });
     }
 
+    template <typename... U>
+    auto FindRecordSplit(const U&... args)
+    {
+        return Measure("FindRecord", [&]() { return inner.FindRecordSplit(args...); });
+    }
+
     template <typename... U>
     auto StoreRecord(U&... record)
     {
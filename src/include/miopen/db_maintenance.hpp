@@ -0,0 +1,129 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_DB_MAINTENANCE_HPP_
+#define GUARD_MIOPEN_DB_MAINTENANCE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+class KernDb;
+class SQLitePerfDb;
+
+/// Contents of a text find-db or perf-db: key -> id -> values, ordered.
+using TextDbRecords = std::map<std::string, std::map<std::string, std::string>>;
+
+struct TextDbReadStats
+{
+    std::size_t lines = 0;
+    /// Records and items without the separators, skipped.
+    std::size_t ill_formed = 0;
+    /// Records with a key seen before in the same file. Their values are merged, the
+    /// first occurrence of an id wins, as in lookups by the library.
+    std::size_t duplicate_keys = 0;
+};
+
+/// Reads the whole text db. Large files are split into chunks parsed in parallel by up
+/// to n_threads threads (0 means the number of hardware threads).
+MIOPEN_INTERNALS_EXPORT TextDbRecords ReadTextDb(const fs::path& file,
+                                                 std::size_t n_threads = 0,
+                                                 TextDbReadStats* stats = nullptr);
+
+/// Replaces the file with the records via a temporary file, so that readers never see
+/// a partial file.
+MIOPEN_INTERNALS_EXPORT void WriteTextDb(const fs::path& file, const TextDbRecords& records);
+
+/// Reads, updates and writes the text db under the same lock the library uses.
+MIOPEN_INTERNALS_EXPORT void UpdateTextDb(const fs::path& file,
+                                          const std::function<void(TextDbRecords&)>& update,
+                                          std::size_t n_threads = 0);
+
+/// Returns the time of a find-db value, or infinity if it is not known.
+MIOPEN_INTERNALS_EXPORT float GetFindDbTime(const std::string& values);
+
+/// Values are listed as "key:id".
+struct TextDbDiff
+{
+    std::vector<std::string> removed;
+    std::vector<std::string> added;
+    std::vector<std::string> changed;
+};
+
+MIOPEN_INTERNALS_EXPORT TextDbDiff DiffTextDbs(const TextDbRecords& from, const TextDbRecords& to);
+
+/// Removes the values with ids rejected by the predicate and the records left empty.
+/// Returns the number of removed values.
+MIOPEN_INTERNALS_EXPORT std::size_t
+PruneTextDb(TextDbRecords& records, const std::function<bool(const std::string& id)>& keep);
+
+struct DbSolverStats
+{
+    std::size_t values = 0;
+    /// Find-db only: records where the solver has the best time.
+    std::size_t best = 0;
+};
+
+struct DbStats
+{
+    std::size_t records = 0;
+    std::size_t values  = 0;
+    std::map<std::string, DbSolverStats> per_solver;
+};
+
+MIOPEN_INTERNALS_EXPORT DbStats GetTextDbStats(DbKinds db_kind, const TextDbRecords& records);
+
+#if MIOPEN_ENABLE_SQLITE
+MIOPEN_INTERNALS_EXPORT DbStats GetPerfDbStats(SQLitePerfDb& db);
+/// Returns the number of removed values.
+MIOPEN_INTERNALS_EXPORT std::size_t
+PrunePerfDb(SQLitePerfDb& db, const std::function<bool(const std::string& id)>& keep);
+
+/// Copies the kernels missing in the target. Returns the number of copied kernels.
+MIOPEN_INTERNALS_EXPORT std::size_t MergeKernDbs(KernDb& target, KernDb& source);
+
+/// Kernel names are used as the solver names of the stats.
+MIOPEN_INTERNALS_EXPORT DbStats GetKernDbStats(KernDb& db);
+/// Removes the kernels which can not be loaded, e.g. because of a checksum mismatch.
+/// The blobs are verified by up to n_threads threads. Returns the number of removed kernels.
+MIOPEN_INTERNALS_EXPORT std::size_t PruneKernDb(KernDb& db, std::size_t n_threads = 0);
+
+/// Drops the orphaned perf-db problem configs and compacts the file.
+MIOPEN_INTERNALS_EXPORT void VacuumPerfDb(SQLitePerfDb& db);
+MIOPEN_INTERNALS_EXPORT void VacuumKernDb(KernDb& db);
+#endif
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_MAINTENANCE_HPP_
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_DB_MERGE_HPP_
+#define GUARD_MIOPEN_DB_MERGE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/db_maintenance.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace miopen {
+
+struct DbMergeStats
+{
+    /// Values which were not present in the target.
+    std::size_t added = 0;
+    /// Values of the target replaced by the ones with a better time.
+    std::size_t replaced = 0;
+    /// Values discarded in favor of a better or equal one.
+    std::size_t kept = 0;
+};
+
+/// Merges the text user databases found in the shard directories into the target one.
+/// The shards have the layout of a MIOPEN_USER_DB_PATH directory, e.g. written by
+/// tuning workers with private user databases. Files are matched by name, find-db
+/// (*.ufdb.txt) and perf-db (*.udb.txt) files of the same device are paired by the
+/// part of the name before the first dot.
+///
+/// Conflicts are resolved by the best time:
+/// - find-db: the value with the lowest time wins;
+/// - perf-db: the value wins if the solver has the lowest find-db time in its shard.
+///   An existing value is replaced only if the shard time of the solver beats the time
+///   stored in the target find-db for the same problems. Values from shards without
+///   find-db times never replace existing ones.
+///
+/// Target files are rewritten under the same locks as used by the library.
+MIOPEN_INTERNALS_EXPORT DbMergeStats MergeUserDbShards(const std::vector<fs::path>& shards,
+                                                       const fs::path& target);
+
+/// Merges the text dbs into the target. Find-db conflicts are resolved by the best time.
+/// Perf-db has no times, so the values of the target and then of the earlier sources win.
+MIOPEN_INTERNALS_EXPORT DbMergeStats MergeTextDbs(DbKinds db_kind,
+                                                  TextDbRecords& target,
+                                                  const std::vector<TextDbRecords>& sources);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_MERGE_HPP_
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_DB_SHARD_HPP_
+#define GUARD_MIOPEN_DB_SHARD_HPP_
+
+#include <cctype>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Header-only on purpose: it is also used by the build-time fdb_shard tool,
+// which does not link against the library.
+
+namespace miopen {
+
+/// Byte range of one problem family inside a sharded text database.
+struct DbShard
+{
+    std::uint64_t offset = 0;
+    std::uint64_t length = 0;
+    /// Line number of the first record, used in diagnostics only.
+    int first_line = 1;
+};
+
+/// Shard holding the records whose key does not look like a convolution problem.
+constexpr std::string_view db_misc_shard_name = "misc";
+
+/// Returns the problem family of a convolution find-db key, i.e. the
+/// "<layout>-<data type>-<direction>" part of
+/// 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F[_g2...].
+/// The input layout also encodes the number of spatial dimensions (NCHW vs NCDHW).
+inline std::string GetDbShardName(std::string_view key)
+{
+    key = key.substr(0, key.find('_'));
+
+    const auto direction_pos = key.rfind('-');
+    if(direction_pos == std::string_view::npos || direction_pos == 0)
+        return std::string{db_misc_shard_name};
+    const auto type_pos = key.rfind('-', direction_pos - 1);
+    if(type_pos == std::string_view::npos)
+        return std::string{db_misc_shard_name};
+
+    const auto direction = key.substr(direction_pos + 1);
+    const auto data_type = key.substr(type_pos + 1, direction_pos - type_pos - 1);
+
+    const auto is_word = [](std::string_view token, bool allow_digits) {
+        if(token.empty())
+            return false;
+        for(const auto c : token)
+        {
+            const auto uc = static_cast<unsigned char>(c);
+            if(std::isupper(uc) == 0 && !(allow_digits && std::isdigit(uc) != 0))
+                return false;
+        }
+        return true;
+    };
+
+    // The first token starting with a letter is the input layout.
+    auto layout = std::string_view{};
+    for(auto pos = std::size_t{0}; pos < type_pos; pos = key.find('-', pos) + 1)
+    {
+        if(std::isalpha(static_cast<unsigned char>(key[pos])) != 0)
+        {
+            layout = key.substr(pos, key.find('-', pos) - pos);
+            break;
+        }
+    }
+
+    if((direction != "F" && direction != "B" && direction != "W") || !is_word(data_type, true) ||
+       !is_word(layout, false))
+        return std::string{db_misc_shard_name};
+
+    auto name = std::string{layout};
+    name.append(1, '-').append(data_type).append(1, '-').append(direction);
+    return name;
+}
+
+/// The manifest lives next to the database file.
+inline std::string GetDbShardManifestPath(const std::string& db_path)
+{
+    return db_path + ".shards";
+}
+
+constexpr std::string_view db_shard_manifest_magic = "miopen-db-shards";
+constexpr int db_shard_manifest_version            = 1;
+
+/// Manifest format:
+///   miopen-db-shards 1 <database size in bytes>
+///   <shard> <offset> <length> <first line>
+///   ...
+/// Returns false if the manifest is malformed or of an unknown version.
+inline bool ReadDbShardManifest(std::istream& input,
+                                std::uint64_t& db_size,
+                                std::map<std::string, DbShard>& shards)
+{
+    auto magic   = std::string{};
+    auto version = 0;
+    if(!(input >> magic >> version >> db_size) || magic != db_shard_manifest_magic ||
+       version != db_shard_manifest_version)
+        return false;
+
+    auto name  = std::string{};
+    auto shard = DbShard{};
+    while(input >> name >> shard.offset >> shard.length >> shard.first_line)
+        shards[name] = shard;
+    return input.eof() && !shards.empty();
+}
+
+/// Rewrites a text database so that the records of every problem family are
+/// contiguous and describes the ranges in the manifest. The records are kept
+/// verbatim, so the result is still a valid text database for a full load.
+/// Returns false if the input is unreadable or contains no records.
+inline bool WriteShardedDb(std::istream& input, std::ostream& output, std::ostream& manifest)
+{
+    auto shards = std::map<std::string, std::vector<std::string>>{};
+    auto line   = std::string{};
+    while(std::getline(input, line))
+    {
+        if(!line.empty() && line.back() == '\r')
+            line.pop_back();
+        const auto key_size = line.find('=');
+        if(key_size == std::string::npos || key_size == 0)
+            continue;
+        shards[GetDbShardName(std::string_view{line}.substr(0, key_size))].push_back(line);
+    }
+
+    if(shards.empty())
+        return false;
+
+    auto ranges     = std::ostringstream{};
+    auto offset     = std::uint64_t{0};
+    auto first_line = 1;
+    for(const auto& [name, lines] : shards)
+    {
+        auto length = std::uint64_t{0};
+        for(const auto& record : lines)
+        {
+            output << record << '\n';
+            length += record.size() + 1;
+        }
+        ranges << name << ' ' << offset << ' ' << length << ' ' << first_line << '\n';
+        offset += length;
+        first_line += static_cast<int>(lines.size());
+    }
+
+    manifest << db_shard_manifest_magic << ' ' << db_shard_manifest_version << ' ' << offset
+             << '\n'
+             << ranges.str();
+    return static_cast<bool>(output) && static_cast<bool>(manifest);
+}
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_SHARD_HPP_
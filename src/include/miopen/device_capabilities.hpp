@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DEVICE_CAPABILITIES_HPP_
+#define GUARD_MIOPEN_DEVICE_CAPABILITIES_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/target_properties.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace miopen {
+
+struct Handle;
+
+/// What the runtime reports about a device. Queried once per device and process, and
+/// with MIOPEN_DEVICE_INFO_CACHE=1 persisted in the user cache directory, so later
+/// processes skip the runtime queries.
+struct MIOPEN_INTERNALS_EXPORT DeviceInfo
+{
+    std::string raw_name; ///< As reported, e.g. "gfx90a:sramecc+:xnack-".
+    std::size_t compute_units      = 0;
+    std::size_t wavefront_width    = 0;
+    std::size_t local_memory_size  = 0;
+    std::size_t global_memory_size = 0;
+    std::size_t image3d_max_width  = 0;
+    bool cooperative_launch        = false;
+
+    /// Derived from raw_name when the record is created or loaded, not persisted.
+    TargetProperties target;
+
+    /// Reads the record written by Save() for the same key.
+    /// Returns false if the file is missing, malformed or was written for another key.
+    bool Load(const fs::path& file, const std::string& key);
+    void Save(const fs::path& file, const std::string& key) const;
+
+    /// Returns the record of the device identified by the key. The query runs only if the
+    /// record is neither in memory nor in the persistent cache. The key shall identify the
+    /// physical device and change with the driver and runtime versions. The runtime settings
+    /// of GetSettingsKey() are added to it.
+    static const DeviceInfo& Get(const std::string& device_key,
+                                 const std::function<DeviceInfo()>& query);
+
+    /// The runtime settings which change the reported properties of the same device, such as
+    /// the CU masks (compute_units) and the xnack mode (raw_name).
+    static std::string GetSettingsKey();
+};
+
+/// Target features checked by the solvers, as a flat set of numbers and flags.
+/// Computed once per target name and CU count in the process. Handles use their (virtual)
+/// GetDeviceName() and GetMaxComputeUnits(), so mock handles get their own records.
+struct MIOPEN_INTERNALS_EXPORT DeviceCapabilities
+{
+    /// The target name split as in LLVM: gfx90a is 9, 0, 0xa; gfx1030 is 10, 3, 0.
+    /// All zero if the name is not recognized.
+    unsigned gfx_major    = 0;
+    unsigned gfx_minor    = 0;
+    unsigned gfx_stepping = 0;
+
+    std::size_t compute_units = 0;
+
+    /// Matrix fused multiply-add (XDLOPS) instructions: gfx908, gfx90a, gfx94x.
+    bool xdlops = false;
+    /// Wave matrix multiply-accumulate instructions: gfx11, gfx12.
+    bool wmma = false;
+
+    bool IsGfx(unsigned major, unsigned minor) const
+    {
+        return gfx_major == major && gfx_minor == minor;
+    }
+
+    bool IsGfx(unsigned major, unsigned minor, unsigned stepping) const
+    {
+        return IsGfx(major, minor) && gfx_stepping == stepping;
+    }
+
+    static DeviceCapabilities FromName(const std::string& name, std::size_t compute_units);
+
+    static const DeviceCapabilities& Get(const std::string& name, std::size_t compute_units);
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DEVICE_CAPABILITIES_HPP_
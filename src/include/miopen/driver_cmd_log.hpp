@@ -0,0 +1,92 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DRIVER_CMD_LOG_HPP_
+#define GUARD_MIOPEN_DRIVER_CMD_LOG_HPP_
+
+#include <miopen/config.hpp>
+
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+/// A MIOpenDriver command line logged with MIOPEN_ENABLE_LOGGING_CMD.
+struct DriverCommand
+{
+    /// The API function which logged the command, e.g. miopenConvolutionForward.
+    std::string api;
+    /// The driver arguments without the driver path, with single spaces between them,
+    /// e.g. "conv -n 1 -c 3 ...".
+    std::string args;
+};
+
+/// Returns the command of a log line, or nothing for the other lines. The optional process id
+/// and elapsed time parts of the logging prefix are skipped.
+MIOPEN_INTERNALS_EXPORT std::optional<DriverCommand> ParseDriverCommand(std::string_view line);
+
+/// Returns the first argument, the driver operation: "conv", "bnormfp16", "CBAInfer"...
+MIOPEN_INTERNALS_EXPORT std::string_view GetDriverOperation(std::string_view args);
+
+/// Returns the value of a driver flag, e.g. "1" for "-F" in "conv ... -F 1 -t 1".
+MIOPEN_INTERNALS_EXPORT std::optional<std::string_view> GetDriverFlag(std::string_view args,
+                                                                      std::string_view flag);
+
+struct DriverProblem
+{
+    std::string args;
+    std::size_t count = 0;
+    /// Occurrences per logging API function.
+    std::map<std::string, std::size_t> apis;
+};
+
+/// Unique driver problems of one or more logs with their occurrence counts.
+class MIOPEN_INTERNALS_EXPORT DriverCommandLog
+{
+public:
+    void Add(const DriverCommand& command);
+
+    /// Adds the commands of every line, returns their number.
+    std::size_t Read(std::istream& stream);
+
+    /// The most frequent problems first, problems with equal counts are ordered by args.
+    std::vector<DriverProblem> GetProblems() const;
+
+    std::size_t GetTotal() const { return total; }
+
+private:
+    std::unordered_map<std::string, DriverProblem> problems;
+    std::size_t total = 0;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DRIVER_CMD_LOG_HPP_
@@ -146,6 +146,9 @@ public:
     auto end() { return content->As<FindDbData>().end(); }
     bool empty() const { return !content.is_initialized(); }
 
+    /// Opens the databases a record would use, so the first lookup does not pay for it.
+    static void WarmUp(Handle& handle, const std::string& path_suffix = "");
+
     template <class TProblemDescription>
     static std::vector<Solution> TryLoad(Handle& handle,
                                          const TProblemDescription& problem,
@@ -167,6 +170,8 @@ public:
         record.in_sync = false;
         record.content.emplace(DbKinds::FindDb, problem);
 
+        // Nothing is stored if the regeneration throws, e.g. when cancelled.
+        record.dont_store = true;
         const auto result = regenerator();
         record.dont_store = !result.is_optimal;
 
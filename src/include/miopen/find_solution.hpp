@@ -38,6 +38,7 @@
 #include <miopen/search_options.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/solver.hpp>
+#include <miopen/tuning_cancel.hpp>
 
 #include <limits>
 #include <type_traits>
@@ -285,7 +286,7 @@ struct SolverContainer
         const auto find_only = GetEnvFindOnlySolver();
         miopen::each_args(
             [&](auto solver) {
-                if(count >= limit)
+                if(count >= limit || IsTuningCancelled())
                     return;
                 if(find_only &&
                    (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
@@ -342,7 +343,7 @@ struct SolverContainer
         const auto find_only = GetEnvFindOnlySolver();
         miopen::each_args(
             [&](auto solver) {
-                if(count >= limit)
+                if(count >= limit || IsTuningCancelled())
                     return;
                 if(find_only &&
                    (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
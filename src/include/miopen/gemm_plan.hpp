@@ -0,0 +1,202 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_GEMM_PLAN_HPP_
+#define GUARD_MIOPEN_GEMM_PLAN_HPP_
+
+#include <miopen/gemm_v2.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+namespace miopen {
+
+/// Identifies GEMM calls which can share a plan. The descriptor must be column-major.
+struct GemmPlanKey
+{
+    /// Backend and device, plans of different backends or devices are never shared.
+    std::string scope;
+    bool transA, transB;
+    int m, n, k;
+    int lda, ldb, ldc;
+    /// Batching is ignored (1 and zero strides) for the non-batched calls.
+    int batch_count;
+    long long int strideA, strideB, strideC;
+    miopenDataType_t dataType, a_cast_type, b_cast_type;
+    bool alpha_one, beta_zero;
+    bool deterministic;
+    bool gfx90a_alt_impl;
+
+    MIOPEN_INTERNALS_EXPORT static GemmPlanKey
+    Make(std::string scope, const GemmDescriptor& desc, bool batched);
+
+    auto Tie() const
+    {
+        return std::tie(scope,
+                        transA,
+                        transB,
+                        m,
+                        n,
+                        k,
+                        lda,
+                        ldb,
+                        ldc,
+                        batch_count,
+                        strideA,
+                        strideB,
+                        strideC,
+                        dataType,
+                        a_cast_type,
+                        b_cast_type,
+                        alpha_one,
+                        beta_zero,
+                        deterministic,
+                        gfx90a_alt_impl);
+    }
+
+    bool operator==(const GemmPlanKey& other) const { return Tie() == other.Tie(); }
+
+    struct Hash
+    {
+        MIOPEN_INTERNALS_EXPORT std::size_t operator()(const GemmPlanKey& key) const;
+    };
+};
+
+/// State prepared by a backend once per GemmPlanKey and reused by the calls,
+/// e.g. hipBLASLt matrix layouts, the matmul descriptor and the algorithm chosen
+/// by the heuristic.
+struct GemmPlan
+{
+    virtual ~GemmPlan() = default;
+};
+
+/// BLAS library used by the GEMM calls. Implementations are bound to the handle and
+/// the buffers are in the memory the backend works with.
+struct GemmBlasBackend
+{
+    virtual ~GemmBlasBackend() = default;
+
+    /// Backend name and device, becomes a part of the plan keys.
+    virtual std::string GetPlanScope() const = 0;
+    /// Called once per key. Batching fields of the descriptor are to be ignored if not batched.
+    virtual std::unique_ptr<GemmPlan> CreatePlan(const GemmDescriptor& desc,
+                                                 bool batched) const = 0;
+    virtual void Run(const GemmPlan& plan,
+                     const GemmDescriptor& desc,
+                     bool batched,
+                     ConstData_t A,
+                     std::size_t a_offset,
+                     ConstData_t B,
+                     std::size_t b_offset,
+                     Data_t C,
+                     std::size_t c_offset) const = 0;
+};
+
+/// Thread-safe LRU cache of GEMM plans.
+class MIOPEN_INTERNALS_EXPORT GemmPlanCache
+{
+public:
+    using PlanPtr = std::shared_ptr<const GemmPlan>;
+
+    explicit GemmPlanCache(std::size_t capacity_ = 256);
+
+    /// Returns the plan for the key, creating it on a miss. The creation runs outside the lock,
+    /// concurrent misses of the same key may create the plan more than once.
+    PlanPtr GetOrCreate(const GemmPlanKey& key,
+                        const std::function<std::unique_ptr<GemmPlan>()>& create);
+
+    std::size_t GetSize() const;
+    std::size_t GetHits() const;
+    std::size_t GetMisses() const;
+    void Clear();
+
+    /// Process-wide cache used by CallGemm* (MIOPEN_GEMM_PLAN_CACHE_SIZE, 0 disables it).
+    static GemmPlanCache& GetInstance();
+
+private:
+    using LruList = std::list<GemmPlanKey>;
+
+    struct Entry
+    {
+        PlanPtr plan;
+        LruList::iterator lru;
+    };
+
+    const std::size_t capacity;
+    mutable std::mutex mutex;
+    LruList lru;
+    std::unordered_map<GemmPlanKey, Entry, GemmPlanKey::Hash> entries;
+    std::size_t hits   = 0;
+    std::size_t misses = 0;
+};
+
+/// Runs the GEMM with the plan from the cache. The descriptor must be column-major.
+MIOPEN_INTERNALS_EXPORT void RunGemmPlan(const GemmBlasBackend& backend,
+                                         GemmPlanCache& cache,
+                                         const GemmDescriptor& desc,
+                                         bool batched,
+                                         ConstData_t A,
+                                         std::size_t a_offset,
+                                         ConstData_t B,
+                                         std::size_t b_offset,
+                                         Data_t C,
+                                         std::size_t c_offset);
+
+/// Reference backend computing fp32 and fp64 GEMMs on host buffers. Counts the plans and
+/// the calls, which allows to test the plan reuse on the machines without GPUs.
+class MIOPEN_INTERNALS_EXPORT HostGemmBackend : public GemmBlasBackend
+{
+public:
+    std::string GetPlanScope() const override { return "host"; }
+    std::unique_ptr<GemmPlan> CreatePlan(const GemmDescriptor& desc, bool batched) const override;
+    void Run(const GemmPlan& plan,
+             const GemmDescriptor& desc,
+             bool batched,
+             ConstData_t A,
+             std::size_t a_offset,
+             ConstData_t B,
+             std::size_t b_offset,
+             Data_t C,
+             std::size_t c_offset) const override;
+
+    std::size_t GetPlansCreated() const { return plans_created; }
+    std::size_t GetCalls() const { return calls; }
+
+private:
+    mutable std::atomic<std::size_t> plans_created{0};
+    mutable std::atomic<std::size_t> calls{0};
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_GEMM_PLAN_HPP_
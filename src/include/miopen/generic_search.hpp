@@ -38,8 +38,10 @@
 #include <miopen/timer.hpp>
 #include <miopen/mt_queue.hpp>
 #include <miopen/generic_search_controls.hpp>
+#include <miopen/tuning_cancel.hpp>
 
 #include <algorithm>
+#include <optional>
 #include <vector>
 #include <cstdlib>
 #include <limits>
@@ -65,6 +67,20 @@ private:
 };
 } // namespace debug
 
+/// Limits the total time of the searches started within the scope by the same thread, e.g.
+/// to the budget assigned to the problem by the TuningPlanner. The searches started after
+/// the budget is exhausted still evaluate the first configs.
+struct MIOPEN_INTERNALS_EXPORT TuningTimeScopedLimiter
+{
+    TuningTimeScopedLimiter(std::chrono::milliseconds budget);
+    TuningTimeScopedLimiter(const TuningTimeScopedLimiter&) = delete;
+    TuningTimeScopedLimiter& operator=(const TuningTimeScopedLimiter&) = delete;
+    ~TuningTimeScopedLimiter();
+
+private:
+    std::optional<std::chrono::steady_clock::time_point> old_deadline;
+};
+
 /// This STL-like container together with corresponding iterator provide access
 /// to a set of all available performance configs for the given problem config.
 ///
@@ -313,22 +329,25 @@ void CompileAgent(size_t thread_index,
                   const Context& context,
                   const Problem& problem,
                   std::vector<PerformanceConfig>& data,
-                  ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>>& comp_queue)
+                  ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>>& comp_queue,
+                  std::chrono::milliseconds time_budget,
+                  const std::atomic<bool>* cancel)
 {
     const auto start_time =
         std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now());
-    const auto data_size   = data.size();
-    const auto time_budget = GetTuningTimeMax();
-    const auto& profile_h  = context.GetStream();
+    const auto data_size  = data.size();
+    const auto& profile_h = context.GetStream();
     // start the counter
     for(auto idx = thread_index; idx < data_size; idx += total_threads)
     {
         // Check if we are out of time
         const auto current_time = std::chrono::time_point_cast<std::chrono::milliseconds>(
             std::chrono::steady_clock::now());
-        if(current_time - start_time > time_budget)
+        const auto cancelled = cancel != nullptr && cancel->load();
+        if(cancelled || current_time - start_time > time_budget)
         {
-            MIOPEN_LOG_I2("Thread: " << thread_index << " Done, exhausted time budget");
+            MIOPEN_LOG_I2("Thread: " << thread_index << " Done, "
+                                     << (cancelled ? "cancelled" : "exhausted time budget"));
             auto tmp = std::make_tuple<PerformanceConfig, ConvSolution, bool>({}, {}, true);
             comp_queue.push(std::move(tmp));
             break;
@@ -408,6 +427,9 @@ auto GenericSearch(const Solver s,
     heartbeat.Start();
 
     const auto total_threads = GetTuningThreadsMax();
+    // The limit and the cancellation are set for the calling thread.
+    const auto time_budget = GetTuningTimeMax();
+    const auto* cancel     = GetTuningCancelFlag();
 
     ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>> solution_queue;
     std::vector<std::thread> compile_agents;
@@ -421,7 +443,9 @@ auto GenericSearch(const Solver s,
                                     std::cref(context),
                                     std::cref(problem),
                                     std::ref(all_configs),
-                                    std::ref(solution_queue));
+                                    std::ref(solution_queue),
+                                    time_budget,
+                                    cancel);
     }
 
     if(!env::enabled(MIOPEN_DEBUG_COMPILE_ONLY))
@@ -441,6 +465,11 @@ auto GenericSearch(const Solver s,
                 MIOPEN_LOG_I2("Ending Search by patience: " << patience);
                 break;
             }
+            if(IsTuningCancelled())
+            {
+                MIOPEN_LOG_I2("Ending Search by cancellation");
+                break;
+            }
 
             last_imprv++;
             MIOPEN_LOG_I2("Waiting for item in queue");
@@ -579,6 +608,9 @@ auto GenericSearch(const Solver s,
     for(auto& agent : compile_agents)
         agent.join();
 
+    if(IsTuningCancelled())
+        MIOPEN_THROW("Search cancelled");
+
     MIOPEN_LOG_W("Done: " << n_runs_total << '/' << n_failed << '/' << n_runs_total << ", best #"
                           << n_best << ' ' << best_time << ' ' << best_config);
 
@@ -73,6 +73,7 @@ extern "C" hipblasStatus_t hipblasLtDestroy(hipblasLtHandle_t handle);
 namespace miopen {
 
 struct HandleImpl;
+struct DeviceCapabilities;
 
 #if MIOPEN_USE_ROCBLAS
 using rocblas_handle_ptr = MIOPEN_MANAGE_PTR(rocblas_handle, rocblas_destroy_handle);
@@ -91,6 +92,11 @@ struct MIOPEN_EXPORT Handle : miopenHandle
     Handle(Handle&&) noexcept;
     virtual ~Handle();
 
+    /// Target properties, BLAS handles, system databases and the kernel cache are
+    /// created on first use. Creates them right away, so latency-sensitive callers
+    /// can keep this cost out of their first operation.
+    void WarmUp();
+
     miopenAcceleratorQueue_t GetStream() const;
     void SetStream(miopenAcceleratorQueue_t streamID) const;
     void SetStreamFromPool(int streamID) const;
@@ -170,6 +176,9 @@ struct MIOPEN_EXPORT Handle : miopenHandle
 
     virtual std::string GetDeviceName() const;
     const TargetProperties& GetTargetProperties() const;
+    /// Target features for applicability checks, computed once per handle from
+    /// GetDeviceName() and GetMaxComputeUnits().
+    const DeviceCapabilities& GetCapabilities() const;
 
 private:
     std::string GetDeviceNameImpl() const;
@@ -26,6 +26,7 @@
 #ifndef GUARD_MIOPEN_KERNEL_HPP
 #define GUARD_MIOPEN_KERNEL_HPP
 
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
@@ -36,6 +37,17 @@ namespace miopen {
 std::string_view GetKernelSrc(const fs::path& name);
 std::string_view GetKernelInc(const fs::path& name);
 const std::vector<std::reference_wrapper<const fs::path>>& GetKernelIncList();
+
+/// Embedded headers a HIP kernel includes directly or transitively, computed by addkernels.
+struct KernelIncDeps
+{
+    /// Hash of the kernel text and the names and texts of the headers.
+    std::uint64_t hash;
+    std::vector<fs::path> includes;
+};
+
+/// Returns nullptr for the kernels not known at the library build time.
+const KernelIncDeps* GetKernelIncDeps(const fs::path& name);
 } // namespace miopen
 
 #if MIOPEN_BACKEND_OPENCL
@@ -29,28 +29,32 @@
 #include <miopen/filesystem.hpp>
 #include <miopen/logger.hpp>
 
-#include <boost/date_time/posix_time/posix_time_duration.hpp>
-#include <boost/date_time/posix_time/posix_time_types.hpp>
-#include <boost/date_time/posix_time/ptime.hpp>
-#include <boost/date_time/time.hpp>
+#ifdef _WIN32
 #include <boost/interprocess/sync/file_lock.hpp>
+#endif
 
+#include <algorithm>
 #include <chrono>
-#include <fstream>
-#include <functional>
+#include <condition_variable>
+#include <cstddef>
 #include <map>
 #include <mutex>
-#include <shared_mutex>
 #include <string>
 #include <string_view>
 
 namespace miopen {
 
 MIOPEN_INTERNALS_EXPORT fs::path LockFilePath(const fs::path& filename_);
-// LockFile class is a wrapper around boost::interprocess::file_lock providing MT-safety.
+
+// LockFile is a reader/writer lock shared by the threads of a process and by processes.
+// Threads of one process share a single file lock: the first reader takes it shared and the
+// last one releases it, writers take it exclusive.
+// On Linux the file lock is an open file description (OFD) lock on a descriptor opened for
+// every acquisition, so it is not released by unrelated close() calls and is not shared with
+// forked children. Untimed waits block in the kernel, timed waits block in a helper thread
+// instead of polling. Elsewhere boost::interprocess::file_lock is used.
 // One process should never have more than one instance of this class with same path at the same
 // time. It may lead to undefined behaviour on Windows.
-// Also on windows mutex can be removed because file locks are MT-safe there.
 class MIOPEN_INTERNALS_EXPORT LockFile
 {
 private:
@@ -59,115 +63,79 @@ private:
     };
 
 public:
+    /// Which side is let in first when readers and writers contend.
+    /// Readers: new readers join the current ones even if a writer waits. Best for the
+    /// read-mostly find-db and perf-db, but a steady stream of readers delays writers.
+    /// Writers: a waiting writer holds off new readers. On Linux this holds across processes,
+    /// elsewhere only within the process.
+    enum class Preference
+    {
+        Readers,
+        Writers,
+    };
+
+    using Clock = std::chrono::steady_clock;
+
     LockFile(const fs::path&, PassKey);
     LockFile(const LockFile&) = delete;
     LockFile operator=(const LockFile&) = delete;
+    ~LockFile();
 
-    bool timed_lock(const boost::posix_time::ptime& abs_time)
-    {
-        access_mutex.lock();
-        return flock.timed_lock(abs_time);
-    }
-
-    bool timed_lock_shared(const boost::posix_time::ptime& abs_time)
-    {
-        access_mutex.lock_shared();
-        return flock.timed_lock_sharable(abs_time);
-    }
-    void lock()
-    {
-        LockOperation("lock", MIOPEN_GET_FN_NAME, [&]() { std::lock(access_mutex, flock); });
-    }
-
-    void lock_shared()
-    {
-        access_mutex.lock_shared();
-        try
-        {
-            LockOperation("shared lock", MIOPEN_GET_FN_NAME, [&]() { flock.lock_sharable(); });
-        }
-        catch(...)
-        {
-            access_mutex.unlock();
-        }
-    }
-
-    bool try_lock()
-    {
-        return TryLockOperation(
-            "lock", MIOPEN_GET_FN_NAME, [&]() { return std::try_lock(access_mutex, flock) != 0; });
-    }
-
-    bool try_lock_shared()
-    {
-        if(!access_mutex.try_lock_shared())
-            return false;
-
-        if(TryLockOperation(
-               "shared lock", MIOPEN_GET_FN_NAME, [&]() { return flock.try_lock_sharable(); }))
-            return true;
-        access_mutex.unlock();
-        return false;
-    }
-
-    void unlock()
-    {
-        LockOperation("unlock", MIOPEN_GET_FN_NAME, [&]() { flock.unlock(); });
-        access_mutex.unlock();
-    }
+    /// Initialized with MIOPEN_DB_LOCK_PREFERENCE ("readers" or "writers").
+    Preference GetPreference() const;
+    void SetPreference(Preference value);
 
-    void unlock_shared()
-    {
-        LockOperation("unlock shared", MIOPEN_GET_FN_NAME, [&]() { flock.unlock_sharable(); });
-        access_mutex.unlock_shared();
-    }
+    void lock() { LockUntil(false, {}); }
+    void lock_shared() { LockUntil(true, {}); }
+    bool try_lock() { return TryLock(false); }
+    bool try_lock_shared() { return TryLock(true); }
+    void unlock() { Unlock(false); }
+    void unlock_shared() { Unlock(true); }
 
     static LockFile& Get(const fs::path& file);
 
     template <class TDuration>
     bool try_lock_for(TDuration duration)
     {
-        if(!access_mutex.try_lock_for(duration))
-            return false;
-
-        if(TryLockOperation("timed lock", MIOPEN_GET_FN_NAME, [&]() {
-               return flock.timed_lock(ToPTime(duration));
-           }))
-            return true;
-        access_mutex.unlock();
-        return false;
+        return LockUntil(false, ToDeadline(duration));
     }
 
     template <class TDuration>
     bool try_lock_shared_for(TDuration duration)
     {
-        if(!access_mutex.try_lock_shared_for(duration))
-            return false;
-
-        if(TryLockOperation("shared timed lock", MIOPEN_GET_FN_NAME, [&]() {
-               return flock.timed_lock_sharable(ToPTime(duration));
-           }))
-            return true;
-        access_mutex.unlock();
-        return false;
+        return LockUntil(true, ToDeadline(duration));
     }
 
     template <class TPoint>
     bool try_lock_until(TPoint point)
     {
-        return try_lock_for(point - std::chrono::system_clock::now());
+        return try_lock_for(point - TPoint::clock::now());
     }
 
     template <class TPoint>
     bool try_lock_shared_until(TPoint point)
     {
-        return try_lock_shared_for(point - std::chrono::system_clock::now());
+        return try_lock_shared_for(point - TPoint::clock::now());
     }
 
 private:
-    fs::path path; // For logging purposes
-    std::shared_timed_mutex access_mutex;
+    fs::path path;
+
+    mutable std::mutex state_mutex;
+    std::condition_variable state_changed;
+    Preference preference;
+    std::size_t readers         = 0;
+    std::size_t writers_waiting = 0;
+    bool writer                 = false;
+    // Set while the first reader acquires the file lock, the following ones wait for it.
+    bool acquiring_shared = false;
+
+#ifdef _WIN32
     boost::interprocess::file_lock flock;
+#else
+    // Descriptor holding the file lock, -1 if the lock is not held.
+    int fd = -1;
+#endif
 
     static std::map<fs::path, LockFile>& LockFiles()
     {
@@ -177,58 +145,29 @@ private:
     }
 
     template <class TDuration>
-    static boost::posix_time::ptime ToPTime(TDuration duration)
+    static Clock::time_point ToDeadline(TDuration duration)
     {
-        return boost::posix_time::second_clock::universal_time() +
-               boost::posix_time::milliseconds(
-                   std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+        const auto left = std::chrono::duration_cast<Clock::duration>(duration);
+        return Clock::now() + std::max(left, Clock::duration::zero());
     }
 
-    void LogFlockError(const boost::interprocess::interprocess_exception& ex,
-                       const std::string& operation,
-                       const std::string_view from) const
-    {
-        // clang-format off
-        MIOPEN_LOG_E_FROM(from, "File <" << path << "> " << operation << " failed. "
-                                "Error code: " << ex.get_error_code() << ". "
-                                "Native error: " << ex.get_native_error() << ". "
-                                "Description: '" << ex.what() << "'");
-        // clang-format on
-    }
+    /// A default constructed deadline waits without a timeout.
+    bool LockUntil(bool shared, Clock::time_point deadline);
+    bool TryLock(bool shared);
+    void Unlock(bool shared);
 
-    void LockOperation(const std::string& op_name,
-                       const std::string_view from,
-                       std::function<void()>&& op)
-    {
-        try
-        {
-            op();
-        }
-        catch(const boost::interprocess::interprocess_exception& ex)
-        {
-            LogFlockError(ex, op_name, from);
-            throw;
-        }
-    }
+    /// Takes the file lock for the threads that have entered the in-process lock.
+    /// Returns false on timeout or failure, errors are logged.
+    bool FileLock(bool shared, Clock::time_point deadline, bool try_only, bool writers_first);
+    void FileUnlock(bool shared);
 
-    bool TryLockOperation(const std::string& op_name,
-                          const std::string_view from,
-                          std::function<bool()>&& op)
-    {
-        try
-        {
-            if(op())
-                return true;
-            MIOPEN_LOG_W("File <" << path << "> " << op_name << " timed out.");
-            return false;
-        }
-        catch(const boost::interprocess::interprocess_exception& ex)
-        {
-            LogFlockError(ex, op_name, from);
-            return false;
-        }
-    }
+    bool CanEnterShared() const;
+    bool AcquireFileLock(std::unique_lock<std::mutex>& guard,
+                         bool shared,
+                         Clock::time_point deadline,
+                         bool try_only);
 };
+
 } // namespace miopen
 
 #endif // GUARD_MIOPEN_LOCK_FILE_HPP_
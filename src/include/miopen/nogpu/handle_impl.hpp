@@ -25,6 +25,10 @@
  *******************************************************************************/
 #ifndef GUARD_MIOPEN_NOGPU_HANDLE_IMPL_HPP_
 #define GUARD_MIOPEN_NOGPU_HANDLE_IMPL_HPP_
+
+#include <atomic>
+#include <mutex>
+
 namespace miopen {
 
 struct HandleImpl
@@ -63,7 +67,11 @@ struct HandleImpl
     Allocator allocator{};
     KernelCache cache;
     std::int64_t ctx;
+    // Target properties are initialized on first use, see Handle::WarmUp().
+    std::mutex lazy_init_mutex;
+    std::atomic<bool> target_properties_ready{false};
     TargetProperties target_properties;
+    std::atomic<const DeviceCapabilities*> capabilities{nullptr};
 };
 } // namespace miopen
 #endif // GUARD_MIOPEN_NOGPU_HANDLE_IMPL_HPP_
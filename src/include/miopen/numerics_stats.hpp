@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_NUMERICS_STATS_HPP_
+#define GUARD_MIOPEN_NUMERICS_STATS_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/miopen.h>
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// Statistics of tensor values which can be accumulated over many tensors.
+struct MIOPEN_INTERNALS_EXPORT NumericsStats
+{
+    /// Magnitudes are bucketed by floor(log2(|x|)), clamped to this range.
+    static constexpr int histogram_min_exponent = -32;
+    static constexpr int histogram_max_exponent = 31;
+    /// Bucket 0 counts zeros, bucket i counts the finite values with the exponent
+    /// histogram_min_exponent + i - 1.
+    static constexpr std::size_t histogram_size =
+        histogram_max_exponent - histogram_min_exponent + 2;
+
+    /// Number of accumulated tensors.
+    std::size_t tensors = 0;
+    /// Number of finite values, the rest of the fields except nans and infs only cover these.
+    std::size_t count = 0;
+    std::size_t nans  = 0;
+    std::size_t infs  = 0;
+    std::size_t zeros = 0;
+
+    double min     = std::numeric_limits<double>::infinity();
+    double max     = -std::numeric_limits<double>::infinity();
+    double sum     = 0.0;
+    double abs_sum = 0.0;
+    double abs_max = 0.0;
+
+    std::array<std::size_t, histogram_size> histogram{};
+
+    void Add(double value);
+    void Merge(const NumericsStats& other);
+
+    bool HasAbnormal() const { return nans != 0 || infs != 0; }
+    double GetMean() const { return count == 0 ? 0.0 : sum / count; }
+    double GetAbsMean() const { return count == 0 ? 0.0 : abs_sum / count; }
+
+    static std::size_t GetHistogramBucket(double abs_value);
+
+    friend MIOPEN_INTERNALS_EXPORT std::ostream& operator<<(std::ostream& stream,
+                                                            const NumericsStats& stats);
+};
+
+/// Statistics of a host tensor. The lengths and the strides are in elements.
+/// fp8 values are decoded the same way as by the kernels.
+MIOPEN_INTERNALS_EXPORT NumericsStats ComputeNumericsStats(miopenDataType_t type,
+                                                           const std::vector<std::size_t>& lengths,
+                                                           const std::vector<std::size_t>& strides,
+                                                           const void* data);
+
+/// Accumulates statistics per tensor across calls (MIOPEN_CHECK_NUMERICS=0x20).
+/// Only every sample_period-th check of each tensor is collected to bound the overhead of
+/// copying the data to the host.
+class MIOPEN_INTERNALS_EXPORT NumericsMonitor
+{
+public:
+    explicit NumericsMonitor(std::size_t sample_period_ = 1);
+
+    /// Counts the check of the tensor, returns true if its statistics are to be collected.
+    bool Sample(const std::string& key);
+    void Record(const std::string& key, const NumericsStats& stats);
+
+    std::optional<NumericsStats> Get(const std::string& key) const;
+    std::map<std::string, NumericsStats> GetAll() const;
+    /// One line per tensor, sorted by the key.
+    std::string GetReport() const;
+    void Reset();
+
+    /// Process-wide instance, the sample period is MIOPEN_CHECK_NUMERICS_SAMPLE_PERIOD.
+    static NumericsMonitor& GetInstance();
+
+private:
+    struct Entry
+    {
+        std::size_t checks = 0;
+        NumericsStats stats;
+    };
+
+    const std::size_t sample_period;
+    mutable std::mutex mutex;
+    std::map<std::string, Entry> entries;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_NUMERICS_STATS_HPP_
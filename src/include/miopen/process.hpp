@@ -29,15 +29,28 @@
 
 #include <miopen/config.hpp>
 #include <miopen/filesystem.hpp>
+#include <map>
 #include <memory>
+#include <ostream>
+#include <string>
 #include <string_view>
-#include <map>
 
 namespace miopen {
 
 struct ProcessImpl;
 using ProcessEnvironmentMap = std::map<std::string, std::string>;
 
+/// Runs an executable with the args and waits for it to finish.
+///
+/// On Linux the process is started with posix_spawn, without a shell, which is cheaper than
+/// fork() for a parent with a large address space. The args are split into words as a shell
+/// would: blanks separate them, quotes and backslashes escape, and "N>file", "N>>file" and
+/// "N>&M" redirect the standard streams. Args with other shell syntax (pipes, variables,
+/// globs...) are run by /bin/sh. The standard input is /dev/null. The output streams, when
+/// given, receive the standard output and error through pipes.
+///
+/// Returns the exit code, 128 + signal number if the process was killed, 127 if the executable
+/// was not found or 126 if it cannot be run.
 struct MIOPEN_INTERNALS_EXPORT Process
 {
     Process(const fs::path& cmd);
@@ -46,19 +59,22 @@ struct MIOPEN_INTERNALS_EXPORT Process
     int operator()(std::string_view args                                       = "",
                    const fs::path& cwd                                         = "",
                    std::ostream* out                                           = nullptr,
-                   const ProcessEnvironmentMap& additionalEnvironmentVariables = {});
+                   const ProcessEnvironmentMap& additionalEnvironmentVariables = {},
+                   std::ostream* err                                           = nullptr);
 
 private:
     std::unique_ptr<ProcessImpl> impl;
 };
 
+/// Starts the process as Process does, Wait() returns the exit code.
 struct MIOPEN_INTERNALS_EXPORT ProcessAsync
 {
     ProcessAsync(const fs::path& cmd,
                  std::string_view args                                       = "",
                  const fs::path& cwd                                         = "",
                  std::ostream* out                                           = nullptr,
-                 const ProcessEnvironmentMap& additionalEnvironmentVariables = {});
+                 const ProcessEnvironmentMap& additionalEnvironmentVariables = {},
+                 std::ostream* err                                           = nullptr);
     ~ProcessAsync() noexcept;
 
     ProcessAsync(ProcessAsync&&) noexcept;
@@ -70,6 +86,35 @@ private:
     std::unique_ptr<ProcessImpl> impl;
 };
 
+/// A long-running process serving requests written to its standard input, for tools which
+/// process several inputs per launch. Linux only.
+struct MIOPEN_INTERNALS_EXPORT ProcessWorker
+{
+    ProcessWorker(const fs::path& cmd,
+                  std::string_view args                                       = "",
+                  const fs::path& cwd                                         = "",
+                  const ProcessEnvironmentMap& additionalEnvironmentVariables = {});
+    /// Closes the standard input of the process and waits for it.
+    ~ProcessWorker() noexcept;
+
+    ProcessWorker(ProcessWorker&&) noexcept;
+    ProcessWorker& operator=(ProcessWorker&&) noexcept;
+
+    /// Writes the request and returns the standard output of the process up to a line equal to
+    /// end_marker, which is consumed. Throws if the process exits before printing it.
+    std::string Call(std::string_view request, std::string_view end_marker);
+
+    /// Closes the standard input of the process and returns its exit code.
+    int Close();
+
+private:
+    std::unique_ptr<ProcessImpl> impl;
+};
+
+/// Tells if a process with the pid exists, e.g. the owner of files left in a shared directory.
+/// Always true on Windows.
+MIOPEN_INTERNALS_EXPORT bool IsProcessAlive(long pid);
+
 } // namespace miopen
 
 #endif // MIOPEN_GUARD_MLOPEN_PROCESS_HPP
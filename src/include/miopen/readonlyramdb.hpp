@@ -27,10 +27,13 @@
 #define MIOPEN_GUARD_MLOPEN_READONLYRAMDB_HPP
 
 #include <miopen/db_record.hpp>
+#include <miopen/db_shard.hpp>
 #include <miopen/filesystem.hpp>
 
 #include <boost/optional.hpp>
 
+#include <map>
+#include <mutex>
 #include <unordered_map>
 #include <string>
 #include <sstream>
@@ -52,21 +55,21 @@ public:
     boost::optional<DbRecord> FindRecord(const std::string& problem) const
     {
         MIOPEN_LOG_I2("Looking for key " << problem << " in file " << db_path);
-        const auto it = cache.find(problem);
+        const auto item = FindItem(problem);
 
-        if(it == cache.end())
+        if(item == nullptr)
             return boost::none;
 
         auto record = DbRecord{problem};
 
         MIOPEN_LOG_I2("Key match: " << problem);
-        MIOPEN_LOG_I2("Contents found: " << it->second.content);
+        MIOPEN_LOG_I2("Contents found: " << item->content);
 
-        if(!record.ParseContents(it->second.content))
+        if(!record.ParseContents(item->content))
         {
             MIOPEN_LOG_E("Error parsing payload under the key: "
-                         << problem << " form file " << db_path << "#" << it->second.line);
-            MIOPEN_LOG_E("Contents: " << it->second.content);
+                         << problem << " form file " << db_path << "#" << item->line);
+            MIOPEN_LOG_E("Contents: " << item->content);
             return boost::none;
         }
 
@@ -95,20 +98,34 @@ public:
         std::string content;
     };
 
-    const std::unordered_map<std::string, CacheItem>& GetCacheMap() const { return cache; }
+    /// Loads the shards which have not been requested yet, if any.
+    const std::unordered_map<std::string, CacheItem>& GetCacheMap() const;
+
+    /// Number of problem families loaded so far. Zero if the file is not sharded.
+    std::size_t GetLoadedShardCount() const;
 
 private:
     DbKinds db_kind;
     fs::path db_path;
-    std::unordered_map<std::string, CacheItem> cache;
-
-    ReadonlyRamDb(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb(ReadonlyRamDb&&)      = default;
-    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = default;
+    // Shards are loaded on demand from const lookups, so the cache is filled lazily.
+    // It is only modified under shards_mutex and only if the file is sharded.
+    mutable std::unordered_map<std::string, CacheItem> cache;
+    bool sharded = false;
+    mutable std::mutex shards_mutex;
+    mutable std::map<std::string, DbShard> pending_shards;
+    mutable std::size_t loaded_shards = 0;
+
+    ReadonlyRamDb(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb(ReadonlyRamDb&&)      = delete;
+    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = delete;
 
     void Prefetch(bool warn_if_unreadable);
-    void ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable);
+    void ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable) const;
+    bool TryUseShards();
+    const CacheItem* FindItem(const std::string& problem) const;
+    void LoadShard(const std::string& name) const;
+    void LoadAllShards() const;
 };
 
 } // namespace miopen
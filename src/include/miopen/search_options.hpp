@@ -32,6 +32,7 @@
 #include <miopen/find_controls.hpp>
 #include <miopen/object.hpp>
 
+#include <chrono>
 #include <limits>
 #include <unordered_map>
 #include <optional>
@@ -53,6 +54,8 @@ struct FindOptions : miopenFindOptions
     std::optional<Workspace> preallocated_workspace;
     std::optional<FindEnforce> find_enforce;
     bool attach_binaries = false;
+    /// Total time of the tuning searches of the find call.
+    std::optional<std::chrono::milliseconds> tuning_time_limit;
 };
 
 } // namespace miopen
@@ -68,6 +71,8 @@ inline std::ostream& operator<<(std::ostream& stream, const miopen::FindOptions&
     case miopenFindResultsOrderByWorkspaceSize: stream << "by workspace size"; break;
     }
     stream << ", workspace limit: " << options.workspace_limit;
+    if(options.tuning_time_limit)
+        stream << ", tuning time limit: " << options.tuning_time_limit->count() << " ms";
     stream << ")";
     return stream;
 }
@@ -29,15 +29,24 @@
 
 #include <ciso646>
 #include <miopen/config.h>
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <functional>
+#include <type_traits>
 
 namespace miopen {
 namespace solver {
 namespace serialize {
 
+/// Fallback for the field types not supported by the fast path below.
+/// May be specialized for custom field types.
 template <class T>
 struct Parse
 {
@@ -50,6 +59,170 @@ struct Parse
     }
 };
 
+namespace detail {
+
+// Character types are printed as characters by iostreams, keep them on the slow path.
+template <class T>
+constexpr bool is_fast_integral_v =
+    std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+    !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char> &&
+    !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+// Precision used by iostreams by default. Formatting with it keeps the text format
+// compatible with the records written by older versions.
+constexpr int stream_float_precision = 6;
+
+/// Formats the value into [first, last) in exactly the same way as
+/// std::ostream::operator<< with default flags does.
+/// Returns the end of the written range or nullptr if the buffer is too small.
+template <class T>
+char* FormatField(char* first, char* last, const T& x)
+{
+    if constexpr(std::is_same_v<T, bool>)
+    {
+        if(first == last)
+            return nullptr;
+        *first = x ? '1' : '0';
+        return first + 1;
+    }
+    else if constexpr(is_fast_integral_v<T>)
+    {
+        const auto result = std::to_chars(first, last, x);
+        return result.ec == std::errc{} ? result.ptr : nullptr;
+    }
+    else if constexpr(std::is_floating_point_v<T>)
+    {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        const auto result =
+            std::to_chars(first, last, x, std::chars_format::general, stream_float_precision);
+        return result.ec == std::errc{} ? result.ptr : nullptr;
+#else
+        const auto size = static_cast<std::size_t>(last - first);
+        const auto n    = std::snprintf(
+            first, size, "%.*Lg", stream_float_precision, static_cast<long double>(x));
+        return (n < 0 || static_cast<std::size_t>(n) >= size) ? nullptr : first + n;
+#endif
+    }
+    else if constexpr(std::is_convertible_v<const T&, std::string_view>)
+    {
+        const auto sv = std::string_view{x};
+        if(sv.size() > static_cast<std::size_t>(last - first))
+            return nullptr;
+        std::memcpy(first, sv.data(), sv.size());
+        return first + sv.size();
+    }
+    else
+    {
+        std::ostringstream ss;
+        ss << x;
+        return FormatField(first, last, ss.str());
+    }
+}
+
+/// Parses the whole string. Unlike iostreams, fails on empty and partially parsed input.
+template <class T>
+bool ParseField(std::string_view s, T& x)
+{
+    if constexpr(std::is_same_v<T, bool>)
+    {
+        if(s == "1")
+            x = true;
+        else if(s == "0")
+            x = false;
+        else
+            return false;
+        return true;
+    }
+    else if constexpr(is_fast_integral_v<T>)
+    {
+        const auto end    = s.data() + s.size();
+        const auto result = std::from_chars(s.data(), end, x);
+        return result.ec == std::errc{} && result.ptr == end;
+    }
+    else if constexpr(std::is_floating_point_v<T>)
+    {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        const auto end    = s.data() + s.size();
+        const auto result = std::from_chars(s.data(), end, x);
+        return result.ec == std::errc{} && result.ptr == end;
+#else
+        // strtold requires null-terminated input.
+        auto buffer = std::array<char, 64>{};
+        if(s.empty() || s.size() >= buffer.size())
+            return false;
+        std::memcpy(buffer.data(), s.data(), s.size());
+        char* end   = nullptr;
+        const auto v = std::strtold(buffer.data(), &end);
+        if(end != buffer.data() + s.size())
+            return false;
+        x = static_cast<T>(v);
+        return true;
+#endif
+    }
+    else if constexpr(std::is_assignable_v<T&, std::string_view>)
+    {
+        x = s;
+        return true;
+    }
+    else
+    {
+        return Parse<T>::apply(std::string{s}, x);
+    }
+}
+
+/// Accumulates serialized fields in a fixed buffer and flushes it to the stream
+/// when full, so the stream is touched once per record in the common case.
+class FieldWriter
+{
+public:
+    explicit FieldWriter(std::ostream& stream_) : stream(stream_) {}
+    FieldWriter(const FieldWriter&) = delete;
+    FieldWriter& operator=(const FieldWriter&) = delete;
+    ~FieldWriter() { Flush(); }
+
+    template <class T>
+    void Write(const T& x)
+    {
+        if(auto end = FormatField(buffer.data() + pos, buffer.data() + buffer.size(), x))
+        {
+            pos = end - buffer.data();
+            return;
+        }
+        Flush();
+        if(auto end = FormatField(buffer.data(), buffer.data() + buffer.size(), x))
+        {
+            pos = end - buffer.data();
+            return;
+        }
+        // Does not fit into the buffer at all.
+        std::ostringstream ss;
+        ss << x;
+        stream << ss.str();
+    }
+
+    void Write(char c)
+    {
+        if(pos == buffer.size())
+            Flush();
+        buffer[pos++] = c;
+    }
+
+    void Flush()
+    {
+        if(pos == 0)
+            return;
+        stream.write(buffer.data(), static_cast<std::streamsize>(pos));
+        pos = 0;
+    }
+
+private:
+    std::ostream& stream;
+    std::array<char, 256> buffer;
+    std::size_t pos = 0;
+};
+
+} // namespace detail
+
 template <char Separator = ','>
 struct SerDes
 {
@@ -57,31 +230,49 @@ private:
     struct SerializeField
     {
         template <class T>
-        void operator()(std::ostream& stream, char& sep, const T& x) const
+        void operator()(detail::FieldWriter& writer, bool& first, const T& x) const
         {
-            if(sep != 0)
-                stream << sep;
-            stream << x;
-            sep = Separator;
+            if(!first)
+                writer.Write(Separator);
+            writer.Write(x);
+            first = false;
         }
     };
 
     struct DeserializeField
     {
         template <class T>
-        void operator()(bool& ok, std::istream& stream, T& x) const
+        void operator()(bool& ok, std::string_view& rest, bool& exhausted, T& x) const
         {
             if(not ok)
                 return;
-            std::string part;
 
-            if(!std::getline(stream, part, Separator))
+            // Mimics std::getline(stream, part, Separator): the last field extends to the end
+            // of the string, extra fields are ignored, and a field is missing only if
+            // nothing is left to read.
+            if(exhausted)
             {
                 ok = false;
                 return;
             }
 
-            ok = Parse<T>::apply(part, x);
+            const auto pos = rest.find(Separator);
+            std::string_view part;
+            if(pos == std::string_view::npos)
+            {
+                part      = rest;
+                rest      = {};
+                exhausted = true;
+            }
+            else
+            {
+                part = rest.substr(0, pos);
+                rest = rest.substr(pos + 1);
+                if(rest.empty())
+                    exhausted = true;
+            }
+
+            ok = detail::ParseField(part, x);
         }
     };
 
@@ -89,20 +280,25 @@ public:
     template <class Self>
     static void Serialize(const Self& self, std::ostream& stream)
     {
-        char sep = 0;
+        detail::FieldWriter writer{stream};
+        bool first = true;
         Self::Visit(
             self,
-            std::bind(SerializeField{}, std::ref(stream), std::ref(sep), std::placeholders::_1));
+            std::bind(SerializeField{}, std::ref(writer), std::ref(first), std::placeholders::_1));
     }
 
     template <class Self>
-    static bool Deserialize(Self& self, const std::string& s)
+    static bool Deserialize(Self& self, std::string_view s)
     {
-        auto out = self;
-        bool ok  = true;
-        std::istringstream ss(s);
-        Self::Visit(
-            out, std::bind(DeserializeField{}, std::ref(ok), std::ref(ss), std::placeholders::_1));
+        auto out       = self;
+        bool ok        = true;
+        bool exhausted = s.empty();
+        Self::Visit(out,
+                    std::bind(DeserializeField{},
+                              std::ref(ok),
+                              std::ref(s),
+                              std::ref(exhausted),
+                              std::placeholders::_1));
 
         if(!ok)
             return false;
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+namespace solver {
+
+struct CKKernelId
+{
+    std::string_view type_string;
+    std::optional<int> split_k;
+};
+
+/// Splits "<type string>+<split k>" kernel ids used by the split-k capable solvers.
+/// Returns nullopt if the split k is not a number, kernel ids come from the databases.
+inline std::optional<CKKernelId> SplitCKKernelId(std::string_view kernel_id)
+{
+    const auto pos = kernel_id.find_last_of('+');
+    if(pos == std::string_view::npos)
+        return CKKernelId{kernel_id, std::nullopt};
+
+    const auto split_k = kernel_id.substr(pos + 1);
+    const auto end     = split_k.data() + split_k.size();
+    auto value         = 0;
+    const auto result  = std::from_chars(split_k.data(), end, value);
+    if(split_k.empty() || result.ec != std::errc{} || result.ptr != end)
+        return std::nullopt;
+    return CKKernelId{kernel_id.substr(0, pos), value};
+}
+
+/// Process-wide immutable set of the composable_kernel instances of a device operation.
+/// DeviceOpType::GetInstances() allocates every instance, so it is called only once;
+/// the instances are shared with the invokers afterwards.
+template <typename DeviceOpType>
+class CKInstanceRegistry
+{
+    using InstanceList = decltype(DeviceOpType::GetInstances());
+
+public:
+    using Instance    = typename InstanceList::value_type::element_type;
+    using InstancePtr = std::shared_ptr<Instance>;
+
+    static const CKInstanceRegistry& Get()
+    {
+        static const CKInstanceRegistry registry;
+        return registry;
+    }
+
+    CKInstanceRegistry(const CKInstanceRegistry&) = delete;
+    CKInstanceRegistry& operator=(const CKInstanceRegistry&) = delete;
+
+    std::size_t Size() const { return instances.size(); }
+    const InstancePtr& At(std::size_t idx) const { return instances[idx]; }
+    const std::string& GetTypeString(std::size_t idx) const { return type_strings[idx]; }
+
+    /// Returns the index of the first instance with the type string.
+    std::optional<std::size_t> Find(std::string_view type_string) const
+    {
+        const auto it = index.find(type_string);
+        if(it == index.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+private:
+    CKInstanceRegistry()
+    {
+        auto ptrs = DeviceOpType::GetInstances();
+        instances.reserve(ptrs.size());
+        type_strings.reserve(ptrs.size());
+        for(auto& ptr : ptrs)
+        {
+            type_strings.emplace_back(ptr->GetTypeString());
+            instances.emplace_back(std::move(ptr));
+        }
+        // The strings are not moved anymore, so the views stay valid.
+        index.reserve(type_strings.size());
+        for(std::size_t i = 0; i < type_strings.size(); ++i)
+            index.emplace(type_strings[i], i);
+    }
+
+    std::vector<InstancePtr> instances;
+    std::vector<std::string> type_strings;
+    std::unordered_map<std::string_view, std::size_t> index;
+};
+
+/// Memoizes which instances of the registry support a problem on a target.
+/// CKArgsType is a part of the cache identity as the same device operation may be
+/// driven by different arguments. The target is a part of the key as the instances check
+/// the architecture of the device.
+template <typename DeviceOpType, typename CKArgsType>
+class CKSupportCache
+{
+public:
+    using Bitmap = std::shared_ptr<const std::vector<bool>>;
+
+    static constexpr std::size_t max_entries = 256;
+
+    /// Evaluates IsSupportedBy() for every instance.
+    static std::vector<bool> Compute(const CKArgsType& args)
+    {
+        const auto& registry = CKInstanceRegistry<DeviceOpType>::Get();
+        auto supported       = std::vector<bool>(registry.Size());
+        for(std::size_t i = 0; i < registry.Size(); ++i)
+            supported[i] = args.IsSupportedBy(registry.At(i));
+        return supported;
+    }
+
+    /// Returns the memoized bitmap for the target and key. make_args is invoked only on a miss.
+    template <typename MakeArgs>
+    static Bitmap Get(std::string_view target, std::string_view key, const MakeArgs& make_args)
+    {
+        auto full_key = std::string{target};
+        full_key.append(1, ';').append(key);
+
+        auto& cache = Instance();
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            const auto it = cache.entries.find(full_key);
+            if(it != cache.entries.end())
+                return it->second;
+        }
+
+        // Evaluated outside of the lock, a concurrent miss just computes the same bitmap.
+        auto bitmap = std::make_shared<const std::vector<bool>>(Compute(make_args()));
+
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if(cache.entries.size() >= max_entries)
+            cache.entries.clear();
+        return cache.entries.emplace(std::move(full_key), std::move(bitmap)).first->second;
+    }
+
+private:
+    static CKSupportCache& Instance()
+    {
+        static CKSupportCache cache;
+        return cache;
+    }
+
+    std::mutex mutex;
+    std::unordered_map<std::string, Bitmap> entries;
+};
+
+} // namespace solver
+} // namespace miopen
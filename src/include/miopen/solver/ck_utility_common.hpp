@@ -27,6 +27,7 @@
 #ifndef GUARD_CK_UTILITY_COMMON_HPP_
 #define GUARD_CK_UTILITY_COMMON_HPP_
 
+#include <miopen/device_capabilities.hpp>
 #include <miopen/env.hpp>
 #include <miopen/hip_build_utils.hpp>
 #include <miopen/mlo_internal.hpp>
@@ -49,21 +50,13 @@ namespace ck_utility {
 //             Please use is_ck_whitelist instead of this function.
 static inline bool is_ck_supported_hardware(const Handle& handle)
 {
-    return (StartsWith(handle.GetDeviceName(), "gfx803") && handle.GetMaxComputeUnits() == 64) ||
-           StartsWith(handle.GetDeviceName(), "gfx900") ||
-           StartsWith(handle.GetDeviceName(), "gfx906") ||
-           StartsWith(handle.GetDeviceName(), "gfx908") ||
-           StartsWith(handle.GetDeviceName(), "gfx90a") ||
-           StartsWith(handle.GetDeviceName(), "gfx940") ||
-           StartsWith(handle.GetDeviceName(), "gfx941") ||
-           StartsWith(handle.GetDeviceName(), "gfx942") ||
-           StartsWith(handle.GetDeviceName(), "gfx1030") ||
-           StartsWith(handle.GetDeviceName(), "gfx1031") ||
-           StartsWith(handle.GetDeviceName(), "gfx1100") ||
-           StartsWith(handle.GetDeviceName(), "gfx1101") ||
-           StartsWith(handle.GetDeviceName(), "gfx1102") ||
-           StartsWith(handle.GetDeviceName(), "gfx1200") ||
-           StartsWith(handle.GetDeviceName(), "gfx1201");
+    const auto& caps = handle.GetCapabilities();
+    return (caps.IsGfx(8, 0, 3) && caps.compute_units == 64) || caps.IsGfx(9, 0, 0) ||
+           caps.IsGfx(9, 0, 6) || caps.IsGfx(9, 0, 8) || caps.IsGfx(9, 0, 0xa) ||
+           caps.IsGfx(9, 4, 0) || caps.IsGfx(9, 4, 1) || caps.IsGfx(9, 4, 2) ||
+           caps.IsGfx(10, 3, 0) || caps.IsGfx(10, 3, 1) || caps.IsGfx(11, 0, 0) ||
+           caps.IsGfx(11, 0, 1) || caps.IsGfx(11, 0, 2) || caps.IsGfx(12, 0, 0) ||
+           caps.IsGfx(12, 0, 1);
 }
 
 // MI100 : gfx908
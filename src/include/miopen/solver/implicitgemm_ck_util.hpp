@@ -32,8 +32,10 @@
 #include <miopen/buffer_info.hpp>
 #include <miopen/tensor_ops.hpp>
 #include <miopen/miopen_internal.h>
+#include <miopen/solver/ck_instance_registry.hpp>
 
 #if MIOPEN_BACKEND_HIP && MIOPEN_USE_COMPOSABLEKERNEL
+#include <ck/host_utility/device_prop.hpp>
 #include <ck/utility/data_type.hpp>
 #include <ck/library/tensor_operation_instance/gpu/grouped_convolution_backward_weight.hpp>
 #endif // MIOPEN_USE_COMPOSABLEKERNEL
@@ -96,13 +98,61 @@ struct CKBWDWeightBufferDescriptor
     }
 };
 
-template <typename ConvPtrsType>
-typename ConvPtrsType::iterator FindConvPtrByID(ConvPtrsType& conv_ptrs,
-                                                const std::string& kernel_id)
+/// Target of the current device, the one the instances check their support for.
+/// Queried once per device.
+inline std::string GetCKTarget()
 {
-    return std::find_if(conv_ptrs.begin(), conv_ptrs.end(), [&kernel_id](const auto& ptr) {
-        return ptr->GetTypeString() == kernel_id;
-    });
+#if MIOPEN_BACKEND_HIP && MIOPEN_USE_COMPOSABLEKERNEL
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::unordered_map<int, std::string> targets;
+
+    auto device = 0;
+    if(hipGetDevice(&device) != hipSuccess)
+        return ck::get_device_name();
+    const std::lock_guard<std::mutex> lock(mutex);
+    auto found = targets.find(device);
+    if(found == targets.end())
+        found = targets.emplace(device, ck::get_device_name()).first;
+    return found->second;
+#else
+    return {};
+#endif
+}
+
+/// Key of the memoized instance support. Only the convolution problems are keyed,
+/// the other problems are evaluated each time.
+template <typename ProblemDescriptionType>
+std::optional<std::string> MakeCKSupportKey(const ProblemDescriptionType& problem)
+{
+    if constexpr(std::is_same_v<ProblemDescriptionType, miopen::conv::ProblemDescription>)
+    {
+        // The network config does not include strides, but CK arguments may depend on them.
+        auto key = problem.MakeNetworkConfig().ToString();
+        for(const auto* desc : {&problem.GetIn(), &problem.GetWeights(), &problem.GetOut()})
+        {
+            key += 'x';
+            for(const auto stride : desc->GetStrides())
+                key.append(std::to_string(stride)).push_back(',');
+        }
+        return key;
+    }
+    else
+    {
+        std::ignore = problem;
+        return std::nullopt;
+    }
+}
+
+template <typename DeviceOpType, typename CKArgsType, typename ProblemDescriptionType>
+std::shared_ptr<const std::vector<bool>>
+GetCKSupportedInstances(const ProblemDescriptionType& problem)
+{
+    using Cache = CKSupportCache<DeviceOpType, CKArgsType>;
+    if(const auto key = MakeCKSupportKey(problem))
+        return Cache::Get(GetCKTarget(), *key, [&problem]() { return CKArgsType{problem}; });
+    return std::make_shared<const std::vector<bool>>(Cache::Compute(CKArgsType{problem}));
 }
 
 template <typename DeviceOpType,
@@ -110,16 +160,16 @@ template <typename DeviceOpType,
           typename ProblemDescriptionType = miopen::conv::ProblemDescription>
 std::vector<std::string> FillValidKernelsIDs(const ProblemDescriptionType& problem)
 {
-    const auto args      = CKArgsType{problem};
-    const auto conv_ptrs = DeviceOpType::GetInstances();
-    assert(!conv_ptrs.empty());
+    const auto& registry = CKInstanceRegistry<DeviceOpType>::Get();
+    const auto supported = GetCKSupportedInstances<DeviceOpType, CKArgsType>(problem);
+    assert(registry.Size() != 0);
 
     std::vector<std::string> valid_kernels;
-    valid_kernels.reserve(conv_ptrs.size());
-    for(size_t idx = 0; idx < conv_ptrs.size(); ++idx)
+    valid_kernels.reserve(registry.Size());
+    for(size_t idx = 0; idx < registry.Size(); ++idx)
     {
-        if(args.IsSupportedBy(conv_ptrs[idx]))
-            valid_kernels.emplace_back(std::move(conv_ptrs[idx]->GetTypeString()));
+        if((*supported)[idx])
+            valid_kernels.emplace_back(registry.GetTypeString(idx));
     }
     assert(!valid_kernels.empty());
     return valid_kernels;
@@ -133,22 +183,22 @@ bool IsCKArgsSupported(const ProblemDescriptionType& problem, const std::string&
 #if MIOPEN_BACKEND_HIP && MIOPEN_USE_COMPOSABLEKERNEL
     if(!kernel_id.empty())
     {
-        auto conv_ptrs = DeviceOpType::GetInstances();
+        const auto& registry = CKInstanceRegistry<DeviceOpType>::Get();
         if constexpr(std::is_same_v<DeviceOpType, conv::DeviceOpGWrwPtrs<ck::half_t>> ||
                      std::is_same_v<DeviceOpType, conv::DeviceOpGWrwPtrs<float>> ||
                      std::is_same_v<DeviceOpType, conv::DeviceOpGWrwPtrs<int8_t>> ||
                      std::is_same_v<DeviceOpType, conv::DeviceOpGWrwPtrs<ck::bhalf_t>>)
         {
-            auto pos      = kernel_id.find_last_of('+');
-            int split_k   = std::stoi(kernel_id.substr(pos + 1));
-            auto ptr_iter = FindConvPtrByID(conv_ptrs, kernel_id.substr(0, pos));
-            return (ptr_iter != conv_ptrs.end()) &&
-                   CKArgsType{problem}.IsSupportedBySplitK(*ptr_iter, split_k);
+            const auto id = SplitCKKernelId(kernel_id);
+            if(!id || !id->split_k)
+                return false;
+            const auto idx = registry.Find(id->type_string);
+            return idx && CKArgsType{problem}.IsSupportedBySplitK(registry.At(*idx), *id->split_k);
         }
         else
         {
-            auto ptr_iter = FindConvPtrByID(conv_ptrs, kernel_id);
-            return (ptr_iter != conv_ptrs.end()) && CKArgsType{problem}.IsSupportedBy(*ptr_iter);
+            const auto idx = registry.Find(kernel_id);
+            return idx && (*GetCKSupportedInstances<DeviceOpType, CKArgsType>(problem))[*idx];
         }
     }
 #endif
@@ -160,11 +210,8 @@ template <typename DeviceOpType,
           typename ProblemDescriptionType = miopen::conv::ProblemDescription>
 bool IsCKApplicable(const ProblemDescriptionType& problem)
 {
-    const auto args = CKArgsType{problem};
-
-    const auto ptrs = DeviceOpType::GetInstances();
-    return std::any_of(
-        ptrs.begin(), ptrs.end(), [&args](auto& ptr) { return args.IsSupportedBy(ptr); });
+    const auto supported = GetCKSupportedInstances<DeviceOpType, CKArgsType>(problem);
+    return std::any_of(supported->begin(), supported->end(), [](bool v) { return v; });
 }
 
 #define WORKAROUND_CK_ISSUE_1184 1
@@ -191,16 +238,16 @@ template <typename DeviceOpType,
 ConvSolution InitAnyInvokerFactory(const ProblemDescriptionType& problem,
                                    const std::string& kernel_id)
 {
-    auto conv_ptrs = DeviceOpType::GetInstances();
-    auto ptr_iter  = FindConvPtrByID(conv_ptrs, kernel_id);
+    const auto& registry = CKInstanceRegistry<DeviceOpType>::Get();
+    const auto idx       = registry.Find(kernel_id);
 
-    if(ptr_iter == conv_ptrs.end())
+    if(!idx)
         return {miopenStatusInvalidValue};
 
     ConvSolution result;
     result.invoker_factory =
-        [ck_args     = CKArgsType{problem},
-         sh_conv_ptr = std::shared_ptr{std::move(*ptr_iter)}](const std::vector<Kernel>&) mutable {
+        [ck_args = CKArgsType{problem}, sh_conv_ptr = registry.At(*idx)](
+            const std::vector<Kernel>&) mutable {
             return [ck_args = std::move(ck_args), sh_conv_ptr = std::move(sh_conv_ptr)](
                        const Handle& handle, const AnyInvokeParams& primitive_parameters) {
                 const auto& data_ctx = primitive_parameters.CastTo<CastType>();
@@ -654,16 +701,8 @@ ConvSolution InitInvokerFactoryNCHW(const ExecutionContext& ctx,
 #if MIOPEN_BACKEND_HIP && MIOPEN_USE_COMPOSABLEKERNEL
     auto ck_args = CKArgsType{problem};
 
-    auto conv_ptrs = DeviceOpType::GetInstances();
-
-    std::optional<int> split_k = std::nullopt;
-    std::string id_string      = kernel_id;
-    auto pos                   = kernel_id.find_last_of('+');
-    if(pos != std::string::npos)
-    {
-        split_k   = std::stoi(kernel_id.substr(pos + 1));
-        id_string = kernel_id.substr(0, pos);
-    }
+    const auto& registry = CKInstanceRegistry<DeviceOpType>::Get();
+    const auto id        = SplitCKKernelId(kernel_id);
 
     std::optional<CKBWDWeightBufferDescriptor> _ck_buff_des;
 
@@ -672,8 +711,8 @@ ConvSolution InitInvokerFactoryNCHW(const ExecutionContext& ctx,
         _ck_buff_des.emplace(GetCKAlphaBetaWorkspace(problem), 0);
     }
 
-    auto ptr_iter = FindConvPtrByID(conv_ptrs, id_string);
-    if(ptr_iter == conv_ptrs.end())
+    const auto idx = id ? registry.Find(id->type_string) : std::nullopt;
+    if(!idx)
     {
         MIOPEN_LOG_E("PerformanceConfig kernel '" + kernel_id + "' does not exist.");
         return {miopenStatusInvalidValue};
@@ -683,9 +722,9 @@ ConvSolution InitInvokerFactoryNCHW(const ExecutionContext& ctx,
         internal::MakeTaggedTransposeInstances<CKArgsType>(
             result, ctx, problem, ck_args, input1_op, input2_op, output_op, _ck_buff_des);
 
-    result.invoker_factory = [split_k             = split_k,
+    result.invoker_factory = [split_k             = id->split_k,
                               ck_args             = std::move(ck_args),
-                              sh_conv_ptr         = std::shared_ptr{std::move(*ptr_iter)},
+                              sh_conv_ptr         = registry.At(*idx),
                               input1_tr_inst      = std::move(_input1_tr_inst),
                               input2_tr_inst      = std::move(_input2_tr_inst),
                               output_tr_inst      = std::move(_output_tr_inst),
@@ -802,20 +841,11 @@ ConvSolution InitInvokerFactoryNHWC(const ExecutionContext&,
                                     const ProblemDescriptionType& problem,
                                     const std::string& kernel_id)
 {
-    auto conv_ptrs = DeviceOpType::GetInstances();
-
-    std::optional<int> split_k = std::nullopt;
-    std::string id_string      = kernel_id;
-    auto pos                   = kernel_id.find_last_of('+');
-    if(pos != std::string::npos)
-    {
-        split_k   = std::stoi(kernel_id.substr(pos + 1));
-        id_string = kernel_id.substr(0, pos);
-    }
-
-    auto ptr_iter = FindConvPtrByID(conv_ptrs, id_string);
+    const auto& registry = CKInstanceRegistry<DeviceOpType>::Get();
+    const auto id        = SplitCKKernelId(kernel_id);
+    const auto idx       = id ? registry.Find(id->type_string) : std::nullopt;
 
-    if(ptr_iter == conv_ptrs.end())
+    if(!idx)
     {
         MIOPEN_LOG_E("PerformanceConfig kernel '" + kernel_id + "' does not exist.");
         return {miopenStatusInvalidValue};
@@ -829,11 +859,11 @@ ConvSolution InitInvokerFactoryNHWC(const ExecutionContext&,
         [[maybe_unused]] bool should_allocated_wrw_buffer =
             ShouldAllocateWorkSpaceBufferForWRW(problem);
 
-        result.invoker_factory = [split_k                     = split_k,
+        result.invoker_factory = [split_k                     = id->split_k,
                                   ck_args                     = CKArgsType{problem},
                                   alpha_beta_case             = alpha_beta_case,
                                   should_allocated_wrw_buffer = should_allocated_wrw_buffer,
-                                  sh_conv_ptr = std::shared_ptr{std::move(*ptr_iter)}](
+                                  sh_conv_ptr = registry.At(*idx)](
                                      const std::vector<Kernel>&) mutable {
             return [split_k                     = split_k,
                     ck_args                     = std::move(ck_args),
@@ -892,7 +922,7 @@ ConvSolution InitInvokerFactoryNHWC(const ExecutionContext&,
     {
         ConvSolution result;
         result.invoker_factory = [ck_args     = CKArgsType{problem},
-                                  sh_conv_ptr = std::shared_ptr{std::move(*ptr_iter)}](
+                                  sh_conv_ptr = registry.At(*idx)](
                                      const std::vector<Kernel>&) mutable {
             return [ck_args = std::move(ck_args), sh_conv_ptr = std::move(sh_conv_ptr)](
                        const Handle& handle, const AnyInvokeParams& primitive_parameters) {
@@ -27,6 +27,7 @@
 #ifndef GUARD_IMPLICITGEMM_UTIL_HPP_
 #define GUARD_IMPLICITGEMM_UTIL_HPP_
 
+#include <miopen/device_capabilities.hpp>
 #include <miopen/env.hpp>
 #include <miopen/hip_build_utils.hpp>
 #include <miopen/mlo_internal.hpp>
@@ -211,10 +212,8 @@ static inline bool IsXdlopsSupport(const ExecutionContext& ctx)
     // disable xdlops kernels by default due to possible failures:
     // 1) inline asm may crash
     // 2) llvm intrin may has incorrect results
-    const bool is_xdlops_supported = StartsWith(ctx.GetStream().GetDeviceName(), "gfx908") ||
-                                     StartsWith(ctx.GetStream().GetDeviceName(), "gfx90a") ||
-                                     StartsWith(ctx.GetStream().GetDeviceName(), "gfx94");
-    return is_xdlops_supported && !env::disabled(MIOPEN_DEBUG_CONV_IMPLICIT_GEMM_XDLOPS);
+    return ctx.GetStream().GetCapabilities().xdlops &&
+           !env::disabled(MIOPEN_DEBUG_CONV_IMPLICIT_GEMM_XDLOPS);
 }
 
 ///\todo remove
@@ -573,14 +572,10 @@ static inline auto get_static_ck_common_compiler_flag(const ExecutionContext& ct
 
 static inline bool IsComposableKernelSupportedHardware(const ExecutionContext& c)
 {
-    return (StartsWith(c.GetStream().GetDeviceName(), "gfx803") &&
-            c.GetStream().GetMaxComputeUnits() == 64) ||
-           StartsWith(c.GetStream().GetDeviceName(), "gfx900") ||
-           StartsWith(c.GetStream().GetDeviceName(), "gfx906") ||
-           StartsWith(c.GetStream().GetDeviceName(), "gfx908") ||
-           StartsWith(c.GetStream().GetDeviceName(), "gfx90a") ||
-           StartsWith(c.GetStream().GetDeviceName(), "gfx94") ||
-           StartsWith(c.GetStream().GetDeviceName(), "gfx103");
+    const auto& caps = c.GetStream().GetCapabilities();
+    return (caps.IsGfx(8, 0, 3) && caps.compute_units == 64) || caps.IsGfx(9, 0, 0) ||
+           caps.IsGfx(9, 0, 6) || caps.IsGfx(9, 0, 8) || caps.IsGfx(9, 0, 0xa) ||
+           caps.IsGfx(9, 4) || caps.IsGfx(10, 3);
 }
 
 // greatest common divisor, aka highest common factor
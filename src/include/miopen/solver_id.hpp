@@ -32,6 +32,7 @@
 #include <miopen/conv_algo_name.hpp>
 
 #include <cstdint>
+#include <string_view>
 
 namespace miopen {
 
@@ -75,6 +76,7 @@ struct MIOPEN_INTERNALS_EXPORT Id
     Id(ForceInit, uint64_t value_);
     Id(const std::string& str);
     Id(const char* str);
+    Id(std::string_view str);
 
     std::string ToString() const;
     AnySolver GetSolver() const;
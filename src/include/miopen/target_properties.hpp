@@ -45,6 +45,9 @@ struct TargetProperties
     static std::size_t GetMaxWaveScratchSize() { return MaxWaveScratchSize; }
     static std::size_t GetMaxLocalMemorySize() { return MaxLocalMemorySize; }
     void Init(const Handle*);
+    /// Initializes from the device name reported by the runtime, e.g. "gfx90a:sramecc+:xnack-".
+    /// MIOPEN_DEVICE_ARCH, if set, takes precedence.
+    void Init(const std::string& device_name);
 
 private:
     void InitDbId();
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_TENSOR_DUMP_HPP_
+#define GUARD_MIOPEN_TENSOR_DUMP_HPP_
+
+#include <miopen/common.hpp>
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/miopen.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+struct TensorDescriptor;
+
+/// Everything needed to interpret the dumped bytes of a tensor.
+struct TensorDumpInfo
+{
+    miopenDataType_t type = miopenFloat;
+    std::vector<std::size_t> lengths;
+    std::vector<std::size_t> strides;
+    std::string layout;
+
+    MIOPEN_INTERNALS_EXPORT static TensorDumpInfo From(const TensorDescriptor& desc);
+
+    /// Number of elements covered by the strides, i.e. what is copied from the device.
+    MIOPEN_INTERNALS_EXPORT std::size_t GetElementSpace() const;
+    MIOPEN_INTERNALS_EXPORT std::size_t GetNumBytes() const;
+};
+
+/// Builds the header of an .npy (format version 1.0) file holding the element space of the
+/// tensor. Dense tensors get the lengths ordered by descending strides as the shape, e.g.
+/// (N, H, W, C) for NHWC, others are written as a flat array of the element space.
+/// bfloat16 and fp8 types have no numpy equivalent and are stored as unsigned integers
+/// of the same size.
+MIOPEN_INTERNALS_EXPORT std::string MakeNpyHeader(const TensorDumpInfo& info);
+
+/// JSON description of the tensor written next to each .npy file: numpy can't store the
+/// strides, the layout and the exact data type.
+MIOPEN_INTERNALS_EXPORT std::string MakeTensorDumpMetadata(const TensorDumpInfo& info,
+                                                           bool compressed);
+
+/// Writes tensors to files on a background thread, so the API call only pays for the
+/// device to host copy. The copies go to staging buffers (pinned on HIP) which are reused
+/// across dumps; the amount of queued data is bounded and the dumping call blocks
+/// while the queue is full.
+class MIOPEN_INTERNALS_EXPORT TensorDumper
+{
+public:
+    enum class Format
+    {
+        Raw, ///< Bytes only, <prefix>_<name>.bin, as written by DumpTensorToFileFromDevice.
+        Npy, ///< <prefix>_<call>_<name>.npy(.zst) and <prefix>_<call>_<name>.json.
+    };
+
+    struct Options
+    {
+        Format format = Format::Npy;
+        /// Compresses .npy files with zstd if the library is built with it.
+        bool compress = false;
+        /// Only every K-th call is dumped.
+        std::size_t every_k = 1;
+        /// Dumping stops after this number of dumped calls, 0 means no limit.
+        std::size_t first_n = 0;
+        /// Dumping blocks while this amount of data is waiting to be written.
+        std::size_t max_pending_bytes = std::size_t{256} << 20;
+    };
+
+    explicit TensorDumper(Options options_);
+    /// Writes everything queued before returning.
+    ~TensorDumper();
+
+    TensorDumper(const TensorDumper&) = delete;
+    TensorDumper& operator=(const TensorDumper&) = delete;
+
+    /// Counts the call and returns its index if the sampling policy selects it for dumping.
+    std::optional<std::size_t> Sample();
+
+    /// Copies the tensor to the host and queues it to be written as
+    /// <prefix>_<call>_<name> (<prefix>_<name> for the raw format).
+    /// Relative prefixes are resolved against the current directory.
+    void Dump(const Handle& handle,
+              const TensorDescriptor& desc,
+              ConstData_t data,
+              const std::string& prefix,
+              std::size_t call,
+              const std::string& name);
+
+    /// Same as Dump() for host data.
+    void DumpHost(const TensorDumpInfo& info,
+                  const void* data,
+                  const std::string& prefix,
+                  std::size_t call,
+                  const std::string& name);
+
+    /// Waits until all queued tensors are written.
+    void Flush();
+
+    /// Path of the file without the extension.
+    fs::path GetPath(const std::string& prefix, std::size_t call, const std::string& name) const;
+
+    const Options& GetOptions() const { return options; }
+
+    /// Process-wide instance configured from the environment (MIOPEN_DUMP_TENSOR_*).
+    /// It is never destroyed, the queue is flushed at exit.
+    static TensorDumper& GetInstance();
+
+private:
+    struct StagingDeleter
+    {
+        void operator()(char* ptr) const;
+    };
+    using StagingPtr = std::unique_ptr<char[], StagingDeleter>;
+
+    struct Staging
+    {
+        StagingPtr data;
+        std::size_t capacity = 0;
+    };
+
+    struct Job
+    {
+        fs::path path;
+        TensorDumpInfo info;
+        Staging staging;
+    };
+
+    /// Waits for room in the queue and returns a buffer of at least the given size.
+    Staging Acquire(std::size_t size);
+    void Enqueue(Job job);
+    void Write(const Job& job) const;
+    void WriterLoop();
+
+    const Options options;
+    std::atomic<std::size_t> calls{0};
+
+    std::mutex mutex;
+    std::condition_variable queue_changed;
+    std::deque<Job> queue;
+    std::vector<Staging> free_staging;
+    std::size_t pending_bytes = 0;
+    std::thread writer;
+    bool stop = false;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_TENSOR_DUMP_HPP_
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_TUNING_CANCEL_HPP_
+#define GUARD_MIOPEN_TUNING_CANCEL_HPP_
+
+#include <miopen/config.hpp>
+
+#include <atomic>
+
+namespace miopen {
+namespace solver {
+
+/// Cancels the searches started within the scope by the same thread once the flag is set,
+/// e.g. by the background tuner at exit. GenericSearch stops before the next config and
+/// stores nothing, the remaining solvers are skipped.
+struct MIOPEN_INTERNALS_EXPORT TuningCancelScope
+{
+    explicit TuningCancelScope(const std::atomic<bool>& flag);
+    TuningCancelScope(const TuningCancelScope&) = delete;
+    TuningCancelScope& operator=(const TuningCancelScope&) = delete;
+    ~TuningCancelScope();
+
+private:
+    const std::atomic<bool>* old_flag;
+};
+
+/// The flag of the innermost TuningCancelScope of the calling thread or nullptr.
+MIOPEN_INTERNALS_EXPORT const std::atomic<bool>* GetTuningCancelFlag();
+
+MIOPEN_INTERNALS_EXPORT bool IsTuningCancelled();
+
+} // namespace solver
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_TUNING_CANCEL_HPP_
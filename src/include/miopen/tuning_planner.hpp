@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/miopen.h>
+
+#include <miopen/config.hpp>
+#include <miopen/object.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+/// Distributes a total tuning time budget among the problems of a network.
+///
+/// Each problem is weighted by its expected gain: the number of its occurrences times the
+/// estimated time of a single call times the expected relative improvement. The time is
+/// known if the problem has a find-db record, otherwise it is estimated from the amount of
+/// work (e.g. flops) with the time per unit of work calibrated on the known times.
+/// The budget is split proportionally to the weights. The problems that would get less than
+/// Options::min_budget are not tuned at all, as a search that short is unlikely to find
+/// anything. The plan is recomputed each time a problem is reported as tuned, so both the
+/// unused budget and the measured times are taken into account for the remaining problems.
+struct MIOPEN_INTERNALS_EXPORT TuningPlanner : miopenTuningPlanner
+{
+    using Duration = std::chrono::milliseconds;
+
+    struct Options
+    {
+        /// Expected relative improvement of a problem without a find-db record.
+        double untuned_gain = 0.3;
+        /// Expected relative improvement of a problem with a find-db record.
+        double tuned_gain = 0.02;
+        /// The time per unit of work used until any time is known, in milliseconds.
+        /// Corresponds to 10 TFLOP/s if the work is measured in flops.
+        double default_time_per_work = 1e-10;
+        Duration min_budget = std::chrono::seconds{10};
+        Duration max_budget = std::chrono::hours{2};
+    };
+
+    struct Item
+    {
+        std::string key;
+        std::size_t count = 0;
+        /// Work of a single call, e.g. flops.
+        double work = 0;
+        /// Time of a single call from the find-db, in milliseconds.
+        std::optional<double> known_time;
+        /// Time of a single call measured after tuning, in milliseconds.
+        std::optional<double> measured_time;
+        Duration budget{0};
+        Duration spent{0};
+        bool done = false;
+    };
+
+    explicit TuningPlanner(Duration total_budget_);
+    TuningPlanner(Duration total_budget_, Options options_);
+
+    /// Adds the problem or increases the occurrence count of an already added one.
+    /// Returns the index of the problem.
+    std::size_t Add(const std::string& key,
+                    std::size_t count,
+                    double work,
+                    std::optional<double> known_time = std::nullopt);
+
+    /// The pending problem with the largest expected gain among the ones with non-zero budget.
+    std::optional<std::size_t> Next() const;
+
+    /// Marks the problem as tuned and replans the remaining budget.
+    void Report(std::size_t index, Duration spent, std::optional<double> measured_time);
+
+    const Item& Get(std::size_t index) const;
+    std::size_t Size() const { return items.size(); }
+
+    /// Estimated time of a single call of the problem, in milliseconds.
+    double GetEstimatedTime(std::size_t index) const;
+    /// Estimated time saved by tuning the problem per a network run, in milliseconds.
+    double GetExpectedGain(std::size_t index) const;
+    /// Share of the problem in the estimated network run time.
+    double GetTimeShare(std::size_t index) const;
+    Duration GetRemainingBudget() const;
+
+private:
+    void Plan();
+    void Calibrate();
+
+    const Duration total_budget;
+    const Options options;
+    std::vector<Item> items;
+    std::unordered_map<std::string, std::size_t> index_by_key;
+    double time_per_work;
+};
+
+} // namespace miopen
+
+MIOPEN_DEFINE_OBJECT(miopenTuningPlanner, miopen::TuningPlanner);
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_TUNING_QUEUE_HPP_
+#define GUARD_MIOPEN_TUNING_QUEUE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// A unit of tuning work: a problem, given as MIOpenDriver arguments, and the solvers
+/// to tune it with.
+struct TuningJob
+{
+    /// Unique within the queue. Also used as the name of the job file and of the shard.
+    std::string name;
+    /// Solvers in the MIOPEN_DEBUG_FIND_ONLY_SOLVER format.
+    std::string solvers;
+    /// MIOpenDriver arguments describing the problem.
+    std::string command;
+};
+
+/// File-based work queue shared by the tuning workers of one machine.
+///
+/// Every job is a file that is moved between the pending/, claimed/, done/ and
+/// failed/ subdirectories of the queue. A claim is an atomic rename, so any number of
+/// worker processes may pull from the same queue without further locking. The name of
+/// a claimed file records the pid of the worker, which allows returning the jobs of
+/// crashed workers back to the queue.
+///
+/// Each job gets its own shard directory to be used as the MIOPEN_USER_DB_PATH of the
+/// worker, see MergeUserDbShards().
+class MIOPEN_INTERNALS_EXPORT TuningQueue
+{
+public:
+    struct Stats
+    {
+        std::size_t pending = 0;
+        std::size_t claimed = 0;
+        std::size_t done    = 0;
+        std::size_t failed  = 0;
+    };
+
+    explicit TuningQueue(const fs::path& root_);
+
+    const fs::path& GetRoot() const { return root; }
+    fs::path GetShardPath(const TuningJob& job) const;
+
+    void Push(const TuningJob& job);
+    /// Takes the pending job with the smallest name. Returns nothing if the queue is empty.
+    std::optional<TuningJob> Claim();
+    /// Moves a job claimed by this process to done/ or failed/.
+    void Complete(const TuningJob& job, bool success);
+    /// Returns the jobs claimed by the processes which are not alive anymore back to
+    /// pending/. Returns the number of such jobs.
+    std::size_t RequeueAbandoned();
+
+    Stats GetStats() const;
+    /// Shard directories of the successfully completed jobs.
+    std::vector<fs::path> GetDoneShards() const;
+
+private:
+    fs::path root;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_TUNING_QUEUE_HPP_
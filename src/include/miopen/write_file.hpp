@@ -27,8 +27,10 @@
 #ifndef GUARD_MLOPEN_WRITE_FILE_HPP
 #define GUARD_MLOPEN_WRITE_FILE_HPP
 
+#include <miopen/errors.hpp>
 #include <miopen/filesystem.hpp>
 #include <fstream>
+#include <vector>
 
 namespace miopen {
 
@@ -28,6 +28,7 @@
 #include <hip/hip_runtime.h>
 #endif
 
+#include "adam_multi_tensor.hpp"
 #include "float_types.h"
 
 template <typename T1, typename T2>
@@ -624,3 +625,133 @@ extern "C" __global__ void TransformersAmpAdamWContiguousWithStep(PTYPE* param_i
                                          input_size);
     }
 }
+
+// Copies the parameters to the float16 output of the chunk when the step is skipped.
+inline __device__ void
+MultiTensorSkipChunk(PTYPE* param, half* param_fp16, size_t begin, size_t end)
+{
+    if(param_fp16 == nullptr)
+        return;
+
+    for(size_t gid = begin + threadIdx.x; gid < end; gid += blockDim.x)
+        param_fp16[gid] = static_cast<half>(param[gid]);
+}
+
+extern "C" __global__ void AdamMultiTensorContiguous(adam_multi_tensor_list_t list,
+                                                     int32_t* grad_scale,
+                                                     bool* found_inf,
+                                                     float lr,
+                                                     float beta1,
+                                                     float beta2,
+                                                     float weight_decay,
+                                                     float eps,
+                                                     uint32_t step,
+                                                     bool amsgrad,
+                                                     bool maximize,
+                                                     bool adamw,
+                                                     uint64_t chunk_size)
+{
+    const uint32_t slot = list.block_to_tensor[blockIdx.x];
+
+    PTYPE* param          = static_cast<PTYPE*>(list.param[slot]);
+    GTYPE* grad_in        = static_cast<GTYPE*>(list.grad[slot]);
+    PTYPE* exp_avg        = static_cast<PTYPE*>(list.exp_avg[slot]);
+    PTYPE* exp_avg_sq     = static_cast<PTYPE*>(list.exp_avg_sq[slot]);
+    PTYPE* max_exp_avg_sq = static_cast<PTYPE*>(list.max_exp_avg_sq[slot]);
+    half* param_fp16      = static_cast<half*>(list.param_fp16[slot]);
+
+    const size_t begin = static_cast<size_t>(list.block_to_chunk[blockIdx.x]) * chunk_size;
+    const size_t end   = min(begin + chunk_size, static_cast<size_t>(list.numel[slot]));
+
+    if(found_inf != nullptr && *found_inf)
+    {
+        MultiTensorSkipChunk(param, param_fp16, begin, end);
+        return;
+    }
+
+    CTYPE scale_factor = (grad_scale) ? static_cast<CTYPE>(*grad_scale) : 1.0f;
+
+    for(size_t gid = begin + threadIdx.x; gid < end; gid += blockDim.x)
+    {
+        CTYPE grad = static_cast<CTYPE>(grad_in[gid]);
+        if(grad_scale)
+            grad /= scale_factor;
+
+        AdamInternal<PTYPE, CTYPE>(param,
+                                   param,
+                                   exp_avg,
+                                   exp_avg,
+                                   exp_avg_sq,
+                                   exp_avg_sq,
+                                   max_exp_avg_sq,
+                                   max_exp_avg_sq,
+                                   grad,
+                                   lr,
+                                   beta1,
+                                   beta2,
+                                   weight_decay,
+                                   eps,
+                                   step,
+                                   amsgrad,
+                                   maximize,
+                                   adamw,
+                                   gid);
+
+        if(param_fp16)
+            param_fp16[gid] = static_cast<half>(param[gid]);
+    }
+}
+
+extern "C" __global__ void TransformersAdamWMultiTensorContiguous(adam_multi_tensor_list_t list,
+                                                                  int32_t* grad_scale,
+                                                                  bool* found_inf,
+                                                                  float beta1,
+                                                                  float beta2,
+                                                                  float eps,
+                                                                  float lr_weight_decay,
+                                                                  float step_size,
+                                                                  uint64_t chunk_size)
+{
+    const uint32_t slot = list.block_to_tensor[blockIdx.x];
+
+    PTYPE* param      = static_cast<PTYPE*>(list.param[slot]);
+    GTYPE* grad_in    = static_cast<GTYPE*>(list.grad[slot]);
+    PTYPE* exp_avg    = static_cast<PTYPE*>(list.exp_avg[slot]);
+    PTYPE* exp_avg_sq = static_cast<PTYPE*>(list.exp_avg_sq[slot]);
+    half* param_fp16  = static_cast<half*>(list.param_fp16[slot]);
+
+    const size_t begin = static_cast<size_t>(list.block_to_chunk[blockIdx.x]) * chunk_size;
+    const size_t end   = min(begin + chunk_size, static_cast<size_t>(list.numel[slot]));
+
+    if(found_inf != nullptr && *found_inf)
+    {
+        MultiTensorSkipChunk(param, param_fp16, begin, end);
+        return;
+    }
+
+    CTYPE scale_factor = (grad_scale) ? static_cast<CTYPE>(*grad_scale) : 1.0f;
+
+    for(size_t gid = begin + threadIdx.x; gid < end; gid += blockDim.x)
+    {
+        CTYPE grad = static_cast<CTYPE>(grad_in[gid]);
+        if(grad_scale)
+            grad /= scale_factor;
+
+        TransformersAdamWInternal<PTYPE, CTYPE>(param,
+                                                param,
+                                                exp_avg,
+                                                exp_avg,
+                                                exp_avg_sq,
+                                                exp_avg_sq,
+                                                grad,
+                                                beta1,
+                                                beta2,
+                                                eps,
+                                                lr_weight_decay,
+                                                step_size,
+                                                gid);
+
+        if(param_fp16)
+            param_fp16[gid] = static_cast<half>(param[gid]);
+    }
+}
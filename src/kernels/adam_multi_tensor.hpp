@@ -0,0 +1,53 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_ADAM_MULTI_TENSOR_HPP
+#define GUARD_ADAM_MULTI_TENSOR_HPP
+
+#include "miopen_cstdint.hpp"
+
+// Limits of a single multi-tensor launch. The work list is passed to the kernel by value,
+// so these are chosen to keep the whole argument buffer below the 4 KiB kernarg limit.
+#define ADAM_MULTI_TENSOR_MAX_TENSORS 36
+#define ADAM_MULTI_TENSOR_MAX_BLOCKS 320
+
+// Work list of one multi-tensor optimizer launch. Every workgroup updates one chunk of one
+// tensor: block i processes elements [chunk * chunk_size, (chunk + 1) * chunk_size) of the
+// tensor in slot block_to_tensor[i]. Optional state (max_exp_avg_sq, param_fp16) is null.
+struct adam_multi_tensor_list_t
+{
+    void* param[ADAM_MULTI_TENSOR_MAX_TENSORS];
+    void* grad[ADAM_MULTI_TENSOR_MAX_TENSORS];
+    void* exp_avg[ADAM_MULTI_TENSOR_MAX_TENSORS];
+    void* exp_avg_sq[ADAM_MULTI_TENSOR_MAX_TENSORS];
+    void* max_exp_avg_sq[ADAM_MULTI_TENSOR_MAX_TENSORS];
+    void* param_fp16[ADAM_MULTI_TENSOR_MAX_TENSORS];
+    uint64_t numel[ADAM_MULTI_TENSOR_MAX_TENSORS];
+    uint32_t block_to_chunk[ADAM_MULTI_TENSOR_MAX_BLOCKS];
+    uint8_t block_to_tensor[ADAM_MULTI_TENSOR_MAX_BLOCKS];
+};
+
+#endif // GUARD_ADAM_MULTI_TENSOR_HPP
@@ -24,12 +24,28 @@
  *
  *******************************************************************************/
 
+#include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/md5.hpp>
 #include <miopen/stringutils.hpp>
 
+#ifdef _WIN32
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <fstream>
+#include <memory>
+#include <system_error>
+#include <thread>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DB_LOCK_PREFERENCE)
+
 namespace miopen {
 
 inline void LogFsError(const fs::filesystem_error& ex, const std::string_view from)
@@ -64,7 +80,111 @@ fs::path LockFilePath(const fs::path& filename_)
     }
 }
 
-LockFile::LockFile(const fs::path& path_, PassKey) : path(path_)
+namespace {
+
+LockFile::Preference GetDefaultPreference()
+{
+    const auto& value = env::value(MIOPEN_DB_LOCK_PREFERENCE);
+    if(value.empty() || value == "readers")
+        return LockFile::Preference::Readers;
+    if(value == "writers")
+        return LockFile::Preference::Writers;
+    MIOPEN_LOG_W("Unknown MIOPEN_DB_LOCK_PREFERENCE value: " << value);
+    return LockFile::Preference::Readers;
+}
+
+#ifndef _WIN32
+
+std::string ErrorMessage(int error) { return std::system_category().message(error); }
+
+#ifdef F_OFD_SETLK
+constexpr int set_lock      = F_OFD_SETLK;
+constexpr int set_lock_wait = F_OFD_SETLKW;
+#else
+// Process-associated locks. Only one descriptor of the file is open at a time, so they are
+// not released behind our back.
+constexpr int set_lock      = F_SETLK;
+constexpr int set_lock_wait = F_SETLKW;
+#endif
+
+// Byte 0 of the file guards the data. Byte 1 is the gate: when writers are preferred, both
+// sides pass it before taking byte 0, so a writer waiting on the gate holds off new readers.
+constexpr off_t data_byte = 0;
+constexpr off_t gate_byte = 1;
+
+/// Returns 0, EAGAIN if the lock is busy and wait is false, or the error code.
+int SetLock(int fd, short type, off_t start, bool wait)
+{
+    struct flock request = {};
+    request.l_type       = type;
+    request.l_whence     = SEEK_SET;
+    request.l_start      = start;
+    request.l_len        = 1;
+
+    while(::fcntl(fd, wait ? set_lock_wait : set_lock, &request) != 0)
+    {
+        if(errno == EACCES)
+            return EAGAIN;
+        if(errno != EINTR)
+            return errno;
+    }
+    return 0;
+}
+
+int SetFileLock(int fd, bool shared, bool writers_first, bool wait)
+{
+    const short type = shared ? F_RDLCK : F_WRLCK;
+    if(writers_first)
+    {
+        if(const auto error = SetLock(fd, type, gate_byte, wait))
+            return error;
+    }
+    const auto error = SetLock(fd, type, data_byte, wait);
+    if(writers_first)
+        SetLock(fd, F_UNLCK, gate_byte, false);
+    return error;
+}
+
+/// There is no timed fcntl(), so the blocking call runs in a helper thread which owns the
+/// descriptor. On timeout the helper is abandoned and closes the descriptor, releasing the
+/// lock, as soon as it gets it.
+int SetFileLockUntil(int fd, bool shared, bool writers_first, LockFile::Clock::time_point deadline)
+{
+    struct Pending
+    {
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool done      = false;
+        bool abandoned = false;
+        int error      = 0;
+    };
+
+    const auto pending = std::make_shared<Pending>();
+    std::thread([=]() {
+        const auto error = SetFileLock(fd, shared, writers_first, true);
+        std::lock_guard<std::mutex> guard(pending->mutex);
+        if(pending->abandoned)
+        {
+            ::close(fd);
+            return;
+        }
+        pending->error = error;
+        pending->done  = true;
+        pending->finished.notify_all();
+    }).detach();
+
+    std::unique_lock<std::mutex> guard(pending->mutex);
+    if(pending->finished.wait_until(guard, deadline, [&]() { return pending->done; }))
+        return pending->error;
+    pending->abandoned = true;
+    return ETIMEDOUT;
+}
+
+#endif
+
+} // namespace
+
+LockFile::LockFile(const fs::path& path_, PassKey) : path(path_), preference(GetDefaultPreference())
 {
     try
     {
@@ -74,20 +194,257 @@ LockFile::LockFile(const fs::path& path_, PassKey) : path(path_)
                 MIOPEN_THROW("Error creating file <" + path + "> for locking.");
             fs::permissions(path, FS_ENUM_PERMS_ALL);
         }
+#ifdef _WIN32
         flock = path.string().c_str();
+#endif
     }
     catch(const fs::filesystem_error& ex)
     {
         LogFsError(ex, MIOPEN_GET_FN_NAME);
         throw;
     }
+#ifdef _WIN32
     catch(const boost::interprocess::interprocess_exception& ex)
     {
-        LogFlockError(ex, "lock initialization", MIOPEN_GET_FN_NAME);
+        MIOPEN_LOG_E("File <" << path << "> lock initialization failed: " << ex.what());
         throw;
     }
+#endif
+}
+
+LockFile::~LockFile()
+{
+#ifndef _WIN32
+    if(fd >= 0)
+        ::close(fd);
+#endif
+}
+
+LockFile::Preference LockFile::GetPreference() const
+{
+    std::lock_guard<std::mutex> guard(state_mutex);
+    return preference;
 }
 
+void LockFile::SetPreference(Preference value)
+{
+    std::lock_guard<std::mutex> guard(state_mutex);
+    preference = value;
+    state_changed.notify_all();
+}
+
+bool LockFile::CanEnterShared() const
+{
+    return !writer && !acquiring_shared &&
+           !(preference == Preference::Writers && writers_waiting > 0);
+}
+
+bool LockFile::LockUntil(bool shared, Clock::time_point deadline)
+{
+    const auto timed = deadline != Clock::time_point{};
+    auto guard       = std::unique_lock<std::mutex>(state_mutex);
+
+    const auto wait = [&](auto&& ready) {
+        if(!timed)
+        {
+            state_changed.wait(guard, ready);
+            return true;
+        }
+        return state_changed.wait_until(guard, deadline, ready);
+    };
+
+    if(shared)
+    {
+        if(!wait([&]() { return CanEnterShared(); }))
+        {
+            MIOPEN_LOG_W("File <" << path << "> shared lock timed out.");
+            return false;
+        }
+    }
+    else
+    {
+        ++writers_waiting;
+        const auto entered = wait([&]() { return !writer && readers == 0 && !acquiring_shared; });
+        --writers_waiting;
+        if(!entered)
+        {
+            // Readers held off by this writer may proceed.
+            state_changed.notify_all();
+            MIOPEN_LOG_W("File <" << path << "> lock timed out.");
+            return false;
+        }
+    }
+
+    const auto locked = AcquireFileLock(guard, shared, deadline, false);
+    if(!locked && !timed)
+        MIOPEN_THROW("File <" + path + "> " + (shared ? "shared lock" : "lock") + " failed.");
+    return locked;
+}
+
+bool LockFile::TryLock(bool shared)
+{
+    auto guard = std::unique_lock<std::mutex>(state_mutex);
+    if(shared ? !CanEnterShared() : (writer || readers > 0 || acquiring_shared))
+        return false;
+    return AcquireFileLock(guard, shared, {}, true);
+}
+
+bool LockFile::AcquireFileLock(std::unique_lock<std::mutex>& guard,
+                               bool shared,
+                               Clock::time_point deadline,
+                               bool try_only)
+{
+    // Readers of this process share the file lock taken by the first one.
+    if(shared && readers > 0)
+    {
+        ++readers;
+        return true;
+    }
+
+    if(shared)
+        acquiring_shared = true;
+    else
+        writer = true;
+    const auto writers_first = preference == Preference::Writers;
+
+    guard.unlock();
+    const auto locked = FileLock(shared, deadline, try_only, writers_first);
+    guard.lock();
+
+    if(shared)
+    {
+        acquiring_shared = false;
+        if(locked)
+            readers = 1;
+    }
+    else if(!locked)
+    {
+        writer = false;
+    }
+    state_changed.notify_all();
+    return locked;
+}
+
+void LockFile::Unlock(bool shared)
+{
+    std::lock_guard<std::mutex> guard(state_mutex);
+    if(shared)
+    {
+        if(readers == 0)
+            MIOPEN_THROW("File <" + path + "> is not locked shared.");
+        if(--readers == 0)
+            FileUnlock(true);
+    }
+    else
+    {
+        if(!writer)
+            MIOPEN_THROW("File <" + path + "> is not locked.");
+        FileUnlock(false);
+        writer = false;
+    }
+    state_changed.notify_all();
+}
+
+#ifdef _WIN32
+
+bool LockFile::FileLock(bool shared, Clock::time_point deadline, bool try_only, bool)
+{
+    try
+    {
+        if(try_only)
+            return shared ? flock.try_lock_sharable() : flock.try_lock();
+        if(deadline == Clock::time_point{})
+        {
+            if(shared)
+                flock.lock_sharable();
+            else
+                flock.lock();
+            return true;
+        }
+        const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::max(deadline - Clock::now(), Clock::duration::zero()));
+        const auto abs_time = boost::posix_time::microsec_clock::universal_time() +
+                              boost::posix_time::milliseconds(left.count());
+        if(shared ? flock.timed_lock_sharable(abs_time) : flock.timed_lock(abs_time))
+            return true;
+        MIOPEN_LOG_W("File <" << path << "> " << (shared ? "shared " : "") << "lock timed out.");
+        return false;
+    }
+    catch(const boost::interprocess::interprocess_exception& ex)
+    {
+        // clang-format off
+        MIOPEN_LOG_E("File <" << path << "> " << (shared ? "shared " : "") << "lock failed. "
+                     "Error code: " << ex.get_error_code() << ". "
+                     "Native error: " << ex.get_native_error() << ". "
+                     "Description: '" << ex.what() << "'");
+        // clang-format on
+        return false;
+    }
+}
+
+void LockFile::FileUnlock(bool shared)
+{
+    if(shared)
+        flock.unlock_sharable();
+    else
+        flock.unlock();
+}
+
+#else
+
+bool LockFile::FileLock(bool shared,
+                        Clock::time_point deadline,
+                        bool try_only,
+                        bool writers_first)
+{
+    const auto operation = shared ? "shared lock" : "lock";
+
+    // A new open file description for every acquisition: the lock belongs to it alone.
+    auto new_fd = -1;
+    do
+        new_fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+    while(new_fd < 0 && errno == EINTR);
+    if(new_fd < 0)
+    {
+        MIOPEN_LOG_E("File <" << path << "> " << operation
+                              << " failed to open the file: " << ErrorMessage(errno));
+        return false;
+    }
+
+    auto error = SetFileLock(new_fd, shared, writers_first, false);
+    if(error == EAGAIN && !try_only)
+    {
+        if(deadline == Clock::time_point{})
+            error = SetFileLock(new_fd, shared, writers_first, true);
+        else
+            error = SetFileLockUntil(new_fd, shared, writers_first, deadline);
+    }
+
+    if(error == 0)
+    {
+        fd = new_fd;
+        return true;
+    }
+    // On timeout the helper thread owns the descriptor.
+    if(error != ETIMEDOUT)
+        ::close(new_fd);
+
+    if(error == ETIMEDOUT)
+        MIOPEN_LOG_W("File <" << path << "> " << operation << " timed out.");
+    else if(error != EAGAIN)
+        MIOPEN_LOG_E("File <" << path << "> " << operation << " failed: " << ErrorMessage(error));
+    return false;
+}
+
+void LockFile::FileUnlock(bool)
+{
+    // Closing the last descriptor of the open file description releases its locks.
+    ::close(fd);
+    fd = -1;
+}
+
+#endif
+
 LockFile& LockFile::Get(const fs::path& file)
 {
 #ifdef _WIN32
@@ -28,6 +28,7 @@
 #include <miopen/config.h>
 #include <miopen/handle.hpp>
 #include <miopen/binary_cache.hpp>
+#include <miopen/device_capabilities.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
@@ -65,7 +66,7 @@ Handle::Handle(miopenAcceleratorQueue_t /* stream */) : Handle::Handle() {}
 
 Handle::Handle() : impl(new HandleImpl())
 {
-    this->impl->target_properties.Init(this);
+    // Target properties are initialized on first use.
     MIOPEN_LOG_NQI(*this);
 }
 
@@ -270,11 +271,29 @@ bool Handle::CooperativeLaunchSupported() const { return false; }
 
 const TargetProperties& Handle::GetTargetProperties() const
 {
+    if(!this->impl->target_properties_ready)
+    {
+        const std::lock_guard<std::mutex> lock(this->impl->lazy_init_mutex);
+        if(!this->impl->target_properties_ready)
+        {
+            this->impl->target_properties.Init(this);
+            this->impl->target_properties_ready = true;
+        }
+    }
     return this->impl->target_properties;
 }
 
+const DeviceCapabilities& Handle::GetCapabilities() const
+{
+    if(const auto* caps = this->impl->capabilities.load())
+        return *caps;
+    const auto& caps         = DeviceCapabilities::Get(GetDeviceName(), GetMaxComputeUnits());
+    this->impl->capabilities = &caps;
+    return caps;
+}
+
 std::string Handle::GetDeviceNameImpl() const { return this->impl->device_name; }
-std::string Handle::GetDeviceName() const { return this->impl->target_properties.Name(); }
+std::string Handle::GetDeviceName() const { return this->GetTargetProperties().Name(); }
 
 std::ostream& Handle::Print(std::ostream& os) const
 {
@@ -0,0 +1,298 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/numerics_stats.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_CHECK_NUMERICS_SAMPLE_PERIOD, 1)
+
+namespace miopen {
+
+namespace {
+
+double DecodeHalf(uint16_t x)
+{
+    const auto sign     = (x & 0x8000) != 0 ? -1.0 : 1.0;
+    const auto exponent = (x >> 10) & 0x1f;
+    const auto mantissa = x & 0x3ff;
+    if(exponent == 0x1f)
+        return mantissa == 0 ? sign * std::numeric_limits<double>::infinity()
+                             : std::numeric_limits<double>::quiet_NaN();
+    if(exponent == 0)
+        return sign * std::ldexp(mantissa, -24);
+    return sign * std::ldexp(mantissa | 0x400, exponent - 25);
+}
+
+double DecodeBFloat16(uint16_t x)
+{
+    const auto bits = static_cast<uint32_t>(x) << 16;
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/// Matches miopen_hip_f8_impl::cast_from_f8 with the bias mode the kernels are built with.
+template <int wm, int we>
+double DecodeFp8(uint8_t x)
+{
+    constexpr bool negative_zero_nan = !MIOPEN_FP8_IEEE_EXPONENT_BIAS;
+    constexpr int bias               = (1 << (we - 1)) - 1 + (negative_zero_nan ? 1 : 0);
+
+    const auto sign     = (x & 0x80) != 0 ? -1.0 : 1.0;
+    const auto exponent = (x & 0x7f) >> wm;
+    const auto mantissa = x & ((1 << wm) - 1);
+
+    if(x == 0x80)
+        return negative_zero_nan ? std::numeric_limits<double>::quiet_NaN() : -0.0;
+    if(!negative_zero_nan && exponent == (1 << we) - 1)
+        return mantissa == 0 ? sign * std::numeric_limits<double>::infinity()
+                             : std::numeric_limits<double>::quiet_NaN();
+    if(exponent == 0)
+        return sign * std::ldexp(mantissa, 1 - bias - wm);
+    return sign * std::ldexp(mantissa | (1 << wm), exponent - bias - wm);
+}
+
+/// Visits the elements in the memory order of the innermost dimension.
+template <class T, class Decode>
+void Accumulate(NumericsStats& stats,
+                const std::vector<std::size_t>& lengths,
+                const std::vector<std::size_t>& strides,
+                const void* data,
+                Decode decode)
+{
+    if(lengths.size() != strides.size())
+        MIOPEN_THROW(miopenStatusBadParm, "Lengths and strides mismatch");
+    if(lengths.empty() || std::find(lengths.begin(), lengths.end(), 0) != lengths.end())
+        return;
+
+    const auto* values      = static_cast<const T*>(data);
+    const auto dims         = lengths.size();
+    const auto inner_length = lengths.back();
+    const auto inner_stride = strides.back();
+    auto index              = std::vector<std::size_t>(dims, 0);
+
+    for(;;)
+    {
+        auto offset = std::size_t{0};
+        for(auto d = std::size_t{0}; d + 1 < dims; ++d)
+            offset += index[d] * strides[d];
+
+        for(auto i = std::size_t{0}; i < inner_length; ++i)
+        {
+            T value;
+            std::memcpy(&value, values + offset + i * inner_stride, sizeof(T));
+            stats.Add(decode(value));
+        }
+
+        auto d = dims - 1;
+        for(;;)
+        {
+            if(d == 0)
+                return;
+            --d;
+            if(++index[d] < lengths[d])
+                break;
+            index[d] = 0;
+        }
+    }
+}
+
+} // namespace
+
+void NumericsStats::Add(double value)
+{
+    if(std::isnan(value))
+    {
+        ++nans;
+        return;
+    }
+    if(std::isinf(value))
+    {
+        ++infs;
+        return;
+    }
+
+    const auto abs_value = std::abs(value);
+    ++count;
+    min = std::min(min, value);
+    max = std::max(max, value);
+    sum += value;
+    abs_sum += abs_value;
+    abs_max = std::max(abs_max, abs_value);
+    if(value == 0.0)
+        ++zeros;
+    ++histogram[GetHistogramBucket(abs_value)];
+}
+
+void NumericsStats::Merge(const NumericsStats& other)
+{
+    tensors += other.tensors;
+    count += other.count;
+    nans += other.nans;
+    infs += other.infs;
+    zeros += other.zeros;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    sum += other.sum;
+    abs_sum += other.abs_sum;
+    abs_max = std::max(abs_max, other.abs_max);
+    for(auto i = std::size_t{0}; i < histogram_size; ++i)
+        histogram[i] += other.histogram[i];
+}
+
+std::size_t NumericsStats::GetHistogramBucket(double abs_value)
+{
+    if(abs_value == 0.0)
+        return 0;
+    const auto exponent = std::ilogb(abs_value);
+    return std::clamp(exponent, histogram_min_exponent, histogram_max_exponent) -
+           histogram_min_exponent + 1;
+}
+
+std::ostream& operator<<(std::ostream& stream, const NumericsStats& stats)
+{
+    stream << "tensors=" << stats.tensors << " values=" << stats.count << " nans=" << stats.nans
+           << " infs=" << stats.infs << " zeros=" << stats.zeros;
+    if(stats.count != 0)
+    {
+        stream << " min=" << stats.min << " max=" << stats.max << " mean=" << stats.GetMean()
+               << " absmean=" << stats.GetAbsMean() << " absmax=" << stats.abs_max;
+    }
+
+    // Non-empty buckets as <log2 of the lower bound>:<count>.
+    stream << " log2hist={";
+    auto first = true;
+    for(auto i = std::size_t{1}; i < NumericsStats::histogram_size; ++i)
+    {
+        if(stats.histogram[i] == 0)
+            continue;
+        stream << (first ? "" : ", ")
+               << static_cast<int>(i) - 1 + NumericsStats::histogram_min_exponent << ':'
+               << stats.histogram[i];
+        first = false;
+    }
+    return stream << '}';
+}
+
+NumericsStats ComputeNumericsStats(miopenDataType_t type,
+                                   const std::vector<std::size_t>& lengths,
+                                   const std::vector<std::size_t>& strides,
+                                   const void* data)
+{
+    auto stats    = NumericsStats{};
+    stats.tensors = 1;
+
+    const auto as_double = [](auto x) { return static_cast<double>(x); };
+
+    switch(type)
+    {
+    case miopenFloat: Accumulate<float>(stats, lengths, strides, data, as_double); break;
+    case miopenDouble: Accumulate<double>(stats, lengths, strides, data, as_double); break;
+    case miopenHalf: Accumulate<uint16_t>(stats, lengths, strides, data, DecodeHalf); break;
+    case miopenBFloat16:
+        Accumulate<uint16_t>(stats, lengths, strides, data, DecodeBFloat16);
+        break;
+    case miopenFloat8: Accumulate<uint8_t>(stats, lengths, strides, data, DecodeFp8<3, 4>); break;
+    case miopenBFloat8: Accumulate<uint8_t>(stats, lengths, strides, data, DecodeFp8<2, 5>); break;
+    case miopenInt8: Accumulate<int8_t>(stats, lengths, strides, data, as_double); break;
+    case miopenInt32: Accumulate<int32_t>(stats, lengths, strides, data, as_double); break;
+    case miopenInt64: Accumulate<int64_t>(stats, lengths, strides, data, as_double); break;
+    default: MIOPEN_THROW(miopenStatusBadParm, "Unsupported data type");
+    }
+
+    return stats;
+}
+
+NumericsMonitor::NumericsMonitor(std::size_t sample_period_) : sample_period(sample_period_)
+{
+    if(sample_period == 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Numerics sample period must be positive");
+}
+
+bool NumericsMonitor::Sample(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries[key].checks++ % sample_period == 0;
+}
+
+void NumericsMonitor::Record(const std::string& key, const NumericsStats& stats)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries[key].stats.Merge(stats);
+}
+
+std::optional<NumericsStats> NumericsMonitor::Get(const std::string& key) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = entries.find(key);
+    if(it == entries.end() || it->second.stats.tensors == 0)
+        return std::nullopt;
+    return it->second.stats;
+}
+
+std::map<std::string, NumericsStats> NumericsMonitor::GetAll() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto result = std::map<std::string, NumericsStats>{};
+    for(const auto& [key, entry] : entries)
+    {
+        if(entry.stats.tensors != 0)
+            result.emplace(key, entry.stats);
+    }
+    return result;
+}
+
+std::string NumericsMonitor::GetReport() const
+{
+    std::ostringstream ss;
+    for(const auto& [key, stats] : GetAll())
+        ss << key << ": " << stats << '\n';
+    return ss.str();
+}
+
+void NumericsMonitor::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+NumericsMonitor& NumericsMonitor::GetInstance()
+{
+    static auto instance =
+        NumericsMonitor{std::max<uint64_t>(env::value(MIOPEN_CHECK_NUMERICS_SAMPLE_PERIOD), 1)};
+    return instance;
+}
+
+} // namespace miopen
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/numerics_stats.hpp>
+
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <cstring>
+
+extern "C" miopenStatus_t miopenGetNumericsStatsReport(char* report, size_t* size)
+{
+    MIOPEN_LOG_FUNCTION(report, size);
+    return miopen::try_([&] {
+        auto& report_size = miopen::deref(size);
+        const auto text   = miopen::NumericsMonitor::GetInstance().GetReport();
+
+        if(report != nullptr)
+        {
+            if(report_size < text.size() + 1)
+                MIOPEN_THROW(miopenStatusBadParm, "The report buffer is too small");
+            std::memcpy(report, text.c_str(), text.size() + 1);
+        }
+        report_size = text.size() + 1;
+    });
+}
+
+extern "C" miopenStatus_t miopenResetNumericsStats()
+{
+    return miopen::try_([&] { miopen::NumericsMonitor::GetInstance().Reset(); });
+}
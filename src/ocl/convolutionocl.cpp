@@ -28,6 +28,7 @@
 
 #include <miopen/algorithm.hpp>
 #include <miopen/conv_algo_name.hpp>
+#include <miopen/conv/background_tuning.hpp>
 #include <miopen/conv/solver_finders.hpp>
 #include <miopen/check_numerics.hpp>
 #include <miopen/config.h>
@@ -41,6 +42,7 @@
 #include <miopen/invoker.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/solution.hpp>
+#include <miopen/tensor_dump.hpp>
 #include <miopen/tensor_ops.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/util.hpp>
@@ -53,6 +55,7 @@
 #include <miopen/conv/data_invoke_params.hpp>
 #include <miopen/conv/wrw_invoke_params.hpp>
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
+#include <miopen/conv/heuristics/cost_model.hpp>
 
 #include <cassert>
 #include <functional>
@@ -61,6 +64,7 @@
 #include <boost/range/adaptors.hpp>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_IMMED_FALLBACK)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_IMMED_FALLBACK_COST_MODEL)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DUMP_TENSOR_PATH)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_FORCE_IMMED_MODE_FALLBACK)
@@ -354,9 +358,13 @@ static void ConvForwardCheckNumerics(const Handle& handle,
     const auto& file_name = env::value(MIOPEN_DUMP_TENSOR_PATH);
     if(flag && !file_name.empty())
     {
-        DumpTensorToFileFromDevice(handle, tensors.xDesc, tensors.x, file_name + "_x.bin");
-        DumpTensorToFileFromDevice(handle, tensors.wDesc, tensors.w, file_name + "_w.bin");
-        DumpTensorToFileFromDevice(handle, tensors.yDesc, tensors.y, file_name + "_y.bin");
+        auto& dumper = TensorDumper::GetInstance();
+        if(const auto call = dumper.Sample())
+        {
+            dumper.Dump(handle, tensors.xDesc, tensors.x, file_name, *call, "x");
+            dumper.Dump(handle, tensors.wDesc, tensors.w, file_name, *call, "w");
+            dumper.Dump(handle, tensors.yDesc, tensors.y, file_name, *call, "y");
+        }
     }
 }
 
@@ -644,6 +652,10 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
                 return wti;
             return 10.0f / wti; // Assume WTI == 1.0 (100%) is 10 ms.
         };
+        // The cost model turns WTI into the expected time, so the reported times are
+        // comparable with find-db ones. Solvers that are unable to compute WTI are estimated
+        // only by calibrated coefficients.
+        const auto use_cost_model = !env::disabled(MIOPEN_DEBUG_CONV_IMMED_FALLBACK_COST_MODEL);
 
         for(const auto& solver_id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
         {
@@ -662,6 +674,15 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
 
             const auto wti = s.GetWti(ctx, problem);
             MIOPEN_LOG_I2(solver_id.ToString() << " Estimated WTI = " << wti);
+            if(use_cost_model)
+            {
+                const auto time = conv::cost_model::EstimateTime(ctx, problem, solver_id, wti);
+                MIOPEN_LOG_I2(solver_id.ToString() << " Estimated time = " << time);
+                if(time < 0.0f) // Skip unknown WTIs unless calibrated.
+                    continue;
+                interim.emplace_back(miopenConvSolution_t{time, ws, solver_id.Value(), algo});
+                continue;
+            }
             if(wti < 0.0f) // Skip unknown WTIs.
                 continue;
             interim.emplace_back(miopenConvSolution_t{wti2time(wti), ws, solver_id.Value(), algo});
@@ -783,6 +804,9 @@ ConvolutionDescriptor::GetSolutions(const ExecutionContext& ctx,
     if(!solutions.empty())
         return solutions;
 
+    // The heuristic solution is used this time, the next calls may get a tuned one.
+    conv::RequestBackgroundTuning(ctx, problem);
+
     return GetSolutionsFallback(ctx, problem, maxSolutionCount, invokeParams);
 }
 
@@ -932,9 +956,13 @@ static void ConvBwdCheckNumerics(const Handle& handle,
     const auto& file_name = env::value(MIOPEN_DUMP_TENSOR_PATH);
     if(flag && !file_name.empty())
     {
-        DumpTensorToFileFromDevice(handle, tensors.dyDesc, tensors.dy, file_name + "_dy.bin");
-        DumpTensorToFileFromDevice(handle, tensors.wDesc, tensors.w, file_name + "_w.bin");
-        DumpTensorToFileFromDevice(handle, tensors.dxDesc, tensors.dx, file_name + "_dx.bin");
+        auto& dumper = TensorDumper::GetInstance();
+        if(const auto call = dumper.Sample())
+        {
+            dumper.Dump(handle, tensors.dyDesc, tensors.dy, file_name, *call, "dy");
+            dumper.Dump(handle, tensors.wDesc, tensors.w, file_name, *call, "w");
+            dumper.Dump(handle, tensors.dxDesc, tensors.dx, file_name, *call, "dx");
+        }
     }
 }
 
@@ -1139,9 +1167,13 @@ static void ConvWrwCheckNumerics(const Handle& handle,
     const auto& file_name = env::value(MIOPEN_DUMP_TENSOR_PATH);
     if(flag && !file_name.empty())
     {
-        DumpTensorToFileFromDevice(handle, tensors.dyDesc, tensors.dy, file_name + "_dy.bin");
-        DumpTensorToFileFromDevice(handle, tensors.xDesc, tensors.x, file_name + "_x.bin");
-        DumpTensorToFileFromDevice(handle, tensors.dwDesc, tensors.dw, file_name + "_dw.bin");
+        auto& dumper = TensorDumper::GetInstance();
+        if(const auto call = dumper.Sample())
+        {
+            dumper.Dump(handle, tensors.dyDesc, tensors.dy, file_name, *call, "dy");
+            dumper.Dump(handle, tensors.xDesc, tensors.x, file_name, *call, "x");
+            dumper.Dump(handle, tensors.dwDesc, tensors.dw, file_name, *call, "dw");
+        }
     }
 }
 
@@ -27,6 +27,7 @@
 #include <miopen/handle.hpp>
 
 #include <miopen/binary_cache.hpp>
+#include <miopen/device_capabilities.hpp>
 #include <miopen/config.h>
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
@@ -42,6 +43,7 @@
 #include <miopen/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <atomic>
 #include <string>
 
 #ifndef _WIN32
@@ -83,6 +85,7 @@ struct HandleImpl
     bool enable_profiling  = false;
     float profiling_result = 0.0;
     TargetProperties target_properties;
+    std::atomic<const DeviceCapabilities*> capabilities{nullptr};
 
     std::string get_device_name() const
     {
@@ -476,6 +479,15 @@ const TargetProperties& Handle::GetTargetProperties() const
     return this->impl->target_properties;
 }
 
+const DeviceCapabilities& Handle::GetCapabilities() const
+{
+    if(const auto* caps = this->impl->capabilities.load())
+        return *caps;
+    const auto& caps         = DeviceCapabilities::Get(GetDeviceName(), GetMaxComputeUnits());
+    this->impl->capabilities = &caps;
+    return caps;
+}
+
 std::ostream& Handle::Print(std::ostream& os) const
 {
     os << "stream: " << this->impl->queue.get() << ", device_id: " << this->impl->device;
@@ -41,6 +41,7 @@
 #include <miopen/datatype.hpp>
 #include <miopen/execution_context.hpp>
 #include <miopen/fusion_plan.hpp>
+#include <miopen/generic_search.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/mlo_internal.hpp>
 #include <miopen/perf_field.hpp>
@@ -176,6 +177,10 @@ Problem::FindSolutions(Handle& handle, const FindOptions& options, std::size_t m
     for(const auto& pair : tensor_descriptors)
         allocate(pair.first, pair.second);
 
+    auto time_limit = std::optional<solver::TuningTimeScopedLimiter>{};
+    if(options.exhaustive_search && options.tuning_time_limit)
+        time_limit.emplace(*options.tuning_time_limit);
+
     auto ret = std::visit(
         boost::hof::match(
             [&](const ConvolutionDescriptor& op_desc) {
@@ -25,9 +25,27 @@
  *******************************************************************************/
 
 #include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
 #include <miopen/process.hpp>
+
 #include <string_view>
 
+#ifndef _WIN32
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 namespace miopen {
 
 #ifdef _WIN32
@@ -43,13 +61,14 @@ public:
     void Create(std::string_view args,
                 std::string_view cwd,
                 std::ostream* out,
+                std::ostream* err,
                 const ProcessEnvironmentMap& additionalEnvironmentVariables)
     {
         STARTUPINFOA info;
         ZeroMemory(&info, sizeof(STARTUPINFO));
         info.cb = sizeof(STARTUPINFO);
 
-        if(out != nullptr)
+        if(out != nullptr || err != nullptr)
         {
             MIOPEN_THROW("Capturing output not defined for Windows.");
         }
@@ -106,58 +125,462 @@ private:
 
 #else
 
+namespace {
+
+struct Redirection
+{
+    int fd;
+    /// Either a file to open or a descriptor to duplicate.
+    std::string file;
+    int source = -1;
+    bool append = false;
+};
+
+struct CommandLine
+{
+    std::vector<std::string> words;
+    std::vector<Redirection> redirections;
+};
+
+bool IsBlank(char c) { return c == ' ' || c == '\t' || c == '\n'; }
+
+/// Splits the args as a POSIX shell does, for the subset of its syntax the library uses.
+/// Returns nothing if the args need a shell: pipes, lists, variables, substitutions, globs...
+std::optional<CommandLine> ParseCommandLine(std::string_view args)
+{
+    constexpr std::string_view shell_chars = "|&;<()$`*?[";
+
+    auto result  = CommandLine{};
+    auto word    = std::string{};
+    auto in_word = false;
+    auto quoted  = false;
+    std::optional<Redirection> pending;
+
+    const auto finish_word = [&]() {
+        if(!in_word)
+            return;
+        if(pending)
+        {
+            pending->file = std::move(word);
+            result.redirections.push_back(std::move(*pending));
+            pending.reset();
+        }
+        else
+        {
+            result.words.push_back(std::move(word));
+        }
+        word.clear();
+        in_word = false;
+        quoted  = false;
+    };
+
+    for(std::size_t i = 0; i < args.size(); ++i)
+    {
+        const auto c = args[i];
+        if(IsBlank(c))
+        {
+            finish_word();
+            continue;
+        }
+        if(!in_word && (c == '#' || c == '~'))
+            return std::nullopt;
+
+        if(c == '\'')
+        {
+            const auto end = args.find('\'', i + 1);
+            if(end == std::string_view::npos)
+                return std::nullopt;
+            word.append(args.substr(i + 1, end - i - 1));
+            in_word = quoted = true;
+            i                = end;
+        }
+        else if(c == '"')
+        {
+            for(++i; i < args.size() && args[i] != '"'; ++i)
+            {
+                if(args[i] == '$' || args[i] == '`')
+                    return std::nullopt;
+                if(args[i] == '\\' && i + 1 < args.size() &&
+                   std::string_view{"\"\\\n"}.find(args[i + 1]) != std::string_view::npos)
+                    ++i;
+                word += args[i];
+            }
+            if(i == args.size())
+                return std::nullopt;
+            in_word = quoted = true;
+        }
+        else if(c == '\\')
+        {
+            if(++i == args.size())
+                return std::nullopt;
+            word += args[i];
+            in_word = quoted = true;
+        }
+        else if(c == '>')
+        {
+            // Only "N>" with N of 1 or 2, or a bare ">" start a redirection.
+            if(pending || quoted || !(word.empty() || word == "1" || word == "2"))
+                return std::nullopt;
+            auto redirection = Redirection{word == "2" ? 2 : 1, {}};
+            word.clear();
+            in_word = false;
+            if(i + 1 < args.size() && args[i + 1] == '>')
+            {
+                redirection.append = true;
+                ++i;
+            }
+            if(i + 1 < args.size() && args[i + 1] == '&')
+            {
+                if(redirection.append || i + 2 >= args.size() ||
+                   (args[i + 2] != '1' && args[i + 2] != '2') ||
+                   (i + 3 < args.size() && !IsBlank(args[i + 3])))
+                    return std::nullopt;
+                redirection.source = args[i + 2] - '0';
+                result.redirections.push_back(std::move(redirection));
+                i += 2;
+            }
+            else
+            {
+                pending = std::move(redirection);
+            }
+        }
+        else if(shell_chars.find(c) != std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+        else
+        {
+            word += c;
+            in_word = true;
+        }
+    }
+    finish_word();
+
+    if(pending)
+        return std::nullopt;
+    return result;
+}
+
+std::string ShellQuote(std::string_view text)
+{
+    auto result = std::string{"'"};
+    for(const auto c : text)
+        result += c == '\'' ? std::string{"'\\''"} : std::string{c};
+    return result + "'";
+}
+
+std::vector<std::string> MakeEnvironment(const ProcessEnvironmentMap& additional)
+{
+    auto result = std::vector<std::string>{};
+    for(auto var = environ; *var != nullptr; ++var)
+    {
+        const auto entry = std::string_view{*var};
+        const auto name  = entry.substr(0, entry.find('='));
+        if(additional.find(std::string{name}) == additional.end())
+            result.emplace_back(entry);
+    }
+    for(const auto& [name, value] : additional)
+        result.push_back(name + "=" + value);
+    return result;
+}
+
+std::vector<char*> MakeArgv(std::vector<std::string>& strings)
+{
+    auto result = std::vector<char*>{};
+    for(auto& string : strings)
+        result.push_back(string.data());
+    result.push_back(nullptr);
+    return result;
+}
+
+void CloseFd(int& fd)
+{
+    if(fd >= 0)
+        close(fd);
+    fd = -1;
+}
+
+class SpawnFileActions
+{
+public:
+    SpawnFileActions()
+    {
+        if(posix_spawn_file_actions_init(&actions) != 0)
+            MIOPEN_THROW("posix_spawn_file_actions_init failed");
+    }
+    ~SpawnFileActions() { posix_spawn_file_actions_destroy(&actions); }
+    SpawnFileActions(const SpawnFileActions&) = delete;
+    SpawnFileActions& operator=(const SpawnFileActions&) = delete;
+
+    void Check(int status) const
+    {
+        if(status != 0)
+            MIOPEN_THROW("posix_spawn file action failed: " + std::string{std::strerror(status)});
+    }
+
+    posix_spawn_file_actions_t* Get() { return &actions; }
+
+private:
+    posix_spawn_file_actions_t actions;
+};
+
+// The child's end of a pipe replaces the stream, the parent's end stays in the parent.
+std::array<int, 2> MakePipe()
+{
+    auto fds = std::array<int, 2>{-1, -1};
+    if(pipe2(fds.data(), O_CLOEXEC) != 0)
+        MIOPEN_THROW("pipe2 failed: " + std::string{std::strerror(errno)});
+    return fds;
+}
+
+/// Writes the data without raising SIGPIPE in the calling process if the reader is gone.
+bool WriteAll(int fd, std::string_view data)
+{
+    sigset_t pipe_signal;
+    sigset_t old_mask;
+    sigemptyset(&pipe_signal);
+    sigaddset(&pipe_signal, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipe_signal, &old_mask);
+
+    auto broken = false;
+    while(!data.empty())
+    {
+        const auto written = write(fd, data.data(), data.size());
+        if(written < 0 && errno == EINTR)
+            continue;
+        if(written < 0)
+        {
+            broken = errno == EPIPE;
+            break;
+        }
+        data.remove_prefix(written);
+    }
+
+    const auto saved_errno = errno;
+    if(broken && sigismember(&old_mask, SIGPIPE) == 0)
+    {
+        // Consume the signal raised by the write before unblocking it.
+        const timespec no_wait{};
+        while(sigtimedwait(&pipe_signal, nullptr, &no_wait) < 0 && errno == EINTR) {}
+    }
+    pthread_sigmask(SIG_SETMASK, &old_mask, nullptr);
+    errno = saved_errno;
+    return data.empty();
+}
+
+} // namespace
+
 struct ProcessImpl
 {
     ProcessImpl(std::string_view cmd) : path{cmd} {}
 
+    ~ProcessImpl()
+    {
+        CloseFd(input);
+        CloseFd(output);
+        CloseFd(error);
+        if(pid > 0)
+        {
+            auto status = 0;
+            while(waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+        }
+    }
+
     void Create(std::string_view args,
                 std::string_view cwd,
                 std::ostream* out,
-                const ProcessEnvironmentMap& additionalEnvironmentVariables)
+                std::ostream* err,
+                const ProcessEnvironmentMap& additionalEnvironmentVariables,
+                bool piped_input = false)
     {
         outStream = out;
-        std::string cmd{path.string()};
-        if(!additionalEnvironmentVariables.empty())
+        errStream = err;
+
+        auto actions        = SpawnFileActions{};
+        auto child_fds      = std::vector<int>{};
+        const auto add_pipe = [&](int fd, int& parent, bool read) {
+            const auto fds  = MakePipe();
+            parent          = fds[read ? 0 : 1];
+            const auto side = fds[read ? 1 : 0];
+            child_fds.push_back(side);
+            actions.Check(posix_spawn_file_actions_adddup2(actions.Get(), side, fd));
+        };
+
+        auto words    = std::vector<std::string>{};
+        const auto cl = ParseCommandLine(args);
+        auto chdir    = !cwd.empty();
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+        if(chdir)
         {
-            std::stringstream environmentVariables;
-            for(const auto& envVariable : additionalEnvironmentVariables)
+            const auto dir = std::string{cwd};
+            actions.Check(posix_spawn_file_actions_addchdir_np(actions.Get(), dir.c_str()));
+            chdir = false;
+        }
+#endif
+
+        const auto direct = cl && !chdir;
+        if(direct)
+        {
+            words.push_back(path.string());
+            words.insert(words.end(), cl->words.begin(), cl->words.end());
+        }
+        else
+        {
+            auto script = std::string{};
+            if(chdir)
+                script += "cd " + ShellQuote(cwd) + " && ";
+            script += "exec " + ShellQuote(path.string()) + " " + std::string{args};
+            words = {"/bin/sh", "-c", script};
+        }
+
+        if(piped_input)
+            add_pipe(STDIN_FILENO, input, false);
+        else
+            actions.Check(posix_spawn_file_actions_addopen(
+                actions.Get(), STDIN_FILENO, "/dev/null", O_RDONLY, 0));
+        if(out != nullptr || piped_input)
+            add_pipe(STDOUT_FILENO, output, true);
+        if(err != nullptr)
+            add_pipe(STDERR_FILENO, error, true);
+
+        // Applied after the pipes, as the shell does.
+        if(direct)
+        {
+            for(const auto& redirection : cl->redirections)
             {
-                environmentVariables << envVariable.first << "=" << envVariable.second << " ";
+                if(redirection.source >= 0)
+                {
+                    actions.Check(posix_spawn_file_actions_adddup2(
+                        actions.Get(), redirection.source, redirection.fd));
+                    continue;
+                }
+                const auto flags =
+                    O_WRONLY | O_CREAT | (redirection.append ? O_APPEND : O_TRUNC);
+                actions.Check(posix_spawn_file_actions_addopen(
+                    actions.Get(), redirection.fd, redirection.file.c_str(), flags, 0666));
             }
-            cmd.insert(0, environmentVariables.str());
         }
-        if(!args.empty())
-            cmd += " " + std::string{args};
-        if(!cwd.empty())
-            cmd.insert(0, "cd " + std::string{cwd} + "; ");
 
-        const auto fileMode = outStream != nullptr ? "r" : "w";
-        pipe                = popen(cmd.c_str(), fileMode);
-        if(pipe == nullptr)
-            MIOPEN_THROW("Error: popen()");
+        auto environment = MakeEnvironment(additionalEnvironmentVariables);
+        auto argv        = MakeArgv(words);
+        auto envp        = MakeArgv(environment);
+
+        const auto status =
+            posix_spawnp(&pid, argv.front(), actions.Get(), nullptr, argv.data(), envp.data());
+
+        for(auto fd : child_fds)
+            CloseFd(fd);
+
+        if(status != 0)
+        {
+            // The shell reports these as exit codes, keep doing so.
+            pid         = -1;
+            spawn_error = status == ENOENT ? 127 : 126;
+            MIOPEN_LOG_W("Cannot run " << path << ": " << std::strerror(status));
+            CloseFd(input);
+            CloseFd(output);
+            CloseFd(error);
+        }
     }
 
     int Wait()
     {
-        if(outStream != nullptr)
+        CloseFd(input);
+        Drain();
+        if(pid <= 0)
+            return spawn_error;
+
+        auto status = 0;
+        while(waitpid(pid, &status, 0) < 0)
         {
-            std::array<char, 1024> buffer{};
+            if(errno != EINTR)
+                MIOPEN_THROW("waitpid failed: " + std::string{std::strerror(errno)});
+        }
+        pid = -1;
 
-            while(feof(pipe) == 0)
+        if(WIFSIGNALED(status))
+            return 128 + WTERMSIG(status);
+        return WEXITSTATUS(status);
+    }
+
+    std::string Call(std::string_view request, std::string_view end_marker)
+    {
+        if(input < 0)
+            MIOPEN_THROW("The worker process is not running");
+
+        if(!WriteAll(input, request))
+            MIOPEN_THROW("Writing to the worker failed: " + std::string{std::strerror(errno)});
+
+        auto result = std::string{};
+        while(true)
+        {
+            for(std::size_t line = 0, next; (next = pending.find('\n', line)) != std::string::npos;
+                line = next + 1)
             {
-                if(fgets(buffer.data(), buffer.size(), pipe) != nullptr)
-                    *outStream << buffer.data();
+                if(std::string_view{pending}.substr(line, next - line) == end_marker)
+                {
+                    result.append(pending, 0, line);
+                    pending.erase(0, next + 1);
+                    return result;
+                }
             }
-        }
 
-        auto status = pclose(pipe);
-        return WEXITSTATUS(status);
+            std::array<char, 4096> buffer{};
+            const auto size = read(output, buffer.data(), buffer.size());
+            if(size < 0 && errno == EINTR)
+                continue;
+            if(size <= 0)
+                MIOPEN_THROW("The worker process exited before answering the request");
+            pending.append(buffer.data(), size);
+        }
     }
 
 private:
-    std::ostream* outStream;
+    /// Copies the output pipes to the streams until both are closed.
+    void Drain()
+    {
+        std::array<char, 4096> buffer{};
+        while(output >= 0 || error >= 0)
+        {
+            pollfd fds[2] = {{output, POLLIN, 0}, {error, POLLIN, 0}};
+            if(poll(fds, 2, -1) < 0)
+            {
+                if(errno == EINTR)
+                    continue;
+                MIOPEN_THROW("poll failed: " + std::string{std::strerror(errno)});
+            }
+
+            for(auto i = 0; i < 2; ++i)
+            {
+                if(fds[i].fd < 0 || fds[i].revents == 0)
+                    continue;
+                auto& fd        = i == 0 ? output : error;
+                auto* stream    = i == 0 ? outStream : errStream;
+                const auto size = read(fd, buffer.data(), buffer.size());
+                if(size < 0 && errno == EINTR)
+                    continue;
+                if(size <= 0)
+                {
+                    CloseFd(fd);
+                    continue;
+                }
+                if(stream != nullptr)
+                    stream->write(buffer.data(), size);
+            }
+        }
+    }
+
     fs::path path;
-    FILE* pipe = nullptr;
+    std::ostream* outStream = nullptr;
+    std::ostream* errStream = nullptr;
+    pid_t pid               = -1;
+    int spawn_error         = 0;
+    int input               = -1;
+    int output              = -1;
+    int error               = -1;
+    /// Worker output read past the last answer.
+    std::string pending;
 };
 
 #endif
@@ -169,9 +592,10 @@ Process::~Process() noexcept = default;
 int Process::operator()(std::string_view args,
                         const fs::path& cwd,
                         std::ostream* out,
-                        const ProcessEnvironmentMap& additionalEnvironmentVariables)
+                        const ProcessEnvironmentMap& additionalEnvironmentVariables,
+                        std::ostream* err)
 {
-    impl->Create(args, cwd.string(), out, additionalEnvironmentVariables);
+    impl->Create(args, cwd.string(), out, err, additionalEnvironmentVariables);
     return impl->Wait();
 }
 
@@ -179,10 +603,11 @@ ProcessAsync::ProcessAsync(const fs::path& cmd,
                            std::string_view args,
                            const fs::path& cwd,
                            std::ostream* out,
-                           const ProcessEnvironmentMap& additionalEnvironmentVariables)
+                           const ProcessEnvironmentMap& additionalEnvironmentVariables,
+                           std::ostream* err)
     : impl{std::make_unique<ProcessImpl>(cmd.string())}
 {
-    impl->Create(args, cwd.string(), out, additionalEnvironmentVariables);
+    impl->Create(args, cwd.string(), out, err, additionalEnvironmentVariables);
 }
 
 ProcessAsync::~ProcessAsync() noexcept = default;
@@ -197,4 +622,74 @@ ProcessAsync& ProcessAsync::operator=(ProcessAsync&& other) noexcept
 
 ProcessAsync::ProcessAsync(ProcessAsync&& other) noexcept : impl{std::move(other.impl)} {}
 
+ProcessWorker::ProcessWorker(const fs::path& cmd,
+                             std::string_view args,
+                             const fs::path& cwd,
+                             const ProcessEnvironmentMap& additionalEnvironmentVariables)
+    : impl{std::make_unique<ProcessImpl>(cmd.string())}
+{
+#ifdef _WIN32
+    std::ignore = args;
+    std::ignore = cwd;
+    std::ignore = additionalEnvironmentVariables;
+    MIOPEN_THROW("Worker processes are not supported on Windows.");
+#else
+    impl->Create(args, cwd.string(), nullptr, nullptr, additionalEnvironmentVariables, true);
+#endif
+}
+
+ProcessWorker::~ProcessWorker() noexcept
+{
+    if(impl == nullptr)
+        return;
+    try
+    {
+        impl->Wait();
+    }
+    catch(...)
+    {
+    }
+}
+
+ProcessWorker::ProcessWorker(ProcessWorker&& other) noexcept : impl{std::move(other.impl)} {}
+
+ProcessWorker& ProcessWorker::operator=(ProcessWorker&& other) noexcept
+{
+    impl = std::move(other.impl);
+    return *this;
+}
+
+std::string ProcessWorker::Call(std::string_view request, std::string_view end_marker)
+{
+#ifdef _WIN32
+    std::ignore = request;
+    std::ignore = end_marker;
+    MIOPEN_THROW("Worker processes are not supported on Windows.");
+#else
+    if(impl == nullptr)
+        MIOPEN_THROW("The worker process is not running");
+    return impl->Call(request, end_marker);
+#endif
+}
+
+int ProcessWorker::Close()
+{
+    if(impl == nullptr)
+        MIOPEN_THROW("The worker process is not running");
+    const auto status = impl->Wait();
+    impl.reset();
+    return status;
+}
+
+bool IsProcessAlive(long pid)
+{
+#ifdef _WIN32
+    std::ignore = pid;
+    return true;
+#else
+    // EPERM means the process exists but belongs to another user.
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+#endif
+}
+
 } // namespace miopen
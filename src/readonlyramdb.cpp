@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include <miopen/readonlyramdb.hpp>
+#include <miopen/env.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/filesystem.hpp>
@@ -36,8 +37,11 @@
 #include <fstream>
 #include <mutex>
 #include <sstream>
+#include <string_view>
 #include <map>
 
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_SYSDB_SHARDS)
+
 namespace miopen {
 
 namespace debug {
@@ -83,7 +87,7 @@ static auto Measure(const std::string& funcName, TFunc&& func)
                                    << " ms");
 }
 
-void ReadonlyRamDb::ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable)
+void ReadonlyRamDb::ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable) const
 {
     if(!input_stream)
     {
@@ -119,6 +123,37 @@ void ReadonlyRamDb::ParseAndLoadDb(std::istream& input_stream, bool warn_if_unre
     }
 }
 
+bool ReadonlyRamDb::TryUseShards()
+{
+    if(env::enabled(MIOPEN_DEBUG_DISABLE_SYSDB_SHARDS))
+        return false;
+
+    auto manifest = std::ifstream{GetDbShardManifestPath(db_path.string())};
+    if(!manifest)
+        return false;
+
+    auto db_size = std::uint64_t{0};
+    auto shards  = std::map<std::string, DbShard>{};
+    if(!ReadDbShardManifest(manifest, db_size, shards))
+    {
+        MIOPEN_LOG_W("Ignoring ill-formed shard manifest of " << db_path);
+        return false;
+    }
+
+    auto ec         = std::error_code{};
+    const auto size = fs::file_size(db_path, ec);
+    if(ec || size != db_size)
+    {
+        MIOPEN_LOG_W("Ignoring stale shard manifest of " << db_path);
+        return false;
+    }
+
+    MIOPEN_LOG_I2("Using " << shards.size() << " shards of " << db_path);
+    pending_shards = std::move(shards);
+    sharded        = true;
+    return true;
+}
+
 void ReadonlyRamDb::Prefetch(bool warn_if_unreadable)
 {
     Measure("Prefetch", [this, warn_if_unreadable]() {
@@ -143,11 +178,106 @@ void ReadonlyRamDb::Prefetch(bool warn_if_unreadable)
             ParseAndLoadDb(input_stream, warn_if_unreadable);
 #endif
         }
-        else
+        else if(!TryUseShards())
         {
             auto input_stream = std::ifstream{db_path};
             ParseAndLoadDb(input_stream, warn_if_unreadable);
         }
     });
 }
+
+const ReadonlyRamDb::CacheItem* ReadonlyRamDb::FindItem(const std::string& problem) const
+{
+    // Without shards the cache is filled once in Prefetch and never changes.
+    if(!sharded)
+    {
+        const auto it = cache.find(problem);
+        return it == cache.end() ? nullptr : &it->second;
+    }
+
+    const std::lock_guard<std::mutex> lock{shards_mutex};
+    LoadShard(GetDbShardName(problem));
+    // References to the elements stay valid when more shards are inserted.
+    const auto it = cache.find(problem);
+    return it == cache.end() ? nullptr : &it->second;
+}
+
+void ReadonlyRamDb::LoadShard(const std::string& name) const
+{
+    const auto shard_it = pending_shards.find(name);
+    if(shard_it == pending_shards.end())
+        return;
+
+    const auto shard = shard_it->second;
+    pending_shards.erase(shard_it);
+
+    Measure("LoadShard", [&]() {
+        auto contents = std::string(shard.length, '\0');
+        auto input    = std::ifstream{db_path, std::ios::binary};
+        input.seekg(static_cast<std::streamoff>(shard.offset));
+        input.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+        auto stale = !input;
+        auto rest  = std::string_view{contents};
+        auto line  = shard.first_line;
+        for(; !stale && !rest.empty(); ++line)
+        {
+            const auto end    = rest.find('\n');
+            const auto record = rest.substr(0, end);
+            const auto key_sz = record.find('=');
+            rest              = end == std::string_view::npos ? "" : rest.substr(end + 1);
+
+            if(key_sz == std::string_view::npos || key_sz == 0)
+            {
+                MIOPEN_LOG_E("Ill-formed record: key not found: " << db_path << "#" << line);
+                continue;
+            }
+
+            const auto key = record.substr(0, key_sz);
+            // A record of another family means the file was edited after sharding.
+            stale = GetDbShardName(key) != name;
+            if(!stale)
+                cache.emplace(key, CacheItem{line, std::string{record.substr(key_sz + 1)}});
+        }
+
+        if(!stale)
+        {
+            ++loaded_shards;
+            MIOPEN_LOG_I2("Loaded shard " << name << " of " << db_path);
+            return;
+        }
+
+        MIOPEN_LOG_W("Shard manifest of " << db_path << " does not match it, loading in full");
+        // Records loaded so far came from the same file, so the cache is not cleared:
+        // other threads may still hold references to them.
+        pending_shards.clear();
+        auto full_input = std::ifstream{db_path};
+        ParseAndLoadDb(full_input, true);
+    });
+}
+
+void ReadonlyRamDb::LoadAllShards() const
+{
+    while(!pending_shards.empty())
+        LoadShard(pending_shards.begin()->first);
+}
+
+const std::unordered_map<std::string, ReadonlyRamDb::CacheItem>& ReadonlyRamDb::GetCacheMap() const
+{
+    if(sharded)
+    {
+        const std::lock_guard<std::mutex> lock{shards_mutex};
+        LoadAllShards();
+    }
+    return cache;
+}
+
+std::size_t ReadonlyRamDb::GetLoadedShardCount() const
+{
+    if(!sharded)
+        return 0;
+    const std::lock_guard<std::mutex> lock{shards_mutex};
+    return loaded_shards;
+}
+
 } // namespace miopen
@@ -55,6 +55,7 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 #include <ostream>
+#include <string_view>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_DEPRECATED_SOLVERS)
 
@@ -138,16 +139,84 @@ std::ostream& operator<<(std::ostream& os, const ConvSolution& s)
 struct IdRegistryEntry
 {
     std::string str_value          = "";
-    Primitive primitive            = Primitive::Convolution;
+    Primitive primitive            = Primitive::Invalid;
     miopenConvAlgorithm_t convAlgo = miopenConvolutionAlgoDirect;
     AnySolver solver;
+
+    bool IsRegistered() const { return primitive != Primitive::Invalid; }
 };
 
+/// Solver ids are dense small integers, so entries are stored in a vector indexed by id value.
+/// Names are looked up via open addressing hash table of ids, which allows lookups by
+/// std::string_view, i.e. without constructing std::string from const char* on every call
+/// (this happens a lot while decoding find-db and perf-db records).
+/// The registry is filled once and is immutable afterwards.
 struct IdRegistryData
 {
-    std::unordered_map<uint64_t, IdRegistryEntry> value_to_entry;
-    std::unordered_map<std::string, uint64_t> str_to_value;
-    std::unordered_map<Primitive, std::vector<Id>> primitive_to_ids;
+    std::vector<IdRegistryEntry> entries;
+    std::vector<uint64_t> name_table; // Contains Id::invalid_value in empty slots.
+    std::vector<std::vector<Id>> primitive_to_ids;
+
+    const IdRegistryEntry* FindEntry(uint64_t value) const
+    {
+        if(value >= entries.size() || !entries[value].IsRegistered())
+            return nullptr;
+        return &entries[value];
+    }
+
+    uint64_t FindValue(std::string_view str) const
+    {
+        if(name_table.empty())
+            return Id::invalid_value;
+        const auto mask = name_table.size() - 1;
+        for(auto slot = Hash(str) & mask;; slot = (slot + 1) & mask)
+        {
+            const auto value = name_table[slot];
+            if(value == Id::invalid_value || entries[value].str_value == str)
+                return value;
+        }
+    }
+
+    void InsertName(uint64_t value)
+    {
+        // Keep the load factor under 1/2 so probe sequences stay short.
+        if((count + 1) * 2 > name_table.size())
+        {
+            auto old = std::move(name_table);
+            name_table.assign(std::max<std::size_t>(old.size() * 2, 512), Id::invalid_value);
+            for(const auto v : old)
+            {
+                if(v != Id::invalid_value)
+                    InsertSlot(v);
+            }
+        }
+        InsertSlot(value);
+        ++count;
+    }
+
+private:
+    std::size_t count = 0;
+
+    static std::size_t Hash(std::string_view str)
+    {
+        // FNV-1a
+        auto hash = std::uint64_t{14695981039346656037ULL};
+        for(const auto c : str)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+
+    void InsertSlot(uint64_t value)
+    {
+        const auto mask = name_table.size() - 1;
+        auto slot       = Hash(entries[value].str_value) & mask;
+        while(name_table[slot] != Id::invalid_value)
+            slot = (slot + 1) & mask;
+        name_table[slot] = value;
+    }
 };
 
 struct SolverRegistrar
@@ -155,47 +224,50 @@ struct SolverRegistrar
     SolverRegistrar(IdRegistryData& registry);
 };
 
-static auto& IdRegistry()
+static const IdRegistryData& IdRegistry()
 {
-    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-    static auto data            = IdRegistryData{};
-    static const auto registrar = SolverRegistrar{data};
-    (void)registrar; // clang-tidy
+    static const auto data = [] {
+        auto registry = IdRegistryData{};
+        SolverRegistrar{registry};
+        return registry;
+    }();
     return data;
 }
 
 const std::vector<Id>& GetSolversByPrimitive(Primitive primitive)
 {
-    return IdRegistry().primitive_to_ids[primitive];
+    static const std::vector<Id> empty;
+    const auto& primitive_to_ids = IdRegistry().primitive_to_ids;
+    const auto idx               = static_cast<std::size_t>(primitive);
+    return idx < primitive_to_ids.size() ? primitive_to_ids[idx] : empty;
 }
 
-Id::Id(uint64_t value_) : value(value_)
-{
-    is_valid = (IdRegistry().value_to_entry.find(value) != IdRegistry().value_to_entry.end());
-}
+Id::Id(uint64_t value_) : value(value_) { is_valid = IdRegistry().FindEntry(value) != nullptr; }
 
 Id::Id(ForceInit, uint64_t value_) : value(value_), is_valid(true) {}
 
-Id::Id(const std::string& str) : Id(str.c_str()) {}
+Id::Id(const std::string& str) : Id(std::string_view{str}) {}
+
+Id::Id(const char* str) : Id(std::string_view{str}) {}
 
-Id::Id(const char* str)
+Id::Id(std::string_view str)
 {
-    const auto it = IdRegistry().str_to_value.find(str);
-    is_valid      = (it != IdRegistry().str_to_value.end());
-    value         = is_valid ? it->second : invalid_value;
+    value    = IdRegistry().FindValue(str);
+    is_valid = (value != invalid_value);
 }
 
 std::string Id::ToString() const
 {
     if(!IsValid())
         return "INVALID_SOLVER_ID_" + std::to_string(value);
-    return IdRegistry().value_to_entry[value].str_value;
+    const auto entry = IdRegistry().FindEntry(value);
+    return entry != nullptr ? entry->str_value : std::string{};
 }
 
 AnySolver Id::GetSolver() const
 {
-    const auto it = IdRegistry().value_to_entry.find(value);
-    return it != IdRegistry().value_to_entry.end() ? it->second.solver : AnySolver{};
+    const auto entry = IdRegistry().FindEntry(value);
+    return entry != nullptr ? entry->solver : AnySolver{};
 }
 
 std::string Id::GetAlgo(miopen::conv::Direction dir) const
@@ -205,18 +277,18 @@ std::string Id::GetAlgo(miopen::conv::Direction dir) const
 
 Primitive Id::GetPrimitive() const
 {
-    const auto it = IdRegistry().value_to_entry.find(value);
-    if(it == IdRegistry().value_to_entry.end())
+    const auto entry = IdRegistry().FindEntry(value);
+    if(entry == nullptr)
         MIOPEN_THROW(miopenStatusInternalError);
-    return it->second.primitive;
+    return entry->primitive;
 }
 
 miopenConvAlgorithm_t Id::GetAlgo() const
 {
-    const auto it = IdRegistry().value_to_entry.find(value);
-    if(it == IdRegistry().value_to_entry.end())
+    const auto entry = IdRegistry().FindEntry(value);
+    if(entry == nullptr)
         MIOPEN_THROW(miopenStatusInternalError);
-    return it->second.convAlgo;
+    return entry->convAlgo;
 }
 
 inline bool
@@ -229,30 +301,34 @@ Register(IdRegistryData& registry, uint64_t value, Primitive primitive, const st
         return false;
     }
 
-    if(registry.value_to_entry.find(value) != registry.value_to_entry.end())
+    if(const auto existing = registry.FindEntry(value))
     {
-        MIOPEN_LOG_E("Registered duplicate ids: ["
-                     << value << "]" << str << " and ["
-                     << registry.value_to_entry.find(value)->first << "]"
-                     << registry.value_to_entry.find(value)->second.str_value);
+        MIOPEN_LOG_E("Registered duplicate ids: [" << value << "]" << str << " and [" << value
+                                                   << "]" << existing->str_value);
         return false;
     }
 
-    if(registry.str_to_value.find(str) != registry.str_to_value.end())
+    const auto existing_value = registry.FindValue(str);
+    if(existing_value != Id::invalid_value)
     {
         MIOPEN_LOG_E("Registered duplicate ids: [" << value << "]" << str << " and ["
-                                                   << registry.str_to_value.find(str)->second << "]"
-                                                   << registry.str_to_value.find(str)->first);
+                                                   << existing_value << "]"
+                                                   << registry.entries[existing_value].str_value);
         return false;
     }
 
-    auto entry      = IdRegistryEntry{};
+    if(registry.entries.size() <= value)
+        registry.entries.resize(value + 1);
+
+    auto& entry     = registry.entries[value];
     entry.str_value = str;
-    entry.primitive = {primitive};
+    entry.primitive = primitive;
+    registry.InsertName(value);
 
-    registry.value_to_entry.emplace(value, std::move(entry));
-    registry.str_to_value.emplace(str, value);
-    registry.primitive_to_ids[primitive].emplace_back(ForceInit{}, value);
+    const auto primitive_idx = static_cast<std::size_t>(primitive);
+    if(registry.primitive_to_ids.size() <= primitive_idx)
+        registry.primitive_to_ids.resize(primitive_idx + 1);
+    registry.primitive_to_ids[primitive_idx].emplace_back(ForceInit{}, value);
     return true;
 }
 
@@ -264,7 +340,7 @@ inline bool Register(IdRegistryData& registry,
 {
     if(!Register(registry, value, primitive, str))
         return false;
-    registry.value_to_entry.at(value).convAlgo = algo;
+    registry.entries[value].convAlgo = algo;
     return true;
 }
 
@@ -275,7 +351,7 @@ inline bool Register(IdRegistryData& registry,
 {
     if(!Register(registry, value, Primitive::Convolution, str))
         return false;
-    registry.value_to_entry.at(value).convAlgo = algo;
+    registry.entries[value].convAlgo = algo;
     return true;
 }
 
@@ -285,7 +361,7 @@ RegisterWithSolver(IdRegistryData& registry, uint64_t value, TSolver, miopenConv
 {
     if(!Register(registry, value, TSolver{}.SolverDbId(), algo))
         return;
-    registry.value_to_entry.at(value).solver = TSolver{};
+    registry.entries[value].solver = TSolver{};
 }
 
 inline SolverRegistrar::SolverRegistrar(IdRegistryData& registry)
@@ -709,6 +785,8 @@ inline SolverRegistrar::SolverRegistrar(IdRegistryData& registry)
              multimarginloss::MultiMarginLossForward{}.SolverDbId());
 
     Register(registry, ++id, Primitive::Mha, mha::MhaCKFlashAttentionV2Forward{}.SolverDbId());
+    Register(registry, ++id, Primitive::Adam, adam::AdamMultiTensor{}.SolverDbId());
+    Register(registry, ++id, Primitive::Adam, adam::TransformersAdamWMultiTensor{}.SolverDbId());
     // IMPORTANT: New solvers should be added to the end of the function, and don't leave a white
     // space between this comment and the newly registered solver(s)!
 }
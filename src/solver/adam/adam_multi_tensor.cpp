@@ -0,0 +1,131 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/adam/solvers.hpp>
+
+#include <miopen/adam.hpp>
+#include <miopen/adam/invoke_params.hpp>
+#include <miopen/datatype.hpp>
+#include <miopen/kernel_build_params.hpp>
+#include <miopen/target_properties.hpp>
+
+namespace miopen {
+
+namespace solver {
+
+namespace adam {
+
+bool AdamMultiTensor::IsApplicable(
+    [[maybe_unused]] const ExecutionContext& context,
+    const miopen::adam::MultiTensorProblemDescription& problem) const
+{
+    if(problem.IsTransformers())
+        return false;
+    if(!problem.IsAllContiguous())
+        return false;
+    return true;
+}
+
+ConvSolution
+AdamMultiTensor::GetSolution([[maybe_unused]] const ExecutionContext& context,
+                             const miopen::adam::MultiTensorProblemDescription& problem) const
+{
+    auto result = ConvSolution{miopenStatusSuccess};
+
+    constexpr size_t local_size = 256;
+
+    {
+        auto param_dtype = miopen::GetDataType(problem.GetParamDesc(0).GetType());
+        auto ptype_size  = miopen::get_data_size(problem.GetParamDesc(0).GetType());
+        auto grad_dtype  = miopen::GetDataType(problem.GetGradDesc(0).GetType());
+
+        const auto build_params =
+            KernelBuildParameters{
+                {"PTYPE", param_dtype},
+                {"GTYPE", grad_dtype},
+                {"CTYPE", ptype_size > 4 ? "double" : "float"},
+            }
+            << GetDataTypeKBP(problem.GetParamDesc(0).GetType());
+
+        auto kernel = KernelInfo{};
+
+        // The grid size depends on the work list and is set for every launch.
+        kernel.l_wk.push_back(local_size);
+        kernel.g_wk.push_back(local_size);
+
+        kernel.comp_options = build_params.GenerateFor(kbp::HIP{});
+        kernel.kernel_file  = "MIOpenAdam.cpp";
+        kernel.kernel_name  = "AdamMultiTensorContiguous";
+
+        result.construction_params.push_back(kernel);
+    }
+
+    result.invoker_factory = [](const std::vector<Kernel>& kernels) {
+        return [=](const Handle& handle_, const AnyInvokeParams& raw_params) {
+            decltype(auto) params =
+                raw_params.CastTo<miopen::adam::AdamMultiTensorInvokeParams>();
+            auto elapsed = 0.f;
+
+            for(const auto& launch : *params.launches)
+            {
+                auto kernel = handle_.Run(kernels.front());
+                kernel.SetGlobalDims(launch.block_to_tensor.size() * local_size, 1, 1);
+
+                kernel(miopen::adam::MakeMultiTensorList(
+                           launch, *params.numels, params.buffers, params.amsgrad),
+                       params.gradScale,
+                       params.foundInf,
+                       params.lr,
+                       params.beta1,
+                       params.beta2,
+                       params.weight_decay,
+                       params.eps,
+                       params.step,
+                       params.amsgrad,
+                       params.maximize,
+                       params.adamw,
+                       static_cast<uint64_t>(params.chunkSize));
+
+                if(handle_.IsProfilingEnabled())
+                    elapsed += handle_.GetKernelTime();
+            }
+
+            if(handle_.IsProfilingEnabled())
+            {
+                handle_.ResetKernelTime();
+                handle_.AccumKernelTime(elapsed);
+            }
+        };
+    };
+
+    return result;
+}
+
+} // namespace adam
+
+} // namespace solver
+
+} // namespace miopen
@@ -75,12 +75,14 @@ const std::size_t TargetProperties::MaxLocalMemorySize = static_cast<const std::
 
 void TargetProperties::Init(const Handle* const handle)
 {
-    const auto rawName = [&]() -> std::string {
-        const auto& arch = env::value(MIOPEN_DEVICE_ARCH);
-        if(!arch.empty())
-            return arch;
-        return handle->GetDeviceNameImpl();
-    }();
+    const auto& arch = env::value(MIOPEN_DEVICE_ARCH);
+    Init(arch.empty() ? handle->GetDeviceNameImpl() : arch);
+}
+
+void TargetProperties::Init(const std::string& device_name)
+{
+    const auto& arch    = env::value(MIOPEN_DEVICE_ARCH);
+    const auto& rawName = arch.empty() ? device_name : arch;
     name = GetDeviceNameFromMap(rawName);
     // DKMS driver older than 5.9 may report incorrect state of SRAMECC feature.
     // Therefore we compute default SRAMECC and rely on it for now.
@@ -0,0 +1,497 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tensor_dump.hpp>
+
+#include <miopen/datatype.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <tuple>
+
+#if MIOPEN_USE_ZSTD
+#include <zstd.h>
+#endif
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DUMP_TENSOR_FORMAT, "npy")
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DUMP_TENSOR_COMPRESS)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DUMP_TENSOR_EVERY_K, 1)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DUMP_TENSOR_FIRST_N, 0)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DUMP_TENSOR_QUEUE_MB, 256)
+
+namespace miopen {
+
+namespace {
+
+/// Buffers kept for reuse after the queue drains.
+constexpr std::size_t max_free_staging = 8;
+
+const char* GetNpyDescr(miopenDataType_t type)
+{
+    switch(type)
+    {
+    case miopenHalf: return "<f2";
+    case miopenFloat: return "<f4";
+    case miopenInt32: return "<i4";
+    case miopenInt8: return "|i1";
+    case miopenBFloat16: return "<u2";
+    case miopenDouble: return "<f8";
+    case miopenFloat8:
+    case miopenBFloat8: return "|u1";
+    case miopenInt64: return "<i8";
+    }
+    MIOPEN_THROW(miopenStatusInternalError, "Unknown data type");
+}
+
+/// Lengths in the memory order if the strides describe a tensor without gaps.
+std::optional<std::vector<std::size_t>> GetDenseShape(const TensorDumpInfo& info)
+{
+    const auto& lengths = info.lengths;
+    const auto& strides = info.strides;
+    if(lengths.size() != strides.size())
+        return std::nullopt;
+
+    auto order = std::vector<std::size_t>(lengths.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](auto l, auto r) {
+        return strides[l] > strides[r];
+    });
+
+    auto expected = std::size_t{1};
+    for(auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        if(strides[*it] != expected)
+            return std::nullopt;
+        expected *= lengths[*it];
+    }
+
+    auto shape = std::vector<std::size_t>{};
+    shape.reserve(order.size());
+    for(const auto i : order)
+        shape.push_back(lengths[i]);
+    return shape;
+}
+
+template <class Range>
+void WriteJsonArray(std::ostream& stream, const Range& range)
+{
+    stream << '[';
+    auto first = true;
+    for(const auto& value : range)
+    {
+        if(!first)
+            stream << ", ";
+        stream << value;
+        first = false;
+    }
+    stream << ']';
+}
+
+#if MIOPEN_USE_ZSTD
+std::vector<char> CompressNpy(const std::string& header, const char* data, std::size_t size)
+{
+    const auto ctx = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>{ZSTD_createCCtx(),
+                                                                         &ZSTD_freeCCtx};
+    if(!ctx)
+        MIOPEN_THROW(miopenStatusAllocFailed, "Unable to create zstd context");
+
+    // Dumps are on the debugging path, favor the speed over the ratio.
+    ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_compressionLevel, 1);
+    ZSTD_CCtx_setPledgedSrcSize(ctx.get(), header.size() + size);
+
+    auto result = std::vector<char>(ZSTD_compressBound(header.size() + size));
+    auto out    = ZSTD_outBuffer{result.data(), result.size(), 0};
+
+    const auto compress = [&](const void* src, std::size_t src_size, ZSTD_EndDirective mode) {
+        auto in = ZSTD_inBuffer{src, src_size, 0};
+        for(;;)
+        {
+            const auto remaining = ZSTD_compressStream2(ctx.get(), &out, &in, mode);
+            if(ZSTD_isError(remaining) != 0u)
+                MIOPEN_THROW(std::string{"zstd compression failed: "} +
+                             ZSTD_getErrorName(remaining));
+            if(mode == ZSTD_e_end ? remaining == 0 : in.pos == in.size)
+                return;
+        }
+    };
+
+    compress(header.data(), header.size(), ZSTD_e_continue);
+    compress(data, size, ZSTD_e_end);
+    result.resize(out.pos);
+    return result;
+}
+#endif
+
+void WriteFile(const fs::path& path, const std::initializer_list<std::string_view>& parts)
+{
+    auto file = std::ofstream{path, std::ios::binary};
+    if(!file.is_open())
+        MIOPEN_THROW("Cannot write to file : " + path.string());
+    for(const auto& part : parts)
+        file.write(part.data(), static_cast<std::streamsize>(part.size()));
+    if(!file)
+        MIOPEN_THROW("Failed to write " + path.string());
+}
+
+} // namespace
+
+TensorDumpInfo TensorDumpInfo::From(const TensorDescriptor& desc)
+{
+    auto info    = TensorDumpInfo{};
+    info.type    = desc.GetType();
+    info.lengths = desc.GetLengths();
+    info.strides = desc.GetStrides();
+    info.layout  = desc.GetLayout_str();
+    return info;
+}
+
+std::size_t TensorDumpInfo::GetElementSpace() const
+{
+    if(lengths.empty())
+        return 0;
+    auto space = std::size_t{1};
+    for(auto i = std::size_t{0}; i < lengths.size(); ++i)
+    {
+        if(lengths[i] == 0)
+            return 0;
+        space += (lengths[i] - 1) * strides[i];
+    }
+    return space;
+}
+
+std::size_t TensorDumpInfo::GetNumBytes() const { return GetElementSpace() * GetTypeSize(type); }
+
+std::string MakeNpyHeader(const TensorDumpInfo& info)
+{
+    const auto shape = GetDenseShape(info).value_or(std::vector{info.GetElementSpace()});
+
+    std::ostringstream dict;
+    dict << "{'descr': '" << GetNpyDescr(info.type) << "', 'fortran_order': False, 'shape': (";
+    for(auto i = std::size_t{0}; i < shape.size(); ++i)
+        dict << (i == 0 ? "" : ", ") << shape[i];
+    // One element tuples need the trailing comma.
+    dict << (shape.size() == 1 ? ",)" : ")") << ", }";
+
+    // Magic, version, header length, then the dictionary padded with spaces and terminated
+    // with a newline, so the data starts at a 64-byte boundary.
+    constexpr std::size_t preamble_size = 10;
+    auto header                         = dict.str();
+    const auto unpadded                 = preamble_size + header.size() + 1;
+    header.append((64 - unpadded % 64) % 64, ' ');
+    header.push_back('\n');
+
+    if(header.size() > 0xffff)
+        MIOPEN_THROW(miopenStatusBadParm, "Too many dimensions for the npy format");
+
+    const auto header_size = static_cast<uint16_t>(header.size());
+    auto result            = std::string{"\x93NUMPY\x01\x00", 8};
+    result.push_back(static_cast<char>(header_size & 0xff));
+    result.push_back(static_cast<char>(header_size >> 8));
+    return result + header;
+}
+
+std::string MakeTensorDumpMetadata(const TensorDumpInfo& info, bool compressed)
+{
+    std::ostringstream ss;
+    ss << "{\n";
+    ss << "    \"type\": \"" << GetDataType(info.type) << "\",\n";
+    ss << "    \"npy_descr\": \"" << GetNpyDescr(info.type) << "\",\n";
+    ss << "    \"layout\": \"" << info.layout << "\",\n";
+    ss << "    \"lengths\": ";
+    WriteJsonArray(ss, info.lengths);
+    ss << ",\n    \"strides\": ";
+    WriteJsonArray(ss, info.strides);
+    ss << ",\n    \"element_space\": " << info.GetElementSpace() << ",\n";
+    ss << "    \"dense\": " << (GetDenseShape(info) ? "true" : "false") << ",\n";
+    ss << "    \"compression\": \"" << (compressed ? "zstd" : "none") << "\"\n";
+    ss << "}\n";
+    return ss.str();
+}
+
+void TensorDumper::StagingDeleter::operator()(char* ptr) const
+{
+#if MIOPEN_BACKEND_HIP && !MIOPEN_MODE_NOGPU
+    std::ignore = hipHostFree(ptr);
+#else
+    delete[] ptr;
+#endif
+}
+
+TensorDumper::TensorDumper(Options options_) : options(std::move(options_))
+{
+    if(options.every_k == 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Tensor dump sampling period must be positive");
+#if !MIOPEN_USE_ZSTD
+    if(options.compress && options.format == Format::Npy)
+        MIOPEN_LOG_W("MIOpen is built without zstd, tensor dumps are not compressed");
+#endif
+}
+
+TensorDumper::~TensorDumper()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    queue_changed.notify_all();
+    if(writer.joinable())
+        writer.join();
+}
+
+std::optional<std::size_t> TensorDumper::Sample()
+{
+    const auto call = calls.fetch_add(1);
+    if(call % options.every_k != 0)
+        return std::nullopt;
+    if(options.first_n != 0 && call / options.every_k >= options.first_n)
+        return std::nullopt;
+    return call;
+}
+
+fs::path
+TensorDumper::GetPath(const std::string& prefix, std::size_t call, const std::string& name) const
+{
+    auto file_name = prefix + '_';
+    if(options.format != Format::Raw)
+        file_name += std::to_string(call) + '_';
+    file_name += name;
+
+    const auto path = fs::path{file_name};
+    return path.has_parent_path() ? path : fs::current_path() / path;
+}
+
+void TensorDumper::Dump(const Handle& handle,
+                        const TensorDescriptor& desc,
+                        ConstData_t data,
+                        const std::string& prefix,
+                        std::size_t call,
+                        const std::string& name)
+{
+    if(data == nullptr)
+    {
+        MIOPEN_LOG_E("Dereferencing nullptr when trying to dump tensor from gpu");
+        return;
+    }
+
+    auto job        = Job{GetPath(prefix, call, name), TensorDumpInfo::From(desc), {}};
+    const auto size = job.info.GetNumBytes();
+    job.staging     = Acquire(size);
+    try
+    {
+        handle.ReadTo(job.staging.data.get(), data, size);
+    }
+    catch(...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending_bytes -= job.staging.capacity;
+        }
+        queue_changed.notify_all();
+        throw;
+    }
+    Enqueue(std::move(job));
+}
+
+void TensorDumper::DumpHost(const TensorDumpInfo& info,
+                            const void* data,
+                            const std::string& prefix,
+                            std::size_t call,
+                            const std::string& name)
+{
+    auto job        = Job{GetPath(prefix, call, name), info, {}};
+    const auto size = info.GetNumBytes();
+    job.staging     = Acquire(size);
+    std::memcpy(job.staging.data.get(), data, size);
+    Enqueue(std::move(job));
+}
+
+TensorDumper::Staging TensorDumper::Acquire(std::size_t size)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        // A tensor larger than the limit is still dumped, alone.
+        queue_changed.wait(lock, [&]() {
+            return pending_bytes == 0 || pending_bytes + size <= options.max_pending_bytes;
+        });
+
+        const auto it = std::min_element(
+            free_staging.begin(), free_staging.end(), [&](const auto& l, const auto& r) {
+                const auto l_fits = l.capacity >= size;
+                const auto r_fits = r.capacity >= size;
+                return l_fits != r_fits ? l_fits : l.capacity < r.capacity;
+            });
+        if(it != free_staging.end() && it->capacity >= size)
+        {
+            auto staging = std::move(*it);
+            free_staging.erase(it);
+            pending_bytes += staging.capacity;
+            return staging;
+        }
+        pending_bytes += size;
+    }
+
+    auto staging     = Staging{};
+    staging.capacity = size;
+#if MIOPEN_BACKEND_HIP && !MIOPEN_MODE_NOGPU
+    void* ptr = nullptr;
+    if(hipHostMalloc(&ptr, std::max<std::size_t>(size, 1)) != hipSuccess)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending_bytes -= size;
+        }
+        queue_changed.notify_all();
+        MIOPEN_THROW(miopenStatusAllocFailed, "hipHostMalloc " + std::to_string(size));
+    }
+    staging.data = StagingPtr{static_cast<char*>(ptr)};
+#else
+    staging.data = StagingPtr{new char[std::max<std::size_t>(size, 1)]};
+#endif
+    return staging;
+}
+
+void TensorDumper::Enqueue(Job job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::move(job));
+        if(!writer.joinable())
+            writer = std::thread{[this]() { WriterLoop(); }};
+    }
+    queue_changed.notify_all();
+}
+
+void TensorDumper::Flush()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    queue_changed.wait(lock, [&]() { return pending_bytes == 0; });
+}
+
+void TensorDumper::Write(const Job& job) const
+{
+    const auto size = job.info.GetNumBytes();
+    const auto data = std::string_view{job.staging.data.get(), size};
+
+    if(!fs::is_directory(job.path.parent_path()))
+        MIOPEN_THROW("Directory does not exists : " + job.path.parent_path().string());
+
+    auto path = job.path;
+    if(options.format == Format::Raw)
+    {
+        path += ".bin";
+        WriteFile(path, {data});
+        MIOPEN_LOG_I("Dumping tensor to file : " << path);
+        return;
+    }
+
+    const auto header = MakeNpyHeader(job.info);
+    auto compressed   = false;
+    path += ".npy";
+#if MIOPEN_USE_ZSTD
+    if(options.compress)
+    {
+        const auto packed = CompressNpy(header, data.data(), data.size());
+        path += ".zst";
+        WriteFile(path, {std::string_view{packed.data(), packed.size()}});
+        compressed = true;
+    }
+#endif
+    if(!compressed)
+        WriteFile(path, {header, data});
+
+    auto metadata_path = job.path;
+    metadata_path += ".json";
+    WriteFile(metadata_path, {MakeTensorDumpMetadata(job.info, compressed)});
+    MIOPEN_LOG_I("Dumping tensor to file : " << path);
+}
+
+void TensorDumper::WriterLoop()
+{
+    for(;;)
+    {
+        auto job = Job{};
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            queue_changed.wait(lock, [&]() { return stop || !queue.empty(); });
+            if(queue.empty())
+                return;
+            job = std::move(queue.front());
+            queue.pop_front();
+        }
+
+        try
+        {
+            Write(job);
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_E("Tensor dump failed: " << ex.what());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending_bytes -= job.staging.capacity;
+            if(free_staging.size() < max_free_staging)
+                free_staging.push_back(std::move(job.staging));
+        }
+        queue_changed.notify_all();
+    }
+}
+
+TensorDumper& TensorDumper::GetInstance()
+{
+    // Never destroyed: the pinned buffers must not be freed after the HIP runtime is gone.
+    static auto* const instance = []() {
+        auto options = Options{};
+
+        const auto& format = env::value(MIOPEN_DUMP_TENSOR_FORMAT);
+        if(format == "raw")
+            options.format = Format::Raw;
+        else if(format != "npy")
+            MIOPEN_LOG_W("Unknown MIOPEN_DUMP_TENSOR_FORMAT=" << format << ", using npy");
+
+        options.compress          = env::enabled(MIOPEN_DUMP_TENSOR_COMPRESS);
+        options.every_k           = std::max<uint64_t>(env::value(MIOPEN_DUMP_TENSOR_EVERY_K), 1);
+        options.first_n           = env::value(MIOPEN_DUMP_TENSOR_FIRST_N);
+        options.max_pending_bytes = env::value(MIOPEN_DUMP_TENSOR_QUEUE_MB) << 20;
+
+        auto* dumper = new TensorDumper{options}; // NOLINT (cppcoreguidelines-owning-memory)
+        std::atexit([]() { GetInstance().Flush(); });
+        return dumper;
+    }();
+    return *instance;
+}
+
+} // namespace miopen
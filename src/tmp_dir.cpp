@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include <miopen/tmp_dir.hpp>
+#include <miopen/build_workspace.hpp>
 #include <miopen/env.hpp>
 #include <miopen/filesystem.hpp>
 #include <miopen/errors.hpp>
@@ -40,7 +41,7 @@ MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_EXIT_STATUS_TEMP_DIR)
 
 namespace miopen {
 
-TmpDir::TmpDir(std::string_view prefix) : path{fs::temp_directory_path()}
+TmpDir::TmpDir(std::string_view prefix) : path{GetBuildWorkspace()}
 {
     std::string p{prefix.empty() ? "" : (prefix[0] == '-' ? "" : "-")};
 
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tuning_planner.hpp>
+
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace miopen {
+
+TuningPlanner::TuningPlanner(Duration total_budget_) : TuningPlanner(total_budget_, Options{}) {}
+
+TuningPlanner::TuningPlanner(Duration total_budget_, Options options_)
+    : total_budget(total_budget_), options(options_), time_per_work(options.default_time_per_work)
+{
+    if(options.min_budget > options.max_budget)
+        MIOPEN_THROW(miopenStatusBadParm, "Min tuning budget exceeds the max one");
+}
+
+std::size_t TuningPlanner::Add(const std::string& key,
+                               std::size_t count,
+                               double work,
+                               std::optional<double> known_time)
+{
+    if(work < 0 || (known_time && *known_time < 0))
+        MIOPEN_THROW(miopenStatusBadParm);
+
+    const auto found = index_by_key.find(key);
+    if(found != index_by_key.end())
+    {
+        auto& item = items[found->second];
+        item.count += count;
+        if(!item.known_time)
+            item.known_time = known_time;
+        Plan();
+        return found->second;
+    }
+
+    auto item       = Item{};
+    item.key        = key;
+    item.count      = count;
+    item.work       = work;
+    item.known_time = known_time;
+    items.push_back(std::move(item));
+    index_by_key.emplace(key, items.size() - 1);
+    Plan();
+    return items.size() - 1;
+}
+
+std::optional<std::size_t> TuningPlanner::Next() const
+{
+    auto best = std::optional<std::size_t>{};
+    for(auto i = std::size_t{0}; i < items.size(); ++i)
+    {
+        if(items[i].done || items[i].budget.count() == 0)
+            continue;
+        if(!best || GetExpectedGain(i) > GetExpectedGain(*best))
+            best = i;
+    }
+    return best;
+}
+
+void TuningPlanner::Report(std::size_t index, Duration spent, std::optional<double> measured_time)
+{
+    auto& item = items.at(index);
+    if(item.done)
+        MIOPEN_THROW(miopenStatusBadParm, "Problem has already been reported: " + item.key);
+
+    item.done          = true;
+    item.spent         = spent;
+    item.measured_time = measured_time;
+    MIOPEN_LOG_I2(item.key << ": spent " << spent.count() << " of " << item.budget.count()
+                           << " ms");
+    Plan();
+}
+
+const TuningPlanner::Item& TuningPlanner::Get(std::size_t index) const { return items.at(index); }
+
+double TuningPlanner::GetEstimatedTime(std::size_t index) const
+{
+    const auto& item = items.at(index);
+    if(item.measured_time)
+        return *item.measured_time;
+    if(item.known_time)
+        return *item.known_time;
+    return item.work * time_per_work;
+}
+
+double TuningPlanner::GetExpectedGain(std::size_t index) const
+{
+    const auto& item = items.at(index);
+    if(item.done)
+        return 0;
+    const auto gain = item.known_time ? options.tuned_gain : options.untuned_gain;
+    return static_cast<double>(item.count) * GetEstimatedTime(index) * gain;
+}
+
+double TuningPlanner::GetTimeShare(std::size_t index) const
+{
+    auto total = 0.0;
+    for(auto i = std::size_t{0}; i < items.size(); ++i)
+        total += static_cast<double>(items[i].count) * GetEstimatedTime(i);
+    if(total <= 0)
+        return 0;
+    return static_cast<double>(items.at(index).count) * GetEstimatedTime(index) / total;
+}
+
+TuningPlanner::Duration TuningPlanner::GetRemainingBudget() const
+{
+    const auto spent = std::accumulate(
+        items.begin(), items.end(), Duration{0}, [](auto sum, const auto& item) {
+            return sum + item.spent;
+        });
+    return std::max(Duration{0}, total_budget - spent);
+}
+
+void TuningPlanner::Calibrate()
+{
+    // Both the find-db and the measured times are for the same device.
+    auto time = 0.0;
+    auto work = 0.0;
+    for(const auto& item : items)
+    {
+        const auto& known = item.measured_time ? item.measured_time : item.known_time;
+        if(!known || item.work <= 0)
+            continue;
+        time += *known;
+        work += item.work;
+    }
+    time_per_work = work > 0 ? time / work : options.default_time_per_work;
+}
+
+void TuningPlanner::Plan()
+{
+    Calibrate();
+
+    auto pending = std::vector<std::pair<std::size_t, double>>{};
+    for(auto i = std::size_t{0}; i < items.size(); ++i)
+    {
+        items[i].budget = Duration{0};
+        const auto gain = GetExpectedGain(i);
+        if(gain > 0)
+            pending.emplace_back(i, gain);
+    }
+
+    std::sort(pending.begin(), pending.end(), [](const auto& l, const auto& r) {
+        return l.second > r.second;
+    });
+
+    const auto remaining  = static_cast<double>(GetRemainingBudget().count());
+    const auto min_budget = static_cast<double>(options.min_budget.count());
+    const auto max_budget = static_cast<double>(options.max_budget.count());
+
+    // Splits the budget among the first n problems proportionally to their gains. The parts
+    // above the max budget are redistributed among the rest. Fails if the last problem gets
+    // less than the min budget.
+    auto budgets     = std::vector<double>{};
+    const auto split = [&](std::size_t n) {
+        budgets.assign(n, 0.0);
+        auto left   = remaining;
+        auto weight = 0.0;
+        for(auto i = std::size_t{0}; i < n; ++i)
+            weight += pending[i].second;
+
+        // The problems are sorted by gain, so the capped ones come first.
+        for(auto i = std::size_t{0}; i < n; ++i)
+        {
+            budgets[i] = std::min(max_budget, left * pending[i].second / weight);
+            left -= budgets[i];
+            weight -= pending[i].second;
+        }
+        return n == 0 || budgets.back() >= min_budget;
+    };
+
+    auto n = pending.size();
+    while(!split(n))
+        --n;
+
+    for(auto i = std::size_t{0}; i < n; ++i)
+        items[pending[i].first].budget = Duration{std::llround(budgets[i])};
+}
+
+} // namespace miopen
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tuning_planner.hpp>
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/problem.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <sstream>
+
+namespace {
+
+std::size_t Product(const std::vector<std::size_t>& values, std::size_t first = 0)
+{
+    return std::accumulate(values.begin() + std::min(first, values.size()),
+                           values.end(),
+                           std::size_t{1},
+                           std::multiplies<std::size_t>{});
+}
+
+void AddConvolutionProblem(miopen::TuningPlanner& planner,
+                           miopen::Handle& handle,
+                           const miopen::Problem& problem,
+                           std::size_t count,
+                           std::size_t& index)
+{
+    const auto& conv_desc =
+        std::get<miopen::ConvolutionDescriptor>(problem.GetOperatorDescriptor());
+    const auto conv_problem = conv_desc.mode == miopenTranspose
+                                  ? problem.MakeTransposed().AsConvolution()
+                                  : problem.AsConvolution();
+
+    // Forward convolution flops: 2 * N * K * C / G * filter size * output size.
+    const auto& y_desc = conv_problem.GetDirection() == miopen::conv::Direction::Forward
+                             ? conv_problem.GetOut()
+                             : conv_problem.GetIn();
+    const auto flops   = 2.0 * static_cast<double>(conv_problem.GetBatchSize()) *
+                       static_cast<double>(Product(conv_problem.GetWeights().GetLengths())) *
+                       static_cast<double>(Product(y_desc.GetLengths(), 2));
+
+    auto known_time = std::optional<double>{};
+    const miopen::FindDbRecord record{handle, conv_problem};
+    for(const auto& pair : record)
+    {
+        if(!known_time || pair.second.time < *known_time)
+            known_time = pair.second.time;
+    }
+
+    std::ostringstream key;
+    key << conv_problem;
+    index = planner.Add(key.str(), count, flops, known_time);
+}
+
+} // namespace
+
+extern "C" miopenStatus_t miopenCreateTuningPlanner(miopenTuningPlanner_t* planner,
+                                                    size_t budgetMs)
+{
+    MIOPEN_LOG_FUNCTION(planner, budgetMs);
+    return miopen::try_([&] {
+        auto& planner_ptr = miopen::deref(planner);
+        planner_ptr       = new miopen::TuningPlanner(miopen::TuningPlanner::Duration{budgetMs});
+    });
+}
+
+extern "C" miopenStatus_t miopenDestroyTuningPlanner(miopenTuningPlanner_t planner)
+{
+    MIOPEN_LOG_FUNCTION(planner);
+    return miopen::try_([&] { miopen_destroy_object(planner); });
+}
+
+extern "C" miopenStatus_t miopenTuningPlannerAddProblem(miopenTuningPlanner_t planner,
+                                                        miopenHandle_t handle,
+                                                        miopenProblem_t problem,
+                                                        size_t count,
+                                                        size_t* index)
+{
+    MIOPEN_LOG_FUNCTION(planner, handle, problem, count, index);
+    return miopen::try_([&] {
+        const auto& container = miopen::deref(problem);
+        const auto* regular   = std::get_if<miopen::Problem>(&container.item);
+        if(regular == nullptr ||
+           !std::holds_alternative<miopen::ConvolutionDescriptor>(regular->GetOperatorDescriptor()))
+        {
+            MIOPEN_THROW(miopenStatusNotImplemented,
+                         "Only convolution problems are supported by the tuning planner.");
+        }
+
+        AddConvolutionProblem(
+            miopen::deref(planner), miopen::deref(handle), *regular, count, miopen::deref(index));
+    });
+}
+
+extern "C" miopenStatus_t
+miopenTuningPlannerGetNext(miopenTuningPlanner_t planner, size_t* index, size_t* budgetMs)
+{
+    MIOPEN_LOG_FUNCTION(planner, index, budgetMs);
+    return miopen::try_([&] {
+        const auto& planner_deref = miopen::deref(planner);
+        const auto next           = planner_deref.Next();
+
+        miopen::deref(index) = next ? *next : std::numeric_limits<size_t>::max();
+        miopen::deref(budgetMs) =
+            next ? static_cast<size_t>(planner_deref.Get(*next).budget.count()) : 0;
+    });
+}
+
+extern "C" miopenStatus_t miopenTuningPlannerGetBudget(miopenTuningPlanner_t planner,
+                                                       size_t index,
+                                                       size_t* budgetMs)
+{
+    MIOPEN_LOG_FUNCTION(planner, index, budgetMs);
+    return miopen::try_([&] {
+        const auto& planner_deref = miopen::deref(planner);
+        if(index >= planner_deref.Size())
+            MIOPEN_THROW(miopenStatusBadParm, "Problem index is out of range.");
+
+        miopen::deref(budgetMs) = static_cast<size_t>(planner_deref.Get(index).budget.count());
+    });
+}
+
+extern "C" miopenStatus_t miopenTuningPlannerReport(miopenTuningPlanner_t planner,
+                                                    size_t index,
+                                                    size_t spentMs,
+                                                    float timeMs)
+{
+    MIOPEN_LOG_FUNCTION(planner, index, spentMs, timeMs);
+    return miopen::try_([&] {
+        auto& planner_deref = miopen::deref(planner);
+        if(index >= planner_deref.Size())
+            MIOPEN_THROW(miopenStatusBadParm, "Problem index is out of range.");
+
+        const auto measured = timeMs >= 0 ? std::optional<double>{timeMs} : std::nullopt;
+        planner_deref.Report(index, miopen::TuningPlanner::Duration{spentMs}, measured);
+    });
+}
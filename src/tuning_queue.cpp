@@ -0,0 +1,206 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tuning_queue.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/process.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace miopen {
+
+namespace {
+
+constexpr const char* pending_dir = "pending";
+constexpr const char* claimed_dir = "claimed";
+constexpr const char* done_dir    = "done";
+constexpr const char* failed_dir  = "failed";
+constexpr const char* temp_dir    = "tmp";
+constexpr const char* shards_dir  = "shards";
+
+// Separates the job name and the pid of the owner in the names of claimed files.
+constexpr char owner_separator = '@';
+
+long GetPid()
+{
+#ifndef _WIN32
+    return static_cast<long>(getpid());
+#else
+    return 0;
+#endif
+}
+
+std::string ClaimedName(const std::string& name, long pid)
+{
+    return name + owner_separator + std::to_string(pid);
+}
+
+std::vector<std::string> ListFiles(const fs::path& dir)
+{
+    auto names = std::vector<std::string>{};
+    auto ec    = std::error_code{};
+    for(auto it = fs::directory_iterator{dir, ec}; !ec && it != fs::directory_iterator{};
+        it.increment(ec))
+    {
+        // The file may be claimed by someone else in the meantime.
+        auto file_ec = std::error_code{};
+        if(it->is_regular_file(file_ec))
+            names.push_back(it->path().filename().string());
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+std::optional<TuningJob> ReadJob(const fs::path& file, const std::string& name)
+{
+    auto stream = std::ifstream{file};
+    auto job    = TuningJob{name, {}, {}};
+    if(!std::getline(stream, job.solvers) || !std::getline(stream, job.command))
+        return std::nullopt;
+    return job;
+}
+
+} // namespace
+
+TuningQueue::TuningQueue(const fs::path& root_) : root(root_)
+{
+    for(const auto dir : {pending_dir, claimed_dir, done_dir, failed_dir, temp_dir, shards_dir})
+        fs::create_directories(root / dir);
+}
+
+fs::path TuningQueue::GetShardPath(const TuningJob& job) const
+{
+    return root / shards_dir / job.name;
+}
+
+void TuningQueue::Push(const TuningJob& job)
+{
+    if(job.name.empty() || job.name.front() == '.' ||
+       job.name.find_first_of(std::string{"/\\"} + owner_separator) != std::string::npos)
+        MIOPEN_THROW(miopenStatusBadParm, "Invalid tuning job name: " + job.name);
+    if(job.solvers.find('\n') != std::string::npos || job.command.find('\n') != std::string::npos)
+        MIOPEN_THROW(miopenStatusBadParm, "Tuning job fields must be single lines: " + job.name);
+
+    // Written aside and renamed, so that a worker never sees a partially written job.
+    const auto temp = root / temp_dir / ClaimedName(job.name, GetPid());
+    {
+        auto stream = std::ofstream{temp};
+        stream << job.solvers << '\n' << job.command << '\n';
+        if(!stream)
+            MIOPEN_THROW("Unable to write tuning job: " + temp.string());
+    }
+    fs::rename(temp, root / pending_dir / job.name);
+}
+
+std::optional<TuningJob> TuningQueue::Claim()
+{
+    const auto pid = GetPid();
+
+    for(const auto& name : ListFiles(root / pending_dir))
+    {
+        const auto claimed = root / claimed_dir / ClaimedName(name, pid);
+        auto ec            = std::error_code{};
+        // Fails if another worker has been faster.
+        fs::rename(root / pending_dir / name, claimed, ec);
+        if(ec)
+            continue;
+
+        if(auto job = ReadJob(claimed, name))
+            return job;
+
+        MIOPEN_LOG_W("Ill-formed tuning job: " << name);
+        fs::rename(claimed, root / failed_dir / name, ec);
+    }
+
+    return std::nullopt;
+}
+
+void TuningQueue::Complete(const TuningJob& job, bool success)
+{
+    fs::rename(root / claimed_dir / ClaimedName(job.name, GetPid()),
+               root / (success ? done_dir : failed_dir) / job.name);
+}
+
+std::size_t TuningQueue::RequeueAbandoned()
+{
+    auto requeued = std::size_t{0};
+
+    for(const auto& claimed : ListFiles(root / claimed_dir))
+    {
+        const auto separator = claimed.rfind(owner_separator);
+        if(separator == std::string::npos)
+            continue;
+
+        const auto pid = std::strtol(claimed.c_str() + separator + 1, nullptr, 10);
+        if(pid <= 0 || IsProcessAlive(pid))
+            continue;
+
+        const auto name = claimed.substr(0, separator);
+        // Results of the interrupted run are incomplete.
+        auto ec = std::error_code{};
+        fs::remove_all(root / shards_dir / name, ec);
+        fs::rename(root / claimed_dir / claimed, root / pending_dir / name, ec);
+        if(ec)
+            continue;
+
+        MIOPEN_LOG_I("Tuning job " << name << " of process " << pid << " is requeued");
+        ++requeued;
+    }
+
+    return requeued;
+}
+
+TuningQueue::Stats TuningQueue::GetStats() const
+{
+    auto stats    = Stats{};
+    stats.pending = ListFiles(root / pending_dir).size();
+    stats.claimed = ListFiles(root / claimed_dir).size();
+    stats.done    = ListFiles(root / done_dir).size();
+    stats.failed  = ListFiles(root / failed_dir).size();
+    return stats;
+}
+
+std::vector<fs::path> TuningQueue::GetDoneShards() const
+{
+    auto shards = std::vector<fs::path>{};
+    for(const auto& name : ListFiles(root / done_dir))
+    {
+        auto shard = root / shards_dir / name;
+        if(fs::is_directory(shard))
+            shards.push_back(std::move(shard));
+    }
+    return shards;
+}
+
+} // namespace miopen
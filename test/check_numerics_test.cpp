@@ -72,6 +72,15 @@ struct check_numeric_normal : check_numerics_base<T>
                                          this->desc,
                                          this->buffer.get(),
                                          false));
+
+        CHECK(!miopen::checkNumericsImpl(
+            this->h, miopen::CheckNumerics::Histograms, this->desc, this->buffer.get(), true));
+        CHECK(!miopen::checkNumericsImpl(this->h,
+                                         miopen::CheckNumerics::Histograms |
+                                             miopen::CheckNumerics::Throw,
+                                         this->desc,
+                                         this->buffer.get(),
+                                         false));
     }
 };
 
@@ -125,6 +134,12 @@ struct check_numeric_abnormal : check_numerics_base<T>
                                       this->buffer.get(),
                                       false);
         }));
+
+        // Host statistics alone detect the abnormal values as well.
+        CHECK(miopen::checkNumericsImpl(
+            this->h, miopen::CheckNumerics::Histograms, this->desc, this->buffer.get(), true));
+        CHECK(miopen::checkNumericsImpl(
+            this->h, miopen::CheckNumerics::Histograms, this->desc, this->buffer.get(), false));
     }
 };
 
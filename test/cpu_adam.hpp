@@ -98,4 +98,47 @@ void cpu_adam(tensor<T1>& params,
     });
 }
 
+// Reference for the multi-tensor step: the tensors are independent, so it is the
+// single tensor reference applied to every tensor of the list.
+template <typename T1, typename T2>
+void cpu_adam_multi_tensor(std::vector<tensor<T1>>& params,
+                           std::vector<tensor<T2>>& grads,
+                           std::vector<tensor<T1>>& exp_avgs,
+                           std::vector<tensor<T1>>& exp_avg_sqs,
+                           std::vector<tensor<T1>>& max_exp_avg_sqs,
+                           float lr,
+                           float beta1,
+                           float beta2,
+                           float weight_decay,
+                           float eps,
+                           bool amsgrad,
+                           bool maximize,
+                           bool adamw,
+                           bool is_amp,
+                           int32_t grad_scale,
+                           bool found_inf,
+                           int32_t step_count)
+{
+    for(size_t i = 0; i < params.size(); ++i)
+    {
+        cpu_adam<T1, T2>(params[i],
+                         grads[i],
+                         exp_avgs[i],
+                         exp_avg_sqs[i],
+                         max_exp_avg_sqs[i],
+                         lr,
+                         beta1,
+                         beta2,
+                         weight_decay,
+                         eps,
+                         amsgrad,
+                         maximize,
+                         adamw,
+                         is_amp,
+                         grad_scale,
+                         found_inf,
+                         step_count);
+    }
+}
+
 #endif
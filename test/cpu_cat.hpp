@@ -26,41 +26,43 @@
 #ifndef GUARD_CPU_CAT_HPP
 #define GUARD_CPU_CAT_HPP
 
+#include "cpu_strided_copy.hpp"
 #include "tensor_holder.hpp"
 
-template <class T>
-void cpu_cat_forward(std::vector<tensor<T>> inputs, tensor<T>& ref_output, int32_t dim)
+#include <vector>
+
+/// Copies every input into its range of the output along dim.
+template <class T, class U>
+void cpu_cat_forward(const std::vector<const miopen::TensorDescriptor*>& inputDescs,
+                     const std::vector<const T*>& inputs,
+                     const miopen::TensorDescriptor& outputDesc,
+                     U* output,
+                     int32_t dim)
 {
-    auto dims              = ref_output.desc.GetLengths();
-    size_t output_dim_size = dims[dim];
-    size_t outer_size      = 1;
-    size_t inner_size      = 1;
-    size_t i               = 0;
-    for(; i < dim; i++)
+    const auto& out_strides = outputDesc.GetStrides();
+    size_t start            = 0;
+    for(size_t i = 0; i < inputs.size(); ++i)
     {
-        outer_size *= dims[i];
+        const auto& lengths = inputDescs[i]->GetLengths();
+        const auto& strides = inputDescs[i]->GetStrides();
+        auto plan           = cpu_copy_plan{};
+        for(size_t d = 0; d < lengths.size(); ++d)
+            plan.add(lengths[d], strides[d], out_strides[d]);
+        plan.run(inputs[i], output + start * out_strides[dim]);
+        start += lengths[dim];
     }
+}
 
-    for(; i < dims.size(); i++)
+template <class T>
+void cpu_cat_forward(const std::vector<tensor<T>>& inputs, tensor<T>& ref_output, int32_t dim)
+{
+    auto descs = std::vector<const miopen::TensorDescriptor*>{};
+    auto data  = std::vector<const T*>{};
+    for(const auto& input : inputs)
     {
-        inner_size *= dims[i];
+        descs.push_back(&input.desc);
+        data.push_back(input.data.data());
     }
-
-    size_t output_start_offset = 0;
-
-    par_ford(inputs.size())([&](int32_t i) {
-        auto input        = inputs[i];
-        size_t dim_size   = inputs[i].desc.GetLengths()[dim];
-        size_t copy_size  = inner_size / output_dim_size * dim_size;
-        size_t input_size = outer_size * copy_size;
-        ford(input_size)([&](int32_t o) {
-            size_t outer_idx = o / copy_size;
-            size_t copy_idx  = o % copy_size;
-            ref_output[output_start_offset + (outer_idx * inner_size) + copy_idx] =
-                input[copy_size * outer_idx + copy_idx];
-        });
-
-        output_start_offset += copy_size;
-    });
+    cpu_cat_forward(descs, data, ref_output.desc, ref_output.data.data(), dim);
 }
 #endif
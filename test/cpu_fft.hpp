@@ -0,0 +1,275 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_FFT_HPP
+#define GUARD_CPU_FFT_HPP
+
+#include <miopen/conv/transform_plan.hpp>
+#include <miopen/errors.hpp>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+/// Host implementation of the FFT convolution with the tiling and the workspace layout of the
+/// fft solver (miopen::conv::FftPlan). Each stage can be run separately to inspect or compare a
+/// single kernel of the GPU pipeline.
+///
+/// Tensors are packed: x and y are NCHW, w is KCRS. The forward direction computes the
+/// correlation of x and w by multiplying with the conjugated filter spectrum. The backward data
+/// direction transforms dy instead of x and multiplies with the filter spectrum itself, dx being
+/// read from the result tiles at the offset of the padding. Frequencies are numbered row major
+/// in the half spectrum, tile_h x (tile_w / 2 + 1). The transforms go to their final, transposed
+/// places directly, as the GPU pipeline does for 7x7 images.
+
+namespace cpu_fft_detail {
+
+using complex = std::complex<double>;
+
+/// Naive DFT of the given size, accurate to double precision, the sizes are small.
+class dft
+{
+public:
+    dft(std::size_t size, bool inverse) : length(size), twiddles(size)
+    {
+        const auto turn = (inverse ? 2.0 : -2.0) * std::acos(-1.0) / static_cast<double>(size);
+        for(std::size_t i = 0; i < size; ++i)
+            twiddles[i] = std::polar(1.0, turn * static_cast<double>(i));
+    }
+
+    /// out[i * out_stride] = sum_j in[j * in_stride] * twiddle(i * j).
+    void operator()(const complex* in,
+                    std::size_t in_stride,
+                    complex* out,
+                    std::size_t out_stride,
+                    std::size_t count) const
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            auto sum = complex{};
+            for(std::size_t j = 0; j < length; ++j)
+                sum += in[j * in_stride] * twiddles[(i * j) % length];
+            out[i * out_stride] = sum;
+        }
+    }
+
+private:
+    std::size_t length;
+    std::vector<complex> twiddles;
+};
+
+/// Real to complex 2D transform of a tile_h x tile_w tile into tile_h x (tile_w / 2 + 1).
+inline void forward(const miopen::conv::FftPlan& plan,
+                    const std::vector<double>& tile,
+                    std::vector<complex>& spectrum)
+{
+    const auto h     = static_cast<std::size_t>(plan.tile_h);
+    const auto w     = static_cast<std::size_t>(plan.tile_w);
+    const auto half  = w / 2 + 1;
+    const auto rows  = dft{w, false};
+    const auto cols  = dft{h, false};
+    auto input       = std::vector<complex>(tile.begin(), tile.end());
+    auto transformed = std::vector<complex>(h * half);
+
+    for(std::size_t i = 0; i < h; ++i)
+        rows(&input[i * w], 1, &transformed[i * half], 1, half);
+    spectrum.resize(h * half);
+    for(std::size_t j = 0; j < half; ++j)
+        cols(&transformed[j], half, &spectrum[j], half, h);
+}
+
+/// Inverse of forward(), normalized.
+inline void inverse(const miopen::conv::FftPlan& plan,
+                    const std::vector<complex>& spectrum,
+                    std::vector<double>& tile)
+{
+    const auto h    = static_cast<std::size_t>(plan.tile_h);
+    const auto w    = static_cast<std::size_t>(plan.tile_w);
+    const auto half = w / 2 + 1;
+    const auto rows = dft{w, true};
+    const auto cols = dft{h, true};
+    auto columns    = std::vector<complex>(h * half);
+    auto full       = std::vector<complex>(h * w);
+    auto result     = std::vector<complex>(h * w);
+
+    for(std::size_t j = 0; j < half; ++j)
+        cols(&spectrum[j], half, &columns[j], half, h);
+    // Each row is now the spectrum of a real row: restores its other half from the symmetry.
+    for(std::size_t i = 0; i < h; ++i)
+        for(std::size_t j = 0; j < w; ++j)
+            full[i * w + j] =
+                j < half ? columns[i * half + j] : std::conj(columns[i * half + (w - j)]);
+    for(std::size_t i = 0; i < h; ++i)
+        rows(&full[i * w], 1, &result[i * w], 1, w);
+
+    tile.resize(h * w);
+    const auto scale = 1.0 / static_cast<double>(h * w);
+    for(std::size_t i = 0; i < h * w; ++i)
+        tile[i] = result[i].real() * scale;
+}
+
+inline void check(const miopen::conv::FftPlan& plan)
+{
+    if(!plan.IsSupported())
+        MIOPEN_THROW("The FFT tile does not fit the problem");
+}
+
+} // namespace cpu_fft_detail
+
+/// Transforms the source images (x, or dy for the backward data direction) placed into zero
+/// tiles: x at the offset of the padding, dy at the origin.
+template <class T>
+void cpu_fft_source_transform(const miopen::conv::FftPlan& plan,
+                              const T* src,
+                              std::complex<float>* workspace)
+{
+    cpu_fft_detail::check(plan);
+    const auto h        = plan.backward_data ? plan.out_h : plan.in_h;
+    const auto w        = plan.backward_data ? plan.out_w : plan.in_w;
+    const auto top      = plan.backward_data ? 0 : static_cast<std::size_t>(plan.pad_h);
+    const auto left     = plan.backward_data ? 0 : static_cast<std::size_t>(plan.pad_w);
+    const auto channels = plan.GetSourceChannels();
+    const auto stride   = plan.GetSourceStride();
+    auto tile           = std::vector<double>(plan.tile_h * plan.tile_w);
+    auto spectrum       = std::vector<cpu_fft_detail::complex>{};
+
+    for(std::size_t image = 0; image < plan.n * channels; ++image)
+    {
+        std::fill(tile.begin(), tile.end(), 0.0);
+        for(std::size_t i = 0; i < h; ++i)
+            for(std::size_t j = 0; j < w; ++j)
+                tile[(top + i) * plan.tile_w + left + j] =
+                    static_cast<double>(src[(image * h + i) * w + j]);
+
+        cpu_fft_detail::forward(plan, tile, spectrum);
+        for(std::size_t f = 0; f < plan.frequencies; ++f)
+            workspace[plan.GetSourceOffset() + f * stride + image] =
+                std::complex<float>(spectrum[f]);
+    }
+}
+
+/// Transforms the filters placed at the origin of zero tiles.
+template <class T>
+void cpu_fft_filter_transform(const miopen::conv::FftPlan& plan,
+                              const T* w,
+                              std::complex<float>* workspace)
+{
+    cpu_fft_detail::check(plan);
+    const auto stride = plan.GetFilterStride();
+    auto tile         = std::vector<double>(plan.tile_h * plan.tile_w);
+    auto spectrum     = std::vector<cpu_fft_detail::complex>{};
+
+    for(std::size_t filter = 0; filter < plan.k * plan.c; ++filter)
+    {
+        std::fill(tile.begin(), tile.end(), 0.0);
+        for(std::size_t i = 0; i < plan.wei_h; ++i)
+            for(std::size_t j = 0; j < plan.wei_w; ++j)
+                tile[i * plan.tile_w + j] =
+                    static_cast<double>(w[(filter * plan.wei_h + i) * plan.wei_w + j]);
+
+        cpu_fft_detail::forward(plan, tile, spectrum);
+        for(std::size_t f = 0; f < plan.frequencies; ++f)
+            workspace[plan.GetFilterOffset() + f * stride + filter] =
+                std::complex<float>(spectrum[f]);
+    }
+}
+
+/// The complex GEMMs batched over the frequencies. Forward: result[n][k] is the sum over c of
+/// src[n][c] * conj(w[k][c]). Backward data: result[n][c] is the sum over k of src[n][k] *
+/// w[k][c].
+inline void cpu_fft_cgemm(const miopen::conv::FftPlan& plan, std::complex<float>* workspace)
+{
+    const auto src_channels = plan.GetSourceChannels();
+    const auto res_channels = plan.GetResultChannels();
+
+    for(std::size_t f = 0; f < plan.frequencies; ++f)
+    {
+        const auto* src = workspace + plan.GetSourceOffset() + f * plan.GetSourceStride();
+        const auto* wei = workspace + plan.GetFilterOffset() + f * plan.GetFilterStride();
+        auto* result    = workspace + plan.GetResultOffset() + f * plan.GetResultStride();
+
+        for(std::size_t n = 0; n < plan.n; ++n)
+        {
+            for(std::size_t o = 0; o < res_channels; ++o)
+            {
+                auto sum = cpu_fft_detail::complex{};
+                for(std::size_t i = 0; i < src_channels; ++i)
+                {
+                    const auto x = cpu_fft_detail::complex(src[n * src_channels + i]);
+                    sum += plan.backward_data
+                               ? x * cpu_fft_detail::complex(wei[i * plan.c + o])
+                               : x * std::conj(cpu_fft_detail::complex(wei[o * plan.c + i]));
+                }
+                result[n * res_channels + o] = std::complex<float>(sum);
+            }
+        }
+    }
+}
+
+/// Transforms the products back and writes y, or dx for the backward data direction.
+template <class T>
+void cpu_fft_result_transform(const miopen::conv::FftPlan& plan,
+                              const std::complex<float>* workspace,
+                              T* dst)
+{
+    cpu_fft_detail::check(plan);
+    const auto h        = plan.backward_data ? plan.in_h : plan.out_h;
+    const auto w        = plan.backward_data ? plan.in_w : plan.out_w;
+    const auto top      = plan.backward_data ? static_cast<std::size_t>(plan.pad_h) : 0;
+    const auto left     = plan.backward_data ? static_cast<std::size_t>(plan.pad_w) : 0;
+    const auto channels = plan.GetResultChannels();
+    const auto stride   = plan.GetResultStride();
+    auto spectrum       = std::vector<cpu_fft_detail::complex>(plan.frequencies);
+    auto tile           = std::vector<double>{};
+
+    for(std::size_t image = 0; image < plan.n * channels; ++image)
+    {
+        for(std::size_t f = 0; f < plan.frequencies; ++f)
+            spectrum[f] = workspace[plan.GetResultOffset() + f * stride + image];
+
+        cpu_fft_detail::inverse(plan, spectrum, tile);
+        for(std::size_t i = 0; i < h; ++i)
+            for(std::size_t j = 0; j < w; ++j)
+                dst[(image * h + i) * w + j] =
+                    static_cast<T>(tile[(top + i) * plan.tile_w + left + j]);
+    }
+}
+
+/// Runs the whole pipeline. The workspace holds plan.GetWorkspaceSize() bytes.
+template <class T>
+void cpu_fft_convolution(const miopen::conv::FftPlan& plan,
+                         const T* src,
+                         const T* w,
+                         T* dst,
+                         std::complex<float>* workspace)
+{
+    cpu_fft_source_transform(plan, src, workspace);
+    cpu_fft_filter_transform(plan, w, workspace);
+    cpu_fft_cgemm(plan, workspace);
+    cpu_fft_result_transform(plan, workspace, dst);
+}
+
+#endif // GUARD_CPU_FFT_HPP
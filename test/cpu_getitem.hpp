@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_GETITEM_HPP
+#define GUARD_CPU_GETITEM_HPP
+
+#include "cpu_strided_copy.hpp"
+#include "tensor_view.hpp"
+
+#include <miopen/tensor_view_utils.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/// dx[getitem position of i] += dy[i] for every element of dy.
+///
+/// The dims of dx listed in dims are indexed by the index tensors, which become a single dim of
+/// dy starting at dims[0]; the dims of dx after the last indexed one follow it. dx_tv is the
+/// view before slicing. Out of range indices set error[j] to -1 and are treated as 0.
+/// Repeated indices accumulate, the dy dim they come from is processed by a single thread.
+template <class T, class U>
+void cpu_getitem_backward(const T* dy,
+                          const tensor_view_t<5>& dy_tv,
+                          uint32_t indexCount,
+                          const int32_t* const* indexs,
+                          size_t index_numel,
+                          U* dx,
+                          tensor_view_t<5> dx_tv,
+                          int32_t* error,
+                          const int32_t* dims,
+                          uint32_t sliceCount,
+                          const int32_t* slices)
+{
+    const auto start_dim = indexCount > 0 ? dims[0] : 0;
+    const auto last_dim  = indexCount > 0 ? dims[indexCount - 1] : 0;
+
+    // The bounds are checked on the unsliced dims as the kernel does.
+    auto index_bounds = std::vector<int64_t>(indexCount);
+    for(uint32_t j = 0; j < indexCount; ++j)
+        index_bounds[j] = static_cast<int64_t>(dx_tv.size[dims[j]]);
+    miopen::slice_tv<5>(dx_tv, sliceCount, slices);
+
+    // Source dim of dy for each dim of dx, -1 for the indexed ones.
+    int dy_dim[5];
+    for(int e = 0; e < 5; ++e)
+    {
+        dy_dim[e] = e;
+        if(indexCount == 0)
+            continue;
+        if(std::find(dims, dims + indexCount, e) != dims + indexCount)
+            dy_dim[e] = -1;
+        else if(e > last_dim)
+            dy_dim[e] = e - last_dim + start_dim;
+    }
+
+    size_t dst_strides[5] = {};
+    for(int e = 0; e < 5; ++e)
+    {
+        if(dy_dim[e] >= 0)
+            dst_strides[dy_dim[e]] += dx_tv.stride[e];
+    }
+
+    auto plan = cpu_copy_plan{};
+    for(int d = 0; d < 5; ++d)
+    {
+        if(indexCount == 0 || d != start_dim)
+        {
+            plan.add(dy_tv.size[d], dy_tv.stride[d], dst_strides[d]);
+            continue;
+        }
+
+        auto offsets = std::vector<size_t>(dy_tv.size[d]);
+        for(uint32_t j = 0; j < indexCount; ++j)
+        {
+            const auto bound = index_bounds[j];
+            for(size_t o = 0; o < index_numel; ++o)
+            {
+                int64_t index = indexs[j][o];
+                if(index < -bound || index >= bound)
+                {
+                    error[j] = -1;
+                    continue;
+                }
+                if(index < 0)
+                    index += bound;
+                if(o < offsets.size())
+                    offsets[o] += static_cast<size_t>(index) * dx_tv.stride[dims[j]];
+            }
+        }
+        plan.add_scatter(dy_tv.stride[d], std::move(offsets));
+    }
+
+    plan.run(dy, dx, cpu_copy_add{});
+}
+
+#endif // GUARD_CPU_GETITEM_HPP
@@ -26,6 +26,7 @@
 #ifndef GUARD_CPU_GROUPNORM_HPP
 #define GUARD_CPU_GROUPNORM_HPP
 
+#include "cpu_norm.hpp"
 #include "tensor_holder.hpp"
 
 template <class T>
@@ -39,40 +40,15 @@ void cpu_groupnorm_forward(tensor<T> input,
                            float eps,
                            miopenNormMode_t mode)
 {
-    auto dims = input.desc.GetLengths();
-
-    size_t numel             = input.desc.GetElementSize();
-    size_t numel_per_channel = numel / dims[0] / dims[1];
-    size_t num_channels      = dims[1];
-
-    size_t outer_size = dims[0] * num_groups;
-    size_t inner_size = numel / outer_size;
-
-    par_ford(outer_size)([&](int32_t o) {
-        T mean_v = 0.0f;
-        T var_v  = 0.0f;
-
-        ford(inner_size)([&](int32_t i) {
-            T tmp = input[o * inner_size + i];
-            mean_v += tmp;
-            var_v += tmp * tmp;
-        });
-
-        mean_v   = mean_v / inner_size;
-        var_v    = var_v / inner_size - mean_v * mean_v;
-        T rstd_v = 1.0f / sqrt(var_v + eps);
-
-        ref_mean[o] = mean_v;
-        ref_rstd[o] = rstd_v;
-
-        ford(inner_size)([&](int32_t i) {
-            size_t idx = o * inner_size + i;
-            size_t c   = (idx / numel_per_channel) % num_channels;
-            T weight_v = mode ? weight[c] : 1;
-            T bias_v   = mode ? bias[c] : 0;
-
-            ref_output[idx] = (input[idx] - mean_v) * rstd_v * weight_v + bias_v;
-        });
-    });
+    cpu_norm_forward(cpu_norm_layout::group(input.desc.GetLengths(), num_groups),
+                     cpu_norm_kind::standard,
+                     input.data.data(),
+                     static_cast<const T*>(nullptr),
+                     mode ? weight.data.data() : nullptr,
+                     mode ? bias.data.data() : nullptr,
+                     eps,
+                     ref_output.data.data(),
+                     ref_mean.data.data(),
+                     ref_rstd.data.data());
 }
 #endif
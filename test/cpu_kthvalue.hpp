@@ -26,56 +26,137 @@
 
 #pragma once
 
+#include "cpu_parallel.hpp"
 #include "tensor_holder.hpp"
 #include "tensor_view.hpp"
 
+#include <miopen/errors.hpp>
 #include <miopen/tensor_view_utils.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <vector>
 
-template <typename TIO>
-void cpu_kthvalue(tensor<TIO> input,
-                  tensor<TIO>& outputHost,
-                  std::vector<size_t>& indices,
-                  miopen::TensorDescriptor indiceDesc,
-                  size_t k,
-                  int dim)
-{
-    size_t inputSize       = input.desc.GetElementSize();
-    size_t dimSize         = input.desc.GetLengths()[dim];
-    size_t dimStride       = input.desc.GetStrides()[dim];
-    auto inputTv           = miopen::get_inner_expanded_tv<5>(input.desc);
-    auto inputTvWithoutDim = miopen::get_tv_without_dim<5>(inputTv, dim);
-    auto outputTv          = miopen::get_inner_expanded_tv<5>(outputHost.desc);
-    auto indicesTv         = miopen::get_inner_expanded_tv<5>(indiceDesc);
+namespace cpu_kthvalue_detail {
 
-    size_t numSlice = inputSize / dimSize;
+/// Orders values as the radix encoding of the kernel does: -0 below +0 and NaN above +inf.
+inline uint32_t radix_key(float v)
+{
+    if(std::isnan(v))
+        return std::numeric_limits<uint32_t>::max();
+    uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits ^ ((bits & 0x80000000u) != 0 ? 0xffffffffu : 0x80000000u);
+}
 
-    std::vector<float> elements;
-    std::vector<size_t> ids(dimSize);
-    for(int i = 0; i < dimSize; ++i)
+/// Returns the position of the k-th smallest (1-based) of n values at x[i * stride].
+/// The keys are packed with the positions, so equal values are ordered by position and the
+/// result is the first occurrence. The kernel may return any of the equal values.
+template <typename TIO>
+size_t select_kth(const TIO* x, size_t n, size_t stride, size_t k, std::vector<uint64_t>& keys)
+{
+    keys.resize(n);
+    if(stride == 1)
     {
-        ids[i] = i;
+        for(size_t i = 0; i < n; ++i)
+            keys[i] = (uint64_t{radix_key(static_cast<float>(x[i]))} << 32) | i;
     }
-
-    for(int slideID = 0; slideID < numSlice; ++slideID)
+    else
     {
-        elements.clear();
-        tensor_layout_t<4> layout(inputTvWithoutDim, slideID);
-        auto idx = inputTvWithoutDim.get_tensor_view_idx(layout);
+        for(size_t i = 0; i < n; ++i)
+            keys[i] = (uint64_t{radix_key(static_cast<float>(x[i * stride]))} << 32) | i;
+    }
+
+    if(k == 1)
+        return *std::min_element(keys.begin(), keys.end()) & 0xffffffffu;
+    if(k == n)
+        return *std::max_element(keys.begin(), keys.end()) & 0xffffffffu;
+    const auto kth = keys.begin() + (k - 1);
+    std::nth_element(keys.begin(), kth, keys.end());
+    return *kth & 0xffffffffu;
+}
+
+} // namespace cpu_kthvalue_detail
+
+/// Finds the k-th smallest value along dim for every slice, in parallel over slices.
+/// Uses selection instead of sorting, O(n) per slice on average.
+template <typename TIO>
+void cpu_kthvalue(const TIO* input,
+                  tensor_view_t<5> inputTv,
+                  TIO* output,
+                  tensor_view_t<5> outputTv,
+                  size_t* indices,
+                  tensor_view_t<5> indicesTv,
+                  size_t k,
+                  int dim)
+{
+    const size_t dimSize   = inputTv.size[dim];
+    const size_t dimStride = inputTv.stride[dim];
+    if(k < 1 || k > dimSize)
+        MIOPEN_THROW(miopenStatusBadParm, "Kthvalue: k is out of range");
+    if(dimSize > std::numeric_limits<uint32_t>::max())
+        MIOPEN_THROW(miopenStatusBadParm, "Kthvalue: the selected dimension is too large");
+
+    const auto inputTvWithoutDim = miopen::get_tv_without_dim<5>(inputTv, dim);
 
-        for(int j = 0; j < dimSize; ++j)
+    size_t numSlice = 1;
+    for(auto size : inputTvWithoutDim.size)
+        numSlice *= size;
+    cpu_par_ranges(numSlice, [&](size_t first, size_t last) {
+        auto inTv  = inputTvWithoutDim;
+        auto outTv = outputTv;
+        auto idxTv = indicesTv;
+        auto keys  = std::vector<uint64_t>{};
+        for(auto sliceID = first; sliceID < last; ++sliceID)
         {
-            elements.push_back(static_cast<float>(input[idx + j * dimStride]));
+            const auto* slice =
+                input + inTv.get_tensor_view_idx(tensor_layout_t<4>(inTv, sliceID));
+            const auto id = cpu_kthvalue_detail::select_kth(slice, dimSize, dimStride, k, keys);
+
+            output[outTv.get_tensor_view_idx(tensor_layout_t<5>(outTv, sliceID))] =
+                slice[id * dimStride];
+            indices[idxTv.get_tensor_view_idx(tensor_layout_t<5>(idxTv, sliceID))] = id;
         }
+    });
+}
 
-        std::sort(ids.begin(), ids.end(), [=](size_t x, size_t y) -> bool {
-            return elements[x] < elements[y];
-        });
-        auto output_layout  = tensor_layout_t<5>(outputTv, slideID);
-        auto indices_layout = tensor_layout_t<5>(indicesTv, slideID);
-        outputHost[outputTv.get_tensor_view_idx(output_layout)] =
-            static_cast<TIO>(elements[ids[k - 1]]);
-        indices[indicesTv.get_tensor_view_idx(indices_layout)] = ids[k - 1];
-    }
+template <typename TIO>
+void cpu_kthvalue(const TIO* input,
+                  const miopen::TensorDescriptor& inputDesc,
+                  TIO* output,
+                  const miopen::TensorDescriptor& outputDesc,
+                  size_t* indices,
+                  const miopen::TensorDescriptor& indiceDesc,
+                  size_t k,
+                  int dim)
+{
+    cpu_kthvalue(input,
+                 miopen::get_inner_expanded_tv<5>(inputDesc),
+                 output,
+                 miopen::get_inner_expanded_tv<5>(outputDesc),
+                 indices,
+                 miopen::get_inner_expanded_tv<5>(indiceDesc),
+                 k,
+                 dim);
+}
+
+template <typename TIO>
+void cpu_kthvalue(const tensor<TIO>& input,
+                  tensor<TIO>& outputHost,
+                  std::vector<size_t>& indices,
+                  const miopen::TensorDescriptor& indiceDesc,
+                  size_t k,
+                  int dim)
+{
+    cpu_kthvalue(input.data.data(),
+                 input.desc,
+                 outputHost.data.data(),
+                 outputHost.desc,
+                 indices.data(),
+                 indiceDesc,
+                 k,
+                 dim);
 }
@@ -0,0 +1,373 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_NORM_HPP
+#define GUARD_CPU_NORM_HPP
+
+#include "cpu_parallel.hpp"
+
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+/// Host references of LayerNorm, AddLayerNorm, T5LayerNorm (RMS) and GroupNorm.
+///
+/// A tensor is viewed as `outer` rows of `inner` contiguous elements normalized independently.
+/// Affine parameters are shared by `span` consecutive elements of a row, and row `o` uses
+/// `inner / span` parameters starting at `(o % phases) * inner / span`:
+///  - layer norm: span 1, one phase, the parameters cover the normalized dims;
+///  - group norm: span is the spatial size, one phase per group, a parameter per channel.
+///
+/// Mean and variance are computed in a single pass over the row shifted by its first element,
+/// with float lanes inside short blocks and double accumulators across blocks, so the loops
+/// vectorize while the result stays accurate for long rows with a large offset. Rows and
+/// parameters are processed in parallel.
+struct cpu_norm_layout
+{
+    std::size_t outer  = 1;
+    std::size_t inner  = 1;
+    std::size_t span   = 1;
+    std::size_t phases = 1;
+
+    /// Normalizes over the dims starting from normalized_dim.
+    static cpu_norm_layout layer(const std::vector<std::size_t>& lengths,
+                                 std::size_t normalized_dim)
+    {
+        cpu_norm_layout layout;
+        for(std::size_t i = 0; i < lengths.size(); ++i)
+            (i < normalized_dim ? layout.outer : layout.inner) *= lengths[i];
+        return layout;
+    }
+
+    /// NC... tensor, the channels are split into num_groups groups.
+    static cpu_norm_layout group(const std::vector<std::size_t>& lengths, std::size_t num_groups)
+    {
+        assert(lengths.size() >= 2 && lengths[1] % num_groups == 0);
+        cpu_norm_layout layout;
+        for(std::size_t i = 2; i < lengths.size(); ++i)
+            layout.span *= lengths[i];
+        layout.outer  = lengths[0] * num_groups;
+        layout.inner  = lengths[1] / num_groups * layout.span;
+        layout.phases = num_groups;
+        return layout;
+    }
+
+    std::size_t params_per_row() const { return inner / span; }
+    std::size_t first_param(std::size_t row) const { return (row % phases) * params_per_row(); }
+};
+
+enum class cpu_norm_kind
+{
+    /// (x - mean) * rstd, rstd = 1 / sqrt(var + eps)
+    standard,
+    /// x * rstd, rstd = 1 / sqrt(mean(x^2) + eps), as T5LayerNorm
+    rms,
+};
+
+namespace cpu_norm_detail {
+
+constexpr std::size_t lanes = 8;
+constexpr std::size_t block = 256;
+
+/// Adds the sums of v and v * v over a block, v = x - shift. The lanes are independent so the
+/// loop vectorizes in float without reassociation by the compiler, and a block is short enough
+/// for float lanes to stay accurate. The block totals are accumulated in double.
+inline void block_sums(const float* x, std::size_t n, float shift, double& s1, double& s2)
+{
+    float acc1[lanes] = {};
+    float acc2[lanes] = {};
+    std::size_t i     = 0;
+    for(; i + lanes <= n; i += lanes)
+    {
+        for(std::size_t l = 0; l < lanes; ++l)
+        {
+            const auto v = x[i + l] - shift;
+            acc1[l] += v;
+            acc2[l] += v * v;
+        }
+    }
+    for(; i < n; ++i)
+    {
+        const auto v = x[i] - shift;
+        s1 += v;
+        s2 += v * v;
+    }
+    for(std::size_t l = 0; l < lanes; ++l)
+    {
+        s1 += acc1[l];
+        s2 += acc2[l];
+    }
+}
+
+/// Sum of f(i) over [0, n), blocked as block_sums.
+template <class F>
+double blocked_sum(std::size_t n, F f)
+{
+    double sum = 0;
+    for(std::size_t b = 0; b < n; b += block)
+    {
+        const auto last  = std::min(n, b + block);
+        float acc[lanes] = {};
+        std::size_t i    = b;
+        for(; i + lanes <= last; i += lanes)
+        {
+            for(std::size_t l = 0; l < lanes; ++l)
+                acc[l] += f(i + l);
+        }
+        for(; i < last; ++i)
+            sum += f(i);
+        for(const auto a : acc)
+            sum += a;
+    }
+    return sum;
+}
+
+struct moments
+{
+    double mean = 0;
+    double var  = 0;
+    float shift = 0;
+};
+
+/// The data is shifted by its first element, so a row with a large offset does not lose
+/// the variance to cancellation.
+inline moments row_moments(const float* x, std::size_t n, cpu_norm_kind kind)
+{
+    if(n == 0)
+        return {};
+
+    const auto shift = kind == cpu_norm_kind::rms ? 0.f : x[0];
+    double s1        = 0;
+    double s2        = 0;
+    for(std::size_t b = 0; b < n; b += block)
+        block_sums(x + b, std::min(block, n - b), shift, s1, s2);
+
+    if(kind == cpu_norm_kind::rms)
+        return {0, s2 / n, 0};
+    const auto m = s1 / n;
+    return {shift + m, std::max(0.0, s2 / n - m * m), shift};
+}
+
+/// Returns the row (plus the row of x2 if any) as floats. Float rows are read in place.
+template <class T>
+const float* load_row(const T* x, const T* x2, std::size_t n, std::vector<float>& buffer)
+{
+    if constexpr(std::is_same_v<T, float>)
+    {
+        if(x2 == nullptr)
+            return x;
+    }
+    for(std::size_t i = 0; i < n; ++i)
+        buffer[i] = static_cast<float>(x[i]);
+    if(x2 != nullptr)
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            buffer[i] += static_cast<float>(x2[i]);
+    }
+    return buffer.data();
+}
+
+} // namespace cpu_norm_detail
+
+/// y = norm(x + x2) * weight + bias. x2, weight, bias, mean and rstd may be null,
+/// missing weight and bias are ones and zeros.
+template <class T, class U>
+void cpu_norm_forward(const cpu_norm_layout& layout,
+                      cpu_norm_kind kind,
+                      const T* x,
+                      const T* x2,
+                      const T* weight,
+                      const T* bias,
+                      float eps,
+                      U* y,
+                      U* mean,
+                      U* rstd)
+{
+    const auto inner = layout.inner;
+    const auto span  = layout.span;
+
+    cpu_for_each_row(layout.outer, 1, inner, [&](std::size_t o, auto& scratch) {
+        const auto* row = cpu_norm_detail::load_row(
+            x + o * inner, x2 != nullptr ? x2 + o * inner : nullptr, inner, scratch[0]);
+
+        const auto stats  = cpu_norm_detail::row_moments(row, inner, kind);
+        const auto rstd_v = static_cast<float>(1.0 / std::sqrt(stats.var + eps));
+        if(mean != nullptr)
+            mean[o] = static_cast<U>(stats.mean);
+        if(rstd != nullptr)
+            rstd[o] = static_cast<U>(rstd_v);
+
+        // x - shift is exact for the values close to the shift, and the rest of the mean is
+        // small, so the centered values keep their precision for rows with a large offset.
+        const auto shift  = stats.shift;
+        const auto delta  = static_cast<float>(stats.mean - shift);
+        auto* dst         = y + o * inner;
+        const auto first  = layout.first_param(o);
+        const auto params = layout.params_per_row();
+        if(span == 1)
+        {
+            // A parameter per element: keep the loop over the row innermost.
+            for(std::size_t i = 0; i < inner; ++i)
+            {
+                const auto w = weight != nullptr ? static_cast<float>(weight[first + i]) : 1.f;
+                const auto b = bias != nullptr ? static_cast<float>(bias[first + i]) : 0.f;
+                dst[i]       = static_cast<U>(((row[i] - shift) - delta) * rstd_v * w + b);
+            }
+            return;
+        }
+        for(std::size_t p = 0; p < params; ++p)
+        {
+            const auto w     = weight != nullptr ? static_cast<float>(weight[first + p]) : 1.f;
+            const auto b     = bias != nullptr ? static_cast<float>(bias[first + p]) : 0.f;
+            const auto scale = rstd_v * w;
+            for(auto i = p * span; i < (p + 1) * span; ++i)
+                dst[i] = static_cast<U>(((row[i] - shift) - delta) * scale + b);
+        }
+    });
+}
+
+/// dx of cpu_norm_forward from the saved mean (ignored for rms) and rstd.
+/// weight may be null.
+template <class T, class M, class U>
+void cpu_norm_backward(const cpu_norm_layout& layout,
+                       cpu_norm_kind kind,
+                       const T* dy,
+                       const T* x,
+                       const T* weight,
+                       const M* mean,
+                       const M* rstd,
+                       U* dx)
+{
+    const auto inner = layout.inner;
+    const auto span  = layout.span;
+
+    cpu_for_each_row(layout.outer, 2, inner, [&](std::size_t o, auto& scratch) {
+        auto& xhat = scratch[0];
+        auto& g    = scratch[1];
+
+        const auto mean_v = kind == cpu_norm_kind::rms ? 0.f : static_cast<float>(mean[o]);
+        const auto rstd_v = static_cast<float>(rstd[o]);
+        const auto first  = layout.first_param(o);
+        const auto params = layout.params_per_row();
+        const auto* x_row  = x + o * inner;
+        const auto* dy_row = dy + o * inner;
+        for(std::size_t i = 0; i < inner; ++i)
+        {
+            xhat[i] = (static_cast<float>(x_row[i]) - mean_v) * rstd_v;
+            g[i]    = static_cast<float>(dy_row[i]);
+        }
+        if(weight != nullptr)
+        {
+            for(std::size_t p = 0; p < params; ++p)
+            {
+                const auto w = static_cast<float>(weight[first + p]);
+                for(auto i = p * span; i < (p + 1) * span; ++i)
+                    g[i] *= w;
+            }
+        }
+
+        const auto* gp = g.data();
+        const auto* xp = xhat.data();
+        double sum_g   = 0;
+        if(kind == cpu_norm_kind::standard)
+            sum_g = cpu_norm_detail::blocked_sum(inner, [=](auto i) { return gp[i]; });
+        const auto sum_gx =
+            cpu_norm_detail::blocked_sum(inner, [=](auto i) { return gp[i] * xp[i]; });
+
+        const auto c1 = static_cast<float>(sum_g / inner);
+        const auto c2 = static_cast<float>(sum_gx / inner);
+        auto* dst     = dx + o * inner;
+        for(std::size_t i = 0; i < inner; ++i)
+            dst[i] = static_cast<U>(rstd_v * (g[i] - c1 - xhat[i] * c2));
+    });
+}
+
+/// Weight and bias gradients: sums of dy * norm(x) and dy over the elements sharing
+/// a parameter. dw or db may be null.
+template <class T, class M, class U>
+void cpu_norm_backward_weight_bias(const cpu_norm_layout& layout,
+                                   cpu_norm_kind kind,
+                                   const T* dy,
+                                   const T* x,
+                                   const M* mean,
+                                   const M* rstd,
+                                   U* dw,
+                                   U* db)
+{
+    const auto inner  = layout.inner;
+    const auto span   = layout.span;
+    const auto params = layout.params_per_row();
+    // Consecutive parameters handled by a task, so that the rows are read in long runs.
+    const auto chunk  = std::min(params, std::max<std::size_t>(1, cpu_norm_detail::block / span));
+    const auto chunks = (params + chunk - 1) / chunk;
+
+    miopen::par_for(layout.phases * chunks, miopen::min_grain{1}, [&](std::size_t task) {
+        const auto phase = task / chunks;
+        const auto begin = task % chunks * chunk;
+        const auto end   = std::min(params, begin + chunk);
+
+        auto sum_w = std::vector<double>(end - begin);
+        auto sum_b = std::vector<double>(end - begin);
+
+        for(auto o = phase; o < layout.outer; o += layout.phases)
+        {
+            const auto mean_v  = kind == cpu_norm_kind::rms ? 0.f : static_cast<float>(mean[o]);
+            const auto rstd_v  = static_cast<float>(rstd[o]);
+            const auto* dy_row = dy + o * inner;
+            const auto* x_row  = x + o * inner;
+
+            for(auto p = begin; p < end; ++p)
+            {
+                double acc_w = 0;
+                double acc_b = 0;
+                for(auto i = p * span; i < (p + 1) * span; ++i)
+                {
+                    const auto d    = static_cast<float>(dy_row[i]);
+                    const auto xhat = (static_cast<float>(x_row[i]) - mean_v) * rstd_v;
+                    acc_w += static_cast<double>(d) * xhat;
+                    acc_b += d;
+                }
+                sum_w[p - begin] += acc_w;
+                sum_b[p - begin] += acc_b;
+            }
+        }
+
+        const auto first = phase * params;
+        for(auto p = begin; p < end; ++p)
+        {
+            if(dw != nullptr)
+                dw[first + p] = static_cast<U>(sum_w[p - begin]);
+            if(db != nullptr)
+                db[first + p] = static_cast<U>(sum_b[p - begin]);
+        }
+    });
+}
+
+#endif // GUARD_CPU_NORM_HPP
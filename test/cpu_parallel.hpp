@@ -0,0 +1,64 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_PARALLEL_HPP
+#define GUARD_CPU_PARALLEL_HPP
+
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/// Splits [0, items) into contiguous ranges and calls f(first, last) for each of them in
+/// parallel. A call per worker, so f may set up the per-worker state once. There are a few
+/// workers per core to balance uneven items.
+template <class F>
+void cpu_par_ranges(std::size_t items, F f)
+{
+    const auto workers = std::max<std::size_t>(
+        1, std::min<std::size_t>(items, std::thread::hardware_concurrency() * 4));
+    const auto items_per_worker = (items + workers - 1) / workers;
+    miopen::par_for(workers, miopen::min_grain{1}, [&](std::size_t worker) {
+        const auto first = worker * items_per_worker;
+        const auto last  = std::min(items, first + items_per_worker);
+        if(first < last)
+            f(first, last);
+    });
+}
+
+/// Calls f(row, buffers) for every row, each worker reuses its float buffers.
+template <class F>
+void cpu_for_each_row(std::size_t rows, std::size_t buffers, std::size_t buffer_size, F f)
+{
+    cpu_par_ranges(rows, [&](std::size_t first, std::size_t last) {
+        auto scratch = std::vector<std::vector<float>>(buffers, std::vector<float>(buffer_size));
+        for(auto row = first; row < last; ++row)
+            f(row, scratch);
+    });
+}
+
+#endif // GUARD_CPU_PARALLEL_HPP
@@ -0,0 +1,405 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_SOFTMAX_HPP
+#define GUARD_CPU_SOFTMAX_HPP
+
+#include "cpu_parallel.hpp"
+
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+/// Host references of softmax and log-softmax (all algorithms and modes) and of the attention
+/// softmax.
+///
+/// A softmax problem is a set of rows normalized independently. Every row of a tensor has the
+/// same element offsets relative to its first element:
+///  - instance mode: a row per image, its elements are the CHW of the image;
+///  - channel mode: a row per (n, h, w), its elements are the channels.
+/// Strided rows are gathered into a float buffer, contiguous float rows are read in place.
+///
+/// Max and sum of exponents are computed in a single pass: each block of a row is reduced with
+/// its own max, and the blocks are merged online by rescaling the running sum. Exponents are
+/// computed by cpu_softmax_detail::fast_exp which vectorizes. Rows are processed in parallel.
+struct cpu_softmax_layout
+{
+    /// Offset of the first element of each row.
+    std::vector<std::size_t> rows;
+    /// Offsets of the row elements relative to the first one.
+    std::vector<std::size_t> elements;
+
+    /// NCHW lengths and strides.
+    static cpu_softmax_layout make(const std::vector<std::size_t>& lengths,
+                                   const std::vector<std::size_t>& strides,
+                                   miopenSoftmaxMode_t mode)
+    {
+        const auto n = lengths[0], c = lengths[1], h = lengths[2], w = lengths[3];
+        cpu_softmax_layout layout;
+        if(mode == MIOPEN_SOFTMAX_MODE_INSTANCE)
+        {
+            for(std::size_t in = 0; in < n; ++in)
+                layout.rows.push_back(in * strides[0]);
+            for(std::size_t ic = 0; ic < c; ++ic)
+                for(std::size_t ih = 0; ih < h; ++ih)
+                    for(std::size_t iw = 0; iw < w; ++iw)
+                        layout.elements.push_back(ic * strides[1] + ih * strides[2] +
+                                                  iw * strides[3]);
+        }
+        else
+        {
+            for(std::size_t in = 0; in < n; ++in)
+                for(std::size_t ih = 0; ih < h; ++ih)
+                    for(std::size_t iw = 0; iw < w; ++iw)
+                        layout.rows.push_back(in * strides[0] + ih * strides[2] +
+                                              iw * strides[3]);
+            for(std::size_t ic = 0; ic < c; ++ic)
+                layout.elements.push_back(ic * strides[1]);
+        }
+        return layout;
+    }
+
+    /// Packed rows of row_len elements.
+    static cpu_softmax_layout packed(std::size_t row_count, std::size_t row_len)
+    {
+        cpu_softmax_layout layout;
+        for(std::size_t r = 0; r < row_count; ++r)
+            layout.rows.push_back(r * row_len);
+        for(std::size_t i = 0; i < row_len; ++i)
+            layout.elements.push_back(i);
+        return layout;
+    }
+
+    bool contiguous() const
+    {
+        for(std::size_t i = 0; i < elements.size(); ++i)
+        {
+            if(elements[i] != i)
+                return false;
+        }
+        return true;
+    }
+};
+
+namespace cpu_softmax_detail {
+
+constexpr std::size_t lanes = 8;
+constexpr std::size_t block = 512;
+
+/// exp(x) with the relative error below 3e-7 (within 3 ulp) for x in [-87, 88]. Flushes to 0
+/// below the range, where the result would be denormal, and saturates above it. As std::exp,
+/// returns NaN for NaN, infinity for infinity and 0 for -infinity.
+///
+/// exp(x) = 2^k * exp(r), k = round(x / ln2), |r| <= ln2 / 2. exp(r) is the Taylor polynomial
+/// of degree 6, its truncation error is below 1.8e-7 on that interval. x and k are clamped on
+/// their integer representations: float comparisons keep GCC from vectorizing the callers
+/// unless -fno-trapping-math.
+inline float fast_exp(float x)
+{
+    constexpr float log2e            = 1.44269504f;
+    constexpr float ln2_hi           = 0.693145752f; // 11 significant bits, k * ln2_hi is exact
+    constexpr float ln2_lo           = 1.42860677e-6f;
+    constexpr float round            = 12582912.f;  // 1.5 * 2^23, adding it rounds to an integer
+    constexpr std::uint32_t abs_mask = 0x7fffffffu;
+    constexpr std::uint32_t max_abs  = 0x42b00000u; // 88.f
+    constexpr std::uint32_t inf_bits = 0x7f800000u;
+
+    std::uint32_t in_bits;
+    std::memcpy(&in_bits, &x, sizeof(x));
+    const auto x_bits = (in_bits & ~abs_mask) | std::min(in_bits & abs_mask, max_abs);
+    std::memcpy(&x, &x_bits, sizeof(x));
+
+    const auto k = (x * log2e + round) - round;
+    const auto r = (x - k * ln2_hi) - k * ln2_lo;
+
+    auto p = 1.f / 720;
+    p      = p * r + 1.f / 120;
+    p      = p * r + 1.f / 24;
+    p      = p * r + 1.f / 6;
+    p      = p * r + 0.5f;
+    p      = p * r + 1.f;
+    p      = p * r + 1.f;
+
+    // A zero biased exponent gives a zero scale.
+    const auto exponent = std::max(static_cast<std::int32_t>(k) + 127, 0);
+    const auto bits     = static_cast<std::uint32_t>(exponent) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    auto result = p * scale;
+
+    // NaN and infinity are returned as is, -infinity is flushed to 0 as the clamped value.
+    // Selected with a mask, branches or ternaries keep GCC from vectorizing.
+    const auto is_nan = static_cast<std::uint32_t>((in_bits & abs_mask) > inf_bits);
+    const auto is_inf = static_cast<std::uint32_t>(in_bits == inf_bits);
+    const auto mask   = std::uint32_t{0} - (is_nan | is_inf);
+    std::uint32_t result_bits;
+    std::memcpy(&result_bits, &result, sizeof(result));
+    result_bits = (in_bits & mask) | (result_bits & ~mask);
+    std::memcpy(&result, &result_bits, sizeof(result));
+    return result;
+}
+
+/// Maximum of a block.
+inline float block_max(const float* x, std::size_t n)
+{
+    float acc[lanes];
+    std::fill_n(acc, lanes, -std::numeric_limits<float>::infinity());
+    std::size_t i = 0;
+    for(; i + lanes <= n; i += lanes)
+    {
+        for(std::size_t l = 0; l < lanes; ++l)
+            acc[l] = std::max(acc[l], x[i + l]);
+    }
+    auto result = -std::numeric_limits<float>::infinity();
+    for(; i < n; ++i)
+        result = std::max(result, x[i]);
+    for(const auto a : acc)
+        result = std::max(result, a);
+    return result;
+}
+
+/// Sum of exp(x - shift) over a block, float lanes as in block_max.
+inline double block_exp_sum(const float* x, std::size_t n, float shift)
+{
+    float acc[lanes] = {};
+    std::size_t i    = 0;
+    for(; i + lanes <= n; i += lanes)
+    {
+        for(std::size_t l = 0; l < lanes; ++l)
+            acc[l] += fast_exp(x[i + l] - shift);
+    }
+    double result = 0;
+    for(; i < n; ++i)
+        result += fast_exp(x[i] - shift);
+    for(const auto a : acc)
+        result += a;
+    return result;
+}
+
+struct row_stats
+{
+    /// The max subtracted before exp, 0 for MIOPEN_SOFTMAX_FAST.
+    float max  = 0;
+    double sum = 0;
+};
+
+/// Max and sum of exp(x - max) in one pass, merging the blocks online.
+inline row_stats exp_stats(const float* x, std::size_t n, miopenSoftmaxAlgorithm_t algo)
+{
+    row_stats stats;
+    if(algo == MIOPEN_SOFTMAX_FAST)
+    {
+        for(std::size_t b = 0; b < n; b += block)
+            stats.sum += block_exp_sum(x + b, std::min(block, n - b), 0);
+        return stats;
+    }
+
+    stats.max = -std::numeric_limits<float>::infinity();
+    for(std::size_t b = 0; b < n; b += block)
+    {
+        const auto len = std::min(block, n - b);
+        const auto m   = block_max(x + b, len);
+        if(m > stats.max)
+        {
+            const auto s = block_exp_sum(x + b, len, m);
+            stats.sum    = stats.sum * std::exp(static_cast<double>(stats.max) - m) + s;
+            stats.max    = m;
+        }
+        else
+        {
+            stats.sum += block_exp_sum(x + b, len, stats.max);
+        }
+    }
+    return stats;
+}
+
+/// Returns the row as floats, reading a contiguous float row in place.
+template <class T>
+const float* load_row(const T* x,
+                      const cpu_softmax_layout& layout,
+                      bool contiguous,
+                      std::size_t row,
+                      std::vector<float>& buffer)
+{
+    const auto* src = x + layout.rows[row];
+    if constexpr(std::is_same_v<T, float>)
+    {
+        if(contiguous)
+            return src;
+    }
+    const auto n = layout.elements.size();
+    if(contiguous)
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            buffer[i] = static_cast<float>(src[i]);
+    }
+    else
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            buffer[i] = static_cast<float>(src[layout.elements[i]]);
+    }
+    return buffer.data();
+}
+
+/// dst = alpha * v + beta * dst, dst is not read if beta is 0.
+template <class U>
+void store_row(const float* v,
+               U* y,
+               const cpu_softmax_layout& layout,
+               std::size_t row,
+               float alpha,
+               float beta)
+{
+    auto* dst            = y + layout.rows[row];
+    const auto& elements = layout.elements;
+    const auto n         = elements.size();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        auto& out = dst[elements[i]];
+        out       = static_cast<U>(beta == 0 ? alpha * v[i]
+                                             : alpha * v[i] + beta * static_cast<float>(out));
+    }
+}
+
+} // namespace cpu_softmax_detail
+
+/// y = alpha * softmax(x) + beta * y, log-softmax for MIOPEN_SOFTMAX_LOG.
+/// MIOPEN_SOFTMAX_FAST does not subtract the max, as the kernels.
+template <class T, class U>
+void cpu_softmax_forward(const cpu_softmax_layout& x_layout,
+                         const cpu_softmax_layout& y_layout,
+                         miopenSoftmaxAlgorithm_t algo,
+                         const T* x,
+                         U* y,
+                         float alpha = 1,
+                         float beta  = 0)
+{
+    const auto n          = x_layout.elements.size();
+    const auto contiguous = x_layout.contiguous();
+
+    cpu_for_each_row(x_layout.rows.size(), 2, n, [&](std::size_t r, auto& scratch) {
+        const auto* row  = cpu_softmax_detail::load_row(x, x_layout, contiguous, r, scratch[0]);
+        const auto stats = cpu_softmax_detail::exp_stats(row, n, algo);
+        auto& result     = scratch[1];
+
+        if(algo == MIOPEN_SOFTMAX_LOG)
+        {
+            const auto shift = static_cast<float>(stats.max + std::log(stats.sum));
+            for(std::size_t i = 0; i < n; ++i)
+                result[i] = row[i] - shift;
+        }
+        else
+        {
+            const auto scale = static_cast<float>(1 / stats.sum);
+            for(std::size_t i = 0; i < n; ++i)
+                result[i] = cpu_softmax_detail::fast_exp(row[i] - stats.max) * scale;
+        }
+
+        cpu_softmax_detail::store_row(result.data(), y, y_layout, r, alpha, beta);
+    });
+}
+
+/// dx = alpha * dsoftmax + beta * dx from the forward output y and its gradient dy.
+template <class T, class U>
+void cpu_softmax_backward(const cpu_softmax_layout& y_layout,
+                          const cpu_softmax_layout& dx_layout,
+                          miopenSoftmaxAlgorithm_t algo,
+                          const T* y,
+                          const T* dy,
+                          U* dx,
+                          float alpha = 1,
+                          float beta  = 0)
+{
+    const auto n          = y_layout.elements.size();
+    const auto contiguous = y_layout.contiguous();
+
+    cpu_for_each_row(y_layout.rows.size(), 3, n, [&](std::size_t r, auto& scratch) {
+        const auto* yr  = cpu_softmax_detail::load_row(y, y_layout, contiguous, r, scratch[0]);
+        const auto* dyr = cpu_softmax_detail::load_row(dy, y_layout, contiguous, r, scratch[1]);
+        auto& result    = scratch[2];
+
+        double dot = 0;
+        if(algo == MIOPEN_SOFTMAX_LOG)
+        {
+            for(std::size_t i = 0; i < n; ++i)
+                dot += dyr[i];
+            const auto d = static_cast<float>(dot);
+            for(std::size_t i = 0; i < n; ++i)
+                result[i] = dyr[i] - d * cpu_softmax_detail::fast_exp(yr[i]);
+        }
+        else
+        {
+            for(std::size_t i = 0; i < n; ++i)
+                dot += static_cast<double>(yr[i]) * dyr[i];
+            const auto d = static_cast<float>(dot);
+            for(std::size_t i = 0; i < n; ++i)
+                result[i] = yr[i] * (dyr[i] - d);
+        }
+
+        cpu_softmax_detail::store_row(result.data(), dx, dx_layout, r, alpha, beta);
+    });
+}
+
+/// Attention softmax of packed rows as the MIOpenSoftmaxAttn kernels without dropout:
+/// y = exp(x * descale - m) * z * scale, m is the row max of x * descale and z is the
+/// reciprocal of the sum of exponents. m and z may be null.
+template <class T, class U>
+void cpu_attn_softmax(std::size_t row_count,
+                      std::size_t row_len,
+                      const T* x,
+                      U* y,
+                      float* m,
+                      float* z,
+                      float descale = 1,
+                      float scale   = 1)
+{
+    cpu_for_each_row(row_count, 1, row_len, [&](std::size_t r, auto& scratch) {
+        auto& row = scratch[0];
+        for(std::size_t i = 0; i < row_len; ++i)
+            row[i] = static_cast<float>(x[r * row_len + i]) * descale;
+
+        const auto stats =
+            cpu_softmax_detail::exp_stats(row.data(), row_len, MIOPEN_SOFTMAX_ACCURATE);
+        const auto rsum = static_cast<float>(1 / stats.sum);
+        if(m != nullptr)
+            m[r] = stats.max;
+        if(z != nullptr)
+            z[r] = rsum;
+
+        const auto factor = rsum * scale;
+        auto* dst         = y + r * row_len;
+        for(std::size_t i = 0; i < row_len; ++i)
+            dst[i] = static_cast<U>(cpu_softmax_detail::fast_exp(row[i] - stats.max) * factor);
+    });
+}
+
+#endif // GUARD_CPU_SOFTMAX_HPP
@@ -0,0 +1,243 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_STRIDED_COPY_HPP
+#define GUARD_CPU_STRIDED_COPY_HPP
+
+#include "cpu_parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/// Host engine for strided copies, gathers and scatters between tensors of the same shape.
+///
+/// A copy is described by its dims, outermost first. Each dim has a length and a stride in the
+/// source and in the destination, or a table of destination offsets (a scatter, e.g. GetItem
+/// indices). Before running, unit dims are dropped and dims contiguous in both tensors are
+/// merged, so a packed copy becomes a single run. The innermost dim is copied in tight loops
+/// which vectorize when both strides are 1, the outer dims are walked incrementally without
+/// divisions and split between threads.
+///
+/// Dims which may map several positions to one destination element (tables and zero strides)
+/// are moved next to the innermost one and are never split between threads, so accumulating
+/// copies do not race.
+struct cpu_copy_dim
+{
+    std::size_t length;
+    std::size_t src_stride;
+    std::size_t dst_stride;
+    /// Replaces dst_stride when not empty.
+    std::vector<std::size_t> dst_offsets;
+
+    bool scatter() const { return !dst_offsets.empty(); }
+    bool serial() const { return scatter() || (dst_stride == 0 && length > 1); }
+    std::size_t dst(std::size_t i) const { return scatter() ? dst_offsets[i] : i * dst_stride; }
+};
+
+struct cpu_copy_assign
+{
+    template <class U, class T>
+    void operator()(U& dst, const T& src) const
+    {
+        dst = src;
+    }
+};
+
+struct cpu_copy_add
+{
+    template <class U, class T>
+    void operator()(U& dst, const T& src) const
+    {
+        dst += src;
+    }
+};
+
+namespace cpu_copy_detail {
+
+/// Splits long runs so a single large copy is still shared between threads.
+constexpr std::size_t max_piece = std::size_t{1} << 16;
+
+template <class T, class U, class Op>
+void copy_run(
+    const T* src, U* dst, const cpu_copy_dim& dim, std::size_t first, std::size_t n, Op op)
+{
+    if(dim.scatter())
+    {
+        for(auto i = first; i < first + n; ++i)
+            op(dst[dim.dst_offsets[i]], src[i * dim.src_stride]);
+    }
+    else if(dim.src_stride == 1 && dim.dst_stride == 1)
+    {
+        src += first;
+        dst += first;
+        for(std::size_t i = 0; i < n; ++i)
+            op(dst[i], src[i]);
+    }
+    else
+    {
+        src += first * dim.src_stride;
+        dst += first * dim.dst_stride;
+        for(std::size_t i = 0; i < n; ++i)
+            op(dst[i * dim.dst_stride], src[i * dim.src_stride]);
+    }
+}
+
+template <class T, class U, class Op>
+void copy_serial(
+    const std::vector<cpu_copy_dim>& dims, std::size_t d, const T* src, U* dst, Op op)
+{
+    const auto& dim = dims[d];
+    if(d + 1 == dims.size())
+    {
+        copy_run(src, dst, dim, 0, dim.length, op);
+        return;
+    }
+    for(std::size_t i = 0; i < dim.length; ++i)
+        copy_serial(dims, d + 1, src + i * dim.src_stride, dst + dim.dst(i), op);
+}
+
+} // namespace cpu_copy_detail
+
+class cpu_copy_plan
+{
+public:
+    cpu_copy_plan& add(std::size_t length, std::size_t src_stride, std::size_t dst_stride)
+    {
+        dims.push_back({length, src_stride, dst_stride, {}});
+        return *this;
+    }
+
+    cpu_copy_plan& add_scatter(std::size_t src_stride, std::vector<std::size_t> dst_offsets)
+    {
+        const auto length = dst_offsets.size();
+        dims.push_back({length, src_stride, 0, std::move(dst_offsets)});
+        return *this;
+    }
+
+    /// The dims the copy runs over: merged, with the serial dims moved inwards.
+    std::vector<cpu_copy_dim> collapsed() const
+    {
+        auto result = std::vector<cpu_copy_dim>{};
+        for(const auto& dim : dims)
+        {
+            if(dim.length == 1 && !dim.scatter())
+                continue;
+            if(!result.empty())
+            {
+                auto& outer = result.back();
+                if(!outer.scatter() && !dim.scatter() &&
+                   outer.src_stride == dim.length * dim.src_stride &&
+                   outer.dst_stride == dim.length * dim.dst_stride)
+                {
+                    outer.length *= dim.length;
+                    outer.src_stride = dim.src_stride;
+                    outer.dst_stride = dim.dst_stride;
+                    continue;
+                }
+            }
+            result.push_back(dim);
+        }
+        if(result.empty())
+            result.push_back({1, 1, 1, {}});
+        std::stable_partition(
+            result.begin(), result.end() - 1, [](const auto& dim) { return !dim.serial(); });
+        return result;
+    }
+
+    /// Calls op(dst[...], src[...]) for every element.
+    template <class T, class U, class Op = cpu_copy_assign>
+    void run(const T* src, U* dst, Op op = {}) const
+    {
+        if(std::any_of(dims.begin(), dims.end(), [](const auto& dim) { return dim.length == 0; }))
+            return;
+
+        const auto plan   = collapsed();
+        const auto& last  = plan.back();
+        const auto serial = std::find_if(
+            plan.begin(), plan.end() - 1, [](const auto& dim) { return dim.serial(); });
+        const auto outer  = static_cast<std::size_t>(serial - plan.begin());
+
+        std::size_t units = 1;
+        for(std::size_t d = 0; d < outer; ++d)
+            units *= plan[d].length;
+        const auto split  = outer + 1 == plan.size() && !last.serial();
+        const auto pieces = split ? (last.length + cpu_copy_detail::max_piece - 1) /
+                                        cpu_copy_detail::max_piece
+                                  : std::size_t{1};
+        const auto items  = units * pieces;
+
+        cpu_par_ranges(items, [&](std::size_t first, std::size_t end) {
+            // Position of the first unit, the next ones are reached incrementally.
+            auto index      = std::vector<std::size_t>(outer);
+            auto unit       = first / pieces;
+            auto piece      = first % pieces;
+            auto src_offset = std::size_t{0};
+            auto dst_offset = std::size_t{0};
+            for(auto d = outer; d-- > 0;)
+            {
+                index[d] = unit % plan[d].length;
+                unit /= plan[d].length;
+                src_offset += index[d] * plan[d].src_stride;
+                dst_offset += index[d] * plan[d].dst_stride;
+            }
+
+            for(auto item = first; item < end; ++item)
+            {
+                if(split)
+                {
+                    const auto begin = piece * cpu_copy_detail::max_piece;
+                    const auto n     = std::min(cpu_copy_detail::max_piece, last.length - begin);
+                    cpu_copy_detail::copy_run(
+                        src + src_offset, dst + dst_offset, last, begin, n, op);
+                }
+                else
+                {
+                    cpu_copy_detail::copy_serial(
+                        plan, outer, src + src_offset, dst + dst_offset, op);
+                }
+
+                if(++piece < pieces)
+                    continue;
+                piece = 0;
+                for(auto d = outer; d-- > 0;)
+                {
+                    src_offset += plan[d].src_stride;
+                    dst_offset += plan[d].dst_stride;
+                    if(++index[d] < plan[d].length)
+                        break;
+                    src_offset -= plan[d].length * plan[d].src_stride;
+                    dst_offset -= plan[d].length * plan[d].dst_stride;
+                    index[d] = 0;
+                }
+            }
+        });
+    }
+
+private:
+    std::vector<cpu_copy_dim> dims;
+};
+
+#endif // GUARD_CPU_STRIDED_COPY_HPP
@@ -83,4 +83,39 @@ void cpu_transformers_adam_w(tensor<T1>& params,
     });
 }
 
+template <typename T1, typename T2>
+void cpu_transformers_adam_w_multi_tensor(std::vector<tensor<T1>>& params,
+                                          std::vector<tensor<T2>>& grads,
+                                          std::vector<tensor<T1>>& exp_avgs,
+                                          std::vector<tensor<T1>>& exp_avg_sqs,
+                                          float lr,
+                                          float beta1,
+                                          float beta2,
+                                          float weight_decay,
+                                          float eps,
+                                          bool correct_bias,
+                                          bool is_amp,
+                                          int32_t grad_scale,
+                                          bool found_inf,
+                                          int32_t step_count)
+{
+    for(size_t i = 0; i < params.size(); ++i)
+    {
+        cpu_transformers_adam_w<T1, T2>(params[i],
+                                        grads[i],
+                                        exp_avgs[i],
+                                        exp_avg_sqs[i],
+                                        lr,
+                                        beta1,
+                                        beta2,
+                                        weight_decay,
+                                        eps,
+                                        correct_bias,
+                                        is_amp,
+                                        grad_scale,
+                                        found_inf,
+                                        step_count);
+    }
+}
+
 #endif
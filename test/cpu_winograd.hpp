@@ -0,0 +1,443 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_WINOGRAD_HPP
+#define GUARD_CPU_WINOGRAD_HPP
+
+#include <miopen/conv/transform_plan.hpp>
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+/// Host implementation of the Winograd F(m, r) convolution with the tiling and the workspace
+/// layout of the bidirectional multi-pass solver (miopen::conv::WinogradPlan). The transforms
+/// can be run one by one to inspect or compare a single stage of the GPU pipeline.
+///
+/// Tensors are packed: x and y are NCHW, w is KCRS, with the groups outermost in the channels.
+/// The transformed tile points of each group form the G dim of the workspace buffers, group
+/// major.
+
+/// Transform matrices of the 1D F(m, r), row major: A^T is m x alpha, G is alpha x r and B^T is
+/// alpha x alpha, so that y = A^T ((G g) * (B^T d)) is the correlation of d and g.
+struct cpu_winograd_matrices
+{
+    int m     = 0;
+    int r     = 0;
+    int alpha = 0;
+    std::vector<double> at;
+    std::vector<double> g;
+    std::vector<double> bt;
+};
+
+namespace cpu_winograd_detail {
+
+/// Interpolation points of the Toom-Cook construction, the last point is the infinity.
+inline double point(int i)
+{
+    constexpr double points[] = {0.0, 1.0, -1.0, 0.5, -0.5, 2.0, -2.0, 0.25, -0.25, 4.0, -4.0};
+    if(i >= static_cast<int>(std::size(points)))
+        MIOPEN_THROW("Winograd transform is too large");
+    return points[i];
+}
+
+/// Least squares solution of the m x n system a x = b, m >= n, by modified Gram-Schmidt.
+inline std::vector<double> solve(std::vector<double> a, std::vector<double> b, int m, int n)
+{
+    auto r = std::vector<double>(n * n, 0.0);
+    for(int j = 0; j < n; ++j)
+    {
+        for(int i = 0; i < j; ++i)
+        {
+            auto dot = 0.0;
+            for(int row = 0; row < m; ++row)
+                dot += a[row * n + i] * a[row * n + j];
+            r[i * n + j] = dot;
+            for(int row = 0; row < m; ++row)
+                a[row * n + j] -= dot * a[row * n + i];
+        }
+        auto norm = 0.0;
+        for(int row = 0; row < m; ++row)
+            norm += a[row * n + j] * a[row * n + j];
+        norm         = std::sqrt(norm);
+        r[j * n + j] = norm;
+        for(int row = 0; row < m; ++row)
+            a[row * n + j] /= norm;
+    }
+
+    auto x = std::vector<double>(n, 0.0);
+    for(int j = 0; j < n; ++j)
+        for(int row = 0; row < m; ++row)
+            x[j] += a[row * n + j] * b[row];
+    for(int j = n - 1; j >= 0; --j)
+    {
+        for(int i = j + 1; i < n; ++i)
+            x[j] -= r[j * n + i] * x[i];
+        x[j] /= r[j * n + j];
+    }
+    return x;
+}
+
+/// out = left * tile * right^T, where left is p x a, tile is a x b and right is q x b.
+inline void sandwich(const double* left,
+                     const double* tile,
+                     const double* right,
+                     double* out,
+                     int p,
+                     int a,
+                     int b,
+                     int q)
+{
+    auto tmp = std::vector<double>(p * b, 0.0);
+    for(int i = 0; i < p; ++i)
+        for(int l = 0; l < a; ++l)
+            for(int j = 0; j < b; ++j)
+                tmp[i * b + j] += left[i * a + l] * tile[l * b + j];
+    for(int i = 0; i < p; ++i)
+    {
+        for(int j = 0; j < q; ++j)
+        {
+            auto sum = 0.0;
+            for(int l = 0; l < b; ++l)
+                sum += tmp[i * b + l] * right[j * b + l];
+            out[i * q + j] = sum;
+        }
+    }
+}
+
+} // namespace cpu_winograd_detail
+
+/// Builds the transforms from the points 0, 1, -1, 1/2, -1/2, 2, -2... and the infinity.
+/// A^T and G come from the Toom-Cook interpolation, B^T is the solution of the identity above.
+inline cpu_winograd_matrices cpu_winograd_make_matrices(int m, int r)
+{
+    using cpu_winograd_detail::point;
+
+    auto result  = cpu_winograd_matrices{};
+    result.m     = m;
+    result.r     = r;
+    result.alpha = m + r - 1;
+    const auto a = result.alpha;
+
+    result.at.assign(m * a, 0.0);
+    result.g.assign(a * r, 0.0);
+    result.bt.assign(a * a, 0.0);
+    if(a == 1)
+    {
+        result.at[0] = result.g[0] = result.bt[0] = 1.0;
+        return result;
+    }
+
+    for(int j = 0; j < a - 1; ++j)
+    {
+        auto f = 1.0;
+        for(int q = 0; q < a - 1; ++q)
+            f *= q == j ? 1.0 : point(j) - point(q);
+        // Keeps the first rows positive, as in the usual F(2, 3) and F(4, 3) matrices.
+        if(j == 0)
+            f = std::abs(f);
+        for(int i = 0; i < m; ++i)
+            result.at[i * a + j] = std::pow(point(j), i);
+        for(int l = 0; l < r; ++l)
+            result.g[j * r + l] = std::pow(point(j), l) / f;
+    }
+    result.at[(m - 1) * a + a - 1] = 1.0;
+    result.g[(a - 1) * r + r - 1]  = 1.0;
+
+    // sum_j A^T[i][j] G[j][l] B^T[j][p] = (p == i + l) for every i, l and p.
+    auto system = std::vector<double>(m * r * a);
+    for(int i = 0; i < m; ++i)
+        for(int l = 0; l < r; ++l)
+            for(int j = 0; j < a; ++j)
+                system[(i * r + l) * a + j] = result.at[i * a + j] * result.g[j * r + l];
+    for(int p = 0; p < a; ++p)
+    {
+        auto rhs = std::vector<double>(m * r);
+        for(int i = 0; i < m; ++i)
+            for(int l = 0; l < r; ++l)
+                rhs[i * r + l] = p == i + l ? 1.0 : 0.0;
+        const auto column = cpu_winograd_detail::solve(system, rhs, m * r, a);
+        for(int j = 0; j < a; ++j)
+            result.bt[j * a + p] = column[j];
+    }
+    return result;
+}
+
+/// Matrices of both dims of a plan.
+struct cpu_winograd_transforms
+{
+    cpu_winograd_matrices h;
+    cpu_winograd_matrices w;
+
+    explicit cpu_winograd_transforms(const miopen::conv::WinogradPlan& plan)
+        : h(cpu_winograd_make_matrices(plan.tile_h, plan.filter_h)),
+          w(cpu_winograd_make_matrices(plan.tile_w, plan.filter_w))
+    {
+        if(plan.scheme != miopen::conv::WinogradScheme::Bidirectional)
+            MIOPEN_THROW("Only the bidirectional Winograd has a host implementation");
+    }
+};
+
+namespace cpu_winograd_detail {
+
+inline std::size_t point_index(const miopen::conv::WinogradPlan& plan,
+                               std::size_t group,
+                               int i,
+                               int j)
+{
+    return (group * plan.xform_h + i) * plan.xform_w + j;
+}
+
+} // namespace cpu_winograd_detail
+
+/// Transforms the input tiles: V = B^T d B, written to the plan.in buffer of the workspace.
+template <class T>
+void cpu_winograd_input_transform(const miopen::conv::WinogradPlan& plan,
+                                  const T* x,
+                                  float* workspace)
+{
+    const auto t     = cpu_winograd_transforms{plan};
+    const auto& info = plan.in;
+    const auto ah    = plan.xform_h;
+    const auto aw    = plan.xform_w;
+    auto* buffer     = workspace + plan.GetInOffset() / sizeof(float);
+    auto tile        = std::vector<double>(ah * aw);
+    auto v           = std::vector<double>(ah * aw);
+
+    for(std::size_t g = 0; g < plan.group; ++g)
+    {
+        for(std::size_t n = 0; n < plan.n; ++n)
+        {
+            for(std::size_t c = 0; c < plan.c; ++c)
+            {
+                const auto* image =
+                    x + ((n * plan.group + g) * plan.c + c) * plan.in_h * plan.in_w;
+                for(std::size_t th = 0; th < plan.data_tiles_h; ++th)
+                {
+                    for(std::size_t tw = 0; tw < plan.data_tiles_w; ++tw)
+                    {
+                        const auto top  = static_cast<long>(th * plan.tile_h) - plan.pad_h;
+                        const auto left = static_cast<long>(tw * plan.tile_w) - plan.pad_w;
+                        for(int i = 0; i < ah; ++i)
+                        {
+                            for(int j = 0; j < aw; ++j)
+                            {
+                                const auto row = top + i;
+                                const auto col = left + j;
+                                const auto inside =
+                                    row >= 0 && col >= 0 && row < static_cast<long>(plan.in_h) &&
+                                    col < static_cast<long>(plan.in_w);
+                                tile[i * aw + j] =
+                                    inside ? static_cast<double>(image[row * plan.in_w + col])
+                                           : 0.0;
+                            }
+                        }
+
+                        cpu_winograd_detail::sandwich(
+                            t.h.bt.data(), tile.data(), t.w.bt.data(), v.data(), ah, ah, aw, aw);
+
+                        for(int i = 0; i < ah; ++i)
+                        {
+                            for(int j = 0; j < aw; ++j)
+                            {
+                                const auto b = cpu_winograd_detail::point_index(plan, g, i, j);
+                                buffer[b * info.stride.g + c * info.stride.c +
+                                       n * info.stride.nk + th * info.stride.h +
+                                       tw * info.stride.w] = static_cast<float>(v[i * aw + j]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Transforms the filters: U = G g G^T, written to the plan.wei buffer of the workspace.
+/// For the backward data direction the filter is mirrored and its K and C are swapped.
+template <class T>
+void cpu_winograd_filter_transform(const miopen::conv::WinogradPlan& plan,
+                                   const T* w,
+                                   float* workspace)
+{
+    const auto t     = cpu_winograd_transforms{plan};
+    const auto& info = plan.wei;
+    const auto ah    = plan.xform_h;
+    const auto aw    = plan.xform_w;
+    const auto rh    = plan.filter_h;
+    const auto rw    = plan.filter_w;
+    auto* buffer     = workspace + plan.GetWeiOffset() / sizeof(float);
+    auto filter      = std::vector<double>(rh * rw);
+    auto u           = std::vector<double>(ah * aw);
+
+    for(std::size_t g = 0; g < plan.group; ++g)
+    {
+        for(std::size_t k = 0; k < plan.k; ++k)
+        {
+            for(std::size_t c = 0; c < plan.c; ++c)
+            {
+                // The stored filter is always the one of the forward convolution.
+                const auto* source =
+                    plan.backward_data ? w + ((g * plan.c + c) * plan.k + k) * rh * rw
+                                       : w + ((g * plan.k + k) * plan.c + c) * rh * rw;
+                for(int i = 0; i < rh; ++i)
+                {
+                    for(int j = 0; j < rw; ++j)
+                    {
+                        const auto index = plan.backward_data ? (rh - 1 - i) * rw + (rw - 1 - j)
+                                                              : i * rw + j;
+                        filter[i * rw + j] = static_cast<double>(source[index]);
+                    }
+                }
+
+                cpu_winograd_detail::sandwich(
+                    t.h.g.data(), filter.data(), t.w.g.data(), u.data(), ah, rh, rw, aw);
+
+                for(int i = 0; i < ah; ++i)
+                {
+                    for(int j = 0; j < aw; ++j)
+                    {
+                        const auto b = cpu_winograd_detail::point_index(plan, g, i, j);
+                        buffer[b * info.stride.g + c * info.stride.c + k * info.stride.nk] =
+                            static_cast<float>(u[i * aw + j]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// The batched GEMM of the solver: for every transformed point, out[k][n, tiles] is the sum
+/// over c of wei[c][k] * in[c][n, tiles].
+inline void cpu_winograd_gemm(const miopen::conv::WinogradPlan& plan, float* workspace)
+{
+    const auto* in  = workspace + plan.GetInOffset() / sizeof(float);
+    const auto* wei = workspace + plan.GetWeiOffset() / sizeof(float);
+    auto* out       = workspace + plan.GetOutOffset() / sizeof(float);
+    const auto cols = plan.gemm_n;
+    auto row        = std::vector<double>(cols);
+
+    for(std::size_t b = 0; b < plan.gemm_batch; ++b)
+    {
+        for(std::size_t k = 0; k < plan.k; ++k)
+        {
+            std::fill(row.begin(), row.end(), 0.0);
+            for(std::size_t c = 0; c < plan.c; ++c)
+            {
+                const auto weight =
+                    static_cast<double>(wei[b * plan.wei.stride.g + c * plan.wei.stride.c + k]);
+                const auto* data = in + b * plan.in.stride.g + c * plan.in.stride.c;
+                for(std::size_t i = 0; i < cols; ++i)
+                    row[i] += weight * data[i];
+            }
+            auto* result = out + b * plan.out.stride.g + k * plan.out.stride.c;
+            for(std::size_t i = 0; i < cols; ++i)
+                result[i] = static_cast<float>(row[i]);
+        }
+    }
+}
+
+/// Transforms the products back: Y = A^T M A, written to y.
+template <class T>
+void cpu_winograd_output_transform(const miopen::conv::WinogradPlan& plan,
+                                   const float* workspace,
+                                   T* y)
+{
+    const auto t     = cpu_winograd_transforms{plan};
+    const auto& info = plan.out;
+    const auto ah    = plan.xform_h;
+    const auto aw    = plan.xform_w;
+    const auto mh    = plan.tile_h;
+    const auto mw    = plan.tile_w;
+    const auto* data = workspace + plan.GetOutOffset() / sizeof(float);
+    auto tile        = std::vector<double>(ah * aw);
+    auto result      = std::vector<double>(mh * mw);
+
+    for(std::size_t g = 0; g < plan.group; ++g)
+    {
+        for(std::size_t n = 0; n < plan.n; ++n)
+        {
+            for(std::size_t k = 0; k < plan.k; ++k)
+            {
+                auto* image = y + ((n * plan.group + g) * plan.k + k) * plan.out_h * plan.out_w;
+                for(std::size_t th = 0; th < plan.data_tiles_h; ++th)
+                {
+                    for(std::size_t tw = 0; tw < plan.data_tiles_w; ++tw)
+                    {
+                        for(int i = 0; i < ah; ++i)
+                        {
+                            for(int j = 0; j < aw; ++j)
+                            {
+                                const auto b = cpu_winograd_detail::point_index(plan, g, i, j);
+                                tile[i * aw + j] =
+                                    data[b * info.stride.g + k * info.stride.c +
+                                         n * info.stride.nk + th * info.stride.h +
+                                         tw * info.stride.w];
+                            }
+                        }
+
+                        cpu_winograd_detail::sandwich(t.h.at.data(),
+                                                      tile.data(),
+                                                      t.w.at.data(),
+                                                      result.data(),
+                                                      mh,
+                                                      ah,
+                                                      aw,
+                                                      mw);
+
+                        for(int i = 0; i < mh; ++i)
+                        {
+                            const auto row = th * mh + i;
+                            for(int j = 0; j < mw && row < plan.out_h; ++j)
+                            {
+                                const auto col = tw * mw + j;
+                                if(col < plan.out_w)
+                                    image[row * plan.out_w + col] =
+                                        static_cast<T>(result[i * mw + j]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Runs the whole pipeline. For the backward data direction x is dy and y is dx. The workspace
+/// holds plan.GetWorkspaceSize() bytes.
+template <class T>
+void cpu_winograd_convolution(
+    const miopen::conv::WinogradPlan& plan, const T* x, const T* w, T* y, float* workspace)
+{
+    cpu_winograd_input_transform(plan, x, workspace);
+    cpu_winograd_filter_transform(plan, w, workspace);
+    cpu_winograd_gemm(plan, workspace);
+    cpu_winograd_output_transform(plan, workspace, y);
+}
+
+#endif // GUARD_CPU_WINOGRAD_HPP
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "adam_multi_tensor.hpp"
+
+namespace adam_multi_tensor {
+
+struct GPU_AdamMultiTensor_FP32 : AdamMultiTensorTest<float, float>
+{
+};
+
+struct GPU_AdamMultiTensor_FP16 : AdamMultiTensorTest<half_float::half, half_float::half>
+{
+};
+
+struct GPU_AmpAdamMultiTensor_FP32 : AdamMultiTensorTest<float, half_float::half>
+{
+};
+
+} // namespace adam_multi_tensor
+using namespace adam_multi_tensor;
+
+TEST_P(GPU_AdamMultiTensor_FP32, AdamMultiTensorFloatTestFw)
+{
+    RunTest();
+    Verify();
+};
+
+TEST_P(GPU_AdamMultiTensor_FP16, AdamMultiTensorFloat16TestFw)
+{
+    RunTest();
+    Verify();
+};
+
+TEST_P(GPU_AmpAdamMultiTensor_FP32, AmpAdamMultiTensorTestFw)
+{
+    RunTest();
+    Verify();
+};
+
+INSTANTIATE_TEST_SUITE_P(Full,
+                         GPU_AdamMultiTensor_FP32,
+                         testing::ValuesIn(AdamMultiTensorTestConfigs()));
+INSTANTIATE_TEST_SUITE_P(Full,
+                         GPU_AdamMultiTensor_FP16,
+                         testing::ValuesIn(AdamMultiTensorTestConfigs()));
+INSTANTIATE_TEST_SUITE_P(Full,
+                         GPU_AmpAdamMultiTensor_FP32,
+                         testing::ValuesIn(AdamMultiTensorTestConfigs()));
@@ -0,0 +1,323 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#define MIOPEN_BETA_API 1
+#include "../driver/tensor_driver.hpp"
+#include "cpu_adam.hpp"
+#include "cpu_transformers_adam_w.hpp"
+#include "get_handle.hpp"
+#include "random.hpp"
+#include "tensor_holder.hpp"
+#include "verify.hpp"
+#include <gtest/gtest.h>
+#include <miopen/adam.hpp>
+#include <miopen/miopen.h>
+
+#include <functional>
+#include <numeric>
+
+struct AdamMultiTensorTestCase
+{
+    std::vector<std::vector<int>> inputs;
+    float weight_decay;
+    bool amsgrad;
+    bool adamw;
+    bool transformers;
+
+    friend std::ostream& operator<<(std::ostream& os, const AdamMultiTensorTestCase& tc)
+    {
+        std::size_t numel = 0;
+        for(const auto& input : tc.inputs)
+        {
+            numel += std::accumulate(
+                input.begin(), input.end(), std::size_t{1}, std::multiplies<std::size_t>{});
+        }
+        os << (tc.transformers ? "transformers_adam_w " : (tc.adamw ? "adam_w " : "adam "));
+        return os << "tensors:" << tc.inputs.size() << " numel:" << numel
+                  << " weight_decay:" << tc.weight_decay << " amsgrad:" << tc.amsgrad;
+    }
+};
+
+std::vector<AdamMultiTensorTestCase> AdamMultiTensorTestConfigs()
+{
+    std::vector<std::vector<std::vector<int>>> tensor_lists{
+        {{1}, {2}, {255}, {1024}, {29, 1024}, {32, 64, 3, 3}},
+        {{65535}, {65536}, {65537}, {3, 65536}},
+    };
+
+    // More tensors than fit into a single launch, some of them spanning several chunks.
+    std::vector<std::vector<int>> many;
+    for(int i = 0; i < 100; ++i)
+        many.push_back({(i % 10 == 9) ? 70000 : (i * 37 + 1)});
+    tensor_lists.push_back(many);
+
+    std::vector<AdamMultiTensorTestCase> result;
+    for(const auto& inputs : tensor_lists)
+    {
+        result.push_back({inputs, 0.0f, false, false, false});
+        result.push_back({inputs, 0.005f, true, false, false});
+        result.push_back({inputs, 0.005f, false, true, false});
+        result.push_back({inputs, 0.0f, false, true, true});
+        result.push_back({inputs, 0.005f, false, true, true});
+    }
+    return result;
+}
+
+template <typename Tp = float, typename Tg = float>
+struct AdamMultiTensorTest : public ::testing::TestWithParam<AdamMultiTensorTestCase>
+{
+protected:
+    void SetUp() override
+    {
+        auto&& handle  = get_handle();
+        config         = GetParam();
+        auto gen_value = [](auto...) { return prng::gen_descreet_unsigned<Tp>(1e-2, 100); };
+        auto gen_zero  = [](auto...) { return 0; };
+
+        is_amp = !std::is_same<Tp, Tg>::value;
+
+        for(const auto& dims : config.inputs)
+        {
+            param.push_back(tensor<Tp>{dims}.generate(gen_value));
+            grad.push_back(tensor<Tg>{dims}.generate(gen_value));
+            exp_avg.push_back(tensor<Tp>{dims}.generate(gen_zero));
+            exp_avg_sq.push_back(tensor<Tp>{dims}.generate(gen_zero));
+            max_exp_avg_sq.push_back(tensor<Tp>{dims}.generate(gen_zero));
+            ref_param.push_back(param.back());
+
+            param_dev.push_back(handle.Write(param.back().data));
+            grad_dev.push_back(handle.Write(grad.back().data));
+            exp_avg_dev.push_back(handle.Write(exp_avg.back().data));
+            exp_avg_sq_dev.push_back(handle.Write(exp_avg_sq.back().data));
+            max_exp_avg_sq_dev.push_back(handle.Write(max_exp_avg_sq.back().data));
+
+            if(is_amp)
+            {
+                param_fp16.push_back(tensor<half_float::half>{dims});
+                param_fp16_dev.push_back(handle.Write(param_fp16.back().data));
+            }
+        }
+
+        if(is_amp)
+        {
+            grad_scale[0]  = 1024;
+            found_inf[0]   = 0;
+            grad_scale_dev = handle.Write(grad_scale.data);
+            found_inf_dev  = handle.Write(found_inf.data);
+        }
+        else
+        {
+            grad_scale[0] = 1;
+            found_inf[0]  = 0;
+        }
+    }
+
+    template <class T>
+    static auto Descs(const std::vector<tensor<T>>& tensors)
+    {
+        std::vector<const miopen::TensorDescriptor*> result;
+        for(const auto& t : tensors)
+            result.push_back(&t.desc);
+        return result;
+    }
+
+    static auto Ptrs(const std::vector<miopen::Allocator::ManageDataPtr>& buffers)
+    {
+        std::vector<Data_t> result;
+        for(const auto& buffer : buffers)
+            result.push_back(buffer.get());
+        return result;
+    }
+
+    void RunTest()
+    {
+        auto&& handle = get_handle();
+
+        if(config.transformers)
+        {
+            cpu_transformers_adam_w_multi_tensor<Tp, Tg>(ref_param,
+                                                         grad,
+                                                         exp_avg,
+                                                         exp_avg_sq,
+                                                         lr,
+                                                         beta1,
+                                                         beta2,
+                                                         config.weight_decay,
+                                                         eps,
+                                                         true,
+                                                         is_amp,
+                                                         grad_scale[0],
+                                                         found_inf[0],
+                                                         step_count);
+        }
+        else
+        {
+            cpu_adam_multi_tensor<Tp, Tg>(ref_param,
+                                          grad,
+                                          exp_avg,
+                                          exp_avg_sq,
+                                          max_exp_avg_sq,
+                                          lr,
+                                          beta1,
+                                          beta2,
+                                          config.weight_decay,
+                                          eps,
+                                          config.amsgrad,
+                                          false,
+                                          config.adamw,
+                                          is_amp,
+                                          grad_scale[0],
+                                          found_inf[0],
+                                          step_count);
+        }
+
+        const auto count = static_cast<int32_t>(param.size());
+
+        const auto param_descs          = Descs(param);
+        const auto grad_descs           = Descs(grad);
+        const auto exp_avg_descs        = Descs(exp_avg);
+        const auto exp_avg_sq_descs     = Descs(exp_avg_sq);
+        const auto max_exp_avg_sq_descs = Descs(max_exp_avg_sq);
+        const auto param_fp16_descs     = Descs(param_fp16);
+
+        const auto params          = Ptrs(param_dev);
+        const auto exp_avgs        = Ptrs(exp_avg_dev);
+        const auto exp_avg_sqs     = Ptrs(exp_avg_sq_dev);
+        const auto max_exp_avg_sqs = Ptrs(max_exp_avg_sq_dev);
+        const auto params_fp16     = Ptrs(param_fp16_dev);
+        const auto grads_mutable   = Ptrs(grad_dev);
+        const auto grads = std::vector<ConstData_t>(grads_mutable.begin(), grads_mutable.end());
+
+        for(uint32_t i = 1; i <= step_count; i++)
+        {
+            miopenStatus_t status;
+            if(config.transformers)
+            {
+                status = miopen::TransformersAdamWMultiTensor(
+                    handle,
+                    count,
+                    param_descs.data(),
+                    params.data(),
+                    grad_descs.data(),
+                    grads.data(),
+                    exp_avg_descs.data(),
+                    exp_avgs.data(),
+                    exp_avg_sq_descs.data(),
+                    exp_avg_sqs.data(),
+                    is_amp ? param_fp16_descs.data() : nullptr,
+                    is_amp ? params_fp16.data() : nullptr,
+                    grad_scale_dev.get(),
+                    found_inf_dev.get(),
+                    i,
+                    lr,
+                    beta1,
+                    beta2,
+                    eps,
+                    config.weight_decay,
+                    -1, // step_size
+                    true,
+                    is_amp);
+            }
+            else
+            {
+                status = miopen::AdamMultiTensor(handle,
+                                                 count,
+                                                 param_descs.data(),
+                                                 params.data(),
+                                                 grad_descs.data(),
+                                                 grads.data(),
+                                                 exp_avg_descs.data(),
+                                                 exp_avgs.data(),
+                                                 exp_avg_sq_descs.data(),
+                                                 exp_avg_sqs.data(),
+                                                 max_exp_avg_sq_descs.data(),
+                                                 max_exp_avg_sqs.data(),
+                                                 is_amp ? param_fp16_descs.data() : nullptr,
+                                                 is_amp ? params_fp16.data() : nullptr,
+                                                 grad_scale_dev.get(),
+                                                 found_inf_dev.get(),
+                                                 i,
+                                                 lr,
+                                                 beta1,
+                                                 beta2,
+                                                 config.weight_decay,
+                                                 eps,
+                                                 config.amsgrad,
+                                                 false,
+                                                 config.adamw,
+                                                 is_amp);
+            }
+
+            EXPECT_EQ(status, miopenStatusSuccess);
+        }
+
+        for(std::size_t i = 0; i < param.size(); ++i)
+            param[i].data = handle.Read<Tp>(param_dev[i], param[i].data.size());
+    }
+
+    void Verify()
+    {
+        double threshold = std::numeric_limits<Tp>::epsilon();
+
+        for(std::size_t i = 0; i < param.size(); ++i)
+        {
+            auto error = miopen::rms_range(ref_param[i], param[i]);
+
+            EXPECT_TRUE(miopen::range_distance(ref_param[i]) == miopen::range_distance(param[i]));
+            EXPECT_TRUE(error < threshold * 10)
+                << "Tensor " << i << " error output beyond tolerance Error:" << error
+                << ",  Thresholdx10: " << threshold * 10;
+        }
+    }
+
+    AdamMultiTensorTestCase config;
+
+    std::vector<tensor<Tp>> param;
+    std::vector<tensor<half_float::half>> param_fp16;
+    std::vector<tensor<Tp>> ref_param;
+    std::vector<tensor<Tg>> grad;
+    std::vector<tensor<Tp>> exp_avg;
+    std::vector<tensor<Tp>> exp_avg_sq;
+    std::vector<tensor<Tp>> max_exp_avg_sq;
+    tensor<int> found_inf{1};
+    tensor<int> grad_scale{1};
+
+    std::vector<miopen::Allocator::ManageDataPtr> param_dev;
+    std::vector<miopen::Allocator::ManageDataPtr> param_fp16_dev;
+    std::vector<miopen::Allocator::ManageDataPtr> grad_dev;
+    std::vector<miopen::Allocator::ManageDataPtr> exp_avg_dev;
+    std::vector<miopen::Allocator::ManageDataPtr> exp_avg_sq_dev;
+    std::vector<miopen::Allocator::ManageDataPtr> max_exp_avg_sq_dev;
+    miopen::Allocator::ManageDataPtr found_inf_dev;
+    miopen::Allocator::ManageDataPtr grad_scale_dev;
+
+    float lr           = 0.001f;
+    float beta1        = 0.9f;
+    float beta2        = 0.999f;
+    float eps          = 0.000001f;
+    bool is_amp        = false;
+    uint32_t step_count = 5;
+};
@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include "../driver/tensor_driver.hpp"
+#include "cpu_getitem.hpp"
 #include "get_handle.hpp"
 #include "random.hpp"
 #include "tensor_holder.hpp"
@@ -46,83 +47,25 @@ void cpu_getitem_backward(tensor<T> dy,
                           int32_t* slices,
                           uint32_t offset)
 {
-    auto dy_dims  = dy.desc.GetLengths();
-    auto dy_numel = std::accumulate(dy_dims.begin(), dy_dims.end(), 1L, std::multiplies<int64_t>());
-    auto dx_dims  = ref_dx.desc.GetLengths();
-    auto index_dims = indexs[0].desc.GetLengths();
-    auto index_numel =
-        std::accumulate(index_dims.begin(), index_dims.end(), 1L, std::multiplies<int64_t>());
-    auto element_index = std::vector<int32_t>(indexCount * index_numel + indexCount);
-
-    std::vector<int32_t> output_dims;
-    for(int32_t i = 0; i < dimCount; i++)
-    {
-        output_dims.push_back(dx_dims[dims[i]]);
-    }
-
-    auto dim_info_offset = indexCount > 0 ? indexCount * index_dims[0] : 0;
-    auto start_dim       = dims[0];
-
-    auto dy_tv     = miopen::get_inner_expanded_tv<5>(dy.desc);
-    auto ref_dx_tv = miopen::get_inner_expanded_tv<5>(ref_dx.desc);
-    miopen::slice_tv<5>(ref_dx_tv, sliceCount, slices);
-
-    // Get element index form indexs
-    for(int j = 0; j < indexCount; j++)
-    {
-        auto index_dim = dims[j];
-        auto dim_size  = output_dims[j];
-
-        par_ford(index_numel)([&](int32_t o) {
-            int32_t getitem_index = indexs[j][o];
-
-            if(getitem_index >= 0 && getitem_index < dim_size)
-            {
-                element_index[(o * indexCount) + j] = getitem_index;
-            }
-            else if(getitem_index >= -dim_size && getitem_index < 0)
-            {
-                element_index[(o * indexCount) + j] = getitem_index + dim_size;
-            }
-            else
-            {
-                ref_error[j] = -1;
-            }
-
-            if(o == 0)
-            {
-                element_index[dim_info_offset + j] = index_dim;
-            }
-        });
-    }
-
-    // GetItem
-    par_ford(dy_numel)([&](int32_t o) {
-        tensor_layout_t<5> ncdhw(dy_tv, o);
-        tensor_layout_t<5> idx(ncdhw);
-
-        if(indexCount > 0)
-        {
-            size_t dim_cursor = ncdhw.layout[start_dim];
-            size_t i          = start_dim;
-            size_t j          = 0;
-
-            for(; i < start_dim + indexCount; ++i, ++j)
-            {
-                size_t dim_idx      = element_index[dim_info_offset + j];
-                idx.layout[dim_idx] = element_index[(dim_cursor * indexCount) + j];
-            }
-
-            i          = element_index[dim_info_offset + indexCount - 1] + 1;
-            dim_cursor = start_dim + 1;
-            for(; i < 5; ++i, ++dim_cursor)
-            {
-                idx.layout[i] = ncdhw.layout[dim_cursor];
-            }
-        }
-
-        ref_dx[ref_dx_tv.get_tensor_view_idx(idx)] += dy[dy_tv.get_tensor_view_idx(ncdhw)];
-    });
+    std::ignore = dimCount;
+    std::ignore = offset;
+
+    auto index_ptrs  = std::vector<const int32_t*>{};
+    auto index_numel = indexs.empty() ? 0 : indexs[0].desc.GetElementSize();
+    for(const auto& index : indexs)
+        index_ptrs.push_back(index.data.data());
+
+    cpu_getitem_backward(dy.data.data(),
+                         miopen::get_inner_expanded_tv<5>(dy.desc),
+                         indexCount,
+                         index_ptrs.data(),
+                         index_numel,
+                         ref_dx.data.data(),
+                         miopen::get_inner_expanded_tv<5>(ref_dx.desc),
+                         ref_error.data.data(),
+                         dims,
+                         sliceCount,
+                         slices);
 }
 
 struct GetitemTestCase
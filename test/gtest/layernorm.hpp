@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include "../driver/tensor_driver.hpp"
+#include "../cpu_norm.hpp"
 #include "get_handle.hpp"
 #include "random.hpp"
 #include "tensor_holder.hpp"
@@ -44,46 +45,17 @@ void cpu_layernorm_forward(tensor<T> input,
                            int32_t dim,
                            miopenNormMode_t mode)
 {
-    auto dims         = input.desc.GetLengths();
-    size_t outer_size = 1;
-    size_t inner_size = 1;
-    size_t i          = 0;
-    for(; i < dim; i++)
-    {
-        outer_size *= dims[i];
-    }
-
-    for(; i < dims.size(); i++)
-    {
-        inner_size *= dims[i];
-    }
-
-    par_ford(outer_size)([&](int32_t o) {
-        float mean_v = 0;
-        float var_v  = 0;
-
-        ford(inner_size)([&](int32_t i) {
-            float tmp = static_cast<float>(input[o * inner_size + i]);
-            mean_v += tmp;
-            var_v += tmp * tmp;
-        });
-
-        mean_v       = mean_v / inner_size;
-        var_v        = var_v / inner_size - mean_v * mean_v;
-        float rstd_v = 1 / sqrt(var_v + eps);
-
-        ref_mean[o] = static_cast<T>(mean_v);
-        ref_rstd[o] = static_cast<T>(rstd_v);
-
-        ford(inner_size)([&](int32_t i) {
-            float weight_v =
-                (mode == MIOPEN_ELEMENTWISE_AFFINE) ? 1 : static_cast<float>(weight[i]);
-            float bias_v = (mode == MIOPEN_ELEMENTWISE_AFFINE) ? 0 : static_cast<float>(bias[i]);
-            ref_output[o * inner_size + i] = static_cast<T>(
-                (static_cast<float>(input[o * inner_size + i]) - mean_v) * rstd_v * weight_v +
-                bias_v);
-        });
-    });
+    const auto affine = mode != MIOPEN_ELEMENTWISE_AFFINE;
+    cpu_norm_forward(cpu_norm_layout::layer(input.desc.GetLengths(), dim),
+                     cpu_norm_kind::standard,
+                     input.data.data(),
+                     static_cast<const T*>(nullptr),
+                     affine ? weight.data.data() : nullptr,
+                     affine ? bias.data.data() : nullptr,
+                     eps,
+                     ref_output.data.data(),
+                     ref_mean.data.data(),
+                     ref_rstd.data.data());
 }
 
 struct LayerNormTestCase
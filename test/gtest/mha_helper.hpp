@@ -23,6 +23,7 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include "cpu_softmax.hpp"
 #include "tensor_holder.hpp"
 #include "conv_tensor_gen.hpp"
 
@@ -328,7 +329,7 @@ void Concat(const tensor<T>& A_mat, tensor<U>& B_mat)
 
 /* attn_max  : max_of_each_row_of(q_dot_k_transpose)
  *              Its a row reduction operation. eg: (3x3) => (3x1)
- * z_sum      : sum(exp((q_dot_k_transpose - attn_max))) eg: (3x3) => (3x1)
+ * z_sum      : 1 / sum(exp((q_dot_k_transpose - attn_max)))
  *              Its a row reduction operation. eg: (3x3) => (3x1)
  */
 template <typename T>
@@ -337,24 +338,16 @@ void SoftMax(const tensor<T>& q_dot_k_transpose,
              tensor<T>& attn_max,
              tensor<T>& z_sum)
 {
-    // compute max across each row of matrix. This value is
-    // used for numerical stability for softmax computation.
-    RowReductionMax(q_dot_k_transpose, attn_max);
+    const auto row_len = q_dot_k_transpose.desc.GetLengths()[3];
+    const auto rows    = q_dot_k_transpose.data.size() / row_len;
 
-    // substract the computed max
-    auto q_dot_k_transpose_sub_attn_max = q_dot_k_transpose;
-    BroadCastSub(q_dot_k_transpose, attn_max, q_dot_k_transpose_sub_attn_max);
+    auto m = std::vector<float>(rows);
+    auto z = std::vector<float>(rows);
+    cpu_attn_softmax(
+        rows, row_len, q_dot_k_transpose.data.data(), softmax.data.data(), m.data(), z.data());
 
-    // Compute the exponential of each element
-    // exp(row_max)
-    auto exp_q_dot_k_transpose_sub_attn_max = q_dot_k_transpose_sub_attn_max;
-    PointWiseExp(q_dot_k_transpose_sub_attn_max, exp_q_dot_k_transpose_sub_attn_max);
-
-    // z_sum aka attn_norm = 1 / sum(exp((q_dot_k_transpose - attn_max)))
-    RowReductionReciprocalSum(exp_q_dot_k_transpose_sub_attn_max, z_sum);
-
-    // softmax = exp((q_dot_k_transpose - attn_max)) * z_sum
-    BroadCastMul(exp_q_dot_k_transpose_sub_attn_max, z_sum, softmax);
+    std::transform(m.begin(), m.end(), attn_max.begin(), [](auto v) { return static_cast<T>(v); });
+    std::transform(z.begin(), z.end(), z_sum.begin(), [](auto v) { return static_cast<T>(v); });
 }
 
 template <typename T = float8>
@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include "../driver/tensor_driver.hpp"
+#include "../cpu_norm.hpp"
 #include "get_handle.hpp"
 #include "random.hpp"
 #include "tensor_holder.hpp"
@@ -41,34 +42,17 @@ void cpu_t5layernorm_forward(tensor<T> x,
                              float eps,
                              miopenNormMode_t mode)
 {
-    auto dims         = x.desc.GetLengths();
-    size_t outer_size = 1;
-    size_t inner_size = dims[dims.size() - 1];
-
-    for(size_t i = 0ULL; i < dims.size() - 1; ++i)
-    {
-        outer_size *= dims[i];
-    }
-
-    par_ford(outer_size)([&](int32_t o) {
-        float pvar = 0;
-
-        ford(inner_size)([&](int32_t i) {
-            float tmp = static_cast<float>(x[o * inner_size + i]);
-            pvar += tmp * tmp;
-        });
-
-        pvar        = pvar / inner_size;
-        float prstd = 1 / sqrt(pvar + eps);
-
-        ref_rstd[o] = static_cast<T>(prstd);
-
-        ford(inner_size)([&](int32_t i) {
-            float pweight = mode ? static_cast<float>(weight[i]) : 1;
-            ref_y[o * inner_size + i] =
-                static_cast<T>(static_cast<float>(x[o * inner_size + i]) * prstd * pweight);
-        });
-    });
+    const auto dims = x.desc.GetLengths();
+    cpu_norm_forward(cpu_norm_layout::layer(dims, dims.size() - 1),
+                     cpu_norm_kind::rms,
+                     x.data.data(),
+                     static_cast<const T*>(nullptr),
+                     mode ? weight.data.data() : nullptr,
+                     static_cast<const T*>(nullptr),
+                     eps,
+                     ref_y.data.data(),
+                     static_cast<T*>(nullptr),
+                     ref_rstd.data.data());
 }
 
 template <class T>
@@ -79,65 +63,43 @@ void cpu_t5layernorm_backward(tensor<T> dy,
                               tensor<T>& ref_dx,
                               miopenNormMode_t mode)
 {
-    auto dims         = dy.desc.GetLengths();
-    size_t outer_size = 1;
-    size_t inner_size = dims[dims.size() - 1];
-
-    for(size_t i = 0ULL; i < dims.size() - 1; ++i)
+    // An empty dy stands for zero gradients.
+    if(dy.GetSize() == 0)
     {
-        outer_size *= dims[i];
+        std::fill(ref_dx.begin(), ref_dx.end(), static_cast<T>(0));
+        return;
     }
 
-    par_ford(outer_size)([&](int32_t o) {
-        float sum = 0;
-
-        ford(inner_size)([&](int32_t i) {
-            float pweight = mode ? static_cast<float>(weight[i]) : 1;
-            float pdy     = (dy.GetSize() != 0) ? static_cast<float>(dy[o * inner_size + i]) : 0;
-            float px      = static_cast<float>(x[o * inner_size + i]);
-            sum += pdy * px * pweight;
-        });
-
-        float s     = 1 / static_cast<float>(inner_size);
-        float prstd = static_cast<float>(rstd[o]);
-        float a     = sum * prstd * prstd * prstd * s;
-
-        ford(inner_size)([&](int32_t i) {
-            float pweight = mode ? static_cast<float>(weight[i]) : 1;
-            float pdy     = (dy.GetSize() != 0) ? static_cast<float>(dy[o * inner_size + i]) : 0;
-
-            float val = prstd * pdy * pweight - a * static_cast<float>(x[o * inner_size + i]);
-            ref_dx[o * inner_size + i] = static_cast<T>(val);
-        });
-    });
+    const auto dims = dy.desc.GetLengths();
+    cpu_norm_backward(cpu_norm_layout::layer(dims, dims.size() - 1),
+                      cpu_norm_kind::rms,
+                      dy.data.data(),
+                      x.data.data(),
+                      mode ? weight.data.data() : nullptr,
+                      static_cast<const T*>(nullptr),
+                      rstd.data.data(),
+                      ref_dx.data.data());
 }
 
 template <class T>
 void cpu_t5layernorm_backward_weight(
-    tensor<T> dy, tensor<T> x, tensor<T> rstd, tensor<T>& ref_dw, miopenNormMode_t mode)
+    tensor<T> dy, tensor<T> x, tensor<T> rstd, tensor<T>& ref_dw, miopenNormMode_t)
 {
-    auto dims         = dy.desc.GetLengths();
-    size_t outer_size = 1;
-    size_t inner_size = dims[dims.size() - 1];
-
-    for(size_t i = 0ULL; i < dims.size() - 1; ++i)
+    if(dy.GetSize() == 0)
     {
-        outer_size *= dims[i];
+        std::fill(ref_dw.begin(), ref_dw.end(), static_cast<T>(0));
+        return;
     }
 
-    par_ford(inner_size)([&](int32_t o) {
-        float sum = 0;
-
-        ford(outer_size)([&](int32_t i) {
-            float prstd = static_cast<float>(rstd[i]);
-            float pdy   = (dy.GetSize() != 0) ? static_cast<float>(dy[i * inner_size + o]) : 0;
-            float px    = static_cast<float>(x[i * inner_size + o]);
-
-            sum += pdy * px * prstd;
-        });
-
-        ref_dw[o] = sum;
-    });
+    const auto dims = dy.desc.GetLengths();
+    cpu_norm_backward_weight_bias(cpu_norm_layout::layer(dims, dims.size() - 1),
+                                  cpu_norm_kind::rms,
+                                  dy.data.data(),
+                                  x.data.data(),
+                                  static_cast<const T*>(nullptr),
+                                  rstd.data.data(),
+                                  ref_dw.data.data(),
+                                  static_cast<T*>(nullptr));
 }
 
 struct T5LayerNormTestCase
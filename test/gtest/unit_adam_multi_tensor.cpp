@@ -0,0 +1,212 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/adam/multi_tensor.hpp>
+#include <miopen/errors.hpp>
+
+#include <numeric>
+#include <vector>
+
+namespace {
+
+using miopen::adam::MakeMultiTensorLaunches;
+using miopen::adam::MultiTensorLaunch;
+
+// Checks that every chunk of every non-empty tensor is processed exactly once, in order,
+// and that the launch limits are respected.
+void CheckCoverage(const std::vector<std::size_t>& numels,
+                   const std::vector<MultiTensorLaunch>& launches,
+                   std::size_t chunk_size,
+                   std::size_t max_tensors,
+                   std::size_t max_blocks)
+{
+    auto expected = std::vector<std::pair<std::size_t, std::size_t>>{};
+    for(std::size_t i = 0; i < numels.size(); ++i)
+    {
+        for(std::size_t chunk = 0; chunk * chunk_size < numels[i]; ++chunk)
+            expected.emplace_back(i, chunk);
+    }
+
+    auto actual = std::vector<std::pair<std::size_t, std::size_t>>{};
+    for(const auto& launch : launches)
+    {
+        ASSERT_FALSE(launch.block_to_tensor.empty());
+        ASSERT_LE(launch.tensors.size(), max_tensors);
+        ASSERT_LE(launch.block_to_tensor.size(), max_blocks);
+        ASSERT_EQ(launch.block_to_tensor.size(), launch.block_to_chunk.size());
+
+        for(std::size_t block = 0; block < launch.block_to_tensor.size(); ++block)
+        {
+            const auto slot = launch.block_to_tensor[block];
+            ASSERT_LT(slot, launch.tensors.size());
+            actual.emplace_back(launch.tensors[slot], launch.block_to_chunk[block]);
+        }
+    }
+
+    EXPECT_EQ(actual, expected);
+}
+
+} // namespace
+
+TEST(CPU_AdamMultiTensorLaunches_NONE, SmallTensors)
+{
+    const auto numels   = std::vector<std::size_t>(100, 64);
+    const auto launches = MakeMultiTensorLaunches(numels);
+
+    // One block per tensor, the number of launches is bound by the tensor slots.
+    EXPECT_EQ(launches.size(), (numels.size() + ADAM_MULTI_TENSOR_MAX_TENSORS - 1) /
+                                   ADAM_MULTI_TENSOR_MAX_TENSORS);
+    CheckCoverage(numels,
+                  launches,
+                  miopen::adam::multi_tensor_chunk_size,
+                  ADAM_MULTI_TENSOR_MAX_TENSORS,
+                  ADAM_MULTI_TENSOR_MAX_BLOCKS);
+}
+
+TEST(CPU_AdamMultiTensorLaunches_NONE, LargeTensorSpansLaunches)
+{
+    const auto numels   = std::vector<std::size_t>{10, 1000, 3, 999};
+    const auto launches = MakeMultiTensorLaunches(numels, 16, 3, 8);
+
+    CheckCoverage(numels, launches, 16, 3, 8);
+    EXPECT_EQ(launches.size(),
+              (std::accumulate(numels.begin(),
+                               numels.end(),
+                               std::size_t{0},
+                               [](auto acc, auto n) { return acc + (n + 15) / 16; }) +
+               7) /
+                  8);
+}
+
+TEST(CPU_AdamMultiTensorLaunches_NONE, EmptyTensors)
+{
+    EXPECT_TRUE(MakeMultiTensorLaunches({}).empty());
+    EXPECT_TRUE(MakeMultiTensorLaunches({0, 0}).empty());
+
+    const auto numels   = std::vector<std::size_t>{0, 5, 0, 17, 0};
+    const auto launches = MakeMultiTensorLaunches(numels, 4, 2, 320);
+    CheckCoverage(numels, launches, 4, 2, 320);
+}
+
+TEST(CPU_AdamMultiTensorLaunches_NONE, Randomized)
+{
+    auto seed = 42u;
+    for(int iter = 0; iter < 50; ++iter)
+    {
+        auto numels = std::vector<std::size_t>(1 + (seed = seed * 1103515245u + 12345u) % 200);
+        for(auto& numel : numels)
+            numel = (seed = seed * 1103515245u + 12345u) % 5000;
+
+        const auto chunk_size  = std::size_t{1} + (seed = seed * 1103515245u + 12345u) % 300;
+        const auto max_tensors = std::size_t{1} + seed % ADAM_MULTI_TENSOR_MAX_TENSORS;
+        const auto max_blocks  = std::size_t{1} + seed % ADAM_MULTI_TENSOR_MAX_BLOCKS;
+
+        CheckCoverage(numels,
+                      MakeMultiTensorLaunches(numels, chunk_size, max_tensors, max_blocks),
+                      chunk_size,
+                      max_tensors,
+                      max_blocks);
+    }
+}
+
+TEST(CPU_AdamMultiTensorLaunches_NONE, KernelArguments)
+{
+    const auto numels   = std::vector<std::size_t>{100, 300, 50};
+    const auto launches = MakeMultiTensorLaunches(numels, 128);
+    ASSERT_EQ(launches.size(), 1);
+
+    auto storage = std::vector<char>(16);
+    auto params  = std::vector<Data_t>{&storage[0], &storage[1], &storage[2]};
+    auto grads   = std::vector<ConstData_t>{&storage[3], &storage[4], &storage[5]};
+    auto avgs    = std::vector<Data_t>{&storage[6], &storage[7], &storage[8]};
+    auto avg_sqs = std::vector<Data_t>{&storage[9], &storage[10], &storage[11]};
+
+    auto buffers      = miopen::adam::MultiTensorBuffers{};
+    buffers.params    = params.data();
+    buffers.grads     = grads.data();
+    buffers.expAvgs   = avgs.data();
+    buffers.expAvgSqs = avg_sqs.data();
+
+    const auto list = miopen::adam::MakeMultiTensorList(launches.front(), numels, buffers);
+
+    for(std::size_t i = 0; i < numels.size(); ++i)
+    {
+        EXPECT_EQ(list.param[i], params[i]);
+        EXPECT_EQ(list.grad[i], grads[i]);
+        EXPECT_EQ(list.exp_avg[i], avgs[i]);
+        EXPECT_EQ(list.exp_avg_sq[i], avg_sqs[i]);
+        EXPECT_EQ(list.max_exp_avg_sq[i], nullptr);
+        EXPECT_EQ(list.param_fp16[i], nullptr);
+        EXPECT_EQ(list.numel[i], numels[i]);
+    }
+
+    const auto expected_tensors = std::vector<int>{0, 1, 1, 1, 2};
+    const auto expected_chunks  = std::vector<int>{0, 0, 1, 2, 0};
+    for(std::size_t block = 0; block < expected_tensors.size(); ++block)
+    {
+        EXPECT_EQ(list.block_to_tensor[block], expected_tensors[block]);
+        EXPECT_EQ(list.block_to_chunk[block], expected_chunks[block]);
+    }
+
+    // The whole work list is passed by value and has to fit into the kernel arguments.
+    EXPECT_LT(sizeof(adam_multi_tensor_list_t) + 128, 4096);
+}
+
+TEST(CPU_AdamMultiTensorLaunches_NONE, AmsgradRequiresMaxExpAvgSqs)
+{
+    const auto numels   = std::vector<std::size_t>{100, 300};
+    const auto launches = MakeMultiTensorLaunches(numels, 128);
+    ASSERT_EQ(launches.size(), 1);
+
+    auto storage = std::vector<char>(16);
+    auto params  = std::vector<Data_t>{&storage[0], &storage[1]};
+    auto grads   = std::vector<ConstData_t>{&storage[2], &storage[3]};
+    auto avgs    = std::vector<Data_t>{&storage[4], &storage[5]};
+    auto avg_sqs = std::vector<Data_t>{&storage[6], &storage[7]};
+    auto max_sqs = std::vector<Data_t>{&storage[8], nullptr};
+
+    auto buffers      = miopen::adam::MultiTensorBuffers{};
+    buffers.params    = params.data();
+    buffers.grads     = grads.data();
+    buffers.expAvgs   = avgs.data();
+    buffers.expAvgSqs = avg_sqs.data();
+
+    const auto& launch = launches.front();
+    EXPECT_THROW(miopen::adam::MakeMultiTensorList(launch, numels, buffers, true),
+                 miopen::Exception);
+
+    buffers.maxExpAvgSqs = max_sqs.data();
+    EXPECT_THROW(miopen::adam::MakeMultiTensorList(launch, numels, buffers, true),
+                 miopen::Exception);
+    EXPECT_EQ(miopen::adam::MakeMultiTensorList(launch, numels, buffers).max_exp_avg_sq[1],
+              nullptr);
+
+    max_sqs[1]      = &storage[9];
+    const auto list = miopen::adam::MakeMultiTensorList(launch, numels, buffers, true);
+    EXPECT_EQ(list.max_exp_avg_sq[0], max_sqs[0]);
+    EXPECT_EQ(list.max_exp_avg_sq[1], max_sqs[1]);
+}
@@ -0,0 +1,269 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/background_tuner.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+
+using miopen::BackgroundTuner;
+using State    = BackgroundTuner::State;
+using Duration = BackgroundTuner::Duration;
+
+struct SimulatedTime
+{
+    Duration now{1000};
+
+    BackgroundTuner::Clock Clock()
+    {
+        return [this]() { return now; };
+    }
+
+    /// The job that takes the given time to complete.
+    BackgroundTuner::Job Job(Duration duration, std::string* log = nullptr, std::string id = {})
+    {
+        return [this, duration, log, id]() {
+            now += duration;
+            if(log != nullptr)
+                *log += id;
+        };
+    }
+};
+
+BackgroundTuner::Options MakeOptions(double duty_cycle = 1.0)
+{
+    auto options       = BackgroundTuner::Options{};
+    options.max_queued = 4;
+    options.max_wait   = Duration{10000};
+    options.duty_cycle = duty_cycle;
+    return options;
+}
+
+/// The job that runs until the tuner is shut down and fails as a cancelled search.
+BackgroundTuner::Job WaitForCancel(const BackgroundTuner& tuner, std::string message = {})
+{
+    return [&tuner, message]() {
+        while(!tuner.GetCancelFlag())
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        if(!message.empty())
+            std::cerr << message << std::endl;
+        throw std::runtime_error("cancelled");
+    };
+}
+
+bool WaitForState(const BackgroundTuner& tuner, const std::string& key, State state)
+{
+    for(auto i = 0; i < 1000 && tuner.GetState(key) != state; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    return tuner.GetState(key) == state;
+}
+
+} // namespace
+
+TEST(CPU_BackgroundTuner_NONE, DeduplicatesAndPrioritizesRequests)
+{
+    SimulatedTime time;
+    BackgroundTuner tuner{MakeOptions(), time.Clock()};
+    std::string log;
+
+    EXPECT_TRUE(tuner.Enqueue("a", time.Job(Duration{1}, &log, "a")));
+    EXPECT_TRUE(tuner.Enqueue("b", time.Job(Duration{1}, &log, "b")));
+    EXPECT_TRUE(tuner.Enqueue("c", time.Job(Duration{1}, &log, "c")));
+    EXPECT_FALSE(tuner.Enqueue("c", time.Job(Duration{1}, &log, "x")));
+    EXPECT_EQ(tuner.GetQueueSize(), 3);
+    EXPECT_EQ(tuner.GetState("c"), State::Queued);
+    EXPECT_EQ(tuner.GetState("d"), State::Unknown);
+
+    while(tuner.RunNext()) {}
+    EXPECT_EQ(log, "cab");
+    EXPECT_EQ(tuner.GetQueueSize(), 0);
+    EXPECT_EQ(tuner.GetGeneration(), 3);
+    EXPECT_EQ(tuner.GetState("a"), State::Done);
+
+    // Finished jobs are not repeated.
+    EXPECT_FALSE(tuner.Enqueue("a", time.Job(Duration{1}, &log, "a")));
+    EXPECT_FALSE(tuner.RunNext());
+    EXPECT_EQ(log, "cab");
+}
+
+TEST(CPU_BackgroundTuner_NONE, IgnoresRequestsBeyondQueueLimit)
+{
+    SimulatedTime time;
+    BackgroundTuner tuner{MakeOptions(), time.Clock()};
+
+    for(auto i = 0; i < 4; ++i)
+        EXPECT_TRUE(tuner.Enqueue(std::to_string(i), time.Job(Duration{1})));
+    EXPECT_FALSE(tuner.Enqueue("4", time.Job(Duration{1})));
+    EXPECT_EQ(tuner.GetState("4"), State::Unknown);
+
+    tuner.RunNext();
+    EXPECT_TRUE(tuner.Enqueue("4", time.Job(Duration{1})));
+}
+
+TEST(CPU_BackgroundTuner_NONE, DropsStaleRequests)
+{
+    SimulatedTime time;
+    BackgroundTuner tuner{MakeOptions(), time.Clock()};
+    std::string log;
+
+    tuner.Enqueue("old", time.Job(Duration{1}, &log, "old"));
+    time.now += Duration{5000};
+    tuner.Enqueue("new", time.Job(Duration{1}, &log, "new"));
+    time.now += Duration{5001};
+
+    EXPECT_FALSE(tuner.RunNext());
+    EXPECT_EQ(log, "new");
+    EXPECT_EQ(tuner.GetState("old"), State::Dropped);
+
+    // The problem may be requested again.
+    EXPECT_TRUE(tuner.Enqueue("old", time.Job(Duration{1}, &log, "old")));
+    tuner.RunNext();
+    EXPECT_EQ(log, "newold");
+}
+
+TEST(CPU_BackgroundTuner_NONE, KeepsDutyCycle)
+{
+    SimulatedTime time;
+    BackgroundTuner tuner{MakeOptions(0.25), time.Clock()};
+    std::string log;
+
+    tuner.Enqueue("a", time.Job(Duration{100}, &log, "a"));
+    tuner.Enqueue("b", time.Job(Duration{100}, &log, "b"));
+
+    EXPECT_EQ(tuner.RunNext(), Duration{300});
+    EXPECT_EQ(log, "a");
+
+    // Nothing runs until the idle time passes.
+    time.now += Duration{200};
+    EXPECT_EQ(tuner.RunNext(), Duration{100});
+    EXPECT_EQ(log, "a");
+
+    time.now += Duration{100};
+    EXPECT_FALSE(tuner.RunNext());
+    EXPECT_EQ(log, "ab");
+}
+
+TEST(CPU_BackgroundTuner_NONE, MarksFailedJobs)
+{
+    SimulatedTime time;
+    BackgroundTuner tuner{MakeOptions(), time.Clock()};
+
+    tuner.Enqueue("bad", []() { throw std::runtime_error("no device"); });
+    tuner.Enqueue("good", time.Job(Duration{1}));
+    tuner.RunNext();
+    tuner.RunNext();
+
+    EXPECT_EQ(tuner.GetState("bad"), State::Failed);
+    EXPECT_EQ(tuner.GetState("good"), State::Done);
+    EXPECT_EQ(tuner.GetGeneration(), 1);
+    EXPECT_FALSE(tuner.Enqueue("bad", time.Job(Duration{1})));
+}
+
+TEST(CPU_BackgroundTuner_NONE, ForgetsOldestFinishedJobs)
+{
+    SimulatedTime time;
+    auto options         = MakeOptions();
+    options.max_finished = 2;
+    BackgroundTuner tuner{options, time.Clock()};
+
+    tuner.Enqueue("a", time.Job(Duration{1}));
+    tuner.Enqueue("b", []() { throw std::runtime_error("no device"); });
+    tuner.Enqueue("c", time.Job(Duration{1}));
+    while(tuner.RunNext()) {}
+
+    EXPECT_EQ(tuner.GetState("a"), State::Unknown);
+    EXPECT_EQ(tuner.GetState("b"), State::Failed);
+    EXPECT_EQ(tuner.GetState("c"), State::Done);
+
+    // Queued jobs are never forgotten.
+    EXPECT_TRUE(tuner.Enqueue("a", time.Job(Duration{1})));
+    EXPECT_TRUE(tuner.Enqueue("d", time.Job(Duration{1})));
+    tuner.RunNext();
+    EXPECT_EQ(tuner.GetState("a"), State::Done);
+    EXPECT_EQ(tuner.GetState("b"), State::Unknown);
+    EXPECT_EQ(tuner.GetState("d"), State::Queued);
+}
+
+TEST(CPU_BackgroundTuner_NONE, ShutdownCancelsRunningJob)
+{
+    BackgroundTuner tuner{MakeOptions()};
+    tuner.Start();
+    tuner.Enqueue("slow", WaitForCancel(tuner));
+    ASSERT_TRUE(WaitForState(tuner, "slow", State::Running));
+
+    tuner.Enqueue("next", []() {});
+    tuner.Shutdown();
+    EXPECT_EQ(tuner.GetState("slow"), State::Failed);
+    EXPECT_EQ(tuner.GetState("next"), State::Queued);
+}
+
+TEST(CPU_BackgroundTuner_NONE, ExitCancelsRunningJob)
+{
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_EXIT(
+        {
+            // Shut down at exit as the process-wide instance.
+            static auto* const tuner = new BackgroundTuner{MakeOptions()}; // NOLINT
+            std::atexit([]() {
+                tuner->Shutdown();
+                std::cerr << "stopped " << tuner->GetGeneration() << std::endl;
+            });
+            tuner->Start();
+            tuner->Enqueue("slow", WaitForCancel(*tuner, "cancelled"));
+            if(WaitForState(*tuner, "slow", State::Running))
+                std::exit(0);
+        },
+        testing::ExitedWithCode(0),
+        "cancelled(.|\n)*stopped 0");
+}
+
+TEST(CPU_BackgroundTuner_NONE, WorkerRunsJobs)
+{
+    auto options     = MakeOptions();
+    options.max_wait = std::chrono::minutes{1};
+    BackgroundTuner tuner{options};
+    std::atomic<int> done{0};
+
+    tuner.Start();
+    for(auto i = 0; i < 4; ++i)
+        tuner.Enqueue(std::to_string(i), [&]() { ++done; });
+
+    for(auto i = 0; i < 1000 && done < 4; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    tuner.Stop();
+
+    EXPECT_EQ(done, 4);
+    EXPECT_EQ(tuner.GetGeneration(), 4);
+}
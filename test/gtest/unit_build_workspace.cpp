@@ -0,0 +1,149 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/build_workspace.hpp>
+#include <miopen/env.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_BUILD_WORKSPACE_DIR)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_BUILD_WORKSPACE_TMPFS_MIN_MB, 512)
+
+namespace {
+
+bool IsInside(const miopen::fs::path& path, const miopen::fs::path& dir)
+{
+    const auto rel = path.lexically_relative(dir);
+    return !rel.empty() && *rel.begin() != "..";
+}
+
+} // namespace
+
+TEST(CPU_BuildWorkspace_NONE, TmpDirIsInsideWorkspace)
+{
+    const auto& workspace = miopen::GetBuildWorkspace();
+    ASSERT_TRUE(miopen::fs::is_directory(workspace));
+    EXPECT_EQ(&workspace, &miopen::GetBuildWorkspace());
+
+    miopen::fs::path path;
+    {
+        const miopen::TmpDir dir{"workspace-test"};
+        path = dir.path;
+        EXPECT_TRUE(miopen::fs::is_directory(path));
+        EXPECT_EQ(path.parent_path(), workspace);
+    }
+    EXPECT_FALSE(miopen::fs::exists(path));
+}
+
+TEST(CPU_BuildWorkspace_NONE, KernelIncludesAreWrittenOnce)
+{
+    const auto& dir = miopen::GetKernelIncludeDir();
+    ASSERT_TRUE(miopen::fs::is_directory(dir));
+    EXPECT_TRUE(IsInside(dir, miopen::GetBuildWorkspace()));
+    EXPECT_FALSE(miopen::fs::is_empty(dir));
+
+    // A removed header is not written again by the later calls.
+    const auto header = miopen::fs::directory_iterator{dir}->path();
+    miopen::fs::remove(header);
+    EXPECT_EQ(&dir, &miopen::GetKernelIncludeDir());
+    EXPECT_FALSE(miopen::fs::exists(header));
+
+    miopen::WriteKernelIncludes(dir);
+    EXPECT_TRUE(miopen::fs::exists(header));
+}
+
+TEST(CPU_BuildWorkspace_NONE, TmpfsNeedsFreeSpace)
+{
+    if(!miopen::env::value(MIOPEN_BUILD_WORKSPACE_DIR).empty())
+        GTEST_SKIP() << "The workspace directory is set by the user";
+
+    miopen::env::update(MIOPEN_BUILD_WORKSPACE_TMPFS_MIN_MB, std::numeric_limits<uint32_t>::max());
+    const auto base = miopen::GetBuildWorkspaceBase();
+    miopen::env::clear(MIOPEN_BUILD_WORKSPACE_TMPFS_MIN_MB);
+    EXPECT_EQ(base, miopen::fs::temp_directory_path());
+}
+
+TEST(CPU_BuildWorkspace_NONE, WriteKernelIncludes)
+{
+    const miopen::TmpDir dir{"workspace-test"};
+    miopen::WriteKernelIncludes(dir.path / "include");
+
+    auto count = 0;
+    for(const auto& entry : miopen::fs::directory_iterator{dir.path / "include"})
+    {
+        const auto shared = miopen::GetKernelIncludeDir() / entry.path().filename();
+        EXPECT_TRUE(miopen::fs::exists(shared)) << shared;
+        EXPECT_EQ(miopen::fs::file_size(entry.path()), miopen::fs::file_size(shared));
+        ++count;
+    }
+    EXPECT_GT(count, 0);
+}
+
+#ifndef _WIN32
+TEST(CPU_BuildWorkspace_NONE, RemovesWorkspacesOfDeadProcesses)
+{
+    const auto name = miopen::GetBuildWorkspace().filename().string();
+    EXPECT_EQ(name.rfind("miopen-build-" + std::to_string(getpid()) + "-", 0), 0) << name;
+
+    // A process which is killed and leaves its workspace behind.
+    const auto dead = fork();
+    ASSERT_NE(dead, -1);
+    if(dead == 0)
+        _exit(0);
+    auto status = 0;
+    ASSERT_EQ(waitpid(dead, &status, 0), dead);
+
+    const miopen::TmpDir base{"workspace-test"};
+    const auto make = [&](const std::string& dir_name) {
+        const auto dir = base.path / dir_name;
+        miopen::fs::create_directories(dir / "include");
+        std::ofstream{dir / "include" / "header.inc"} << "// header";
+        return dir;
+    };
+    const auto abandoned = make("miopen-build-" + std::to_string(dead) + "-0a1b-2c3d-4e5f-6789");
+    const auto alive = make("miopen-build-" + std::to_string(getpid()) + "-0a1b-2c3d-4e5f-6789");
+    const auto unknown = make("miopen-build-0a1b-2c3d-4e5f-6789");
+    const auto other   = make("other-" + std::to_string(dead) + "-0a1b-2c3d-4e5f-6789");
+
+    EXPECT_EQ(miopen::RemoveAbandonedBuildWorkspaces(base.path), 1);
+    EXPECT_FALSE(miopen::fs::exists(abandoned));
+    EXPECT_TRUE(miopen::fs::exists(alive));
+    EXPECT_TRUE(miopen::fs::exists(unknown));
+    EXPECT_TRUE(miopen::fs::exists(other));
+    EXPECT_EQ(miopen::RemoveAbandonedBuildWorkspaces(base.path), 0);
+}
+#endif
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/solver/ck_instance_registry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct FakeDeviceOp
+{
+    explicit FakeDeviceOp(int tile_) : tile(tile_) {}
+    std::string GetTypeString() const { return "FakeDeviceOp<" + std::to_string(tile) + ">"; }
+    int tile;
+};
+
+struct FakeDeviceOpFactory
+{
+    static inline int get_instances_calls = 0;
+
+    static std::vector<std::unique_ptr<FakeDeviceOp>> GetInstances()
+    {
+        ++get_instances_calls;
+        std::vector<std::unique_ptr<FakeDeviceOp>> ptrs;
+        for(const auto tile : {16, 32, 64, 128, 32})
+            ptrs.emplace_back(std::make_unique<FakeDeviceOp>(tile));
+        return ptrs;
+    }
+};
+
+struct FakeCKArgs
+{
+    static inline int is_supported_calls = 0;
+
+    explicit FakeCKArgs(int size_) : size(size_) {}
+
+    template <typename OpPtr>
+    bool IsSupportedBy(const OpPtr& op) const
+    {
+        ++is_supported_calls;
+        return size % op->tile == 0;
+    }
+
+    int size;
+};
+
+using Registry = miopen::solver::CKInstanceRegistry<FakeDeviceOpFactory>;
+using Cache    = miopen::solver::CKSupportCache<FakeDeviceOpFactory, FakeCKArgs>;
+
+} // namespace
+
+TEST(CPU_CKInstanceRegistry_NONE, BuiltOnce)
+{
+    const auto& registry = Registry::Get();
+    EXPECT_EQ(&registry, &Registry::Get());
+    EXPECT_EQ(FakeDeviceOpFactory::get_instances_calls, 1);
+
+    ASSERT_EQ(registry.Size(), 5);
+    for(std::size_t i = 0; i < registry.Size(); ++i)
+        EXPECT_EQ(registry.GetTypeString(i), registry.At(i)->GetTypeString());
+}
+
+TEST(CPU_CKInstanceRegistry_NONE, Find)
+{
+    const auto& registry = Registry::Get();
+
+    EXPECT_EQ(registry.Find("FakeDeviceOp<64>"), 2);
+    // Duplicated type strings resolve to the first instance, as a linear search would.
+    EXPECT_EQ(registry.Find("FakeDeviceOp<32>"), 1);
+    EXPECT_FALSE(registry.Find("FakeDeviceOp<8>"));
+    EXPECT_FALSE(registry.Find(""));
+}
+
+TEST(CPU_CKInstanceRegistry_NONE, SplitKernelId)
+{
+    using miopen::solver::SplitCKKernelId;
+
+    const auto split = SplitCKKernelId("FakeDeviceOp<64>+4");
+    ASSERT_TRUE(split);
+    EXPECT_EQ(split->type_string, "FakeDeviceOp<64>");
+    EXPECT_EQ(split->split_k, 4);
+
+    const auto plain = SplitCKKernelId("FakeDeviceOp<64>");
+    ASSERT_TRUE(plain);
+    EXPECT_EQ(plain->type_string, "FakeDeviceOp<64>");
+    EXPECT_FALSE(plain->split_k);
+}
+
+TEST(CPU_CKInstanceRegistry_NONE, SplitMalformedKernelId)
+{
+    using miopen::solver::SplitCKKernelId;
+
+    for(const auto id : {"Op<1>+", "Op<1>+x", "Op<1>+4x", "Op<1>+ 4", "Op<1>+99999999999", "+"})
+        EXPECT_FALSE(SplitCKKernelId(id)) << id;
+}
+
+TEST(CPU_CKInstanceRegistry_NONE, SupportIsMemoized)
+{
+    auto make_args_calls = 0;
+    const auto make_args = [&make_args_calls]() {
+        ++make_args_calls;
+        return FakeCKArgs{64};
+    };
+
+    const auto calls = FakeCKArgs::is_supported_calls;
+    const auto first = Cache::Get("gfx90a", "size64", make_args);
+    EXPECT_EQ(*first, (std::vector<bool>{true, true, true, false, true}));
+    EXPECT_EQ(FakeCKArgs::is_supported_calls - calls, 5);
+
+    const auto second = Cache::Get("gfx90a", "size64", make_args);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(make_args_calls, 1);
+    EXPECT_EQ(FakeCKArgs::is_supported_calls - calls, 5);
+
+    const auto other = Cache::Get("gfx90a", "size16", []() { return FakeCKArgs{16}; });
+    EXPECT_EQ(*other, (std::vector<bool>{true, false, false, false, false}));
+}
+
+TEST(CPU_CKInstanceRegistry_NONE, SupportIsKeyedByTarget)
+{
+    auto make_args_calls = 0;
+    const auto make_args = [&make_args_calls]() {
+        ++make_args_calls;
+        return FakeCKArgs{128};
+    };
+
+    const auto gfx90a = Cache::Get("gfx90a", "size128", make_args);
+    const auto gfx942 = Cache::Get("gfx942", "size128", make_args);
+    EXPECT_NE(gfx90a, gfx942);
+    EXPECT_EQ(make_args_calls, 2);
+    EXPECT_EQ(Cache::Get("gfx942", "size128", make_args), gfx942);
+    EXPECT_EQ(make_args_calls, 2);
+}
+
+TEST(CPU_CKInstanceRegistry_NONE, CacheIsBounded)
+{
+    for(std::size_t i = 0; i < 2 * Cache::max_entries; ++i)
+    {
+        const auto size   = static_cast<int>(i + 1);
+        const auto bitmap =
+            Cache::Get("gfx90a", std::to_string(size), [size]() { return FakeCKArgs{size}; });
+        EXPECT_EQ((*bitmap)[0], size % 16 == 0);
+    }
+}
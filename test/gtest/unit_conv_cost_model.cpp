@@ -0,0 +1,273 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/conv/heuristics/cost_model.hpp>
+#include <miopen/conv/transform_plan.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cm = miopen::conv::cost_model;
+
+namespace {
+
+cm::ConvShape MakeShape(std::size_t n,
+                        std::size_t c,
+                        std::size_t k,
+                        std::size_t hw,
+                        std::size_t filter,
+                        miopenDataType_t type = miopenFloat)
+{
+    auto shape        = cm::ConvShape{};
+    shape.n           = n;
+    shape.c           = c;
+    shape.k           = k;
+    shape.in_spatial  = {1, hw, hw};
+    shape.out_spatial = {1, hw, hw};
+    shape.filter      = {1, filter, filter};
+    shape.type        = type;
+    return shape;
+}
+
+} // namespace
+
+TEST(CPU_ConvCostModelFamily_NONE, Classification)
+{
+    EXPECT_EQ(cm::GetSolverFamily("ConvAsm1x1U", miopenConvolutionAlgoDirect),
+              cm::SolverFamily::Asm1x1);
+    EXPECT_EQ(cm::GetSolverFamily("ConvAsm1x1UV2", miopenConvolutionAlgoDirect),
+              cm::SolverFamily::Asm1x1);
+    EXPECT_EQ(cm::GetSolverFamily("ConvAsm3x3U", miopenConvolutionAlgoDirect),
+              cm::SolverFamily::Asm3x3);
+    EXPECT_EQ(cm::GetSolverFamily("ConvOclDirectFwd", miopenConvolutionAlgoDirect),
+              cm::SolverFamily::Direct);
+    EXPECT_EQ(cm::GetSolverFamily("ConvBinWinogradRxSf2x3", miopenConvolutionAlgoWinograd),
+              cm::SolverFamily::Winograd);
+    EXPECT_EQ(cm::GetSolverFamily("GemmFwdRest", miopenConvolutionAlgoGEMM),
+              cm::SolverFamily::Gemm);
+    EXPECT_EQ(cm::GetSolverFamily("fft", miopenConvolutionAlgoFFT), cm::SolverFamily::Fft);
+    EXPECT_EQ(cm::GetSolverFamily("ConvHipImplicitGemmFwdXdlops",
+                                  miopenConvolutionAlgoImplicitGEMM),
+              cm::SolverFamily::ImplicitGemm);
+
+    for(std::size_t i = 0; i < cm::SolverFamilyCount; ++i)
+    {
+        const auto family = static_cast<cm::SolverFamily>(i);
+        EXPECT_EQ(cm::SolverFamilyFromString(cm::ToString(family)), family);
+    }
+}
+
+TEST(CPU_ConvCostModelShape_NONE, FromDbKey)
+{
+    auto shape = cm::ConvShape{};
+    ASSERT_TRUE(
+        cm::ConvShape::FromDbKey("576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F", shape));
+    EXPECT_EQ(shape.c, 576);
+    EXPECT_EQ(shape.k, 192);
+    EXPECT_EQ(shape.n, 8);
+    EXPECT_EQ(shape.InSpatialSize(), 16);
+    EXPECT_EQ(shape.FilterSize(), 1);
+    EXPECT_EQ(shape.stride[1], 2);
+    EXPECT_EQ(shape.type, miopenFloat);
+
+    ASSERT_TRUE(cm::ConvShape::FromDbKey(
+        "64-28-28-3x3-32-28-28-4-1x1-1x1-1x1-0-NHWC-NHWC-NHWC-FP16-B_g2", shape));
+    // Backward data keys have "in" and "out" swapped.
+    EXPECT_EQ(shape.c, 32);
+    EXPECT_EQ(shape.k, 64);
+    EXPECT_EQ(shape.group, 2);
+    EXPECT_EQ(shape.type, miopenHalf);
+
+    ASSERT_TRUE(cm::ConvShape::FromDbKey(
+        "16-8-8-8-3x3x3-32-8-8-8-2-1x1x1-1x1x1-1x1x1-0-NCDHW-FP32-F", shape));
+    EXPECT_EQ(shape.FilterSize(), 27);
+    EXPECT_EQ(shape.OutSpatialSize(), 512);
+
+    EXPECT_FALSE(cm::ConvShape::FromDbKey("garbage", shape));
+    EXPECT_FALSE(
+        cm::ConvShape::FromDbKey("576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP99-F", shape));
+}
+
+TEST(CPU_ConvCostModelEstimate_NONE, Ordering)
+{
+    const auto device = cm::DeviceCaps::FromName("gfx90a", 104);
+    const auto model  = cm::CostModel{};
+
+    const auto small = MakeShape(1, 64, 64, 28, 3);
+    const auto large = MakeShape(64, 256, 256, 56, 3);
+
+    // Larger problems take longer for every family.
+    for(std::size_t i = 0; i < cm::SolverFamilyCount; ++i)
+    {
+        const auto family = static_cast<cm::SolverFamily>(i);
+        EXPECT_LT(model.Estimate(device, small, family), model.Estimate(device, large, family))
+            << cm::ToString(family);
+    }
+
+    // Winograd does less work than Direct for 3x3 filters.
+    EXPECT_LT(model.Estimate(device, large, cm::SolverFamily::Winograd),
+              model.Estimate(device, large, cm::SolverFamily::Direct));
+
+    // Higher WTI means faster solver.
+    EXPECT_LT(model.Estimate(device, large, cm::SolverFamily::Direct, 0.8f),
+              model.Estimate(device, large, cm::SolverFamily::Direct, 0.2f));
+
+    // Matrix cores make fp16 implicit GEMM faster than fp32.
+    const auto large_fp16 = MakeShape(64, 256, 256, 56, 3, miopenHalf);
+    EXPECT_LT(model.Estimate(device, large_fp16, cm::SolverFamily::ImplicitGemm),
+              model.Estimate(device, large, cm::SolverFamily::ImplicitGemm));
+
+    // Unknown devices are supported.
+    const auto unknown = cm::DeviceCaps::FromName("gfx000", 8);
+    EXPECT_GT(model.Estimate(unknown, large, cm::SolverFamily::Gemm),
+              model.Estimate(device, large, cm::SolverFamily::Gemm));
+}
+
+TEST(CPU_ConvCostModelEstimate_NONE, TransformFamiliesFollowPlans)
+{
+    const auto shape = MakeShape(16, 64, 128, 28, 5);
+
+    const auto winograd = miopen::conv::WinogradPlan::Make(
+        miopen::conv::WinogradScheme::Fused, shape, 2, 3, 2, 3, 2, 2);
+    EXPECT_EQ(cm::GetFamilyWork(cm::SolverFamily::Winograd, shape).flops, winograd.GetFlops());
+
+    const auto fft = miopen::conv::FftPlan::Make(shape, 2, 2);
+    ASSERT_TRUE(fft.IsSupported());
+    const auto fft_work = cm::GetFamilyWork(cm::SolverFamily::Fft, shape);
+    EXPECT_EQ(fft_work.flops, fft.GetFlops());
+    EXPECT_GT(fft_work.bytes, static_cast<double>(fft.GetWorkspaceSize()));
+
+    // 3D problems are not planned and keep the generic estimate.
+    auto shape_3d        = shape;
+    shape_3d.in_spatial  = {8, 28, 28};
+    shape_3d.out_spatial = {8, 28, 28};
+    EXPECT_GT(cm::GetFamilyWork(cm::SolverFamily::Fft, shape_3d).flops, 0.0);
+}
+
+TEST(CPU_ConvCostModelEstimate_NONE, FallbackRanksUnknownWtiOnlyWhenCalibrated)
+{
+    struct Candidate
+    {
+        const char* name;
+        cm::SolverFamily family;
+        float wti;
+    };
+    // The first one reports wti_approximate_worst, and the uncalibrated family
+    // coefficients would put it first.
+    const auto candidates = std::vector<Candidate>{
+        {"unknown", cm::SolverFamily::Winograd, -2.0f},
+        {"direct", cm::SolverFamily::Direct, 0.1f},
+        {"gemm", cm::SolverFamily::Gemm, 0.2f},
+    };
+
+    const auto device = cm::DeviceCaps::FromName("gfx90a", 104);
+    const auto shape  = MakeShape(64, 256, 256, 56, 3);
+
+    const auto rank = [&](const cm::CostModel& model) {
+        auto ranked = std::vector<std::pair<float, std::string>>{};
+        for(const auto& c : candidates)
+        {
+            const auto time = model.EstimateFallback(device, shape, c.family, c.wti);
+            if(time >= 0.0f)
+                ranked.emplace_back(time, c.name);
+        }
+        std::sort(ranked.begin(), ranked.end());
+        return ranked;
+    };
+
+    const auto model = cm::CostModel{};
+    ASSERT_FALSE(model.IsCalibrated());
+    ASSERT_LT(model.Estimate(device, shape, cm::SolverFamily::Winograd),
+              model.Estimate(device, shape, cm::SolverFamily::Direct, 0.1f));
+    const auto ranked = rank(model);
+    ASSERT_EQ(ranked.size(), 2u);
+    EXPECT_NE(ranked.front().second, "unknown");
+
+    auto calibrated = cm::CostModel{};
+    std::istringstream coeffs{"Winograd=0.5,0.5,0.01"};
+    ASSERT_TRUE(calibrated.Load(coeffs));
+    ASSERT_TRUE(calibrated.IsCalibrated());
+    EXPECT_EQ(rank(calibrated).size(), candidates.size());
+}
+
+TEST(CPU_ConvCostModelCalibrate_NONE, RecoversCoefficients)
+{
+    const auto device = cm::DeviceCaps::FromName("gfx942", 304);
+
+    auto reference = cm::CostModel{};
+    reference.Set(cm::SolverFamily::ImplicitGemm, {0.2, 0.3, 0.004});
+
+    auto samples = std::vector<cm::CalibrationSample>{};
+    for(auto n : {1, 4, 16, 64, 256})
+    {
+        for(auto c : {64, 256, 1024})
+        {
+            const auto shape = MakeShape(n, c, c, 28, 3);
+            samples.push_back({cm::SolverFamily::ImplicitGemm,
+                               shape,
+                               reference.Estimate(device, shape, cm::SolverFamily::ImplicitGemm)});
+        }
+    }
+
+    const auto fitted = cm::Calibrate(device, samples);
+    const auto& coeffs = fitted.Get(cm::SolverFamily::ImplicitGemm);
+
+    // Launch overhead is not recovered exactly, so the efficiency is approximate.
+    EXPECT_NEAR(coeffs.compute_efficiency, 0.2, 0.05);
+    EXPECT_GT(coeffs.launch_overhead_ms, 0.0);
+
+    // Families without samples keep defaults.
+    EXPECT_EQ(fitted.Get(cm::SolverFamily::Fft).compute_efficiency,
+              cm::CostModel{}.Get(cm::SolverFamily::Fft).compute_efficiency);
+
+    for(const auto& s : samples)
+    {
+        const auto estimated = fitted.Estimate(device, s.shape, s.family);
+        EXPECT_NEAR(estimated / s.measured_ms, 1.0, 0.3);
+    }
+}
+
+TEST(CPU_ConvCostModelSerialization_NONE, RoundTrip)
+{
+    auto model = cm::CostModel{};
+    model.Set(cm::SolverFamily::Winograd, {0.625, 0.75, 0.125});
+
+    std::stringstream ss;
+    model.Save(ss);
+
+    auto loaded = cm::CostModel{};
+    ASSERT_TRUE(loaded.Load(ss));
+    EXPECT_EQ(loaded.Get(cm::SolverFamily::Winograd).compute_efficiency, 0.625);
+    EXPECT_EQ(loaded.Get(cm::SolverFamily::Winograd).memory_efficiency, 0.75);
+    EXPECT_EQ(loaded.Get(cm::SolverFamily::Winograd).launch_overhead_ms, 0.125);
+
+    std::istringstream bad{"Winograd=0.5;0.5"};
+    EXPECT_FALSE(cm::CostModel{}.Load(bad));
+}
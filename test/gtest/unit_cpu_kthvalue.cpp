@@ -0,0 +1,173 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "cpu_kthvalue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct KthvalueCase
+{
+    std::vector<size_t> lengths; // Five dims, the output keeps the selected one with size 1.
+    int dim;
+    size_t k;
+    bool transposed; // Swaps the strides of the first and the last dims.
+    int distinct;    // Number of distinct values, small values produce many ties.
+};
+
+tensor_view_t<5> MakeView(std::vector<size_t> lengths, bool transposed)
+{
+    auto tv = tensor_view_t<5>{};
+    if(transposed)
+        std::swap(lengths.front(), lengths.back());
+    uint64_t stride = 1;
+    for(int i = 4; i >= 0; --i)
+    {
+        tv.size[i]   = lengths[i];
+        tv.stride[i] = stride;
+        stride *= lengths[i];
+    }
+    if(transposed)
+    {
+        std::swap(tv.size[0], tv.size[4]);
+        std::swap(tv.stride[0], tv.stride[4]);
+    }
+    return tv;
+}
+
+size_t Offset(const tensor_view_t<5>& tv, const std::array<size_t, 5>& id)
+{
+    size_t offset = 0;
+    for(int i = 0; i < 5; ++i)
+        offset += id[i] * tv.stride[i];
+    return offset;
+}
+
+/// Sorts every slice, the ties are resolved by the position as the engine documents.
+void NaiveKthvalue(const std::vector<float>& x,
+                   const tensor_view_t<5>& xTv,
+                   std::vector<float>& y,
+                   std::vector<size_t>& indices,
+                   const tensor_view_t<5>& yTv,
+                   int dim,
+                   size_t k)
+{
+    const auto n = xTv.size[dim];
+    auto ids     = std::vector<size_t>(n);
+    auto id      = std::array<size_t, 5>{};
+    for(id[0] = 0; id[0] < yTv.size[0]; ++id[0])
+        for(id[1] = 0; id[1] < yTv.size[1]; ++id[1])
+            for(id[2] = 0; id[2] < yTv.size[2]; ++id[2])
+                for(id[3] = 0; id[3] < yTv.size[3]; ++id[3])
+                    for(id[4] = 0; id[4] < yTv.size[4]; ++id[4])
+                    {
+                        auto at = [&](size_t i) {
+                            auto xid = id;
+                            xid[dim] = i;
+                            return x[Offset(xTv, xid)];
+                        };
+                        std::iota(ids.begin(), ids.end(), 0);
+                        std::stable_sort(ids.begin(), ids.end(), [&](size_t a, size_t b) {
+                            return cpu_kthvalue_detail::radix_key(at(a)) <
+                                   cpu_kthvalue_detail::radix_key(at(b));
+                        });
+                        y[Offset(yTv, id)]       = at(ids[k - 1]);
+                        indices[Offset(yTv, id)] = ids[k - 1];
+                    }
+}
+
+class CPU_HostKthvalue_NONE : public testing::TestWithParam<KthvalueCase>
+{
+};
+
+TEST_P(CPU_HostKthvalue_NONE, MatchesSort)
+{
+    const auto& tc  = GetParam();
+    const auto xTv  = MakeView(tc.lengths, tc.transposed);
+    auto out_len    = tc.lengths;
+    out_len[tc.dim] = 1;
+    const auto yTv  = MakeView(out_len, false);
+
+    const auto size = std::accumulate(
+        tc.lengths.begin(), tc.lengths.end(), size_t{1}, std::multiplies<size_t>{});
+    const auto out_size = size / tc.lengths[tc.dim];
+
+    auto gen  = std::mt19937{static_cast<unsigned>(size + tc.k)};
+    auto dist = std::uniform_int_distribution<int>{0, tc.distinct - 1};
+    auto x    = std::vector<float>(size);
+    for(auto& v : x)
+        v = static_cast<float>(dist(gen)) - tc.distinct / 2.f;
+
+    auto y       = std::vector<float>(out_size);
+    auto indices = std::vector<size_t>(out_size);
+    auto ref     = std::vector<float>(out_size);
+    auto ref_ids = std::vector<size_t>(out_size);
+    cpu_kthvalue(x.data(), xTv, y.data(), yTv, indices.data(), yTv, tc.k, tc.dim);
+    NaiveKthvalue(x, xTv, ref, ref_ids, yTv, tc.dim, tc.k);
+
+    EXPECT_EQ(y, ref);
+    EXPECT_EQ(indices, ref_ids);
+}
+
+INSTANTIATE_TEST_SUITE_P(Unit,
+                         CPU_HostKthvalue_NONE,
+                         testing::Values(KthvalueCase{{2, 3, 4, 5, 300}, 4, 1, false, 1000},
+                                         KthvalueCase{{2, 3, 4, 5, 300}, 4, 300, false, 1000},
+                                         KthvalueCase{{2, 3, 4, 5, 300}, 4, 77, false, 5},
+                                         KthvalueCase{{7, 3, 1, 1, 64}, 0, 4, true, 3},
+                                         KthvalueCase{{3, 129, 2, 1, 5}, 1, 65, false, 16},
+                                         KthvalueCase{{3, 129, 2, 1, 5}, 1, 65, true, 1 << 20},
+                                         KthvalueCase{{1, 1, 1, 1, 1}, 4, 1, false, 2}));
+
+TEST(CPU_HostKthvalueOrder_NONE, FollowsKernelRadixOrder)
+{
+    const auto nan = std::numeric_limits<float>::quiet_NaN();
+    const auto inf = std::numeric_limits<float>::infinity();
+    auto x         = std::vector<float>{nan, 0.f, -inf, -0.f, inf, 2.f, -0.f, -2.f};
+    const auto tv  = MakeView({1, 1, 1, 1, x.size()}, false);
+    const auto yTv = MakeView({1, 1, 1, 1, 1}, false);
+
+    auto expected_ids = std::vector<size_t>{2, 7, 3, 6, 1, 5, 4, 0};
+    for(size_t k = 1; k <= x.size(); ++k)
+    {
+        auto y       = 0.f;
+        size_t index = 0;
+        cpu_kthvalue(x.data(), tv, &y, yTv, &index, yTv, k, 4);
+        EXPECT_EQ(index, expected_ids[k - 1]) << "k " << k;
+    }
+}
+
+} // namespace
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "cpu_norm.hpp"
+#include "unit_cpu_reference.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using cpu_reference_test::ExpectNear;
+using cpu_reference_test::Random;
+
+struct NormCase
+{
+    cpu_norm_layout layout;
+    cpu_norm_kind kind;
+    float offset; // Large offsets catch the cancellation of E[x^2] - E[x]^2.
+};
+
+std::size_t Param(const cpu_norm_layout& layout, std::size_t o, std::size_t i)
+{
+    return layout.first_param(o) + i / layout.span;
+}
+
+struct Naive
+{
+    std::vector<double> mean, rstd, y, dx, dw, db;
+};
+
+Naive NaiveNorm(const NormCase& tc,
+                const std::vector<float>& x,
+                const std::vector<float>& w,
+                const std::vector<float>& b,
+                const std::vector<float>& dy,
+                float eps)
+{
+    const auto& l = tc.layout;
+    const auto n  = static_cast<double>(l.inner);
+    auto r        = Naive{};
+    r.mean.resize(l.outer);
+    r.rstd.resize(l.outer);
+    r.y.resize(x.size());
+    r.dx.resize(x.size());
+    r.dw.resize(w.size());
+    r.db.resize(w.size());
+
+    for(std::size_t o = 0; o < l.outer; ++o)
+    {
+        double mean = 0;
+        if(tc.kind == cpu_norm_kind::standard)
+        {
+            for(std::size_t i = 0; i < l.inner; ++i)
+                mean += x[o * l.inner + i];
+            mean /= n;
+        }
+        double var = 0;
+        for(std::size_t i = 0; i < l.inner; ++i)
+            var += (x[o * l.inner + i] - mean) * (x[o * l.inner + i] - mean);
+        const auto rstd = 1 / std::sqrt(var / n + eps);
+        r.mean[o]       = mean;
+        r.rstd[o]       = rstd;
+
+        double mean_g  = 0;
+        double mean_gx = 0;
+        for(std::size_t i = 0; i < l.inner; ++i)
+        {
+            const auto idx  = o * l.inner + i;
+            const auto p    = Param(l, o, i);
+            const auto xhat = (x[idx] - mean) * rstd;
+            r.y[idx]        = xhat * w[p] + b[p];
+            r.dw[p] += dy[idx] * xhat;
+            r.db[p] += dy[idx];
+            mean_g += dy[idx] * w[p] / n;
+            mean_gx += dy[idx] * w[p] * xhat / n;
+        }
+        if(tc.kind == cpu_norm_kind::rms)
+            mean_g = 0;
+        for(std::size_t i = 0; i < l.inner; ++i)
+        {
+            const auto idx  = o * l.inner + i;
+            const auto xhat = (x[idx] - mean) * rstd;
+            r.dx[idx]       = rstd * (dy[idx] * w[Param(l, o, i)] - mean_g - xhat * mean_gx);
+        }
+    }
+    return r;
+}
+
+} // namespace
+
+class CPU_HostNorm_NONE : public testing::TestWithParam<NormCase>
+{
+};
+
+TEST_P(CPU_HostNorm_NONE, MatchesNaive)
+{
+    const auto& tc = GetParam();
+    const auto& l  = tc.layout;
+    const auto eps = 1e-5f;
+    const auto x   = Random(l.outer * l.inner, 1, 1.f, tc.offset);
+    const auto dy  = Random(l.outer * l.inner, 2);
+    const auto w   = Random(l.phases * l.params_per_row(), 3, 1.f, 1.f);
+    const auto b   = tc.kind == cpu_norm_kind::rms ? std::vector<float>(w.size())
+                                                   : Random(w.size(), 4);
+    const auto ref = NaiveNorm(tc, x, w, b, dy, eps);
+
+    auto y    = std::vector<float>(x.size());
+    auto mean = std::vector<float>(l.outer);
+    auto rstd = std::vector<float>(l.outer);
+    cpu_norm_forward(l,
+                     tc.kind,
+                     x.data(),
+                     static_cast<const float*>(nullptr),
+                     w.data(),
+                     tc.kind == cpu_norm_kind::rms ? nullptr : b.data(),
+                     eps,
+                     y.data(),
+                     mean.data(),
+                     rstd.data());
+    ExpectNear(mean, ref.mean, 1e-6);
+    ExpectNear(rstd, ref.rstd, 1e-5);
+    ExpectNear(y, ref.y, 1e-4);
+
+    auto dx = std::vector<float>(x.size());
+    cpu_norm_backward(
+        l, tc.kind, dy.data(), x.data(), w.data(), mean.data(), rstd.data(), dx.data());
+    ExpectNear(dx, ref.dx, 1e-4);
+
+    auto dw = std::vector<double>(w.size());
+    auto db = std::vector<double>(w.size());
+    cpu_norm_backward_weight_bias(
+        l, tc.kind, dy.data(), x.data(), mean.data(), rstd.data(), dw.data(), db.data());
+    ExpectNear(dw, ref.dw, 1e-4);
+    ExpectNear(db, ref.db, 1e-4);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Full,
+    CPU_HostNorm_NONE,
+    testing::Values(NormCase{cpu_norm_layout::layer({7, 1000}, 1), cpu_norm_kind::standard, 0},
+                    NormCase{cpu_norm_layout::layer({4, 3, 513}, 1), cpu_norm_kind::standard, 1e3},
+                    NormCase{cpu_norm_layout::layer({2, 5, 3, 7}, 2), cpu_norm_kind::standard, 0},
+                    NormCase{cpu_norm_layout::layer({9, 1030}, 1), cpu_norm_kind::rms, 0},
+                    NormCase{cpu_norm_layout::group({3, 6, 5, 7}, 3), cpu_norm_kind::standard, 0},
+                    NormCase{cpu_norm_layout::group({2, 8, 300}, 2), cpu_norm_kind::standard, 10}));
+
+TEST(CPU_HostNorm_NONE, Layouts)
+{
+    const auto layer = cpu_norm_layout::layer({2, 3, 4, 5}, 2);
+    EXPECT_EQ(layer.outer, 6);
+    EXPECT_EQ(layer.inner, 20);
+    EXPECT_EQ(layer.params_per_row(), 20);
+    EXPECT_EQ(layer.first_param(5), 0);
+
+    const auto group = cpu_norm_layout::group({2, 6, 4, 5}, 3);
+    EXPECT_EQ(group.outer, 6);
+    EXPECT_EQ(group.inner, 40);
+    EXPECT_EQ(group.span, 20);
+    EXPECT_EQ(group.params_per_row(), 2);
+    EXPECT_EQ(group.first_param(4), 2);
+}
+
+TEST(CPU_HostNorm_NONE, AddedInput)
+{
+    const auto l  = cpu_norm_layout::layer({5, 300}, 1);
+    const auto x  = Random(l.outer * l.inner, 5);
+    const auto x2 = Random(l.outer * l.inner, 6, 1.f, 2.f);
+    auto sum      = x;
+    for(std::size_t i = 0; i < sum.size(); ++i)
+        sum[i] += x2[i];
+
+    auto fused       = std::vector<float>(x.size());
+    auto separate    = std::vector<float>(x.size());
+    const auto* none = static_cast<const float*>(nullptr);
+    auto* no_stats   = static_cast<float*>(nullptr);
+    cpu_norm_forward(l,
+                     cpu_norm_kind::standard,
+                     x.data(),
+                     x2.data(),
+                     none,
+                     none,
+                     1e-5f,
+                     fused.data(),
+                     no_stats,
+                     no_stats);
+    cpu_norm_forward(l,
+                     cpu_norm_kind::standard,
+                     sum.data(),
+                     none,
+                     none,
+                     none,
+                     1e-5f,
+                     separate.data(),
+                     no_stats,
+                     no_stats);
+    EXPECT_EQ(fused, separate);
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+/// Helpers shared by the tests of the host references against their naive versions.
+namespace cpu_reference_test {
+
+/// Uniformly distributed values in [offset - scale, offset + scale).
+inline std::vector<float> Random(std::size_t size, unsigned seed, float scale = 1, float offset = 0)
+{
+    auto gen  = std::mt19937{seed};
+    auto dist = std::uniform_real_distribution<float>{-1.f, 1.f};
+    auto data = std::vector<float>(size);
+    for(auto& v : data)
+        v = offset + scale * dist(gen);
+    return data;
+}
+
+/// The error allowed for the expected value: tol, relative to it when it is above 1.
+inline double Tolerance(double expected, double tol)
+{
+    return tol * std::max(1.0, std::abs(expected));
+}
+
+/// Compares every element, stops at the first mismatch.
+template <class T, class U>
+void ExpectNear(const std::vector<T>& actual, const std::vector<U>& expected, double tol)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for(std::size_t i = 0; i < actual.size(); ++i)
+        ASSERT_NEAR(actual[i], expected[i], Tolerance(expected[i], tol)) << "at " << i;
+}
+
+} // namespace cpu_reference_test
@@ -0,0 +1,236 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "cpu_softmax.hpp"
+#include "unit_cpu_reference.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using cpu_reference_test::Random;
+using cpu_reference_test::Tolerance;
+
+struct SoftmaxCase
+{
+    std::vector<std::size_t> lengths;
+    std::size_t padding; // Added to the H and W strides.
+    miopenSoftmaxMode_t mode;
+    miopenSoftmaxAlgorithm_t algo;
+    float scale; // Input magnitude, large values need the max to be subtracted.
+};
+
+std::vector<std::size_t> Strides(const SoftmaxCase& tc)
+{
+    const auto w_stride = 1;
+    const auto h_stride = tc.lengths[3] + tc.padding;
+    const auto c_stride = tc.lengths[2] * h_stride + tc.padding;
+    return {tc.lengths[1] * c_stride, c_stride, h_stride, w_stride};
+}
+
+std::size_t Space(const SoftmaxCase& tc)
+{
+    return tc.lengths[0] * Strides(tc)[0];
+}
+
+/// Calls f(offset, row) for every element, row identifies the softmax row of the element.
+template <class F>
+void ForEachElement(const SoftmaxCase& tc, F f)
+{
+    const auto& l = tc.lengths;
+    const auto s  = Strides(tc);
+    for(std::size_t n = 0; n < l[0]; ++n)
+        for(std::size_t c = 0; c < l[1]; ++c)
+            for(std::size_t h = 0; h < l[2]; ++h)
+                for(std::size_t w = 0; w < l[3]; ++w)
+                {
+                    const auto row =
+                        tc.mode == MIOPEN_SOFTMAX_MODE_INSTANCE ? n : (n * l[2] + h) * l[3] + w;
+                    f(n * s[0] + c * s[1] + h * s[2] + w * s[3], row);
+                }
+}
+
+std::size_t Rows(const SoftmaxCase& tc)
+{
+    const auto& l = tc.lengths;
+    return tc.mode == MIOPEN_SOFTMAX_MODE_INSTANCE ? l[0] : l[0] * l[2] * l[3];
+}
+
+std::vector<double> NaiveForward(const SoftmaxCase& tc, const std::vector<float>& x)
+{
+    auto max = std::vector<double>(Rows(tc), -INFINITY);
+    auto sum = std::vector<double>(Rows(tc));
+    if(tc.algo != MIOPEN_SOFTMAX_FAST)
+        ForEachElement(tc, [&](auto i, auto r) { max[r] = std::max<double>(max[r], x[i]); });
+    else
+        std::fill(max.begin(), max.end(), 0);
+    ForEachElement(tc, [&](auto i, auto r) { sum[r] += std::exp(x[i] - max[r]); });
+
+    auto y = std::vector<double>(x.size());
+    ForEachElement(tc, [&](auto i, auto r) {
+        y[i] = tc.algo == MIOPEN_SOFTMAX_LOG ? x[i] - max[r] - std::log(sum[r])
+                                             : std::exp(x[i] - max[r]) / sum[r];
+    });
+    return y;
+}
+
+std::vector<double>
+NaiveBackward(const SoftmaxCase& tc, const std::vector<float>& y, const std::vector<float>& dy)
+{
+    auto dot = std::vector<double>(Rows(tc));
+    ForEachElement(tc, [&](auto i, auto r) {
+        dot[r] += tc.algo == MIOPEN_SOFTMAX_LOG ? dy[i] : static_cast<double>(y[i]) * dy[i];
+    });
+
+    auto dx = std::vector<double>(y.size());
+    ForEachElement(tc, [&](auto i, auto r) {
+        dx[i] = tc.algo == MIOPEN_SOFTMAX_LOG ? dy[i] - dot[r] * std::exp(y[i])
+                                              : y[i] * (dy[i] - dot[r]);
+    });
+    return dx;
+}
+
+/// Compares the elements of the tensor, padding is not written.
+template <class T>
+void ExpectNear(const SoftmaxCase& tc,
+                const std::vector<T>& actual,
+                const std::vector<double>& expected,
+                double tol)
+{
+    ForEachElement(tc, [&](auto i, auto) {
+        ASSERT_NEAR(actual[i], expected[i], Tolerance(expected[i], tol)) << "at " << i;
+    });
+}
+
+} // namespace
+
+class CPU_HostSoftmax_NONE : public testing::TestWithParam<SoftmaxCase>
+{
+};
+
+TEST_P(CPU_HostSoftmax_NONE, MatchesNaive)
+{
+    const auto& tc    = GetParam();
+    const auto layout = cpu_softmax_layout::make(tc.lengths, Strides(tc), tc.mode);
+    const auto x      = Random(Space(tc), 1, tc.scale);
+    const auto ref_y  = NaiveForward(tc, x);
+
+    auto y = std::vector<float>(x.size());
+    cpu_softmax_forward(layout, layout, tc.algo, x.data(), y.data());
+    ExpectNear(tc, y, ref_y, 1e-5);
+
+    // The GPU solvers blend with the previous contents.
+    auto blended = Random(Space(tc), 2);
+    auto ref_b   = ref_y;
+    ForEachElement(tc, [&](auto i, auto) { ref_b[i] = 0.5 * ref_y[i] + 0.25 * blended[i]; });
+    cpu_softmax_forward(layout, layout, tc.algo, x.data(), blended.data(), 0.5f, 0.25f);
+    ExpectNear(tc, blended, ref_b, 1e-5);
+
+    const auto dy     = Random(Space(tc), 3);
+    const auto ref_dx = NaiveBackward(tc, y, dy);
+    auto dx           = std::vector<double>(x.size());
+    cpu_softmax_backward(layout, layout, tc.algo, y.data(), dy.data(), dx.data());
+    ExpectNear(tc, dx, ref_dx, 1e-5);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Full,
+    CPU_HostSoftmax_NONE,
+    testing::Values(
+        SoftmaxCase{{2, 3, 4, 5}, 0, MIOPEN_SOFTMAX_MODE_INSTANCE, MIOPEN_SOFTMAX_FAST, 1},
+        SoftmaxCase{{2, 3, 4, 5}, 2, MIOPEN_SOFTMAX_MODE_INSTANCE, MIOPEN_SOFTMAX_ACCURATE, 1},
+        SoftmaxCase{{2, 3, 4, 5}, 1, MIOPEN_SOFTMAX_MODE_CHANNEL, MIOPEN_SOFTMAX_LOG, 1},
+        SoftmaxCase{{2, 3, 4, 5}, 0, MIOPEN_SOFTMAX_MODE_CHANNEL, MIOPEN_SOFTMAX_FAST, 1},
+        SoftmaxCase{{3, 5, 23, 37}, 0, MIOPEN_SOFTMAX_MODE_INSTANCE, MIOPEN_SOFTMAX_ACCURATE, 30},
+        SoftmaxCase{{3, 5, 23, 37}, 0, MIOPEN_SOFTMAX_MODE_INSTANCE, MIOPEN_SOFTMAX_LOG, 30},
+        SoftmaxCase{{2, 700, 2, 3}, 0, MIOPEN_SOFTMAX_MODE_CHANNEL, MIOPEN_SOFTMAX_ACCURATE, 30}));
+
+TEST(CPU_HostSoftmax_NONE, FastExp)
+{
+    double worst = 0;
+    for(auto x = -87.f; x <= 88.f; x += 0.001f)
+    {
+        const auto expected = std::exp(static_cast<double>(x));
+        const auto actual   = cpu_softmax_detail::fast_exp(x);
+        worst               = std::max(worst, std::abs(actual - expected) / expected);
+    }
+    EXPECT_LT(worst, 3e-7);
+    EXPECT_EQ(cpu_softmax_detail::fast_exp(-100.f), 0.f);
+    EXPECT_EQ(cpu_softmax_detail::fast_exp(-INFINITY), 0.f);
+}
+
+TEST(CPU_HostSoftmax_NONE, NonFiniteInputs)
+{
+    EXPECT_TRUE(std::isnan(cpu_softmax_detail::fast_exp(NAN)));
+    EXPECT_TRUE(std::isnan(cpu_softmax_detail::fast_exp(-NAN)));
+    EXPECT_EQ(cpu_softmax_detail::fast_exp(INFINITY), INFINITY);
+    EXPECT_TRUE(std::isfinite(cpu_softmax_detail::fast_exp(100.f)));
+
+    // NaN spoils its row only, as in the naive softmax.
+    const auto layout = cpu_softmax_layout::packed(2, 20);
+    auto x            = Random(40, 5);
+    x[3]              = NAN;
+    auto y            = std::vector<float>(40);
+    cpu_softmax_forward(layout, layout, MIOPEN_SOFTMAX_ACCURATE, x.data(), y.data());
+    for(std::size_t i = 0; i < 20; ++i)
+        EXPECT_TRUE(std::isnan(y[i])) << i;
+    for(std::size_t i = 20; i < 40; ++i)
+        EXPECT_TRUE(std::isfinite(y[i])) << i;
+}
+
+TEST(CPU_HostSoftmax_NONE, Attention)
+{
+    const auto rows    = std::size_t{6};
+    const auto len     = std::size_t{1500};
+    const auto descale = 0.5f;
+    const auto scale   = 2.f;
+    const auto x       = Random(rows * len, 4, 20.f);
+
+    auto y = std::vector<float>(x.size());
+    auto m = std::vector<float>(rows);
+    auto z = std::vector<float>(rows);
+    cpu_attn_softmax(rows, len, x.data(), y.data(), m.data(), z.data(), descale, scale);
+
+    for(std::size_t r = 0; r < rows; ++r)
+    {
+        double max = -INFINITY;
+        double sum = 0;
+        for(std::size_t i = 0; i < len; ++i)
+            max = std::max<double>(max, x[r * len + i] * descale);
+        for(std::size_t i = 0; i < len; ++i)
+            sum += std::exp(x[r * len + i] * descale - max);
+        EXPECT_EQ(m[r], max);
+        EXPECT_NEAR(z[r], 1 / sum, 1e-6 / sum);
+        for(std::size_t i = 0; i < len; ++i)
+        {
+            const auto expected = std::exp(x[r * len + i] * descale - max) / sum * scale;
+            ASSERT_NEAR(y[r * len + i], expected, Tolerance(expected, 1e-5)) << r << " " << i;
+        }
+    }
+}
@@ -0,0 +1,313 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "cpu_getitem.hpp"
+#include "cpu_strided_copy.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct View
+{
+    std::vector<size_t> lengths;
+    std::vector<size_t> strides;
+
+    size_t Offset(size_t linear) const
+    {
+        size_t offset = 0;
+        for(auto d = lengths.size(); d-- > 0;)
+        {
+            offset += linear % lengths[d] * strides[d];
+            linear /= lengths[d];
+        }
+        return offset;
+    }
+
+    size_t Elements() const
+    {
+        return std::accumulate(
+            lengths.begin(), lengths.end(), size_t{1}, std::multiplies<size_t>{});
+    }
+
+    size_t Space() const
+    {
+        size_t space = 1;
+        for(size_t d = 0; d < lengths.size(); ++d)
+            space += (lengths[d] - 1) * strides[d];
+        return space;
+    }
+};
+
+View Packed(std::vector<size_t> lengths, std::vector<size_t> order = {})
+{
+    if(order.empty())
+    {
+        order.resize(lengths.size());
+        std::iota(order.begin(), order.end(), 0);
+    }
+    auto view    = View{lengths, std::vector<size_t>(lengths.size())};
+    size_t space = 1;
+    for(auto d = order.size(); d-- > 0;)
+    {
+        view.strides[order[d]] = space;
+        space *= lengths[order[d]];
+    }
+    return view;
+}
+
+std::vector<float> Iota(size_t size)
+{
+    auto data = std::vector<float>(size);
+    std::iota(data.begin(), data.end(), 1.f);
+    return data;
+}
+
+cpu_copy_plan MakePlan(const View& src, const View& dst)
+{
+    auto plan = cpu_copy_plan{};
+    for(size_t d = 0; d < src.lengths.size(); ++d)
+        plan.add(src.lengths[d], src.strides[d], dst.strides[d]);
+    return plan;
+}
+
+} // namespace
+
+TEST(CPU_HostStridedCopyPlan_NONE, CollapsesContiguousDims)
+{
+    const auto packed = Packed({2, 3, 1, 4, 5});
+    auto dims         = MakePlan(packed, packed).collapsed();
+    ASSERT_EQ(dims.size(), 1);
+    EXPECT_EQ(dims[0].length, 120);
+
+    // Cat along dim 1: the output rows are longer, only the inner dims merge.
+    const auto input  = Packed({2, 3, 4, 5});
+    const auto output = Packed({2, 7, 4, 5});
+    dims              = MakePlan(input, output).collapsed();
+    ASSERT_EQ(dims.size(), 2);
+    EXPECT_EQ(dims[1].length, 60);
+
+    // Scatter dims go next to the innermost one.
+    auto plan = cpu_copy_plan{};
+    plan.add_scatter(20, {0, 7, 7});
+    plan.add(2, 60, 100);
+    plan.add(20, 1, 1);
+    dims = plan.collapsed();
+    ASSERT_EQ(dims.size(), 3);
+    EXPECT_FALSE(dims[0].serial());
+    EXPECT_TRUE(dims[1].scatter());
+}
+
+class CPU_HostStridedCopy_NONE : public testing::TestWithParam<std::pair<View, View>>
+{
+};
+
+TEST_P(CPU_HostStridedCopy_NONE, MatchesNaive)
+{
+    const auto& [src, dst] = GetParam();
+    const auto x           = Iota(src.Space());
+    auto y                 = std::vector<float>(dst.Space(), -1.f);
+    auto ref               = y;
+
+    for(size_t i = 0; i < src.Elements(); ++i)
+        ref[dst.Offset(i)] = x[src.Offset(i)];
+    MakePlan(src, dst).run(x.data(), y.data());
+
+    EXPECT_EQ(y, ref);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Unit,
+    CPU_HostStridedCopy_NONE,
+    testing::Values(std::make_pair(Packed({3, 5, 7}), Packed({3, 5, 7})),
+                    std::make_pair(Packed({3, 5, 7}), Packed({3, 5, 7}, {2, 1, 0})),
+                    std::make_pair(Packed({4, 33, 1, 17}, {1, 3, 2, 0}), Packed({4, 33, 1, 17})),
+                    std::make_pair(Packed({2, 3, 4, 5}), View{{2, 3, 4, 5}, {150, 50, 10, 2}}),
+                    std::make_pair(Packed({3, 70000}), Packed({3, 70000}, {1, 0})),
+                    std::make_pair(Packed({300000}), Packed({300000}))));
+
+TEST(CPU_HostStridedCopy_NONE, AccumulatesScatter)
+{
+    const auto x       = Iota(6 * 40);
+    auto y             = std::vector<float>(5 * 40);
+    auto ref           = y;
+    const auto offsets = std::vector<size_t>{40, 0, 40, 160, 40, 0};
+
+    for(size_t i = 0; i < 6; ++i)
+        for(size_t j = 0; j < 40; ++j)
+            ref[offsets[i] + j] += x[i * 40 + j];
+
+    auto plan = cpu_copy_plan{};
+    plan.add_scatter(40, offsets);
+    plan.add(40, 1, 1);
+    plan.run(x.data(), y.data(), cpu_copy_add{});
+
+    EXPECT_EQ(y, ref);
+}
+
+namespace {
+
+/// The element by element loop of the GetItem references before the copy engine.
+void NaiveGetitem(const std::vector<float>& dy,
+                  tensor_view_t<5> dy_tv,
+                  const std::vector<std::vector<int32_t>>& indexs,
+                  std::vector<float>& dx,
+                  tensor_view_t<5> dx_tv,
+                  std::vector<int32_t>& error,
+                  const std::vector<int32_t>& dims,
+                  const std::vector<int32_t>& slices)
+{
+    const auto indexCount  = indexs.size();
+    const auto index_numel = indexCount > 0 ? indexs[0].size() : 0;
+    auto element_index     = std::vector<int32_t>(indexCount * index_numel + indexCount);
+    const auto start_dim   = indexCount > 0 ? dims[0] : 0;
+    const auto info_offset = indexCount * index_numel;
+    const auto sliceCount  = static_cast<int32_t>(slices.size() / 4);
+
+    for(size_t j = 0; j < indexCount; ++j)
+    {
+        const auto dim_size = static_cast<int32_t>(dx_tv.size[dims[j]]);
+        for(size_t o = 0; o < index_numel; ++o)
+        {
+            const auto index = indexs[j][o];
+            if(index >= 0 && index < dim_size)
+                element_index[o * indexCount + j] = index;
+            else if(index >= -dim_size && index < 0)
+                element_index[o * indexCount + j] = index + dim_size;
+            else
+                error[j] = -1;
+        }
+        element_index[info_offset + j] = dims[j];
+    }
+    miopen::slice_tv<5>(dx_tv, sliceCount, slices.data());
+
+    const auto numel =
+        dy_tv.size[0] * dy_tv.size[1] * dy_tv.size[2] * dy_tv.size[3] * dy_tv.size[4];
+    for(size_t o = 0; o < numel; ++o)
+    {
+        tensor_layout_t<5> ncdhw(dy_tv, o);
+        tensor_layout_t<5> idx(ncdhw);
+        if(indexCount > 0)
+        {
+            size_t dim_cursor = ncdhw.layout[start_dim];
+            size_t i          = start_dim;
+            for(size_t j = 0; j < indexCount; ++i, ++j)
+                idx.layout[element_index[info_offset + j]] =
+                    element_index[dim_cursor * indexCount + j];
+
+            i          = element_index[info_offset + indexCount - 1] + 1;
+            dim_cursor = start_dim + 1;
+            for(; i < 5; ++i, ++dim_cursor)
+                idx.layout[i] = ncdhw.layout[dim_cursor];
+        }
+        dx[dx_tv.get_tensor_view_idx(idx)] += dy[dy_tv.get_tensor_view_idx(ncdhw)];
+    }
+}
+
+tensor_view_t<5> Expanded(const std::vector<size_t>& lengths)
+{
+    const auto view = Packed(lengths);
+    auto tv         = tensor_view_t<5>{};
+    for(size_t i = 0; i < 5; ++i)
+    {
+        tv.size[i]   = i < lengths.size() ? lengths[i] : 1;
+        tv.stride[i] = i < lengths.size() ? view.strides[i] : 1;
+    }
+    return tv;
+}
+
+struct GetitemCase
+{
+    std::vector<size_t> dy;
+    std::vector<size_t> dx;
+    std::vector<int32_t> dims;
+    size_t index_numel;
+    std::vector<int32_t> slices;
+};
+
+} // namespace
+
+class CPU_HostGetitem_NONE : public testing::TestWithParam<GetitemCase>
+{
+};
+
+TEST_P(CPU_HostGetitem_NONE, MatchesElementLoop)
+{
+    const auto& tc   = GetParam();
+    const auto dy_tv = Expanded(tc.dy);
+    const auto dx_tv = Expanded(tc.dx);
+    const auto dy    = Iota(Packed(tc.dy).Elements());
+
+    // Indices repeat, are negative and some are out of range.
+    auto gen    = std::mt19937{static_cast<unsigned>(tc.index_numel)};
+    auto indexs = std::vector<std::vector<int32_t>>{};
+    for(auto dim : tc.dims)
+    {
+        const auto size = static_cast<int32_t>(tc.dx[dim]);
+        auto dist       = std::uniform_int_distribution<int32_t>{-size, size - 1};
+        auto& index     = indexs.emplace_back(tc.index_numel);
+        std::generate(index.begin(), index.end(), [&]() { return dist(gen); });
+    }
+    if(!indexs.empty())
+        indexs[0].back() = static_cast<int32_t>(tc.dx[tc.dims[0]]);
+
+    auto dx        = std::vector<float>(Packed(tc.dx).Elements());
+    auto ref       = dx;
+    auto error     = std::vector<int32_t>(tc.dims.size());
+    auto ref_error = error;
+    auto ptrs      = std::vector<const int32_t*>{};
+    for(const auto& index : indexs)
+        ptrs.push_back(index.data());
+
+    cpu_getitem_backward(dy.data(),
+                         dy_tv,
+                         indexs.size(),
+                         ptrs.data(),
+                         tc.index_numel,
+                         dx.data(),
+                         dx_tv,
+                         error.data(),
+                         tc.dims.data(),
+                         tc.slices.size() / 4,
+                         tc.slices.data());
+    NaiveGetitem(dy, dy_tv, indexs, ref, dx_tv, ref_error, tc.dims, tc.slices);
+
+    EXPECT_EQ(dx, ref);
+    EXPECT_EQ(error, ref_error);
+}
+
+INSTANTIATE_TEST_SUITE_P(Unit,
+                         CPU_HostGetitem_NONE,
+                         testing::Values(GetitemCase{{300, 16}, {64, 16}, {0}, 300, {}},
+                                         GetitemCase{{8, 50, 9}, {8, 12, 9}, {1}, 50, {}},
+                                         GetitemCase{{4, 60}, {4, 10, 12}, {1, 2}, 60, {}},
+                                         GetitemCase{{12, 40}, {24, 40}, {0}, 12, {1, 0, 40, 2}},
+                                         GetitemCase{{6, 7}, {6, 7}, {}, 0, {}}));
@@ -0,0 +1,327 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "../cpu_fft.hpp"
+#include "../cpu_winograd.hpp"
+#include "unit_cpu_reference.hpp"
+
+#include <miopen/conv/heuristics/cost_model.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using miopen::conv::FftPlan;
+using miopen::conv::WinogradPlan;
+using miopen::conv::WinogradScheme;
+using miopen::conv::cost_model::ConvShape;
+using cpu_reference_test::ExpectNear;
+using cpu_reference_test::Random;
+
+ConvShape MakeShape(std::size_t n,
+                    std::size_t c,
+                    std::size_t k,
+                    std::size_t group,
+                    std::size_t in,
+                    std::size_t filter,
+                    std::size_t pad,
+                    std::size_t stride = 1)
+{
+    auto shape        = ConvShape{};
+    shape.n           = n;
+    shape.c           = c;
+    shape.k           = k;
+    shape.group       = group;
+    shape.in_spatial  = {1, in, in};
+    shape.filter      = {1, filter, filter};
+    shape.stride      = {1, stride, stride};
+    const auto out    = (in + 2 * pad - filter) / stride + 1;
+    shape.out_spatial = {1, out, out};
+    return shape;
+}
+
+/// Direct forward convolution with stride 1 and groups, NCHW and KCRS.
+std::vector<float> ConvForward(const ConvShape& s,
+                               int pad,
+                               const std::vector<float>& x,
+                               const std::vector<float>& w)
+{
+    const auto in  = static_cast<long>(s.in_spatial[1]);
+    const auto out = static_cast<long>(s.out_spatial[1]);
+    const auto r   = static_cast<long>(s.filter[1]);
+    const auto cg  = s.c / s.group;
+    const auto kg  = s.k / s.group;
+    auto y         = std::vector<float>(s.n * s.k * out * out);
+    for(std::size_t n = 0; n < s.n; ++n)
+        for(std::size_t k = 0; k < s.k; ++k)
+            for(long i = 0; i < out; ++i)
+                for(long j = 0; j < out; ++j)
+                {
+                    auto sum = 0.0;
+                    for(std::size_t c = 0; c < cg; ++c)
+                        for(long u = 0; u < r; ++u)
+                            for(long v = 0; v < r; ++v)
+                            {
+                                const auto row = i + u - pad;
+                                const auto col = j + v - pad;
+                                if(row < 0 || col < 0 || row >= in || col >= in)
+                                    continue;
+                                const auto channel = k / kg * cg + c;
+                                sum += x[((n * s.c + channel) * in + row) * in + col] *
+                                       w[((k * cg + c) * r + u) * r + v];
+                            }
+                    y[((n * s.k + k) * out + i) * out + j] = static_cast<float>(sum);
+                }
+    return y;
+}
+
+/// Direct backward data convolution with stride 1 and groups.
+std::vector<float> ConvBackwardData(const ConvShape& s,
+                                    int pad,
+                                    const std::vector<float>& dy,
+                                    const std::vector<float>& w)
+{
+    const auto in  = static_cast<long>(s.in_spatial[1]);
+    const auto out = static_cast<long>(s.out_spatial[1]);
+    const auto r   = static_cast<long>(s.filter[1]);
+    const auto cg  = s.c / s.group;
+    const auto kg  = s.k / s.group;
+    auto dx        = std::vector<float>(s.n * s.c * in * in, 0.f);
+    for(std::size_t n = 0; n < s.n; ++n)
+        for(std::size_t k = 0; k < s.k; ++k)
+            for(long i = 0; i < out; ++i)
+                for(long j = 0; j < out; ++j)
+                    for(std::size_t c = 0; c < cg; ++c)
+                        for(long u = 0; u < r; ++u)
+                            for(long v = 0; v < r; ++v)
+                            {
+                                const auto row = i + u - pad;
+                                const auto col = j + v - pad;
+                                if(row < 0 || col < 0 || row >= in || col >= in)
+                                    continue;
+                                const auto channel = k / kg * cg + c;
+                                dx[((n * s.c + channel) * in + row) * in + col] +=
+                                    dy[((n * s.k + k) * out + i) * out + j] *
+                                    w[((k * cg + c) * r + u) * r + v];
+                            }
+    return dx;
+}
+
+} // namespace
+
+TEST(CPU_WinogradPlan_NONE, MatchesSolverBuffers)
+{
+    // ConvMPBidirectWinograd<2, 3> on a grouped problem.
+    const auto shape = MakeShape(2, 8, 12, 2, 9, 3, 1);
+    const auto plan  = WinogradPlan::Make(WinogradScheme::Bidirectional, shape, 2, 3, 2, 3, 1, 1);
+    const auto info  = [](miopen::ConvWinoBuffType type) {
+        return miopen::WinogradBufferInfo<2, 3>(2,
+                                                6,
+                                                4,
+                                                2,
+                                                9,
+                                                9,
+                                                3,
+                                                3,
+                                                miopen::MemLayout_t::GCNHW,
+                                                miopen::ConvWinoXformType::N_GXhXw_C_Th_Tw,
+                                                4,
+                                                type,
+                                                4,
+                                                4)
+            .buff_info.total_byte_size;
+    };
+    EXPECT_EQ(plan.in.total_byte_size, info(miopen::ConvWinoBuffType::Input));
+    EXPECT_EQ(plan.out.total_byte_size, info(miopen::ConvWinoBuffType::Output));
+    EXPECT_EQ(plan.wei.total_byte_size, info(miopen::ConvWinoBuffType::Weight));
+    EXPECT_EQ(plan.GetWorkspaceSize(), 4 * 16 * 2 * (2 * 4 * 25 + 2 * 6 * 25 + 6 * 4));
+    EXPECT_EQ(plan.GetWeiOffset(), plan.in.total_byte_size + plan.out.total_byte_size);
+
+    // ConvWinograd3x3MultipassWrW<3, 3> with stride 2: a 3x3 dw from a 14x14 dy.
+    const auto wrw   = MakeShape(4, 8, 16, 1, 28, 3, 1, 2);
+    const auto multi = WinogradPlan::Make(WinogradScheme::MultipassWrW, wrw, 3, 3, 3, 3, 1, 1);
+    EXPECT_EQ(multi.xform_h, 3 + 2 * 2);
+    const auto wrw_info = [](miopen::ConvWinoBuffType type, miopen::MemLayout_t layout) {
+        return miopen::WinogradBufferInfo<3, 3>(8, 16, 4, 3, 3, 14, 14, layout, 4, type, 7, 7)
+            .buff_info.total_byte_size;
+    };
+    EXPECT_EQ(multi.in.total_byte_size,
+              wrw_info(miopen::ConvWinoBuffType::Input, miopen::MemLayout_t::HWNC));
+    EXPECT_EQ(multi.out.total_byte_size,
+              wrw_info(miopen::ConvWinoBuffType::Output, miopen::MemLayout_t::HWCN));
+    EXPECT_EQ(multi.wei.total_byte_size,
+              wrw_info(miopen::ConvWinoBuffType::Weight, miopen::MemLayout_t::HWNC));
+
+    EXPECT_ANY_THROW(WinogradPlan::Make(
+        WinogradScheme::Bidirectional, MakeShape(1, 1, 1, 1, 8, 5, 2), 2, 3, 2, 3, 2, 2));
+}
+
+TEST(CPU_WinogradPlan_NONE, CountsFlops)
+{
+    // F(2x2, 3x3) does 16 multiplications per tile instead of 36.
+    const auto shape  = MakeShape(1, 64, 64, 1, 56, 3, 1);
+    const auto plan   = WinogradPlan::Make(WinogradScheme::Bidirectional, shape, 2, 3, 2, 3, 1, 1);
+    const auto direct = 2.0 * 64 * 64 * 56 * 56 * 9;
+    EXPECT_DOUBLE_EQ(plan.GetGemmFlops(), direct * 16 / 36);
+    EXPECT_GT(plan.GetFlops(), plan.GetGemmFlops());
+    EXPECT_EQ(plan.input_transforms, 64 * 28 * 28);
+    EXPECT_EQ(plan.gemm_batch, 16);
+
+    // The fused kernels split a 5x5 filter into four 3x3 blocks and need no workspace.
+    const auto fused = WinogradPlan::Make(
+        WinogradScheme::Fused, MakeShape(1, 64, 64, 1, 56, 5, 2), 2, 3, 2, 3, 2, 2);
+    EXPECT_EQ(fused.GetWorkspaceSize(), 0);
+    EXPECT_EQ(fused.filter_tiles_h * fused.filter_tiles_w, 4);
+
+    // Stride 2 turns a 3x3 filter into 4 phases of 2x2, 1x2, 2x1 and 1x1.
+    const auto strided = WinogradPlan::Make(
+        WinogradScheme::Fused, MakeShape(1, 64, 64, 1, 56, 3, 1, 2), 2, 3, 2, 3, 1, 1);
+    EXPECT_EQ(strided.filter_tiles_h * strided.filter_tiles_w, 4);
+}
+
+TEST(CPU_FftPlan_NONE, MatchesSolverWorkspace)
+{
+    for(auto image : {7, 14, 27, 28})
+    {
+        const auto shape = MakeShape(16, 32, 48, 1, image, 5, 2);
+        for(auto backward : {false, true})
+        {
+            const auto plan = FftPlan::Make(shape, 2, 2, backward);
+            ASSERT_TRUE(plan.IsSupported());
+
+            // fft::GetWorkspaceSize()
+            const auto tile = image == 7 ? 12 : image == 14 ? 18 : 32;
+            const auto n    = tile * (tile / 2 + 1);
+            const auto src  = (backward ? 48 : 32) * 16 + 64;
+            const auto dst  = (backward ? 32 : 48) * 16 + 64;
+            const auto temp = std::max(src + 32 * 48 + 64, dst);
+            EXPECT_EQ(plan.GetWorkspaceSize(), sizeof(float) * 2 * 2 * n * temp);
+            EXPECT_EQ(plan.GetFilterOffset(), plan.GetHalfSize() + n * src);
+        }
+    }
+
+    EXPECT_FALSE(FftPlan::Make(MakeShape(1, 1, 1, 1, 30, 5, 2), 2, 2).IsSupported());
+    EXPECT_ANY_THROW(FftPlan::Make(MakeShape(1, 2, 2, 2, 28, 5, 2), 2, 2));
+}
+
+TEST(CPU_HostWinograd_NONE, TransformMatrices)
+{
+    // F(2, 3) of Lavin and Gray, up to the sign of the point at the infinity.
+    const auto f23 = cpu_winograd_make_matrices(2, 3);
+    const auto at  = std::vector<double>{1, 1, 1, 0, 0, 1, -1, 1};
+    const auto g   = std::vector<double>{1, 0, 0, .5, .5, .5, .5, -.5, .5, 0, 0, 1};
+    const auto bt  = std::vector<double>{1, 0, -1, 0, 0, 1, 1, 0, 0, -1, 1, 0, 0, -1, 0, 1};
+    for(std::size_t i = 0; i < at.size(); ++i)
+        EXPECT_NEAR(f23.at[i], at[i], 1e-12);
+    for(std::size_t i = 0; i < g.size(); ++i)
+        EXPECT_NEAR(f23.g[i], g[i], 1e-12);
+    for(std::size_t i = 0; i < bt.size(); ++i)
+        EXPECT_NEAR(f23.bt[i], bt[i], 1e-12);
+
+    // The 1D identity holds for every supported tile.
+    for(auto m : {1, 2, 3, 4, 5, 6, 7})
+    {
+        for(auto r : {1, 2, 3})
+        {
+            const auto t = cpu_winograd_make_matrices(m, r);
+            const auto d = Random(t.alpha, 1);
+            const auto f = Random(r, 2);
+            for(int i = 0; i < m; ++i)
+            {
+                auto expected = 0.0;
+                for(int l = 0; l < r; ++l)
+                    expected += static_cast<double>(d[i + l]) * f[l];
+                auto actual = 0.0;
+                for(int j = 0; j < t.alpha; ++j)
+                {
+                    auto u = 0.0;
+                    auto v = 0.0;
+                    for(int l = 0; l < r; ++l)
+                        u += t.g[j * r + l] * f[l];
+                    for(int p = 0; p < t.alpha; ++p)
+                        v += t.bt[j * t.alpha + p] * d[p];
+                    actual += t.at[i * t.alpha + j] * u * v;
+                }
+                EXPECT_NEAR(actual, expected, 1e-9) << "F(" << m << ", " << r << ")";
+            }
+        }
+    }
+}
+
+TEST(CPU_HostWinograd_NONE, MatchesDirectConvolution)
+{
+    const auto shape  = MakeShape(2, 6, 4, 2, 11, 3, 1);
+    const auto x      = Random(2 * 6 * 11 * 11, 3);
+    const auto w      = Random(4 * 3 * 3 * 3, 4);
+    const auto dy     = Random(2 * 4 * 11 * 11, 5);
+    const auto y_ref  = ConvForward(shape, 1, x, w);
+    const auto dx_ref = ConvBackwardData(shape, 1, dy, w);
+
+    for(auto m : {2, 3, 4, 5, 6})
+    {
+        const auto fwd = WinogradPlan::Make(WinogradScheme::Bidirectional, shape, m, 3, m, 3, 1, 1);
+        auto workspace = std::vector<float>(fwd.GetWorkspaceSize() / sizeof(float));
+        auto y         = std::vector<float>(y_ref.size());
+        cpu_winograd_convolution(fwd, x.data(), w.data(), y.data(), workspace.data());
+        ExpectNear(y, y_ref, 1e-4f * m * m);
+
+        const auto bwd =
+            WinogradPlan::Make(WinogradScheme::Bidirectional, shape, m, 3, m, 3, 1, 1, true);
+        workspace.assign(bwd.GetWorkspaceSize() / sizeof(float), 0.f);
+        auto dx = std::vector<float>(dx_ref.size());
+        cpu_winograd_convolution(bwd, dy.data(), w.data(), dx.data(), workspace.data());
+        ExpectNear(dx, dx_ref, 1e-4f * m * m);
+    }
+}
+
+TEST(CPU_HostFft_NONE, MatchesDirectConvolution)
+{
+    for(auto image : {7, 14, 27})
+    {
+        const auto shape  = MakeShape(2, 3, 4, 1, image, 5, 2);
+        const auto size   = static_cast<std::size_t>(image * image);
+        const auto x      = Random(2 * 3 * size, 6);
+        const auto w      = Random(4 * 3 * 25, 7);
+        const auto dy     = Random(2 * 4 * size, 8);
+        const auto y_ref  = ConvForward(shape, 2, x, w);
+        const auto dx_ref = ConvBackwardData(shape, 2, dy, w);
+
+        const auto fwd = FftPlan::Make(shape, 2, 2);
+        auto workspace = std::vector<std::complex<float>>(fwd.GetWorkspaceSize() / 8);
+        auto y         = std::vector<float>(y_ref.size());
+        cpu_fft_convolution(fwd, x.data(), w.data(), y.data(), workspace.data());
+        ExpectNear(y, y_ref, 1e-4f);
+
+        const auto bwd = FftPlan::Make(shape, 2, 2, true);
+        workspace.assign(bwd.GetWorkspaceSize() / 8, {});
+        auto dx = std::vector<float>(dx_ref.size());
+        cpu_fft_convolution(bwd, dy.data(), w.data(), dx.data(), workspace.data());
+        ExpectNear(dx, dx_ref, 1e-4f);
+    }
+}
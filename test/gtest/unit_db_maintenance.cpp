@@ -0,0 +1,214 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_maintenance.hpp>
+#include <miopen/db_merge.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/kern_db.hpp>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+namespace {
+
+namespace fs = miopen::fs;
+
+void Write(const fs::path& file, const std::string& contents)
+{
+    std::ofstream{file, std::ios::binary} << contents;
+}
+
+std::string Read(const fs::path& file)
+{
+    auto stream = std::ifstream{file, std::ios::binary};
+    return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+std::string FindValue(float time)
+{
+    return std::to_string(time) + ",0,miopenConvolutionFwdAlgoGEMM";
+}
+
+} // namespace
+
+TEST(CPU_DbMaintenance_NONE, ReadsAndWritesTextDb)
+{
+    const miopen::TmpDir dir{"db-maintenance-test"};
+    const auto file = dir.path / "test.udb.txt";
+
+    Write(file, "K1=B:b;A:a1\r\ngarbage\n\nK0=A:x;broken;\nK1=A:a2;C:c");
+
+    auto stats         = miopen::TextDbReadStats{};
+    const auto records = miopen::ReadTextDb(file, 0, &stats);
+    EXPECT_EQ(stats.lines, 5);
+    EXPECT_EQ(stats.ill_formed, 2);
+    EXPECT_EQ(stats.duplicate_keys, 1);
+
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records.at("K0").at("A"), "x");
+    EXPECT_EQ(records.at("K1").size(), 3);
+    EXPECT_EQ(records.at("K1").at("A"), "a1");
+
+    miopen::WriteTextDb(file, records);
+    EXPECT_EQ(Read(file), "K0=A:x\nK1=A:a1;B:b;C:c\n");
+    EXPECT_EQ(miopen::ReadTextDb(file), records);
+
+    EXPECT_TRUE(miopen::ReadTextDb(dir.path / "missing.udb.txt").empty());
+}
+
+TEST(CPU_DbMaintenance_NONE, ParallelReadMatchesSequential)
+{
+    const miopen::TmpDir dir{"db-maintenance-test"};
+    const auto file = dir.path / "large.ufdb.txt";
+
+    // Large enough to be split into several chunks, with keys repeated across them.
+    {
+        auto stream      = std::ofstream{file, std::ios::binary};
+        const auto value = ":" + FindValue(1);
+        for(auto i = 0; i < 100000; ++i)
+        {
+            stream << "key" << i % 40000 << "=S" << i % 7 << value << ";T" << i % 3 << value
+                   << '\n';
+        }
+    }
+
+    auto sequential_stats = miopen::TextDbReadStats{};
+    auto parallel_stats   = miopen::TextDbReadStats{};
+    const auto sequential = miopen::ReadTextDb(file, 1, &sequential_stats);
+    const auto parallel   = miopen::ReadTextDb(file, 8, &parallel_stats);
+
+    EXPECT_EQ(sequential.size(), 40000);
+    EXPECT_EQ(sequential, parallel);
+    EXPECT_EQ(sequential_stats.lines, 100000);
+    EXPECT_EQ(parallel_stats.lines, 100000);
+    EXPECT_EQ(sequential_stats.duplicate_keys, 60000);
+    EXPECT_EQ(parallel_stats.duplicate_keys, 60000);
+}
+
+TEST(CPU_DbMaintenance_NONE, Diff)
+{
+    const auto from = miopen::TextDbRecords{{"K0", {{"A", "1"}, {"B", "2"}}}, {"K1", {{"A", "1"}}}};
+    const auto to   = miopen::TextDbRecords{{"K0", {{"A", "3"}, {"C", "2"}}}, {"K2", {{"A", "1"}}}};
+
+    const auto diff = miopen::DiffTextDbs(from, to);
+    EXPECT_EQ(diff.removed, (std::vector<std::string>{"K0:B", "K1:A"}));
+    EXPECT_EQ(diff.added, (std::vector<std::string>{"K0:C", "K2:A"}));
+    EXPECT_EQ(diff.changed, (std::vector<std::string>{"K0:A"}));
+
+    const auto same = miopen::DiffTextDbs(from, from);
+    EXPECT_TRUE(same.removed.empty() && same.added.empty() && same.changed.empty());
+}
+
+TEST(CPU_DbMaintenance_NONE, Prune)
+{
+    auto records =
+        miopen::TextDbRecords{{"K0", {{"Old", "1"}, {"New", "2"}}}, {"K1", {{"Old", "1"}}}};
+
+    const auto removed =
+        miopen::PruneTextDb(records, [](const std::string& id) { return id != "Old"; });
+    EXPECT_EQ(removed, 2);
+    EXPECT_EQ(records, (miopen::TextDbRecords{{"K0", {{"New", "2"}}}}));
+}
+
+TEST(CPU_DbMaintenance_NONE, Stats)
+{
+    const auto records = miopen::TextDbRecords{
+        {"K0", {{"A", FindValue(2)}, {"B", FindValue(1)}}},
+        {"K1", {{"A", FindValue(1)}, {"B", FindValue(3)}, {"C", "ill-formed"}}},
+        {"K2", {{"B", FindValue(5)}}},
+    };
+
+    const auto find = miopen::GetTextDbStats(miopen::DbKinds::FindDb, records);
+    EXPECT_EQ(find.records, 3);
+    EXPECT_EQ(find.values, 6);
+    EXPECT_EQ(find.per_solver.at("A").values, 2);
+    EXPECT_EQ(find.per_solver.at("A").best, 1);
+    EXPECT_EQ(find.per_solver.at("B").values, 3);
+    EXPECT_EQ(find.per_solver.at("B").best, 2);
+    EXPECT_EQ(find.per_solver.at("C").best, 0);
+
+    const auto perf = miopen::GetTextDbStats(miopen::DbKinds::PerfDb, records);
+    EXPECT_EQ(perf.per_solver.at("B").values, 3);
+    EXPECT_EQ(perf.per_solver.at("B").best, 0);
+}
+
+TEST(CPU_DbMaintenance_NONE, MergeTextDbs)
+{
+    auto find = miopen::TextDbRecords{{"K0", {{"A", FindValue(2)}}}};
+    const auto find_stats =
+        miopen::MergeTextDbs(miopen::DbKinds::FindDb,
+                             find,
+                             {{{"K0", {{"A", FindValue(3)}, {"B", FindValue(4)}}}},
+                              {{"K0", {{"A", FindValue(1)}, {"B", FindValue(5)}}}}});
+    EXPECT_EQ(find.at("K0").at("A"), FindValue(1));
+    EXPECT_EQ(find.at("K0").at("B"), FindValue(4));
+    EXPECT_EQ(find_stats.added, 1);
+    EXPECT_EQ(find_stats.replaced, 1);
+    EXPECT_EQ(find_stats.kept, 2);
+
+    auto perf = miopen::TextDbRecords{{"K0", {{"A", "target"}}}};
+    miopen::MergeTextDbs(miopen::DbKinds::PerfDb,
+                         perf,
+                         {{{"K0", {{"A", "s0"}, {"B", "s0"}}}}, {{"K0", {{"B", "s1"}}}}});
+    EXPECT_EQ(perf.at("K0").at("A"), "target");
+    EXPECT_EQ(perf.at("K0").at("B"), "s0");
+}
+
+#if MIOPEN_ENABLE_SQLITE
+TEST(CPU_DbMaintenance_NONE, KernDb)
+{
+    const miopen::TmpDir dir{"db-maintenance-test"};
+    auto db = miopen::KernDb{miopen::DbKinds::KernelDb, dir.path / "test.ukdb", false};
+
+    for(const auto& name : {"a.s", "b.s", "c.cpp"})
+    {
+        auto config = miopen::KernelConfig{name, "-O3", std::vector<char>(4096, 'x')};
+        ASSERT_TRUE(db.StoreRecord(config));
+    }
+    db.sql.Exec("UPDATE kern_db SET kernel_hash = 'broken' WHERE kernel_name = 'b.s';");
+
+    const auto stats = miopen::GetKernDbStats(db);
+    EXPECT_EQ(stats.records, 3);
+    EXPECT_EQ(stats.per_solver.at("b.s").values, 1);
+
+    EXPECT_EQ(miopen::PruneKernDb(db, 2), 1);
+    EXPECT_EQ(miopen::GetKernDbStats(db).records, 2);
+    EXPECT_NO_THROW(miopen::VacuumKernDb(db));
+
+    auto config = miopen::KernelConfig{"a.s", "-O3", {}};
+    EXPECT_TRUE(db.FindRecord(config));
+
+    auto copy = miopen::KernDb{miopen::DbKinds::KernelDb, dir.path / "copy.ukdb", false};
+    EXPECT_EQ(miopen::MergeKernDbs(copy, db), 2);
+    EXPECT_EQ(miopen::MergeKernDbs(copy, db), 0);
+    EXPECT_TRUE(copy.FindRecord(config));
+}
+#endif
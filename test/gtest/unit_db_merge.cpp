@@ -0,0 +1,210 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_merge.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace fs = miopen::fs;
+
+constexpr const char* find_db = "gfx90a68.HIP.ufdb.txt";
+constexpr const char* perf_db = "gfx90a68.HIP.fdb.udb.txt";
+
+void Write(const fs::path& file, const std::string& contents)
+{
+    fs::create_directories(file.parent_path());
+    std::ofstream{file} << contents;
+}
+
+std::map<std::string, std::string> Read(const fs::path& file)
+{
+    auto values = std::map<std::string, std::string>{};
+    auto stream = std::ifstream{file};
+    auto line   = std::string{};
+    while(std::getline(stream, line))
+    {
+        const auto eq = line.find('=');
+        auto items    = std::istringstream{line.substr(eq + 1)};
+        auto item     = std::string{};
+        while(std::getline(items, item, ';'))
+        {
+            const auto colon = item.find(':');
+            values[line.substr(0, eq) + "/" + item.substr(0, colon)] = item.substr(colon + 1);
+        }
+    }
+    return values;
+}
+
+std::string FindValue(float time)
+{
+    return std::to_string(time) + ",0,miopenConvolutionFwdAlgoGEMM";
+}
+
+} // namespace
+
+TEST(CPU_DbMerge_NONE, FindDbBestTimeWins)
+{
+    const miopen::TmpDir dir{"db-merge-test"};
+    const auto target = dir.path / "target";
+
+    Write(target / find_db, "P0=A:" + FindValue(5) + ";B:" + FindValue(1) + "\n");
+    Write(dir.path / "s0" / find_db, "P0=A:" + FindValue(3) + ";B:" + FindValue(2) + "\n");
+    Write(dir.path / "s1" / find_db, "P0=A:" + FindValue(4) + "\nP1=C:" + FindValue(7) + "\n");
+
+    const auto stats = miopen::MergeUserDbShards({dir.path / "s0", dir.path / "s1"}, target);
+    EXPECT_EQ(stats.added, 1);
+    EXPECT_EQ(stats.replaced, 1);
+    EXPECT_EQ(stats.kept, 2);
+
+    const auto merged = Read(target / find_db);
+    EXPECT_EQ(merged.size(), 3);
+    EXPECT_EQ(merged.at("P0/A"), FindValue(3));
+    EXPECT_EQ(merged.at("P0/B"), FindValue(1));
+    EXPECT_EQ(merged.at("P1/C"), FindValue(7));
+}
+
+TEST(CPU_DbMerge_NONE, PerfDbFollowsFindDbTime)
+{
+    const miopen::TmpDir dir{"db-merge-test"};
+    const auto target = dir.path / "target";
+
+    Write(target / find_db, "F0=A:" + FindValue(2) + ";B:" + FindValue(2) + "\n");
+    Write(target / perf_db, "K0=A:old;B:old\n");
+
+    // The shard with the better time of A, but worse time of B than the target has.
+    Write(dir.path / "s0" / find_db, "F0=A:" + FindValue(1) + ";B:" + FindValue(3) + "\n");
+    Write(dir.path / "s0" / perf_db, "K0=A:s0;B:s0\n");
+    // Slower than s0 for A.
+    Write(dir.path / "s1" / find_db, "F0=A:" + FindValue(1.5) + "\n");
+    Write(dir.path / "s1" / perf_db, "K0=A:s1\nK1=A:s1\n");
+    // No times at all, so never replaces anything.
+    Write(dir.path / "s2" / perf_db, "K0=C:s2;B:s2\n");
+
+    miopen::MergeUserDbShards({dir.path / "s0", dir.path / "s1", dir.path / "s2"}, target);
+
+    const auto merged = Read(target / perf_db);
+    EXPECT_EQ(merged.size(), 4);
+    EXPECT_EQ(merged.at("K0/A"), "s0");
+    EXPECT_EQ(merged.at("K0/B"), "old");
+    EXPECT_EQ(merged.at("K0/C"), "s2");
+    EXPECT_EQ(merged.at("K1/A"), "s1");
+}
+
+TEST(CPU_DbMerge_NONE, IgnoresMissingAndIllFormed)
+{
+    const miopen::TmpDir dir{"db-merge-test"};
+    const auto target = dir.path / "target";
+
+    Write(dir.path / "s0" / find_db, "garbage\nP0=A:" + FindValue(1) + ";broken\n");
+    Write(dir.path / "s0" / "readme.txt", "P0=A:x\n");
+
+    const auto stats = miopen::MergeUserDbShards({dir.path / "s0", dir.path / "none"}, target);
+    EXPECT_EQ(stats.added, 1);
+    EXPECT_EQ(Read(target / find_db).size(), 1);
+    EXPECT_FALSE(fs::exists(target / "readme.txt"));
+}
+
+// Tunes a set of problems the way the coordinator does, with the workers replaced by
+// threads following a simple timing model.
+TEST(CPU_DbMerge_NONE, SimulatedTuning)
+{
+    const std::vector<std::string> problems = {"P0", "P1", "P2", "P3"};
+    const std::map<std::string, float> solvers = {{"A", 1.0f}, {"B", 0.7f}, {"C", 1.3f}};
+    // Every pair is tuned twice, the second run finds a worse config.
+    constexpr auto n_runs    = 2;
+    constexpr auto n_workers = 4;
+
+    const auto model = [&](const std::string& problem, const std::string& solver, int run) {
+        return static_cast<float>(problem.back() - '0' + 1) * solvers.at(solver) *
+               (1.0f + 0.5f * static_cast<float>(run));
+    };
+
+    const miopen::TmpDir dir{"db-merge-test"};
+    auto queue = miopen::TuningQueue{dir.path / "queue"};
+    auto index = 0;
+    for(auto run = 0; run < n_runs; ++run)
+        for(const auto& problem : problems)
+            for(const auto& solver : solvers)
+                queue.Push({std::to_string(index++),
+                            solver.first,
+                            problem + " " + std::to_string(run)});
+
+    auto workers = std::vector<std::thread>{};
+    for(auto w = 0; w < n_workers; ++w)
+    {
+        workers.emplace_back([&]() {
+            auto worker_queue = miopen::TuningQueue{queue.GetRoot()};
+            while(const auto job = worker_queue.Claim())
+            {
+                auto args    = std::istringstream{job->command};
+                auto problem = std::string{};
+                auto run     = 0;
+                args >> problem >> run;
+
+                const auto time  = model(problem, job->solvers, run);
+                const auto shard = worker_queue.GetShardPath(*job);
+                Write(shard / find_db,
+                      "F" + problem + "=" + job->solvers + ":" + FindValue(time) + "\n");
+                Write(shard / perf_db,
+                      "K" + problem + "=" + job->solvers + ":run" + std::to_string(run) + "\n");
+                worker_queue.Complete(*job, true);
+            }
+        });
+    }
+    for(auto& worker : workers)
+        worker.join();
+
+    const auto shards = queue.GetDoneShards();
+    ASSERT_EQ(shards.size(), index);
+
+    const auto target = dir.path / "user-db";
+    const auto stats  = miopen::MergeUserDbShards(shards, target);
+    EXPECT_EQ(stats.added, 2 * problems.size() * solvers.size());
+    EXPECT_EQ(stats.kept, 2 * problems.size() * solvers.size());
+
+    const auto find = Read(target / find_db);
+    const auto perf = Read(target / perf_db);
+    for(const auto& problem : problems)
+    {
+        for(const auto& solver : solvers)
+        {
+            const auto id = "/" + solver.first;
+            EXPECT_EQ(find.at("F" + problem + id), FindValue(model(problem, solver.first, 0)));
+            EXPECT_EQ(perf.at("K" + problem + id), "run0");
+        }
+    }
+}
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/device_capabilities.hpp>
+#include <miopen/env.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+namespace {
+
+miopen::DeviceInfo MakeInfo()
+{
+    auto info               = miopen::DeviceInfo{};
+    info.raw_name           = "gfx90a:sramecc+:xnack-";
+    info.compute_units      = 110;
+    info.wavefront_width    = 64;
+    info.local_memory_size  = 65536;
+    info.global_memory_size = 68702699520;
+    info.image3d_max_width  = 16384;
+    info.cooperative_launch = true;
+    return info;
+}
+
+} // namespace
+
+TEST(CPU_DeviceCapabilities_NONE, ParsesTargetNames)
+{
+    const auto gfx90a = miopen::DeviceCapabilities::FromName("gfx90a", 104);
+    EXPECT_TRUE(gfx90a.IsGfx(9, 0, 0xa));
+    EXPECT_EQ(gfx90a.compute_units, 104);
+    EXPECT_TRUE(gfx90a.xdlops);
+    EXPECT_FALSE(gfx90a.wmma);
+
+    const auto gfx1030 = miopen::DeviceCapabilities::FromName("gfx1030", 36);
+    EXPECT_TRUE(gfx1030.IsGfx(10, 3, 0));
+    EXPECT_FALSE(gfx1030.xdlops);
+    EXPECT_FALSE(gfx1030.wmma);
+
+    const auto gfx803 = miopen::DeviceCapabilities::FromName("gfx803", 64);
+    EXPECT_TRUE(gfx803.IsGfx(8, 0, 3));
+
+    const auto gfx942 = miopen::DeviceCapabilities::FromName("gfx942:sramecc+:xnack-", 304);
+    EXPECT_TRUE(gfx942.IsGfx(9, 4, 2));
+    EXPECT_TRUE(gfx942.xdlops);
+
+    const auto gfx1101 = miopen::DeviceCapabilities::FromName("gfx1101", 60);
+    EXPECT_TRUE(gfx1101.IsGfx(11, 0, 1));
+    EXPECT_TRUE(gfx1101.wmma);
+}
+
+TEST(CPU_DeviceCapabilities_NONE, UnknownNamesHaveNoFeatures)
+{
+    for(const auto name : {"", "gfx", "gfx9", "gfx90z", "gfxx0a", "Ellesmere"})
+    {
+        const auto caps = miopen::DeviceCapabilities::FromName(name, 8);
+        EXPECT_EQ(caps.gfx_major, 0) << name;
+        EXPECT_EQ(caps.gfx_minor, 0) << name;
+        EXPECT_EQ(caps.gfx_stepping, 0) << name;
+        EXPECT_FALSE(caps.xdlops) << name;
+        EXPECT_FALSE(caps.wmma) << name;
+    }
+}
+
+TEST(CPU_DeviceCapabilities_NONE, RecordsAreShared)
+{
+    const auto& first  = miopen::DeviceCapabilities::Get("gfx908", 120);
+    const auto& second = miopen::DeviceCapabilities::Get("gfx908", 120);
+    const auto& other  = miopen::DeviceCapabilities::Get("gfx908", 60);
+    EXPECT_EQ(&first, &second);
+    EXPECT_NE(&first, &other);
+    EXPECT_EQ(other.compute_units, 60);
+}
+
+TEST(CPU_DeviceCapabilities_NONE, DeviceInfoRoundTrip)
+{
+    const auto dir  = miopen::TmpDir{"device_info"};
+    const auto file = dir / "device.txt";
+    const auto key  = std::string{"0000:03:00.0 driver 60342131 runtime 60342131"};
+
+    MakeInfo().Save(file, key);
+
+    auto loaded = miopen::DeviceInfo{};
+    ASSERT_TRUE(loaded.Load(file, key));
+    const auto expected = MakeInfo();
+    EXPECT_EQ(loaded.raw_name, expected.raw_name);
+    EXPECT_EQ(loaded.compute_units, expected.compute_units);
+    EXPECT_EQ(loaded.wavefront_width, expected.wavefront_width);
+    EXPECT_EQ(loaded.local_memory_size, expected.local_memory_size);
+    EXPECT_EQ(loaded.global_memory_size, expected.global_memory_size);
+    EXPECT_EQ(loaded.image3d_max_width, expected.image3d_max_width);
+    EXPECT_EQ(loaded.cooperative_launch, expected.cooperative_launch);
+    EXPECT_EQ(loaded.target.Name(), "gfx90a");
+    EXPECT_TRUE(loaded.target.Xnack() && !*loaded.target.Xnack());
+
+    EXPECT_FALSE(miopen::DeviceInfo{}.Load(file, "0000:03:00.0 driver 1 runtime 1"));
+    EXPECT_FALSE(miopen::DeviceInfo{}.Load(dir / "missing.txt", key));
+}
+
+TEST(CPU_DeviceCapabilities_NONE, DeviceInfoRejectsMalformedRecords)
+{
+    const auto dir  = miopen::TmpDir{"device_info"};
+    const auto file = dir / "device.txt";
+    const auto key  = std::string{"device 0"};
+
+    MakeInfo().Save(file, key);
+    {
+        auto out = std::ofstream{file, std::ios::app};
+        out << "compute_units=lots\n";
+    }
+    EXPECT_FALSE(miopen::DeviceInfo{}.Load(file, key));
+
+    {
+        auto out = std::ofstream{file};
+        out << "MIOpen device info 1\n" << key << "\nraw_name=gfx90a\n";
+    }
+    EXPECT_FALSE(miopen::DeviceInfo{}.Load(file, key));
+}
+
+TEST(CPU_DeviceCapabilities_NONE, DeviceInfoKeyHasRuntimeSettings)
+{
+    if(miopen::env::getEnvironmentVariable("HSA_CU_MASK"))
+        GTEST_SKIP() << "HSA_CU_MASK is set by the user";
+
+    auto queries   = 0;
+    const auto get = [&]() -> const miopen::DeviceInfo& {
+        return miopen::DeviceInfo::Get("settings test device", [&]() {
+            ++queries;
+            return MakeInfo();
+        });
+    };
+    const auto& all = get();
+    EXPECT_EQ(&get(), &all);
+    EXPECT_EQ(queries, 1);
+
+    // The CUs are masked out, the record of the whole device does not apply.
+    const auto unmasked = miopen::DeviceInfo::GetSettingsKey();
+    miopen::env::setEnvironmentVariable("HSA_CU_MASK", "0:0-15");
+    const auto masked = miopen::DeviceInfo::GetSettingsKey();
+    const auto& part  = get();
+    miopen::env::clearEnvironmentVariable("HSA_CU_MASK");
+
+    EXPECT_NE(masked, unmasked);
+    EXPECT_NE(masked.find("HSA_CU_MASK=0:0-15"), std::string::npos) << masked;
+    EXPECT_NE(&part, &all);
+    EXPECT_EQ(queries, 2);
+    EXPECT_EQ(&get(), &all);
+}
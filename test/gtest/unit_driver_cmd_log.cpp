@@ -0,0 +1,87 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/driver_cmd_log.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+TEST(CPU_DriverCmdLog_NONE, ParsesCommandLines)
+{
+    const auto command = miopen::ParseDriverCommand(
+        "MIOpen(HIP): Command [LogCmdConvolution] ./bin/MIOpenDriver conv -n 1 -c 3  -H 32\r");
+    ASSERT_TRUE(command);
+    EXPECT_EQ(command->api, "LogCmdConvolution");
+    EXPECT_EQ(command->args, "conv -n 1 -c 3 -H 32");
+
+    // Process ids and elapsed time are optional parts of the prefix.
+    const auto prefixed = miopen::ParseDriverCommand(
+        "12:34 MIOpen(HIP)  12.345: Command [LogCmdBNorm] MIOpenDriver.exe bnormfp16 -n 4 -F 1");
+    ASSERT_TRUE(prefixed);
+    EXPECT_EQ(prefixed->api, "LogCmdBNorm");
+    EXPECT_EQ(prefixed->args, "bnormfp16 -n 4 -F 1");
+
+    EXPECT_FALSE(miopen::ParseDriverCommand("MIOpen(HIP): Info [Find] Command [x"));
+    EXPECT_FALSE(
+        miopen::ParseDriverCommand("MIOpen(HIP): Command [LogCmdBNorm] ./bin/MIOpenDriver"));
+    EXPECT_FALSE(miopen::ParseDriverCommand("MIOpen(HIP): Info [GetSolutions] conv -n 1"));
+}
+
+TEST(CPU_DriverCmdLog_NONE, ReadsArguments)
+{
+    const auto args = "CBAInfer -F 2 -n 4 -c 8";
+    EXPECT_EQ(miopen::GetDriverOperation(args), "CBAInfer");
+    EXPECT_EQ(miopen::GetDriverFlag(args, "-F"), "2");
+    EXPECT_EQ(miopen::GetDriverFlag(args, "-c"), "8");
+    EXPECT_FALSE(miopen::GetDriverFlag(args, "-k"));
+    EXPECT_FALSE(miopen::GetDriverFlag("conv -n", "-n"));
+}
+
+TEST(CPU_DriverCmdLog_NONE, CountsUniqueProblems)
+{
+    auto log = std::istringstream{
+        "MIOpen(HIP): Command [LogCmdConvolution] ./bin/MIOpenDriver conv -n 2 -F 1\n"
+        "MIOpen(HIP): Info [ForwardConvolution] something else\n"
+        "MIOpen(HIP): Command [LogCmdFindConvolution] ./bin/MIOpenDriver conv -n 2 -F 1\n"
+        "MIOpen(HIP): Command [LogCmdConvolution] ./bin/MIOpenDriver conv  -n 2 -F 1\n"
+        "MIOpen(HIP): Command [LogCmdBNorm] ./bin/MIOpenDriver bnorm -n 2 -F 1\n"
+        "MIOpen(HIP): Command [LogCmdConvolution] ./bin/MIOpenDriver conv -n 1 -F 1\n"};
+
+    auto commands = miopen::DriverCommandLog{};
+    EXPECT_EQ(commands.Read(log), 5);
+    EXPECT_EQ(commands.GetTotal(), 5);
+
+    const auto problems = commands.GetProblems();
+    ASSERT_EQ(problems.size(), 3);
+    EXPECT_EQ(problems[0].args, "conv -n 2 -F 1");
+    EXPECT_EQ(problems[0].count, 3);
+    EXPECT_EQ(problems[0].apis.at("LogCmdConvolution"), 2);
+    EXPECT_EQ(problems[0].apis.at("LogCmdFindConvolution"), 1);
+    // Equal counts are ordered by the arguments.
+    EXPECT_EQ(problems[1].args, "bnorm -n 2 -F 1");
+    EXPECT_EQ(problems[2].args, "conv -n 1 -F 1");
+}
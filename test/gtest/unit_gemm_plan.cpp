@@ -0,0 +1,259 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/gemm_plan.hpp>
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+namespace {
+
+miopen::GemmDescriptor MakeDesc(bool transA, bool transB, int m, int n, int k, float beta = 0.f)
+{
+    return {true,
+            transA,
+            transB,
+            m,
+            n,
+            k,
+            transA ? k : m,
+            transB ? n : k,
+            m,
+            1,
+            0,
+            0,
+            0,
+            1.f,
+            beta,
+            miopenFloat,
+            false};
+}
+
+std::vector<float> Iota(std::size_t size, float start)
+{
+    auto data = std::vector<float>(size);
+    for(auto i = std::size_t{0}; i < size; ++i)
+        data[i] = start + static_cast<float>(i);
+    return data;
+}
+
+std::vector<float> Reference(const miopen::GemmDescriptor& desc,
+                             const std::vector<float>& a,
+                             const std::vector<float>& b,
+                             std::vector<float> c)
+{
+    for(auto i = 0; i < desc.m; ++i)
+    {
+        for(auto j = 0; j < desc.n; ++j)
+        {
+            auto sum = 0.f;
+            for(auto p = 0; p < desc.k; ++p)
+            {
+                const auto av = desc.transA ? a[p + i * desc.lda] : a[i + p * desc.lda];
+                const auto bv = desc.transB ? b[j + p * desc.ldb] : b[p + j * desc.ldb];
+                sum += av * bv;
+            }
+            auto& out = c[i + j * desc.ldc];
+            out       = desc.alpha * sum + desc.beta * out;
+        }
+    }
+    return c;
+}
+
+} // namespace
+
+class CPU_GemmPlan_NONE : public testing::TestWithParam<std::tuple<bool, bool>>
+{
+};
+
+TEST_P(CPU_GemmPlan_NONE, HostGemm)
+{
+    const auto [transA, transB] = GetParam();
+    const auto desc             = MakeDesc(transA, transB, 3, 4, 5, 0.5f);
+    const auto a                = Iota(3 * 5, 1.f);
+    const auto b                = Iota(5 * 4, -7.f);
+    auto c                      = Iota(3 * 4, 2.f);
+    const auto expected         = Reference(desc, a, b, c);
+
+    auto backend = miopen::HostGemmBackend{};
+    auto cache   = miopen::GemmPlanCache{};
+    miopen::RunGemmPlan(backend, cache, desc, false, a.data(), 0, b.data(), 0, c.data(), 0);
+
+    EXPECT_EQ(c, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(Full,
+                         CPU_GemmPlan_NONE,
+                         testing::Combine(testing::Bool(), testing::Bool()));
+
+TEST(CPU_GemmPlanCache_NONE, ReusesPlan)
+{
+    const auto desc = MakeDesc(false, false, 2, 2, 2);
+    const auto a    = Iota(4, 1.f);
+    const auto b    = Iota(4, 1.f);
+    auto c          = std::vector<float>(4);
+
+    auto backend = miopen::HostGemmBackend{};
+    auto cache   = miopen::GemmPlanCache{};
+    for(auto i = 0; i < 10; ++i)
+        miopen::RunGemmPlan(backend, cache, desc, false, a.data(), 0, b.data(), 0, c.data(), 0);
+
+    EXPECT_EQ(backend.GetPlansCreated(), 1);
+    EXPECT_EQ(backend.GetCalls(), 10);
+    EXPECT_EQ(cache.GetSize(), 1);
+    EXPECT_EQ(cache.GetMisses(), 1);
+    EXPECT_EQ(cache.GetHits(), 9);
+
+    // The scalars only matter for the key when they change the 1/0 special cases.
+    auto scaled  = desc;
+    scaled.alpha = 2.f;
+    scaled.beta  = 0.5f;
+    miopen::RunGemmPlan(backend, cache, scaled, false, a.data(), 0, b.data(), 0, c.data(), 0);
+    EXPECT_EQ(backend.GetPlansCreated(), 2);
+
+    auto rescaled  = desc;
+    rescaled.alpha = 3.f;
+    rescaled.beta  = 0.25f;
+    miopen::RunGemmPlan(backend, cache, rescaled, false, a.data(), 0, b.data(), 0, c.data(), 0);
+    EXPECT_EQ(backend.GetPlansCreated(), 2);
+
+    auto overwrite = scaled;
+    overwrite.beta = 0.f;
+    miopen::RunGemmPlan(backend, cache, overwrite, false, a.data(), 0, b.data(), 0, c.data(), 0);
+    EXPECT_EQ(backend.GetPlansCreated(), 3);
+
+    auto accumulate = desc;
+    accumulate.beta = 1.f;
+    miopen::RunGemmPlan(backend, cache, accumulate, false, a.data(), 0, b.data(), 0, c.data(), 0);
+    EXPECT_EQ(backend.GetPlansCreated(), 4);
+
+    auto transposed   = desc;
+    transposed.transA = true;
+    miopen::RunGemmPlan(backend, cache, transposed, false, a.data(), 0, b.data(), 0, c.data(), 0);
+    EXPECT_EQ(backend.GetPlansCreated(), 5);
+    EXPECT_EQ(cache.GetSize(), 5);
+}
+
+TEST(CPU_GemmPlanCache_NONE, Batched)
+{
+    const auto batch_count = 3;
+    auto desc              = MakeDesc(false, true, 2, 3, 4);
+    desc.batch_count       = batch_count;
+    desc.strideA           = 2 * 4;
+    desc.strideB           = 3 * 4;
+    desc.strideC           = 2 * 3;
+
+    const auto a = Iota(batch_count * desc.strideA, 0.5f);
+    const auto b = Iota(batch_count * desc.strideB, -3.f);
+    auto c       = std::vector<float>(batch_count * desc.strideC);
+
+    auto backend = miopen::HostGemmBackend{};
+    auto cache   = miopen::GemmPlanCache{};
+    miopen::RunGemmPlan(backend, cache, desc, true, a.data(), 0, b.data(), 0, c.data(), 0);
+
+    for(auto batch = 0; batch < batch_count; ++batch)
+    {
+        const auto a_batch = std::vector<float>(a.begin() + batch * desc.strideA,
+                                                a.begin() + (batch + 1) * desc.strideA);
+        const auto b_batch = std::vector<float>(b.begin() + batch * desc.strideB,
+                                                b.begin() + (batch + 1) * desc.strideB);
+        const auto c_batch = std::vector<float>(c.begin() + batch * desc.strideC,
+                                                c.begin() + (batch + 1) * desc.strideC);
+        EXPECT_EQ(c_batch, Reference(desc, a_batch, b_batch, std::vector<float>(desc.strideC)));
+    }
+
+    // Sequential calls run one batch at a time with the offsets and share a non-batched plan.
+    for(auto batch = 0; batch < batch_count; ++batch)
+    {
+        miopen::RunGemmPlan(backend,
+                            cache,
+                            desc,
+                            false,
+                            a.data(),
+                            batch * desc.strideA,
+                            b.data(),
+                            batch * desc.strideB,
+                            c.data(),
+                            batch * desc.strideC);
+    }
+    EXPECT_EQ(backend.GetPlansCreated(), 2);
+    EXPECT_EQ(backend.GetCalls(), 1 + batch_count);
+}
+
+TEST(CPU_GemmPlanCache_NONE, Eviction)
+{
+    const auto a = Iota(16, 1.f);
+    const auto b = Iota(16, 1.f);
+    auto c       = std::vector<float>(16);
+
+    auto backend   = miopen::HostGemmBackend{};
+    auto cache     = miopen::GemmPlanCache{2};
+    const auto run = [&](int m) {
+        const auto desc = MakeDesc(false, false, m, 2, 2);
+        miopen::RunGemmPlan(backend, cache, desc, false, a.data(), 0, b.data(), 0, c.data(), 0);
+    };
+
+    run(1);
+    run(2);
+    run(1); // 2 becomes the least recently used
+    run(3);
+    EXPECT_EQ(cache.GetSize(), 2);
+    EXPECT_EQ(backend.GetPlansCreated(), 3);
+
+    run(1);
+    EXPECT_EQ(backend.GetPlansCreated(), 3);
+    run(2);
+    EXPECT_EQ(backend.GetPlansCreated(), 4);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetSize(), 0);
+    EXPECT_EQ(cache.GetHits(), 0);
+}
+
+TEST(CPU_GemmPlanCache_NONE, Disabled)
+{
+    const auto desc = MakeDesc(false, false, 2, 2, 2);
+    const auto a    = Iota(4, 1.f);
+    const auto b    = Iota(4, 1.f);
+    auto c          = std::vector<float>(4);
+
+    auto backend = miopen::HostGemmBackend{};
+    auto cache   = miopen::GemmPlanCache{0};
+    for(auto i = 0; i < 3; ++i)
+        miopen::RunGemmPlan(backend, cache, desc, false, a.data(), 0, b.data(), 0, c.data(), 0);
+
+    EXPECT_EQ(backend.GetPlansCreated(), 3);
+    EXPECT_EQ(cache.GetSize(), 0);
+}
+
+TEST(CPU_GemmPlanCache_NONE, RowMajorIsRejected)
+{
+    auto desc       = MakeDesc(false, false, 2, 2, 2);
+    desc.isColMajor = false;
+    EXPECT_ANY_THROW(miopen::GemmPlanKey::Make("host", desc, false));
+}
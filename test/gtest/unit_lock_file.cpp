@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/lock_file.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+/// A lock held through a separate open file description, as another process would.
+class ForeignLock
+{
+public:
+    explicit ForeignLock(const miopen::fs::path& path)
+        : fd(::open(path.c_str(), O_RDWR | O_CLOEXEC))
+    {
+    }
+    ForeignLock(const ForeignLock&) = delete;
+    ForeignLock& operator=(const ForeignLock&) = delete;
+    ~ForeignLock() { ::close(fd); }
+
+    bool TryLock(short type, off_t byte = 0)
+    {
+        struct flock request = {};
+        request.l_type       = type;
+        request.l_whence     = SEEK_SET;
+        request.l_start      = byte;
+        request.l_len        = 1;
+        return ::fcntl(fd, F_OFD_SETLK, &request) == 0;
+    }
+
+    void Unlock(off_t byte = 0) { TryLock(F_UNLCK, byte); }
+
+private:
+    int fd;
+};
+
+bool CanLock(const miopen::fs::path& path, short type, off_t byte = 0)
+{
+    return ForeignLock{path}.TryLock(type, byte);
+}
+
+miopen::LockFile& GetLockFile(const miopen::TmpDir& dir)
+{
+    return miopen::LockFile::Get(dir.path / "test.lock");
+}
+
+} // namespace
+
+TEST(CPU_LockFile_NONE, FileLockFollowsReadersAndWriters)
+{
+    const miopen::TmpDir dir{"lock-file-test"};
+    auto& lock_file = GetLockFile(dir);
+    const auto path = dir.path / "test.lock";
+
+    lock_file.lock_shared();
+    EXPECT_TRUE(CanLock(path, F_RDLCK));
+    EXPECT_FALSE(CanLock(path, F_WRLCK));
+
+    // The second reader joins the first one, the file stays locked until both leave.
+    EXPECT_TRUE(lock_file.try_lock_shared());
+    EXPECT_FALSE(lock_file.try_lock());
+    lock_file.unlock_shared();
+    EXPECT_FALSE(CanLock(path, F_WRLCK));
+    lock_file.unlock_shared();
+    EXPECT_TRUE(CanLock(path, F_WRLCK));
+
+    lock_file.lock();
+    EXPECT_FALSE(CanLock(path, F_RDLCK));
+    EXPECT_FALSE(lock_file.try_lock_shared());
+    lock_file.unlock();
+    EXPECT_TRUE(CanLock(path, F_WRLCK));
+}
+
+TEST(CPU_LockFile_NONE, TimedWaits)
+{
+    const miopen::TmpDir dir{"lock-file-test"};
+    auto& lock_file = GetLockFile(dir);
+
+    auto foreign = ForeignLock{dir.path / "test.lock"};
+    ASSERT_TRUE(foreign.TryLock(F_WRLCK));
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(lock_file.try_lock_shared_for(50ms));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 50ms);
+    EXPECT_FALSE(lock_file.try_lock());
+
+    // The waiter wakes up when the lock is released, not at the deadline.
+    auto releaser = std::thread([&]() {
+        std::this_thread::sleep_for(50ms);
+        foreign.Unlock();
+    });
+    EXPECT_TRUE(lock_file.try_lock_for(60s));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 30s);
+    releaser.join();
+
+    // The timed out waiter has not left the file locked.
+    EXPECT_FALSE(CanLock(dir.path / "test.lock", F_RDLCK));
+    lock_file.unlock();
+    EXPECT_TRUE(CanLock(dir.path / "test.lock", F_WRLCK));
+}
+
+TEST(CPU_LockFile_NONE, ReadersPreference)
+{
+    const miopen::TmpDir dir{"lock-file-test"};
+    auto& lock_file = GetLockFile(dir);
+    lock_file.SetPreference(miopen::LockFile::Preference::Readers);
+
+    auto reader      = std::shared_lock<miopen::LockFile>(lock_file);
+    auto writer_done = std::atomic<bool>{false};
+    auto writer      = std::thread([&]() {
+        const auto lock = std::unique_lock<miopen::LockFile>(lock_file);
+        writer_done     = true;
+    });
+    std::this_thread::sleep_for(20ms);
+
+    // Readers are let in while the writer waits.
+    EXPECT_TRUE(lock_file.try_lock_shared());
+    lock_file.unlock_shared();
+    EXPECT_FALSE(writer_done);
+
+    reader.unlock();
+    writer.join();
+    EXPECT_TRUE(writer_done);
+}
+
+TEST(CPU_LockFile_NONE, WritersPreference)
+{
+    const miopen::TmpDir dir{"lock-file-test"};
+    auto& lock_file = GetLockFile(dir);
+    const auto path = dir.path / "test.lock";
+    lock_file.SetPreference(miopen::LockFile::Preference::Writers);
+
+    // In-process: a waiting writer holds off new readers.
+    {
+        auto reader      = std::shared_lock<miopen::LockFile>(lock_file);
+        auto writer_done = std::atomic<bool>{false};
+        auto writer      = std::thread([&]() {
+            const auto lock = std::unique_lock<miopen::LockFile>(lock_file);
+            writer_done     = true;
+        });
+        std::this_thread::sleep_for(20ms);
+        EXPECT_FALSE(lock_file.try_lock_shared());
+        EXPECT_FALSE(writer_done);
+        reader.unlock();
+        writer.join();
+        EXPECT_TRUE(writer_done);
+    }
+
+    // Across processes: the writer queues on the gate and other readers see it.
+    {
+        auto foreign_reader = ForeignLock{path};
+        ASSERT_TRUE(foreign_reader.TryLock(F_RDLCK));
+        auto writer = std::thread([&]() {
+            const auto lock = std::unique_lock<miopen::LockFile>(lock_file);
+        });
+        auto gate_taken = false;
+        for(auto i = 0; i < 1000 && !gate_taken; ++i)
+        {
+            gate_taken = !CanLock(path, F_RDLCK, 1);
+            if(!gate_taken)
+                std::this_thread::sleep_for(1ms);
+        }
+        EXPECT_TRUE(gate_taken);
+        EXPECT_TRUE(CanLock(path, F_RDLCK));
+        foreign_reader.Unlock();
+        writer.join();
+        EXPECT_TRUE(CanLock(path, F_WRLCK, 0));
+        EXPECT_TRUE(CanLock(path, F_WRLCK, 1));
+    }
+}
+
+#endif
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/config.h>
+#include <miopen/numerics_stats.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+using Stats = miopen::NumericsStats;
+
+std::size_t Bucket(int exponent)
+{
+    return static_cast<std::size_t>(exponent - Stats::histogram_min_exponent + 1);
+}
+
+} // namespace
+
+TEST(CPU_NumericsStats_NONE, Float)
+{
+    const auto data = std::vector<float>{1.f,
+                                         -2.f,
+                                         0.f,
+                                         4.5f,
+                                         std::numeric_limits<float>::quiet_NaN(),
+                                         std::numeric_limits<float>::infinity()};
+    const auto stats = miopen::ComputeNumericsStats(miopenFloat, {6}, {1}, data.data());
+
+    EXPECT_EQ(stats.tensors, 1);
+    EXPECT_EQ(stats.count, 4);
+    EXPECT_EQ(stats.nans, 1);
+    EXPECT_EQ(stats.infs, 1);
+    EXPECT_EQ(stats.zeros, 1);
+    EXPECT_TRUE(stats.HasAbnormal());
+    EXPECT_EQ(stats.min, -2.0);
+    EXPECT_EQ(stats.max, 4.5);
+    EXPECT_EQ(stats.abs_max, 4.5);
+    EXPECT_DOUBLE_EQ(stats.GetMean(), 3.5 / 4);
+    EXPECT_DOUBLE_EQ(stats.GetAbsMean(), 7.5 / 4);
+
+    EXPECT_EQ(stats.histogram[0], 1);
+    EXPECT_EQ(stats.histogram[Bucket(0)], 1);
+    EXPECT_EQ(stats.histogram[Bucket(1)], 1);
+    EXPECT_EQ(stats.histogram[Bucket(2)], 1);
+}
+
+TEST(CPU_NumericsStats_NONE, Strided)
+{
+    // 2x2 with padded rows, the padding must not be counted.
+    const auto data  = std::vector<float>{1.f, 2.f, -100.f, 3.f, 4.f};
+    const auto stats = miopen::ComputeNumericsStats(miopenFloat, {2, 2}, {3, 1}, data.data());
+    EXPECT_EQ(stats.count, 4);
+    EXPECT_EQ(stats.min, 1.0);
+    EXPECT_EQ(stats.sum, 10.0);
+
+    // Transposed view.
+    const auto transposed =
+        miopen::ComputeNumericsStats(miopenFloat, {2, 2}, {1, 3}, data.data());
+    EXPECT_EQ(transposed.sum, 10.0);
+}
+
+TEST(CPU_NumericsStats_NONE, HostTypes)
+{
+    const auto half = std::vector<uint16_t>{0x3c00, 0xc000, 0x0001, 0x7c00, 0x7e00};
+    const auto half_stats =
+        miopen::ComputeNumericsStats(miopenHalf, {half.size()}, {1}, half.data());
+    EXPECT_EQ(half_stats.count, 3);
+    EXPECT_EQ(half_stats.infs, 1);
+    EXPECT_EQ(half_stats.nans, 1);
+    EXPECT_EQ(half_stats.max, 1.0);
+    EXPECT_EQ(half_stats.min, -2.0);
+    EXPECT_EQ(half_stats.histogram[Bucket(-24)], 1);
+
+    const auto bf16       = std::vector<uint16_t>{0x3f80, 0xc040};
+    const auto bf16_stats = miopen::ComputeNumericsStats(miopenBFloat16, {2}, {1}, bf16.data());
+    EXPECT_EQ(bf16_stats.max, 1.0);
+    EXPECT_EQ(bf16_stats.min, -3.0);
+
+    // 1.0 and -0.5
+#if MIOPEN_FP8_IEEE_EXPONENT_BIAS
+    const auto fp8 = std::vector<uint8_t>{0x38, 0xb0, 0x00};
+    const auto bf8 = std::vector<uint8_t>{0x3c, 0xb8, 0x7c};
+#else
+    const auto fp8 = std::vector<uint8_t>{0x40, 0xb8, 0x00};
+    const auto bf8 = std::vector<uint8_t>{0x40, 0xbc, 0x80};
+#endif
+    const auto fp8_stats = miopen::ComputeNumericsStats(miopenFloat8, {3}, {1}, fp8.data());
+    EXPECT_EQ(fp8_stats.max, 1.0);
+    EXPECT_EQ(fp8_stats.min, -0.5);
+    EXPECT_EQ(fp8_stats.zeros, 1);
+
+    // The last one is infinity with the IEEE bias and NaN otherwise.
+    const auto bf8_stats = miopen::ComputeNumericsStats(miopenBFloat8, {3}, {1}, bf8.data());
+    EXPECT_EQ(bf8_stats.max, 1.0);
+    EXPECT_EQ(bf8_stats.min, -0.5);
+    EXPECT_TRUE(bf8_stats.HasAbnormal());
+
+    const auto ints      = std::vector<int32_t>{-7, 0, 9};
+    const auto int_stats = miopen::ComputeNumericsStats(miopenInt32, {3}, {1}, ints.data());
+    EXPECT_EQ(int_stats.sum, 2.0);
+    EXPECT_EQ(int_stats.zeros, 1);
+}
+
+TEST(CPU_NumericsStats_NONE, MergeAndClamp)
+{
+    auto first = Stats{};
+    first.Add(1e-30);
+    first.Add(3.0);
+
+    auto second = Stats{};
+    second.Add(1e30);
+    second.Add(-5.0);
+
+    first.Merge(second);
+    EXPECT_EQ(first.count, 4);
+    EXPECT_EQ(first.min, -5.0);
+    EXPECT_EQ(first.max, 1e30);
+    EXPECT_EQ(first.histogram[1], 1);
+    EXPECT_EQ(first.histogram[Stats::histogram_size - 1], 1);
+    EXPECT_EQ(first.histogram[Bucket(1)], 1);
+    EXPECT_EQ(first.histogram[Bucket(2)], 1);
+}
+
+TEST(CPU_NumericsMonitor_NONE, Sampling)
+{
+    auto monitor = miopen::NumericsMonitor{3};
+
+    auto sampled = std::vector<bool>{};
+    for(auto i = 0; i < 7; ++i)
+        sampled.push_back(monitor.Sample("x"));
+    EXPECT_EQ(sampled, (std::vector<bool>{true, false, false, true, false, false, true}));
+
+    // Each tensor has its own counter.
+    EXPECT_TRUE(monitor.Sample("y"));
+    EXPECT_FALSE(monitor.Get("y"));
+
+    const auto data = std::vector<float>{1.f, 2.f};
+    monitor.Record("x", miopen::ComputeNumericsStats(miopenFloat, {2}, {1}, data.data()));
+    monitor.Record("x", miopen::ComputeNumericsStats(miopenFloat, {2}, {1}, data.data()));
+
+    const auto stats = monitor.Get("x");
+    ASSERT_TRUE(stats);
+    EXPECT_EQ(stats->tensors, 2);
+    EXPECT_EQ(stats->count, 4);
+    EXPECT_EQ(monitor.GetAll().size(), 1);
+
+    const auto report = monitor.GetReport();
+    EXPECT_EQ(report.rfind("x: tensors=2 values=4", 0), 0) << report;
+    EXPECT_NE(report.find("log2hist={0:2, 1:2}"), std::string::npos) << report;
+
+    monitor.Reset();
+    EXPECT_FALSE(monitor.Get("x"));
+    EXPECT_TRUE(monitor.GetReport().empty());
+}
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/process.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#ifndef _WIN32
+
+TEST(CPU_Process_NONE, CapturesOutput)
+{
+    auto out = std::ostringstream{};
+    auto err = std::ostringstream{};
+    EXPECT_EQ(miopen::Process{"/bin/sh"}("-c 'echo out; echo err >&2; exit 3'", "", &out, {}, &err),
+              3);
+    EXPECT_EQ(out.str(), "out\n");
+    EXPECT_EQ(err.str(), "err\n");
+}
+
+TEST(CPU_Process_NONE, SplitsArguments)
+{
+    auto out = std::ostringstream{};
+    EXPECT_EQ(miopen::Process{"printf"}(R"('[%s]' a\ b "c \"d\"" 'e  f' g)", "", &out), 0);
+    EXPECT_EQ(out.str(), R"([a b][c "d"][e  f][g])");
+}
+
+TEST(CPU_Process_NONE, Redirects)
+{
+    auto out = std::ostringstream{};
+    auto err = std::ostringstream{};
+    miopen::Process{"ls"}("/nonexistent-path 2>&1", "", &out, {}, &err);
+    EXPECT_FALSE(out.str().empty());
+    EXPECT_TRUE(err.str().empty());
+
+    out.str("");
+    EXPECT_EQ(miopen::Process{"echo"}("hidden 1>/dev/null", "", &out), 0);
+    EXPECT_TRUE(out.str().empty());
+}
+
+TEST(CPU_Process_NONE, FallsBackToShell)
+{
+    auto out = std::ostringstream{};
+    EXPECT_EQ(miopen::Process{"echo"}("a b | tr ab xy", "", &out), 0);
+    EXPECT_EQ(out.str(), "x y\n");
+}
+
+TEST(CPU_Process_NONE, UsesWorkingDirectoryAndEnvironment)
+{
+    auto out = std::ostringstream{};
+    EXPECT_EQ(miopen::Process{"pwd"}("", "/", &out), 0);
+    EXPECT_EQ(out.str(), "/\n");
+
+    out.str("");
+    const auto env = miopen::ProcessEnvironmentMap{{"MIOPEN_PROCESS_TEST", "1"}};
+    EXPECT_EQ(miopen::Process{"printenv"}("MIOPEN_PROCESS_TEST", "", &out, env), 0);
+    EXPECT_EQ(out.str(), "1\n");
+}
+
+TEST(CPU_Process_NONE, ReportsMissingExecutable)
+{
+    EXPECT_EQ(miopen::Process{"/nonexistent-executable"}(), 127);
+    EXPECT_EQ(miopen::Process{"/bin/sh"}("-c 'kill -9 $$'"), 128 + 9);
+}
+
+TEST(CPU_Process_NONE, ServesRequests)
+{
+    auto worker = miopen::ProcessWorker{"/bin/sh"};
+    EXPECT_EQ(worker.Call("echo first; echo __END__\n", "__END__"), "first\n");
+    EXPECT_EQ(worker.Call("echo a; echo b; echo __END__\n", "__END__"), "a\nb\n");
+    EXPECT_EQ(worker.Close(), 0);
+
+    auto failing = miopen::ProcessWorker{"/bin/sh"};
+    EXPECT_ANY_THROW(failing.Call("exit 1\n", "__END__"));
+    // The process has exited, writing to it must not kill the caller.
+    EXPECT_ANY_THROW(failing.Call(std::string(1 << 20, '\n'), "__END__"));
+    EXPECT_EQ(failing.Close(), 1);
+}
+
+#endif
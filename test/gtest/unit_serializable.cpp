@@ -0,0 +1,170 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/perf_field.hpp>
+#include <miopen/serializable.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+struct TestConfig : miopen::solver::Serializable<TestConfig>
+{
+    int a           = 0;
+    bool b          = false;
+    std::size_t c   = 0;
+    float d         = 0.0f;
+    double e        = 0.0;
+    std::string f   = "";
+    int64_t g       = 0;
+    unsigned char h = 0;
+
+    template <class Self, class F>
+    static void Visit(Self&& self, F f)
+    {
+        f(self.a, "a");
+        f(self.b, "b");
+        f(self.c, "c");
+        f(self.d, "d");
+        f(self.e, "e");
+        f(self.f, "f");
+        f(self.g, "g");
+        f(self.h, "h");
+    }
+
+    friend bool operator==(const TestConfig& l, const TestConfig& r)
+    {
+        return l.a == r.a && l.b == r.b && l.c == r.c && l.d == r.d && l.e == r.e &&
+               l.f == r.f && l.g == r.g && l.h == r.h;
+    }
+};
+
+/// How the records were formatted before the fast path was introduced.
+std::string SerializeWithStream(const TestConfig& config)
+{
+    std::ostringstream ss;
+    char sep = 0;
+    TestConfig::Visit(config, [&](const auto& x, const char*) {
+        if(sep != 0)
+            ss << sep;
+        ss << x;
+        sep = ',';
+    });
+    return ss.str();
+}
+
+std::string Serialize(const TestConfig& config)
+{
+    std::ostringstream ss;
+    config.Serialize(ss);
+    return ss.str();
+}
+
+} // namespace
+
+TEST(CPU_Serializable_NONE, MatchesStreamFormat)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> ints(std::numeric_limits<int>::min(),
+                                            std::numeric_limits<int>::max());
+    std::uniform_real_distribution<float> floats(-1e6f, 1e6f);
+    std::uniform_real_distribution<double> exps(-30.0, 30.0);
+
+    for(auto i = 0; i < 1000; ++i)
+    {
+        TestConfig config;
+        config.a = ints(gen);
+        config.b = (i % 2) == 0;
+        config.c = static_cast<std::size_t>(ints(gen)) * 12345;
+        config.d = floats(gen);
+        config.e = std::pow(10.0, exps(gen));
+        config.f = "algo" + std::to_string(i);
+        config.g = static_cast<int64_t>(ints(gen)) * 1000000;
+        config.h = static_cast<unsigned char>('a' + i % 26);
+
+        ASSERT_EQ(Serialize(config), SerializeWithStream(config));
+    }
+}
+
+TEST(CPU_Serializable_NONE, RoundTrip)
+{
+    TestConfig config;
+    config.a = -17;
+    config.b = true;
+    config.c = std::numeric_limits<std::size_t>::max();
+    config.d = 0.125f;
+    config.e = 1e-05;
+    config.f = "miopenConvolutionFwdAlgoDirect";
+    config.g = std::numeric_limits<int64_t>::min();
+    config.h = 'x';
+
+    TestConfig loaded;
+    ASSERT_TRUE(loaded.Deserialize(Serialize(config)));
+    EXPECT_EQ(loaded, config);
+}
+
+TEST(CPU_Serializable_NONE, Deserialize)
+{
+    TestConfig config;
+    // Extra fields are ignored like it was with std::getline.
+    EXPECT_TRUE(config.Deserialize("1,0,2,3.5,4,str,5,y,extra"));
+    EXPECT_EQ(config.a, 1);
+    EXPECT_EQ(config.f, "str");
+    EXPECT_EQ(config.h, 'y');
+
+    const auto backup = config;
+    // Missing field.
+    EXPECT_FALSE(config.Deserialize("1,0,2,3.5,4,str,5"));
+    EXPECT_FALSE(config.Deserialize("1,0,2,3.5,4,str,5,"));
+    EXPECT_FALSE(config.Deserialize(""));
+    // Ill-formed numbers.
+    EXPECT_FALSE(config.Deserialize("1x,0,2,3.5,4,str,5,y"));
+    EXPECT_FALSE(config.Deserialize("1,2,2,3.5,4,str,5,y"));
+    EXPECT_FALSE(config.Deserialize("1,0,,3.5,4,str,5,y"));
+    // Object is not modified on failure.
+    EXPECT_EQ(config, backup);
+}
+
+TEST(CPU_Serializable_NONE, FindDbData)
+{
+    const auto data = miopen::FindDbData{0.0123456789f, 1024, "miopenConvolutionFwdAlgoGEMM"};
+
+    std::ostringstream ss;
+    data.Serialize(ss);
+    EXPECT_EQ(ss.str(), "0.0123457,1024,miopenConvolutionFwdAlgoGEMM");
+
+    miopen::FindDbData loaded;
+    ASSERT_TRUE(loaded.Deserialize(ss.str()));
+    EXPECT_FLOAT_EQ(loaded.time, 0.0123457f);
+    EXPECT_EQ(loaded.workspace, 1024);
+    EXPECT_EQ(loaded.algorithm, data.algorithm);
+}
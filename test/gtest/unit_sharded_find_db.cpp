@@ -0,0 +1,194 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_shard.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+namespace fs = miopen::fs;
+
+const auto fwd_nchw_fp32  = std::string{"576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F"};
+const auto fwd_nhwc_fp16  = std::string{"576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NHWC-FP16-F"};
+const auto bwd_nhwc_fp16  = std::string{"576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NHWC-FP16-B"};
+const auto wrw_ncdhw_bf16 =
+    std::string{"16-4-4-4-1x1x1-32-4-4-4-8-0x0x0-1x1x1-1x1x1-0-NCDHW-BF16-W"};
+const auto grouped_mixed  = std::string{"8-4-4-3x3-8-4-4-1-1x1-1x1-1x1-0-NHWC-NCHW-NCHW-FP16-F_g8"};
+
+std::string Values(int i) { return std::to_string(i) + ",0,miopenConvolutionFwdAlgoGEMM"; }
+
+std::string Value(int i) { return "Solver" + std::to_string(i) + ":" + Values(i); }
+
+std::string MakeDb()
+{
+    return fwd_nchw_fp32 + "=" + Value(0) + "\n" + //
+           fwd_nhwc_fp16 + "=" + Value(1) + "\n" + //
+           "not-a-conv-key=" + Value(2) + "\n" +   //
+           bwd_nhwc_fp16 + "=" + Value(3) + "\n" + //
+           wrw_ncdhw_bf16 + "=" + Value(4) + "\n" +
+           grouped_mixed + "=" + Value(5) + "\n";
+}
+
+void WriteSharded(const fs::path& file, const std::string& contents)
+{
+    auto input    = std::istringstream{contents};
+    auto output   = std::ofstream{file, std::ios::binary};
+    auto manifest = std::ofstream{miopen::GetDbShardManifestPath(file.string()), std::ios::binary};
+    ASSERT_TRUE(miopen::WriteShardedDb(input, output, manifest));
+}
+
+struct RawValues
+{
+    std::string text;
+
+    bool Deserialize(const std::string& s)
+    {
+        text = s;
+        return true;
+    }
+};
+
+std::string GetValue(const miopen::ReadonlyRamDb& db, const std::string& key, int i)
+{
+    const auto record = db.FindRecord(key);
+    if(!record)
+        return "<none>";
+    auto values = RawValues{};
+    if(!record->GetValues("Solver" + std::to_string(i), values))
+        return "<missing>";
+    return values.text;
+}
+
+void ExpectAllFound(const miopen::ReadonlyRamDb& db)
+{
+    EXPECT_EQ(GetValue(db, fwd_nchw_fp32, 0), Values(0));
+    EXPECT_EQ(GetValue(db, fwd_nhwc_fp16, 1), Values(1));
+    EXPECT_EQ(GetValue(db, "not-a-conv-key", 2), Values(2));
+    EXPECT_EQ(GetValue(db, bwd_nhwc_fp16, 3), Values(3));
+    EXPECT_EQ(GetValue(db, wrw_ncdhw_bf16, 4), Values(4));
+    EXPECT_EQ(GetValue(db, grouped_mixed, 5), Values(5));
+}
+
+} // namespace
+
+TEST(CPU_ShardedFindDb_NONE, ShardNames)
+{
+    EXPECT_EQ(miopen::GetDbShardName(fwd_nchw_fp32), "NCHW-FP32-F");
+    EXPECT_EQ(miopen::GetDbShardName(bwd_nhwc_fp16), "NHWC-FP16-B");
+    EXPECT_EQ(miopen::GetDbShardName(wrw_ncdhw_bf16), "NCDHW-BF16-W");
+    EXPECT_EQ(miopen::GetDbShardName(grouped_mixed), "NHWC-FP16-F");
+    EXPECT_EQ(miopen::GetDbShardName("not-a-conv-key"), "misc");
+    EXPECT_EQ(miopen::GetDbShardName("1-2-3"), "misc");
+    EXPECT_EQ(miopen::GetDbShardName("-F"), "misc");
+    EXPECT_EQ(miopen::GetDbShardName(""), "misc");
+}
+
+TEST(CPU_ShardedFindDb_NONE, WritesManifest)
+{
+    auto input    = std::istringstream{MakeDb() + "garbage\n"};
+    auto output   = std::ostringstream{};
+    auto manifest = std::stringstream{};
+    ASSERT_TRUE(miopen::WriteShardedDb(input, output, manifest));
+
+    auto size   = std::uint64_t{0};
+    auto shards = std::map<std::string, miopen::DbShard>{};
+    ASSERT_TRUE(miopen::ReadDbShardManifest(manifest, size, shards));
+    EXPECT_EQ(size, output.str().size());
+    ASSERT_EQ(shards.size(), 5);
+
+    // The two fp16 NHWC forward records are contiguous.
+    const auto& shard = shards.at("NHWC-FP16-F");
+    const auto text   = output.str().substr(shard.offset, shard.length);
+    EXPECT_EQ(text, fwd_nhwc_fp16 + "=" + Value(1) + "\n" + grouped_mixed + "=" + Value(5) + "\n");
+
+    auto empty = std::istringstream{"garbage\n"};
+    EXPECT_FALSE(miopen::WriteShardedDb(empty, output, manifest));
+}
+
+TEST(CPU_ShardedFindDb_NONE, LoadsOnlyRequestedShards)
+{
+    const miopen::TmpDir dir{"sharded-find-db-test"};
+    const auto file = dir.path / "test.fdb.txt";
+    WriteSharded(file, MakeDb());
+
+    const auto& db = miopen::ReadonlyRamDb::GetCached(miopen::DbKinds::FindDb, file, true);
+    EXPECT_EQ(db.GetLoadedShardCount(), 0);
+
+    EXPECT_EQ(GetValue(db, fwd_nhwc_fp16, 1), Values(1));
+    EXPECT_EQ(GetValue(db, grouped_mixed, 5), Values(5));
+    EXPECT_EQ(db.GetLoadedShardCount(), 1);
+
+    // A miss in an absent family loads nothing.
+    EXPECT_EQ(GetValue(db, "576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NHWC-FP32-F", 0), "<none>");
+    EXPECT_EQ(db.GetLoadedShardCount(), 1);
+
+    EXPECT_EQ(db.GetCacheMap().size(), 6);
+    EXPECT_EQ(db.GetLoadedShardCount(), 5);
+    ExpectAllFound(db);
+}
+
+TEST(CPU_ShardedFindDb_NONE, IgnoresStaleManifest)
+{
+    const miopen::TmpDir dir{"sharded-find-db-test"};
+    const auto file = dir.path / "test.fdb.txt";
+    WriteSharded(file, MakeDb());
+    // Appending a record changes the size, the manifest is not used.
+    std::ofstream{file, std::ios::app} << fwd_nchw_fp32 << "_g2=" << Value(6) << "\n";
+
+    const auto& db = miopen::ReadonlyRamDb::GetCached(miopen::DbKinds::FindDb, file, true);
+    ExpectAllFound(db);
+    EXPECT_EQ(GetValue(db, fwd_nchw_fp32 + "_g2", 6), Values(6));
+    EXPECT_EQ(db.GetLoadedShardCount(), 0);
+}
+
+TEST(CPU_ShardedFindDb_NONE, FallsBackOnMismatchedManifest)
+{
+    const miopen::TmpDir dir{"sharded-find-db-test"};
+    const auto file = dir.path / "test.fdb.txt";
+    WriteSharded(file, MakeDb());
+
+    // Same size, but the records were reordered after sharding.
+    auto contents = std::string{};
+    {
+        auto input    = std::ifstream{file, std::ios::binary};
+        auto reversed = std::string{};
+        for(auto line = std::string{}; std::getline(input, line);)
+            reversed.insert(0, line + "\n");
+        contents = reversed;
+    }
+    std::ofstream{file, std::ios::binary} << contents;
+
+    const auto& db = miopen::ReadonlyRamDb::GetCached(miopen::DbKinds::FindDb, file, true);
+    ExpectAllFound(db);
+    EXPECT_EQ(db.GetCacheMap().size(), 6);
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/solver_id.hpp>
+
+#include <limits>
+#include <set>
+#include <string_view>
+
+namespace {
+
+const auto& GetAllPrimitives()
+{
+    using miopen::solver::Primitive;
+    static const auto primitives = std::vector<Primitive>{Primitive::Convolution,
+                                                          Primitive::Activation,
+                                                          Primitive::Batchnorm,
+                                                          Primitive::Bias,
+                                                          Primitive::Fusion,
+                                                          Primitive::Pooling,
+                                                          Primitive::Normalization,
+                                                          Primitive::Reduce,
+                                                          Primitive::Cat,
+                                                          Primitive::Mha,
+                                                          Primitive::Softmax,
+                                                          Primitive::Adam,
+                                                          Primitive::Item,
+                                                          Primitive::RoPE,
+                                                          Primitive::ReLU,
+                                                          Primitive::Kthvalue,
+                                                          Primitive::SoftMarginLoss,
+                                                          Primitive::MultiMarginLoss};
+    return primitives;
+}
+
+} // namespace
+
+TEST(CPU_SolverIdRegistry_NONE, RoundTrip)
+{
+    auto values = std::set<uint64_t>{};
+    auto names  = std::set<std::string>{};
+
+    for(const auto primitive : GetAllPrimitives())
+    {
+        for(const auto& id : miopen::solver::GetSolversByPrimitive(primitive))
+        {
+            ASSERT_TRUE(id.IsValid());
+            EXPECT_EQ(id.GetPrimitive(), primitive);
+
+            const auto name = id.ToString();
+            EXPECT_TRUE(values.insert(id.Value()).second) << name;
+            EXPECT_TRUE(names.insert(name).second) << name;
+
+            EXPECT_EQ(miopen::solver::Id{id.Value()}, id) << name;
+            EXPECT_EQ(miopen::solver::Id{name}, id) << name;
+            EXPECT_EQ(miopen::solver::Id{name.c_str()}, id) << name;
+            EXPECT_EQ(miopen::solver::Id{std::string_view{name}}, id) << name;
+        }
+    }
+
+    EXPECT_FALSE(values.empty());
+}
+
+TEST(CPU_SolverIdRegistry_NONE, Invalid)
+{
+    EXPECT_FALSE(miopen::solver::Id{miopen::solver::Id::invalid_value}.IsValid());
+    EXPECT_FALSE(miopen::solver::Id{"ThereIsNoSuchSolver"}.IsValid());
+    EXPECT_FALSE(miopen::solver::Id{""}.IsValid());
+    EXPECT_FALSE(miopen::solver::Id{std::numeric_limits<uint64_t>::max()}.IsValid());
+
+    // Prefix of a valid name is not a valid name.
+    const auto& conv_ids =
+        miopen::solver::GetSolversByPrimitive(miopen::solver::Primitive::Convolution);
+    ASSERT_FALSE(conv_ids.empty());
+    const auto name = conv_ids.front().ToString();
+    EXPECT_FALSE(miopen::solver::Id{std::string_view{name}.substr(0, name.size() - 1)}.IsValid());
+
+    EXPECT_TRUE(miopen::solver::GetSolversByPrimitive(miopen::solver::Primitive::Invalid).empty());
+}
@@ -0,0 +1,205 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tensor_dump.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace fs = miopen::fs;
+
+miopen::TensorDumpInfo MakeInfo(std::vector<std::size_t> lengths,
+                                 std::vector<std::size_t> strides,
+                                 miopenDataType_t type = miopenFloat)
+{
+    auto info    = miopen::TensorDumpInfo{};
+    info.type    = type;
+    info.lengths = std::move(lengths);
+    info.strides = std::move(strides);
+    info.layout  = "NCHW";
+    return info;
+}
+
+std::string ReadFile(const fs::path& path)
+{
+    auto file = std::ifstream{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+std::string GetNpyDict(const std::string& header)
+{
+    const auto size = static_cast<unsigned char>(header[8]) |
+                      (static_cast<unsigned char>(header[9]) << 8);
+    return header.substr(10, size);
+}
+
+std::vector<float> Iota(std::size_t size)
+{
+    auto data = std::vector<float>(size);
+    std::iota(data.begin(), data.end(), 0.f);
+    return data;
+}
+
+} // namespace
+
+TEST(CPU_TensorDumpNpyHeader_NONE, Dense)
+{
+    const auto header = miopen::MakeNpyHeader(MakeInfo({2, 3, 4, 5}, {60, 20, 5, 1}));
+
+    EXPECT_EQ(header.substr(0, 8), (std::string{"\x93NUMPY\x01\x00", 8}));
+    EXPECT_EQ(header.size() % 64, 0);
+    EXPECT_EQ(header.back(), '\n');
+    EXPECT_EQ(10 + GetNpyDict(header).size(), header.size());
+
+    const auto dict = GetNpyDict(header);
+    EXPECT_NE(dict.find("'descr': '<f4'"), std::string::npos) << dict;
+    EXPECT_NE(dict.find("'fortran_order': False"), std::string::npos) << dict;
+    EXPECT_NE(dict.find("'shape': (2, 3, 4, 5)"), std::string::npos) << dict;
+}
+
+TEST(CPU_TensorDumpNpyHeader_NONE, Layouts)
+{
+    // NHWC: the shape follows the memory order.
+    auto nhwc            = MakeInfo({2, 3, 4, 5}, {60, 1, 15, 3}, miopenHalf);
+    nhwc.layout          = "NHWC";
+    const auto nhwc_dict = GetNpyDict(miopen::MakeNpyHeader(nhwc));
+    EXPECT_NE(nhwc_dict.find("'descr': '<f2'"), std::string::npos) << nhwc_dict;
+    EXPECT_NE(nhwc_dict.find("'shape': (2, 4, 5, 3)"), std::string::npos) << nhwc_dict;
+
+    // Padded rows can't be described by a shape, the element space is dumped as is.
+    const auto padded      = MakeInfo({2, 3}, {8, 1}, miopenBFloat16);
+    const auto padded_dict = GetNpyDict(miopen::MakeNpyHeader(padded));
+    EXPECT_EQ(padded.GetElementSpace(), 11);
+    EXPECT_NE(padded_dict.find("'descr': '<u2'"), std::string::npos) << padded_dict;
+    EXPECT_NE(padded_dict.find("'shape': (11,)"), std::string::npos) << padded_dict;
+
+    const auto metadata = miopen::MakeTensorDumpMetadata(padded, false);
+    EXPECT_NE(metadata.find("\"type\": \"bfloat16\""), std::string::npos) << metadata;
+    EXPECT_NE(metadata.find("\"strides\": [8, 1]"), std::string::npos) << metadata;
+    EXPECT_NE(metadata.find("\"dense\": false"), std::string::npos) << metadata;
+}
+
+TEST(CPU_TensorDumpSampling_NONE, EveryKFirstN)
+{
+    auto options    = miopen::TensorDumper::Options{};
+    options.every_k = 3;
+    options.first_n = 2;
+    auto dumper     = miopen::TensorDumper{options};
+
+    auto sampled = std::vector<std::size_t>{};
+    for(auto i = 0; i < 12; ++i)
+    {
+        if(const auto call = dumper.Sample())
+            sampled.push_back(*call);
+    }
+    EXPECT_EQ(sampled, (std::vector<std::size_t>{0, 3}));
+}
+
+TEST(CPU_TensorDumper_NONE, WritesNpy)
+{
+    const miopen::TmpDir dir{"tensor-dump-test"};
+    const auto prefix = (dir.path / "conv").string();
+    const auto info   = MakeInfo({2, 3, 4}, {12, 4, 1});
+    const auto data   = Iota(24);
+
+    {
+        auto dumper = miopen::TensorDumper{miopen::TensorDumper::Options{}};
+        dumper.DumpHost(info, data.data(), prefix, 5, "x");
+        dumper.Flush();
+    }
+
+    const auto contents = ReadFile(dir.path / "conv_5_x.npy");
+    const auto header   = miopen::MakeNpyHeader(info);
+    ASSERT_EQ(contents.size(), header.size() + data.size() * sizeof(float));
+    EXPECT_EQ(contents.substr(0, header.size()), header);
+    EXPECT_EQ(std::memcmp(contents.data() + header.size(), data.data(), sizeof(float) * 24), 0);
+    EXPECT_EQ(ReadFile(dir.path / "conv_5_x.json"), miopen::MakeTensorDumpMetadata(info, false));
+}
+
+TEST(CPU_TensorDumper_NONE, BoundedQueue)
+{
+    const miopen::TmpDir dir{"tensor-dump-test"};
+    const auto prefix = (dir.path / "conv").string();
+    const auto info   = MakeInfo({256}, {1});
+
+    auto options              = miopen::TensorDumper::Options{};
+    options.format            = miopen::TensorDumper::Format::Raw;
+    options.max_pending_bytes = 2 * info.GetNumBytes();
+    auto dumper               = miopen::TensorDumper{options};
+
+    // More data than the queue holds: the producer has to wait for the writer.
+    for(auto i = 0; i < 16; ++i)
+    {
+        const auto data = std::vector<float>(256, static_cast<float>(i));
+        dumper.DumpHost(info, data.data(), prefix, i, "t" + std::to_string(i));
+    }
+    dumper.Flush();
+
+    for(auto i = 0; i < 16; ++i)
+    {
+        const auto contents = ReadFile(dir.path / ("conv_t" + std::to_string(i) + ".bin"));
+        ASSERT_EQ(contents.size(), info.GetNumBytes());
+        EXPECT_EQ(reinterpret_cast<const float*>(contents.data())[255], static_cast<float>(i));
+    }
+}
+
+TEST(CPU_TensorDumper_NONE, Compressed)
+{
+    const miopen::TmpDir dir{"tensor-dump-test"};
+    const auto prefix = (dir.path / "conv").string();
+    const auto info   = MakeInfo({64, 64}, {64, 1});
+    const auto data   = std::vector<float>(64 * 64, 1.f);
+
+    auto options     = miopen::TensorDumper::Options{};
+    options.compress = true;
+    {
+        auto dumper = miopen::TensorDumper{options};
+        dumper.DumpHost(info, data.data(), prefix, 0, "y");
+    }
+
+    // Compression depends on the library being built with zstd, the metadata tells which.
+    const auto metadata = ReadFile(dir.path / "conv_0_y.json");
+    if(metadata.find("\"compression\": \"zstd\"") != std::string::npos)
+    {
+        EXPECT_TRUE(fs::exists(dir.path / "conv_0_y.npy.zst"));
+        EXPECT_LT(fs::file_size(dir.path / "conv_0_y.npy.zst"), info.GetNumBytes());
+    }
+    else
+    {
+        EXPECT_EQ(metadata, miopen::MakeTensorDumpMetadata(info, false));
+        EXPECT_TRUE(fs::exists(dir.path / "conv_0_y.npy"));
+    }
+}
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/generic_search.hpp>
+#include <miopen/tuning_planner.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+using miopen::TuningPlanner;
+using std::chrono::seconds;
+
+TuningPlanner::Options MakeOptions()
+{
+    auto options       = TuningPlanner::Options{};
+    options.min_budget = seconds{10};
+    options.max_budget = seconds{1000};
+    return options;
+}
+
+} // namespace
+
+TEST(CPU_TuningPlanner_NONE, SplitsBudgetByExpectedGain)
+{
+    TuningPlanner planner{seconds{100}, MakeOptions()};
+    const auto small = planner.Add("small", 1, 1e9);
+    const auto large = planner.Add("large", 1, 3e9);
+
+    EXPECT_EQ(planner.Get(small).budget, seconds{25});
+    EXPECT_EQ(planner.Get(large).budget, seconds{75});
+    EXPECT_DOUBLE_EQ(planner.GetTimeShare(large), 0.75);
+    EXPECT_EQ(planner.Next(), large);
+}
+
+TEST(CPU_TuningPlanner_NONE, CountsOccurrences)
+{
+    TuningPlanner planner{seconds{100}, MakeOptions()};
+    const auto a = planner.Add("a", 1, 1e9);
+    const auto b = planner.Add("b", 1, 1e9);
+    EXPECT_EQ(planner.Add("a", 2, 1e9), a);
+
+    EXPECT_EQ(planner.Size(), 2);
+    EXPECT_EQ(planner.Get(a).count, 3);
+    EXPECT_EQ(planner.Get(a).budget, seconds{75});
+    EXPECT_EQ(planner.Get(b).budget, seconds{25});
+}
+
+TEST(CPU_TuningPlanner_NONE, SkipsProblemsBelowMinBudget)
+{
+    TuningPlanner planner{seconds{30}, MakeOptions()};
+    for(const auto* key : {"a", "b", "c", "d"})
+        planner.Add(key, 1, 1e9);
+
+    auto funded = 0;
+    for(auto i = std::size_t{0}; i < planner.Size(); ++i)
+    {
+        if(planner.Get(i).budget.count() == 0)
+            continue;
+        EXPECT_EQ(planner.Get(i).budget, seconds{10});
+        ++funded;
+    }
+    EXPECT_EQ(funded, 3);
+}
+
+TEST(CPU_TuningPlanner_NONE, RedistributesBudgetAboveMax)
+{
+    auto options       = MakeOptions();
+    options.max_budget = seconds{50};
+    TuningPlanner planner{seconds{100}, options};
+    const auto a = planner.Add("a", 1, 8e9);
+    const auto b = planner.Add("b", 1, 1e9);
+    const auto c = planner.Add("c", 1, 1e9);
+
+    EXPECT_EQ(planner.Get(a).budget, seconds{50});
+    EXPECT_EQ(planner.Get(b).budget, seconds{25});
+    EXPECT_EQ(planner.Get(c).budget, seconds{25});
+}
+
+TEST(CPU_TuningPlanner_NONE, PrefersUntunedProblems)
+{
+    TuningPlanner planner{seconds{100}, MakeOptions()};
+    // Same time, but the first one has a find-db record already.
+    const auto tuned   = planner.Add("tuned", 1, 1e9, 1.0);
+    const auto untuned = planner.Add("untuned", 1, 1e9);
+
+    // The known time calibrates the estimate of the other problem.
+    EXPECT_DOUBLE_EQ(planner.GetEstimatedTime(untuned), 1.0);
+    EXPECT_GT(planner.Get(untuned).budget, planner.Get(tuned).budget);
+    EXPECT_EQ(planner.Next(), untuned);
+}
+
+TEST(CPU_TuningPlanner_NONE, ReplansAfterReport)
+{
+    TuningPlanner planner{seconds{100}, MakeOptions()};
+    const auto a = planner.Add("a", 1, 2e9);
+    const auto b = planner.Add("b", 1, 1e9);
+    const auto c = planner.Add("c", 1, 1e9);
+    EXPECT_EQ(planner.Get(a).budget, seconds{50});
+
+    // The unused budget goes to the rest.
+    planner.Report(a, seconds{20}, 1.0);
+    EXPECT_EQ(planner.Get(a).budget.count(), 0);
+    EXPECT_EQ(planner.GetRemainingBudget(), seconds{80});
+    EXPECT_EQ(planner.Get(b).budget, seconds{40});
+    EXPECT_EQ(planner.Get(c).budget, seconds{40});
+
+    // The measured time calibrates the estimates.
+    EXPECT_DOUBLE_EQ(planner.GetEstimatedTime(b), 0.5);
+
+    planner.Report(b, seconds{75}, std::nullopt);
+    EXPECT_EQ(planner.Next(), std::nullopt);
+    EXPECT_EQ(planner.Get(c).budget.count(), 0);
+    EXPECT_ANY_THROW(planner.Report(b, seconds{0}, std::nullopt));
+}
+
+TEST(CPU_TuningPlanner_NONE, LimitsTuningTime)
+{
+    const auto unlimited = miopen::solver::GetTuningTimeMax();
+    {
+        const miopen::solver::TuningTimeScopedLimiter limiter{seconds{10}};
+        EXPECT_LE(miopen::solver::GetTuningTimeMax(), seconds{10});
+        EXPECT_GT(miopen::solver::GetTuningTimeMax(), seconds{9});
+        {
+            const miopen::solver::TuningTimeScopedLimiter nested{seconds{0}};
+            EXPECT_EQ(miopen::solver::GetTuningTimeMax().count(), 0);
+        }
+        EXPECT_GT(miopen::solver::GetTuningTimeMax(), seconds{9});
+    }
+    EXPECT_EQ(miopen::solver::GetTuningTimeMax(), unlimited);
+}
+
+TEST(CPU_TuningPlanner_NONE, TuningTimeLimitIsPerThread)
+{
+    const auto unlimited = miopen::solver::GetTuningTimeMax();
+    const miopen::solver::TuningTimeScopedLimiter limiter{seconds{0}};
+    EXPECT_EQ(miopen::solver::GetTuningTimeMax().count(), 0);
+
+    auto other = std::chrono::milliseconds{-1};
+    std::thread{[&other]() { other = miopen::solver::GetTuningTimeMax(); }}.join();
+    EXPECT_EQ(other, unlimited);
+}
+
+TEST(CPU_TuningPlanner_NONE, TuningCancelIsPerThread)
+{
+    EXPECT_FALSE(miopen::solver::IsTuningCancelled());
+
+    std::atomic<bool> flag{false};
+    {
+        const miopen::solver::TuningCancelScope cancel{flag};
+        EXPECT_FALSE(miopen::solver::IsTuningCancelled());
+        flag = true;
+        EXPECT_TRUE(miopen::solver::IsTuningCancelled());
+
+        auto other = true;
+        std::thread{[&other]() { other = miopen::solver::IsTuningCancelled(); }}.join();
+        EXPECT_FALSE(other);
+    }
+    EXPECT_FALSE(miopen::solver::IsTuningCancelled());
+}
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+miopen::TuningJob MakeJob(int i)
+{
+    auto name = std::to_string(i);
+    name.insert(0, 6 - name.size(), '0');
+    return {name, "ConvHipImplicitGemmV4R1Fwd", "conv -n 1 -c " + std::to_string(i)};
+}
+
+} // namespace
+
+TEST(CPU_TuningQueue_NONE, ClaimsInOrder)
+{
+    const miopen::TmpDir dir{"tuning-queue-test"};
+    auto queue = miopen::TuningQueue{dir.path};
+
+    for(auto i : {2, 0, 1})
+        queue.Push(MakeJob(i));
+    EXPECT_EQ(queue.GetStats().pending, 3);
+
+    for(auto i = 0; i < 3; ++i)
+    {
+        const auto job = queue.Claim();
+        ASSERT_TRUE(job);
+        miopen::fs::create_directories(queue.GetShardPath(*job));
+        EXPECT_EQ(job->name, MakeJob(i).name);
+        EXPECT_EQ(job->solvers, MakeJob(i).solvers);
+        EXPECT_EQ(job->command, MakeJob(i).command);
+        EXPECT_EQ(queue.GetStats().claimed, 1);
+        queue.Complete(*job, i != 1);
+    }
+    EXPECT_FALSE(queue.Claim());
+
+    const auto stats = queue.GetStats();
+    EXPECT_EQ(stats.pending, 0);
+    EXPECT_EQ(stats.claimed, 0);
+    EXPECT_EQ(stats.done, 2);
+    EXPECT_EQ(stats.failed, 1);
+    EXPECT_EQ(queue.GetShardPath(MakeJob(1)), dir.path / "shards" / "000001");
+
+    const auto shards = queue.GetDoneShards();
+    ASSERT_EQ(shards.size(), 2);
+    EXPECT_EQ(shards[0], queue.GetShardPath(MakeJob(0)));
+    EXPECT_EQ(shards[1], queue.GetShardPath(MakeJob(2)));
+}
+
+TEST(CPU_TuningQueue_NONE, RejectsInvalidJobs)
+{
+    const miopen::TmpDir dir{"tuning-queue-test"};
+    auto queue = miopen::TuningQueue{dir.path};
+
+    EXPECT_ANY_THROW(queue.Push({"", "a", "b"}));
+    EXPECT_ANY_THROW(queue.Push({"x@1", "a", "b"}));
+    EXPECT_ANY_THROW(queue.Push({"../x", "a", "b"}));
+    EXPECT_ANY_THROW(queue.Push({"x", "a", "b\nc"}));
+    EXPECT_EQ(queue.GetStats().pending, 0);
+}
+
+TEST(CPU_TuningQueue_NONE, ConcurrentClaimsAreExclusive)
+{
+    constexpr auto n_jobs    = 200;
+    constexpr auto n_workers = 8;
+
+    const miopen::TmpDir dir{"tuning-queue-test"};
+    {
+        auto queue = miopen::TuningQueue{dir.path};
+        for(auto i = 0; i < n_jobs; ++i)
+            queue.Push(MakeJob(i));
+    }
+
+    auto mutex   = std::mutex{};
+    auto claimed = std::map<std::string, int>{};
+    auto workers = std::vector<std::thread>{};
+
+    for(auto w = 0; w < n_workers; ++w)
+    {
+        workers.emplace_back([&]() {
+            // Every worker has its own view of the queue, like separate processes do.
+            auto queue = miopen::TuningQueue{dir.path};
+            while(const auto job = queue.Claim())
+            {
+                {
+                    const auto lock = std::lock_guard<std::mutex>{mutex};
+                    ++claimed[job->name];
+                }
+                queue.Complete(*job, true);
+            }
+        });
+    }
+    for(auto& worker : workers)
+        worker.join();
+
+    EXPECT_EQ(claimed.size(), n_jobs);
+    for(const auto& [name, count] : claimed)
+        EXPECT_EQ(count, 1) << name;
+    EXPECT_EQ(miopen::TuningQueue{dir.path}.GetStats().done, n_jobs);
+}
+
+#ifndef _WIN32
+TEST(CPU_TuningQueue_NONE, RequeuesJobsOfDeadWorkers)
+{
+    const miopen::TmpDir dir{"tuning-queue-test"};
+    auto queue = miopen::TuningQueue{dir.path};
+    queue.Push(MakeJob(0));
+    queue.Push(MakeJob(1));
+
+    // This process is alive, its job must stay claimed.
+    const auto own = queue.Claim();
+    ASSERT_TRUE(own);
+
+    // A worker which crashes with a claimed job and a partial shard.
+    const auto pid = fork();
+    ASSERT_NE(pid, -1);
+    if(pid == 0)
+    {
+        const auto job = queue.Claim();
+        if(job)
+            miopen::fs::create_directories(queue.GetShardPath(*job));
+        _exit(job ? 0 : 1);
+    }
+    auto status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+    EXPECT_EQ(queue.GetStats().claimed, 2);
+
+    EXPECT_EQ(queue.RequeueAbandoned(), 1);
+    EXPECT_EQ(queue.RequeueAbandoned(), 0);
+    EXPECT_FALSE(miopen::fs::exists(queue.GetShardPath(MakeJob(1))));
+
+    const auto stats = queue.GetStats();
+    EXPECT_EQ(stats.pending, 1);
+    EXPECT_EQ(stats.claimed, 1);
+
+    const auto requeued = queue.Claim();
+    ASSERT_TRUE(requeued);
+    EXPECT_EQ(requeued->name, MakeJob(1).name);
+    EXPECT_EQ(requeued->command, MakeJob(1).command);
+}
+#endif
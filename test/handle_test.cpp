@@ -318,6 +318,27 @@ void test_arch_name()
         known_arch.begin(), known_arch.end(), [&](std::string arch) { return arch == this_arch; }));
 }
 
+void test_lazy_init()
+{
+    const auto expected = get_handle().GetDeviceName();
+
+    // Subsystems are created on first use, with or without an explicit warm-up.
+    auto lazy = miopen::Handle{};
+    EXPECT(lazy.GetDeviceName() == expected);
+
+    auto warm = miopen::Handle{};
+    warm.WarmUp();
+    warm.WarmUp();
+    EXPECT(warm.GetDeviceName() == expected);
+    EXPECT(warm.GetTargetProperties().DbId() == get_handle().GetTargetProperties().DbId());
+
+    miopenHandle_t handle = nullptr;
+    EXPECT(miopenCreate(&handle) == miopenStatusSuccess);
+    EXPECT(miopenWarmUpHandle(handle) == miopenStatusSuccess);
+    EXPECT(miopen::deref(handle).GetDeviceName() == expected);
+    EXPECT(miopenDestroy(handle) == miopenStatusSuccess);
+}
+
 int main()
 {
     auto&& h = get_handle();
@@ -334,6 +355,7 @@ int main()
     test_multithreads(miopenOpenCLKernelType, true);
     test_errors(miopenOpenCLKernelType);
     test_arch_name();
+    test_lazy_init();
 // Warnings currently dont work in opencl
 #if !MIOPEN_BACKEND_OPENCL
     test_warnings(miopenOpenCLKernelType);
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/// Fits the coefficients of the convolution cost model (see
+/// src/include/miopen/conv/heuristics/cost_model.hpp) to the timings stored in a
+/// text find-db. The result can be passed to the library via
+/// MIOPEN_DEBUG_CONV_COST_MODEL_COEFFS_PATH.
+///
+/// Usage: conv_cost_calibrate <find-db.txt> <device name> <CU count> [output file]
+
+#include <miopen/conv/heuristics/cost_model.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace cm = miopen::conv::cost_model;
+
+void ReadSamples(std::istream& stream, std::vector<cm::CalibrationSample>& samples)
+{
+    auto line      = std::string{};
+    auto ill_keys  = 0;
+    auto ill_items = 0;
+
+    while(std::getline(stream, line))
+    {
+        const auto eq = line.find('=');
+        if(eq == std::string::npos)
+            continue;
+
+        auto shape = cm::ConvShape{};
+        if(!cm::ConvShape::FromDbKey(line.substr(0, eq), shape))
+        {
+            ++ill_keys;
+            continue;
+        }
+
+        // Items are "solver:time,workspace,algorithm" separated by ';'.
+        for(const auto& item : miopen::SplitDelim(line.substr(eq + 1), ';'))
+        {
+            const auto colon = item.find(':');
+            if(colon == std::string::npos)
+            {
+                ++ill_items;
+                continue;
+            }
+
+            const auto id = miopen::solver::Id{item.substr(0, colon)};
+            if(!id.IsValid())
+            {
+                ++ill_items;
+                continue;
+            }
+
+            const auto time = std::strtof(item.c_str() + colon + 1, nullptr);
+            if(!(time > 0.0f))
+            {
+                ++ill_items;
+                continue;
+            }
+
+            samples.push_back({cm::GetSolverFamily(id), shape, time});
+        }
+    }
+
+    if(ill_keys > 0 || ill_items > 0)
+    {
+        std::cerr << "Skipped " << ill_keys << " ill-formed keys and " << ill_items
+                  << " ill-formed or obsolete items." << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if(argc < 4)
+    {
+        std::cerr << "Usage: " << argv[0] << " <find-db.txt> <device name> <CU count> [output]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto input = std::ifstream{argv[1]};
+    if(!input)
+    {
+        std::cerr << "Unable to open " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto samples = std::vector<cm::CalibrationSample>{};
+    ReadSamples(input, samples);
+
+    const auto device = cm::DeviceCaps::FromName(argv[2], std::strtoull(argv[3], nullptr, 10));
+    const auto model  = cm::Calibrate(device, samples);
+
+    auto per_family = std::map<std::string, std::size_t>{};
+    for(const auto& s : samples)
+        ++per_family[cm::ToString(s.family)];
+    for(const auto& f : per_family)
+        std::cerr << f.first << ": " << f.second << " samples" << std::endl;
+
+    if(argc > 4)
+    {
+        auto output = std::ofstream{argv[4]};
+        if(!output)
+        {
+            std::cerr << "Unable to open " << argv[4] << std::endl;
+            return EXIT_FAILURE;
+        }
+        model.Save(output);
+    }
+    else
+    {
+        model.Save(std::cout);
+    }
+
+    return EXIT_SUCCESS;
+}
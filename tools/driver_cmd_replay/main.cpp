@@ -0,0 +1,222 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/// Turns logs written with MIOPEN_ENABLE_LOGGING_CMD=1 into driver workloads.
+///
+/// Usage: miopen-cmd-replay [options] <command> <log>...
+///   profile    Operations and problems ordered by their share of the logged calls.
+///   manifest   A shell script running every unique problem once with MIOpenDriver, the most
+///              frequent first, each preceded by its occurrence count.
+/// Options:
+///   -m count   Skips problems logged less than count times.
+///   -n count   Lists at most count problems (profile).
+///   -i iters   Adds "-i" to the commands, splitting iters between them proportionally to
+///              their counts, at least 1 each (manifest).
+///   -d path    Driver executable, ./bin/MIOpenDriver by default (manifest).
+/// A log named "-" is read from the standard input.
+
+#include <miopen/driver_cmd_log.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options
+{
+    std::size_t min_count  = 1;
+    std::size_t max_listed = 50;
+    std::size_t iterations = 0;
+    std::string driver     = "./bin/MIOpenDriver";
+};
+
+void ReadLog(miopen::DriverCommandLog& log, const std::string& file)
+{
+    if(file == "-")
+    {
+        log.Read(std::cin);
+        return;
+    }
+    auto stream = std::ifstream{file};
+    if(!stream)
+        throw std::runtime_error("Cannot open " + file);
+    log.Read(stream);
+}
+
+double Percent(std::size_t count, std::size_t total)
+{
+    return total == 0 ? 0. : 100. * static_cast<double>(count) / static_cast<double>(total);
+}
+
+/// Convolutions and fusions are split by the direction or the fusion mode.
+std::string GetGroup(const std::string& args)
+{
+    auto group = std::string{miopen::GetDriverOperation(args)};
+    if(const auto mode = miopen::GetDriverFlag(args, "-F"))
+        group += " -F " + std::string{*mode};
+    return group;
+}
+
+void Profile(const miopen::DriverCommandLog& log,
+             const std::vector<miopen::DriverProblem>& problems,
+             const Options& options)
+{
+    const auto total = log.GetTotal();
+    std::cout << total << " commands, " << problems.size() << " unique problems" << std::endl;
+
+    auto groups = std::map<std::string, std::pair<std::size_t, std::size_t>>{};
+    for(const auto& problem : problems)
+    {
+        auto& group = groups[GetGroup(problem.args)];
+        group.first += problem.count;
+        ++group.second;
+    }
+    auto ordered = std::vector<std::pair<std::string, std::pair<std::size_t, std::size_t>>>{
+        groups.begin(), groups.end()};
+    std::stable_sort(ordered.begin(), ordered.end(), [](const auto& l, const auto& r) {
+        return l.second.first > r.second.first;
+    });
+
+    std::cout << std::fixed << std::setprecision(2) << "Operations:" << std::endl;
+    for(const auto& [name, group] : ordered)
+    {
+        std::cout << "  " << name << ": " << group.first << " (" << Percent(group.first, total)
+                  << "%), " << group.second << " problems" << std::endl;
+    }
+
+    std::cout << "Problems (count, share, cumulative share):" << std::endl;
+    auto cumulative   = std::size_t{0};
+    const auto listed = std::min(problems.size(), options.max_listed);
+    for(std::size_t i = 0; i < listed; ++i)
+    {
+        const auto& problem = problems[i];
+        cumulative += problem.count;
+        std::cout << "  " << problem.count << " " << Percent(problem.count, total) << "% "
+                  << Percent(cumulative, total) << "% " << problem.args << std::endl;
+        for(const auto& [api, count] : problem.apis)
+            std::cout << "      " << api << ": " << count << std::endl;
+    }
+    if(listed < problems.size())
+        std::cout << "  ... " << problems.size() - listed << " more" << std::endl;
+}
+
+void Manifest(const miopen::DriverCommandLog& log,
+              const std::vector<miopen::DriverProblem>& problems,
+              const Options& options)
+{
+    const auto total = log.GetTotal();
+    auto selected    = std::size_t{0};
+    for(const auto& problem : problems)
+        selected += problem.count;
+
+    std::cout << "#!/bin/sh" << std::endl
+              << "# " << problems.size() << " problems covering " << selected << " of " << total
+              << " logged commands" << std::endl;
+
+    for(const auto& problem : problems)
+    {
+        std::cout << "# " << problem.count << std::endl << options.driver << " " << problem.args;
+        const auto has_iterations = miopen::GetDriverFlag(problem.args, "-i") ||
+                                    miopen::GetDriverFlag(problem.args, "--iter");
+        if(options.iterations > 0 && !has_iterations)
+        {
+            const auto share = static_cast<double>(options.iterations) *
+                               static_cast<double>(problem.count) / static_cast<double>(selected);
+            std::cout << " -i " << std::max<std::size_t>(1, std::llround(share));
+        }
+        std::cout << std::endl;
+    }
+}
+
+int Usage(const char* name)
+{
+    std::cerr << "Usage: " << name
+              << " [-m min count] [-n listed] [-i iterations] [-d driver] <profile|manifest>"
+                 " <log>..."
+              << std::endl;
+    return EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    auto args    = std::vector<std::string>(argv + 1, argv + argc);
+    auto options = Options{};
+
+    while(args.size() >= 2 && args[0].size() == 2 && args[0][0] == '-')
+    {
+        const auto flag  = args[0][1];
+        const auto value = args[1];
+        if(flag == 'm')
+            options.min_count = std::strtoull(value.c_str(), nullptr, 10);
+        else if(flag == 'n')
+            options.max_listed = std::strtoull(value.c_str(), nullptr, 10);
+        else if(flag == 'i')
+            options.iterations = std::strtoull(value.c_str(), nullptr, 10);
+        else if(flag == 'd')
+            options.driver = value;
+        else
+            return Usage(argv[0]);
+        args.erase(args.begin(), args.begin() + 2);
+    }
+    if(args.size() < 2 || (args[0] != "profile" && args[0] != "manifest"))
+        return Usage(argv[0]);
+
+    try
+    {
+        auto log = miopen::DriverCommandLog{};
+        for(auto file = args.begin() + 1; file != args.end(); ++file)
+            ReadLog(log, *file);
+
+        auto problems = log.GetProblems();
+        problems.erase(std::find_if(problems.begin(),
+                                    problems.end(),
+                                    [&](const auto& p) { return p.count < options.min_count; }),
+                       problems.end());
+
+        if(args[0] == "profile")
+            Profile(log, problems, options);
+        else
+            Manifest(log, problems, options);
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
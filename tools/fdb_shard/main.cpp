@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Does not link against the library: it runs during the build to shard the
+// system find-db files. See miopen/db_shard.hpp for the format.
+
+#include <miopen/db_shard.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+int main(int argn, char** args)
+{
+    if(argn < 2 || argn > 3)
+    {
+        std::cerr << "Usage:" << std::endl;
+        std::cerr << args[0] << " input_path [output_path]" << std::endl;
+        std::cerr << "input_path - path to the input text find-db." << std::endl;
+        std::cerr << "output_path - optional path to the sharded output file. Existing file would "
+                     "be replaced. Defaults to the input_path. The manifest is written next to it "
+                     "with .shards appended to the name."
+                  << std::endl;
+        return 1;
+    }
+
+    const std::string in_filename  = args[1];
+    const std::string out_filename = argn > 2 ? args[2] : in_filename;
+    const auto tmp_filename        = out_filename + ".tmp";
+    const auto manifest_filename   = miopen::GetDbShardManifestPath(out_filename);
+
+    {
+        auto input    = std::ifstream{in_filename, std::ios::binary};
+        auto output   = std::ofstream{tmp_filename, std::ios::binary};
+        auto manifest = std::ofstream{manifest_filename, std::ios::binary};
+
+        if(!input)
+        {
+            std::cerr << "Unable to read " << in_filename << std::endl;
+            return 1;
+        }
+
+        if(!miopen::WriteShardedDb(input, output, manifest))
+        {
+            std::cerr << "Unable to shard " << in_filename << std::endl;
+            std::remove(tmp_filename.c_str());
+            std::remove(manifest_filename.c_str());
+            return 1;
+        }
+    }
+
+    if(std::rename(tmp_filename.c_str(), out_filename.c_str()) != 0)
+    {
+        std::cerr << "Unable to replace " << out_filename << std::endl;
+        std::remove(manifest_filename.c_str());
+        return 1;
+    }
+
+    return 0;
+}
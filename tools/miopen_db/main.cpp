@@ -0,0 +1,362 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/// Maintenance of the find-db, perf-db and kernel db files.
+///
+/// Usage: miopen-db [-j threads] <command> <files>
+///   stats <db>...              Sizes and per-solver (per-kernel file) counts.
+///   diff <from> <to>           Values removed, added and changed, text dbs only.
+///   merge <target> <source>... Find-db: the best time wins. Perf-db: existing values win.
+///   prune <db>...              Removes the values of solvers which are not known anymore,
+///                              or the kernels which fail to load.
+///   vacuum <db>...             Compacts the file. Text dbs get duplicate keys merged and
+///                              ill-formed records dropped.
+///
+/// The kind of a db is determined by the file name: *.fdb.txt and *.ufdb.txt are text
+/// find-dbs, *.db.txt and *.udb.txt are text perf-dbs, *.db and *.udb are SQLite perf-dbs,
+/// *.kdb and *.ukdb are kernel dbs. Text dbs are parsed by several threads, -j limits them.
+
+#include <miopen/db_maintenance.hpp>
+#include <miopen/db_merge.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/stringutils.hpp>
+
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/kern_db.hpp>
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace fs = miopen::fs;
+
+enum class DbFormat
+{
+    TextFindDb,
+    TextPerfDb,
+    SQLitePerfDb,
+    KernDb,
+    Unknown,
+};
+
+DbFormat GetFormat(const fs::path& file)
+{
+    const auto name      = file.filename().string();
+    const auto extension = file.extension().string();
+    if(miopen::EndsWith(name, ".fdb.txt") || miopen::EndsWith(name, ".ufdb.txt"))
+        return DbFormat::TextFindDb;
+    if(miopen::EndsWith(name, ".db.txt") || miopen::EndsWith(name, ".udb.txt"))
+        return DbFormat::TextPerfDb;
+    if(extension == ".kdb" || extension == ".ukdb")
+        return DbFormat::KernDb;
+    if(extension == ".db" || extension == ".udb")
+        return DbFormat::SQLitePerfDb;
+    return DbFormat::Unknown;
+}
+
+bool IsText(DbFormat format)
+{
+    return format == DbFormat::TextFindDb || format == DbFormat::TextPerfDb;
+}
+
+miopen::DbKinds GetKind(DbFormat format)
+{
+    return format == DbFormat::TextFindDb ? miopen::DbKinds::FindDb : miopen::DbKinds::PerfDb;
+}
+
+bool IsKnownSolver(const std::string& id) { return miopen::solver::Id{id}.IsValid(); }
+
+void Unsupported(const std::string& command, const fs::path& file)
+{
+    throw std::runtime_error(command + " is not supported for " + file.string());
+}
+
+void PrintStats(const fs::path& file, const miopen::DbStats& stats, bool find_db)
+{
+    std::cout << file.string() << ": " << fs::file_size(file) << " bytes, " << stats.records
+              << " records, " << stats.values << " values" << std::endl;
+
+    auto solvers = std::vector<std::pair<std::string, miopen::DbSolverStats>>{
+        stats.per_solver.begin(), stats.per_solver.end()};
+    std::sort(solvers.begin(), solvers.end(), [](const auto& l, const auto& r) {
+        return l.second.values > r.second.values;
+    });
+
+    for(const auto& [id, solver] : solvers)
+    {
+        std::cout << "  " << id << ": " << solver.values;
+        if(find_db)
+            std::cout << " (best in " << solver.best << ")";
+        std::cout << std::endl;
+    }
+}
+
+void Stats(const fs::path& file, std::size_t n_threads)
+{
+    const auto format = GetFormat(file);
+
+    if(IsText(format))
+    {
+        auto read_stats    = miopen::TextDbReadStats{};
+        const auto records = miopen::ReadTextDb(file, n_threads, &read_stats);
+        const auto stats   = miopen::GetTextDbStats(GetKind(format), records);
+        PrintStats(file, stats, format == DbFormat::TextFindDb);
+
+        auto unknown = std::size_t{0};
+        for(const auto& solver : stats.per_solver)
+            unknown += IsKnownSolver(solver.first) ? 0 : solver.second.values;
+        std::cout << "  " << read_stats.duplicate_keys << " duplicate keys, "
+                  << read_stats.ill_formed << " ill-formed, " << unknown
+                  << " values of unknown solvers" << std::endl;
+        return;
+    }
+
+#if MIOPEN_ENABLE_SQLITE
+    if(format == DbFormat::SQLitePerfDb)
+    {
+        auto db = miopen::SQLitePerfDb{miopen::DbKinds::PerfDb, file, false};
+        PrintStats(file, miopen::GetPerfDbStats(db), false);
+        return;
+    }
+    if(format == DbFormat::KernDb)
+    {
+        auto db = miopen::KernDb{miopen::DbKinds::KernelDb, file, false};
+        PrintStats(file, miopen::GetKernDbStats(db), false);
+        return;
+    }
+#endif
+
+    Unsupported("stats", file);
+}
+
+void Diff(const fs::path& from, const fs::path& to, std::size_t n_threads)
+{
+    if(!IsText(GetFormat(from)) || GetFormat(from) != GetFormat(to))
+        Unsupported("diff", from);
+
+    auto from_records = std::async(std::launch::async, [&]() {
+        return miopen::ReadTextDb(from, n_threads);
+    });
+    const auto to_records = miopen::ReadTextDb(to, n_threads);
+    const auto diff       = miopen::DiffTextDbs(from_records.get(), to_records);
+
+    for(const auto& value : diff.removed)
+        std::cout << "- " << value << std::endl;
+    for(const auto& value : diff.added)
+        std::cout << "+ " << value << std::endl;
+    for(const auto& value : diff.changed)
+        std::cout << "~ " << value << std::endl;
+}
+
+void Merge(const fs::path& target, const std::vector<fs::path>& sources, std::size_t n_threads)
+{
+    const auto format = GetFormat(target);
+    for(const auto& source : sources)
+    {
+        if(GetFormat(source) != format)
+            Unsupported("merge", source);
+    }
+
+    if(IsText(format))
+    {
+        auto reads = std::vector<std::future<miopen::TextDbRecords>>{};
+        for(const auto& source : sources)
+        {
+            reads.push_back(std::async(std::launch::async, [&source, n_threads]() {
+                return miopen::ReadTextDb(source, n_threads);
+            }));
+        }
+        auto records = std::vector<miopen::TextDbRecords>{};
+        for(auto& read : reads)
+            records.push_back(read.get());
+
+        auto stats = miopen::DbMergeStats{};
+        miopen::UpdateTextDb(
+            target,
+            [&](miopen::TextDbRecords& target_records) {
+                stats = miopen::MergeTextDbs(GetKind(format), target_records, records);
+            },
+            n_threads);
+        std::cout << target.string() << ": " << stats.added << " added, " << stats.replaced
+                  << " replaced, " << stats.kept << " kept" << std::endl;
+        return;
+    }
+
+#if MIOPEN_ENABLE_SQLITE
+    if(format == DbFormat::KernDb)
+    {
+        auto db    = miopen::KernDb{miopen::DbKinds::KernelDb, target, false};
+        auto added = std::size_t{0};
+        for(const auto& source : sources)
+        {
+            auto source_db = miopen::KernDb{miopen::DbKinds::KernelDb, source, false};
+            added += miopen::MergeKernDbs(db, source_db);
+        }
+        std::cout << target.string() << ": " << added << " added" << std::endl;
+        return;
+    }
+#endif
+
+    // SQLite perf-dbs can be converted with sqlite2txt first.
+    Unsupported("merge", target);
+}
+
+void Prune(const fs::path& file, std::size_t n_threads)
+{
+    const auto format = GetFormat(file);
+    auto removed      = std::size_t{0};
+
+    if(IsText(format))
+    {
+        miopen::UpdateTextDb(
+            file,
+            [&](miopen::TextDbRecords& records) {
+                removed = miopen::PruneTextDb(records, IsKnownSolver);
+            },
+            n_threads);
+    }
+#if MIOPEN_ENABLE_SQLITE
+    else if(format == DbFormat::SQLitePerfDb)
+    {
+        auto db = miopen::SQLitePerfDb{miopen::DbKinds::PerfDb, file, false};
+        removed = miopen::PrunePerfDb(db, IsKnownSolver);
+    }
+    else if(format == DbFormat::KernDb)
+    {
+        auto db = miopen::KernDb{miopen::DbKinds::KernelDb, file, false};
+        removed = miopen::PruneKernDb(db, n_threads);
+    }
+#endif
+    else
+    {
+        Unsupported("prune", file);
+    }
+
+    std::cout << file.string() << ": " << removed << " removed" << std::endl;
+}
+
+void Vacuum(const fs::path& file, std::size_t n_threads)
+{
+    const auto format = GetFormat(file);
+    const auto before = fs::file_size(file);
+
+    if(IsText(format))
+    {
+        miopen::UpdateTextDb(file, [](miopen::TextDbRecords&) {}, n_threads);
+    }
+#if MIOPEN_ENABLE_SQLITE
+    else if(format == DbFormat::SQLitePerfDb)
+    {
+        auto db = miopen::SQLitePerfDb{miopen::DbKinds::PerfDb, file, false};
+        miopen::VacuumPerfDb(db);
+    }
+    else if(format == DbFormat::KernDb)
+    {
+        auto db = miopen::KernDb{miopen::DbKinds::KernelDb, file, false};
+        miopen::VacuumKernDb(db);
+    }
+#endif
+    else
+    {
+        Unsupported("vacuum", file);
+    }
+
+    std::cout << file.string() << ": " << before << " -> " << fs::file_size(file) << " bytes"
+              << std::endl;
+}
+
+int Usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [-j threads] <command> <files>\n"
+              << "  stats <db>...\n"
+              << "  diff <from> <to>\n"
+              << "  merge <target> <source>...\n"
+              << "  prune <db>...\n"
+              << "  vacuum <db>..." << std::endl;
+    return EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    auto args = std::vector<std::string>(argv + 1, argv + argc);
+
+    auto n_threads = std::size_t{0};
+    if(args.size() >= 2 && args[0] == "-j")
+    {
+        n_threads = std::strtoull(args[1].c_str(), nullptr, 10);
+        args.erase(args.begin(), args.begin() + 2);
+    }
+    if(args.size() < 2)
+        return Usage(argv[0]);
+
+    const auto command = args[0];
+    const auto files   = std::vector<fs::path>(args.begin() + 1, args.end());
+
+    try
+    {
+        if(command == "diff" && files.size() == 2)
+        {
+            Diff(files[0], files[1], n_threads);
+            return EXIT_SUCCESS;
+        }
+        if(command == "merge" && files.size() >= 2)
+        {
+            Merge(files[0], {files.begin() + 1, files.end()}, n_threads);
+            return EXIT_SUCCESS;
+        }
+
+        void (*action)(const fs::path&, std::size_t) = nullptr;
+        if(command == "stats")
+            action = Stats;
+        else if(command == "prune")
+            action = Prune;
+        else if(command == "vacuum")
+            action = Vacuum;
+        else
+            return Usage(argv[0]);
+
+        for(const auto& file : files)
+            action(file, n_threads);
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
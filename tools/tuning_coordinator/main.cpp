@@ -0,0 +1,287 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/// Tunes many problems on one machine with several MIOpenDriver processes without
+/// fighting over the user databases. The problems are split into problem/solver jobs
+/// of a file-based queue (see src/include/miopen/tuning_queue.hpp). Every job is tuned
+/// with a private user db shard, and the shards are merged into the user db at the end
+/// with conflicts resolved by the best time (see src/include/miopen/db_merge.hpp).
+///
+/// Usage:
+///   tuning_coordinator <queue> push <commands file> [solver,...]
+///   tuning_coordinator <queue> work <MIOpenDriver> [workers]
+///   tuning_coordinator <queue> merge [user db path]
+///   tuning_coordinator <queue> status
+///   tuning_coordinator <queue> run <commands file> <MIOpenDriver> [workers]
+///
+/// Every line of the commands file is MIOpenDriver arguments of a convolution, e.g.
+/// "conv -n 32 -c 64 -H 56 -W 56 -k 64 -y 3 -x 3 -p 1 -q 1 -V 0". Lines without a
+/// single direction are tuned for each one. Without the solver list, every tunable
+/// convolution solver gets its own job and the non-tunable ones share one job per
+/// problem. Several "work" commands may serve the same queue.
+
+#include <miopen/any_solver.hpp>
+#include <miopen/db_merge.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/process.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/stringutils.hpp>
+#include <miopen/tuning_queue.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace fs = miopen::fs;
+
+std::vector<std::string> GetDefaultSolvers()
+{
+    auto solvers     = std::vector<std::string>{};
+    auto non_tunable = std::string{};
+
+    const auto& ids = miopen::solver::GetSolversByPrimitive(miopen::solver::Primitive::Convolution);
+    for(const auto& id : ids)
+    {
+        const auto solver = id.GetSolver();
+        if(solver.IsEmpty())
+            continue;
+        if(solver.IsTunable())
+        {
+            solvers.push_back(id.ToString());
+            continue;
+        }
+        if(!non_tunable.empty())
+            non_tunable += ';';
+        non_tunable += id.ToString();
+    }
+
+    if(!non_tunable.empty())
+        solvers.push_back(non_tunable);
+    return solvers;
+}
+
+// Splits the command into the ones with a single direction each, so that every shard
+// holds the results of one problem.
+std::vector<std::string> SplitDirections(const std::string& command)
+{
+    auto args      = std::istringstream{command};
+    auto arg       = std::string{};
+    auto direction = std::string{};
+    auto rest      = std::string{};
+
+    while(args >> arg)
+    {
+        if(arg == "-F" || arg == "--forw")
+        {
+            args >> direction;
+            continue;
+        }
+        if(miopen::EndsWith(arg, "MIOpenDriver") && rest.empty())
+            continue;
+        rest += (rest.empty() ? "" : " ") + arg;
+    }
+
+    if(direction == "1" || direction == "2" || direction == "4")
+        return {rest + " -F " + direction};
+    if(!direction.empty() && direction != "0")
+        std::cerr << "Direction " << direction << " is split: " << command << std::endl;
+    return {rest + " -F 1", rest + " -F 2", rest + " -F 4"};
+}
+
+std::string MakeJobName(std::size_t index)
+{
+    auto name = std::ostringstream{};
+    name << std::setw(8) << std::setfill('0') << index;
+    return name.str();
+}
+
+int Push(miopen::TuningQueue& queue, const fs::path& commands_file, const std::string& solver_list)
+{
+    auto commands = std::ifstream{commands_file};
+    if(!commands)
+    {
+        std::cerr << "Unable to open " << commands_file << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto solvers =
+        solver_list.empty() ? GetDefaultSolvers() : miopen::SplitDelim(solver_list, ',');
+
+    // Continue numbering after the jobs already known to the queue.
+    const auto stats = queue.GetStats();
+    auto index       = stats.pending + stats.claimed + stats.done + stats.failed;
+    const auto first = index;
+
+    auto line = std::string{};
+    while(std::getline(commands, line))
+    {
+        const auto start = line.find_first_not_of(" \t");
+        if(start == std::string::npos || line[start] == '#')
+            continue;
+
+        for(const auto& command : SplitDirections(line))
+            for(const auto& solver : solvers)
+                queue.Push({MakeJobName(index++), solver, command});
+    }
+
+    std::cerr << "Pushed " << index - first << " jobs" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+bool RunJob(const miopen::TuningQueue& queue,
+            const fs::path& driver,
+            const miopen::TuningJob& job)
+{
+    const auto shard = queue.GetShardPath(job);
+    fs::create_directories(shard);
+    auto log = std::ofstream{shard / "driver.log"};
+
+    const auto env = miopen::ProcessEnvironmentMap{
+        {"MIOPEN_USER_DB_PATH", shard.string()},
+        {"MIOPEN_DEBUG_FIND_ONLY_SOLVER", job.solvers},
+        {"MIOPEN_FIND_MODE", "NORMAL"},
+        {"MIOPEN_FIND_ENFORCE", "SEARCH_DB_UPDATE"},
+    };
+
+    try
+    {
+        return miopen::Process{driver}(job.command, "", &log, env) == 0;
+    }
+    catch(const std::exception& ex)
+    {
+        log << ex.what() << std::endl;
+        return false;
+    }
+}
+
+int Work(const fs::path& root, const fs::path& driver, unsigned n_workers)
+{
+    const auto requeued = miopen::TuningQueue{root}.RequeueAbandoned();
+    if(requeued > 0)
+        std::cerr << "Requeued " << requeued << " abandoned jobs" << std::endl;
+
+    auto workers = std::vector<std::thread>{};
+    for(auto i = 0u; i < n_workers; ++i)
+    {
+        workers.emplace_back([&]() {
+            auto queue = miopen::TuningQueue{root};
+            while(const auto job = queue.Claim())
+            {
+                const auto success = RunJob(queue, driver, *job);
+                queue.Complete(*job, success);
+                std::cerr << job->name << (success ? " done: " : " failed: ") << job->command
+                          << " (" << job->solvers << ")" << std::endl;
+            }
+        });
+    }
+    for(auto& worker : workers)
+        worker.join();
+
+    return EXIT_SUCCESS;
+}
+
+int Merge(const miopen::TuningQueue& queue, const fs::path& target)
+{
+    const auto stats = miopen::MergeUserDbShards(queue.GetDoneShards(), target);
+    std::cerr << "Merged into " << target << ": " << stats.added << " added, " << stats.replaced
+              << " replaced, " << stats.kept << " kept" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+int Status(const miopen::TuningQueue& queue)
+{
+    const auto stats = queue.GetStats();
+    std::cout << "pending: " << stats.pending << ", claimed: " << stats.claimed
+              << ", done: " << stats.done << ", failed: " << stats.failed << std::endl;
+    return EXIT_SUCCESS;
+}
+
+unsigned GetWorkers(int argc, char* argv[], int index)
+{
+    if(argc <= index)
+        return 1;
+    return std::max(1u, static_cast<unsigned>(std::strtoul(argv[index], nullptr, 10)));
+}
+
+int Usage(const char* name)
+{
+    std::cerr << "Usage:\n"
+              << "  " << name << " <queue> push <commands file> [solver,...]\n"
+              << "  " << name << " <queue> work <MIOpenDriver> [workers]\n"
+              << "  " << name << " <queue> merge [user db path]\n"
+              << "  " << name << " <queue> status\n"
+              << "  " << name << " <queue> run <commands file> <MIOpenDriver> [workers]"
+              << std::endl;
+    return EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
+        return Usage(argv[0]);
+
+    try
+    {
+        auto queue         = miopen::TuningQueue{argv[1]};
+        const auto command = std::string{argv[2]};
+        const auto user_db = miopen::GetUserDbPath();
+
+        if(command == "push" && argc > 3)
+            return Push(queue, argv[3], argc > 4 ? argv[4] : "");
+        if(command == "work" && argc > 3)
+            return Work(queue.GetRoot(), argv[3], GetWorkers(argc, argv, 4));
+        if(command == "merge")
+            return Merge(queue, argc > 3 ? fs::path{argv[3]} : user_db);
+        if(command == "status")
+            return Status(queue);
+        if(command == "run" && argc > 4)
+        {
+            if(Push(queue, argv[3], "") != EXIT_SUCCESS)
+                return EXIT_FAILURE;
+            Work(queue.GetRoot(), argv[4], GetWorkers(argc, argv, 5));
+            Status(queue);
+            return Merge(queue, user_db);
+        }
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return Usage(argv[0]);
+}